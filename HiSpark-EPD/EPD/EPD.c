@@ -14,19 +14,69 @@
 #include "pinctrl.h"
 #include "gpio.h"
 #include "soc_osal.h"
+#include "spi.h"
+#include "tcxo.h"
+#if defined(CONFIG_SPI_SUPPORT_DMA)
+#include "dma.h"
+#endif
 #include "EPD.h"
 
+static uint8_t g_epd_transport_ready = 0;
+static uint8_t g_epd_hw_spi = 0;
+// 连续数据写入的暂存区，DMA 源地址需位于 RAM 且 4 字节对齐
+static uint8_t g_epd_stage[EPD_STAGE_BYTES] __attribute__((aligned(4)));
+static uint32_t g_epd_stage_len = 0;
+// 命令和单个参数字节的发送缓冲区：单字节传输同样走 DMA，不能直接用栈上参数的地址
+static uint8_t g_epd_byte[4] __attribute__((aligned(4)));
+// BUSY 下降沿中断释放的信号量，注册失败时 EPD_READBUSY 退回轮询
+static osal_semaphore g_epd_busy_sem;
+static uint8_t g_epd_busy_irq = 0;
+
+static void EPD_BusyIsr(pin_t pin, uintptr_t param)
+{
+	unused(pin);
+	unused(param);
+	osal_sem_up(&g_epd_busy_sem);
+}
+
+static void EPD_BusyIrqInit(void)
+{
+	if (osal_sem_init(&g_epd_busy_sem, 0) != OSAL_SUCCESS)
+	{
+		osal_printk("EPD busy sem init fail\r\n");
+		return;
+	}
+	if (uapi_gpio_register_isr_func(EPD_BUSY_PIN, GPIO_INTERRUPT_FALLING_EDGE, EPD_BusyIsr) != ERRCODE_SUCC)
+	{
+		osal_printk("EPD busy irq register fail\r\n");
+		osal_sem_destroy(&g_epd_busy_sem);
+		return;
+	}
+	g_epd_busy_irq = 1;
+}
+
+// 等待 BUSY 变低：有中断时睡在信号量上，由下降沿唤醒；信号量里残留的旧信号只会多触发一次电平检查
 void EPD_READBUSY(void)
 {
-	for (uint8_t i = 0; i < 200; i++)
+	uint64_t deadline = uapi_tcxo_get_ms() + EPD_BUSY_TIMEOUT_MS;
+	while (uapi_gpio_get_val(EPD_BUSY_PIN) != GPIO_LEVEL_LOW)
 	{
-		osal_msleep(100);
-		if (uapi_gpio_get_val(13) == GPIO_LEVEL_LOW)
+		uint64_t now = uapi_tcxo_get_ms();
+		if (now >= deadline)
+		{
+			osal_printk("BUSY timeout\r\n");
+			return;
+		}
+		if (g_epd_busy_irq)
 		{
-			osal_printk("BUSY_LOW\r\n");
-			break;
+			(void)osal_sem_down_timeout(&g_epd_busy_sem, (uint32_t)(deadline - now));
+		}
+		else
+		{
+			osal_msleep(EPD_BUSY_POLL_MS);
 		}
 	}
+	osal_printk("BUSY_LOW\r\n");
 }
 
 // 已移植
@@ -39,10 +89,10 @@ void EPD_HW_RESET(void)
 	osal_msleep(10);
 }
 
-void EPD_WriteByte(uint8_t byte)
+// 软件 SPI 移出一个字节，不操作 CS
+static void EPD_ShiftByte(uint8_t byte)
 {
 	uint8_t i;
-	EPD_CS_Clr();
 	for (i = 0; i < 8; i++)
 	{
 		EPD_SCL_Clr();
@@ -57,28 +107,151 @@ void EPD_WriteByte(uint8_t byte)
 		EPD_SCL_Set();
 		byte <<= 1;
 	}
+}
+
+// 在已拉低的 CS 下发送一段数据
+static void EPD_SpiSend(const uint8_t *buf, uint32_t len)
+{
+	if (!g_epd_hw_spi)
+	{
+		for (uint32_t i = 0; i < len; i++)
+		{
+			EPD_ShiftByte(buf[i]);
+		}
+		return;
+	}
+	while (len > 0)
+	{
+		uint32_t n = (len > EPD_SPI_MAX_XFER) ? EPD_SPI_MAX_XFER : len;
+		spi_xfer_data_t data = {0};
+		data.tx_buff = (uint8_t *)buf;
+		data.tx_bytes = n;
+		errcode_t ret = uapi_spi_master_write(EPD_SPI_BUS_ID, &data, 0xFFFFFFFF);
+		if (ret != ERRCODE_SUCC)
+		{
+			osal_printk("EPD spi write failed:0x%x\r\n", ret);
+		}
+		buf += n;
+		len -= n;
+	}
+}
+
+void EPD_TransportInit(void)
+{
+	if (g_epd_transport_ready)
+	{
+		return;
+	}
+	g_epd_transport_ready = 1;
+	EPD_BusyIrqInit();
+	EPD_CS_Set();
+	EPD_DC_Set(); // DC 空闲时保持数据态，只有命令字节期间拉低
+#if EPD_USE_HW_SPI
+	spi_attr_t config = {0};
+	spi_extra_attr_t ext_config = {0};
+
+	config.is_slave = false;
+	config.slave_num = 1;
+	config.bus_clk = 32000000;
+	config.freq_mhz = EPD_SPI_FREQ_MHZ;
+	config.clk_polarity = 0;
+	config.clk_phase = 0;
+	config.frame_format = 0;
+	config.spi_frame_format = HAL_SPI_FRAME_FORMAT_STANDARD;
+	config.frame_size = HAL_SPI_FRAME_SIZE_8;
+	config.tmod = 0;
+	config.sste = 0;
+#if defined(CONFIG_SPI_SUPPORT_DMA)
+	(void)uapi_dma_init();
+	(void)uapi_dma_open();
+	ext_config.tx_use_dma = true;
+#endif
+
+	uapi_pin_set_mode(7, EPD_SPI_PIN_MODE);
+	uapi_pin_set_mode(9, EPD_SPI_PIN_MODE);
+	if (uapi_spi_init(EPD_SPI_BUS_ID, &config, &ext_config) == ERRCODE_SUCC)
+	{
+		g_epd_hw_spi = 1;
+		osal_printk("EPD transport: hw spi\r\n");
+		return;
+	}
+	// 回退到软件 SPI，恢复 GPIO 模式
+	uapi_pin_set_mode(7, 0);
+	uapi_pin_set_mode(9, 0);
+	uapi_gpio_set_dir(7, GPIO_DIRECTION_OUTPUT);
+	uapi_gpio_set_dir(9, GPIO_DIRECTION_OUTPUT);
+#endif
+	osal_printk("EPD transport: gpio spi\r\n");
+}
+
+uint8_t EPD_TransportIsHw(void)
+{
+	return g_epd_hw_spi;
+}
+
+void EPD_WriteByte(uint8_t byte)
+{
+	g_epd_byte[0] = byte;
+	EPD_CS_Clr();
+	EPD_SpiSend(g_epd_byte, 1);
 	EPD_CS_Set();
 }
 
 // Send a byte to the command register
 void EPD_WR_REG(uint8_t byte)
 {
-	uapi_gpio_set_val(10, GPIO_LEVEL_LOW);
+	EPD_DC_Clr();
 	EPD_WriteByte(byte);
-	uapi_gpio_set_val(10, GPIO_LEVEL_HIGH);
+	EPD_DC_Set();
 }
 
+// DC 在命令之外始终为高，这里无需再切换
 void EPD_WR_DATA8(uint8_t byte)
 {
-	uapi_gpio_set_val(10, GPIO_LEVEL_HIGH);
 	EPD_WriteByte(byte);
-	uapi_gpio_set_val(10, GPIO_LEVEL_HIGH);
+}
+
+void EPD_DataBegin(void)
+{
+	g_epd_stage_len = 0;
+	EPD_CS_Clr();
+}
+
+static void EPD_DataFlush(void)
+{
+	if (g_epd_stage_len > 0)
+	{
+		EPD_SpiSend(g_epd_stage, g_epd_stage_len);
+		g_epd_stage_len = 0;
+	}
+}
+
+void EPD_DataPut(uint8_t byte)
+{
+	g_epd_stage[g_epd_stage_len++] = byte;
+	if (g_epd_stage_len == EPD_STAGE_BYTES)
+	{
+		EPD_DataFlush();
+	}
+}
+
+void EPD_DataWrite(const uint8_t *buf, uint32_t len)
+{
+	EPD_DataFlush();
+	EPD_SpiSend(buf, len);
+}
+
+void EPD_DataEnd(void)
+{
+	EPD_DataFlush();
+	EPD_CS_Set();
 }
 
 // 已移植
 //  Initialize the oled screen
 void EPD_Init(void)
 {
+	EPD_TransportInit();
 	EPD_HW_RESET();
 	EPD_READBUSY();
 	EPD_WR_REG(0x12);
@@ -194,177 +367,199 @@ void EPD_Display_Clear(void)
 	EPD_SetRAMMP();
 	EPD_SetRAMMA();
 	EPD_WR_REG(0x24);
+	EPD_DataBegin();
 	for (i = 0; i < Gate_BITS; i++)
 	{
 		for (j = 0; j < Source_BYTES; j++)
 		{
-			EPD_WR_DATA8(0xFF);
+			EPD_DataPut(0xFF);
 		}
 	}
+	EPD_DataEnd();
 	EPD_SetRAMMA();
 	EPD_WR_REG(0x26);
+	EPD_DataBegin();
 	for (i = 0; i < Gate_BITS; i++)
 	{
 		for (j = 0; j < Source_BYTES; j++)
 		{
-			EPD_WR_DATA8(0x00);
+			EPD_DataPut(0x00);
 		}
 	}
+	EPD_DataEnd();
 	EPD_SetRAMSP();
 	EPD_SetRAMSA();
 	EPD_WR_REG(0xA4);
+	EPD_DataBegin();
 	for (i = 0; i < Gate_BITS; i++)
 	{
 		for (j = 0; j < Source_BYTES; j++)
 		{
-			EPD_WR_DATA8(0xFF);
+			EPD_DataPut(0xFF);
 		}
 	}
+	EPD_DataEnd();
 	EPD_SetRAMSA();
 	EPD_WR_REG(0xA6);
+	EPD_DataBegin();
 	for (i = 0; i < Gate_BITS; i++)
 	{
 		for (j = 0; j < Source_BYTES; j++)
 		{
-			EPD_WR_DATA8(0x00);
+			EPD_DataPut(0x00);
 		}
 	}
+	EPD_DataEnd();
 }
 
-void EPD_Display_BW(const uint8_t *ImageBW)
+// 画布一行的字节数（主、从两半各 Source_BYTES）
+#define EPD_LINE_BYTES (Source_BYTES * 2)
+// 每次转置的列数，Source_BYTES 需能被其整除
+#define EPD_STRIP_COLS 10
+
+// 转置条带缓冲区：EPD_STRIP_COLS 列 x Gate_BITS 行，按列优先存放，整块交给传输层
+static uint8_t g_epd_strip[EPD_STRIP_COLS * Gate_BITS] __attribute__((aligned(4)));
+
+// 控制器按“列优先、每列 nlines 行”的顺序接收数据，而画布是行优先。
+// 每次按行顺序读出至多 EPD_STRIP_COLS 个相邻字节，转置进条带后整块发送；lines 指向窗口第一行
+static void EPD_UploadWindow(const uint8_t *lines, uint32_t col0, uint32_t ncols, uint32_t nlines)
 {
-	uint32_t i;
-	uint8_t tempOriginal;
-	uint32_t tempcol = 0;
-	uint32_t templine = 0;
-	EPD_SetRAMMP();
-	EPD_SetRAMMA();
-	EPD_WR_REG(0x24);
-	for (i = 0; i < ALLSCREEN_BYTES; i++)
-	{
-		tempOriginal = *(ImageBW + templine * Source_BYTES * 2 + tempcol);
-		templine++;
-		if (templine >= Gate_BITS)
-		{
-			tempcol++;
-			templine = 0;
-		}
-		EPD_WR_DATA8(tempOriginal);
-	}
-	EPD_SetRAMSP();
-	EPD_SetRAMSA();
-	EPD_WR_REG(0xa4); // write RAM for black(0)/white (1)
-	for (i = 0; i < ALLSCREEN_BYTES; i++)
+	for (uint32_t col = col0; col < col0 + ncols; col += EPD_STRIP_COLS)
 	{
-		tempOriginal = *(ImageBW + templine * Source_BYTES * 2 + tempcol);
-		templine++;
-		if (templine >= Gate_BITS)
+		uint32_t cols = col0 + ncols - col;
+		cols = (cols > EPD_STRIP_COLS) ? EPD_STRIP_COLS : cols;
+		const uint8_t *src = lines + col;
+		for (uint32_t line = 0; line < nlines; line++)
 		{
-			tempcol++;
-			templine = 0;
+			for (uint32_t k = 0; k < cols; k++)
+			{
+				g_epd_strip[k * nlines + line] = src[k];
+			}
+			src += EPD_LINE_BYTES;
 		}
-		EPD_WR_DATA8(tempOriginal);
+		EPD_DataWrite(g_epd_strip, cols * nlines);
 	}
 }
 
-void EPD_Display_R(const uint8_t *ImageR)
+static void EPD_UploadHalf(const uint8_t *image, uint32_t col_start)
+{
+	EPD_UploadWindow(image, col_start, Source_BYTES, Gate_BITS);
+}
+
+// 上传一个颜色平面：左半写主控 RAM，右半写从控 RAM
+static void EPD_UploadPlane(const uint8_t *image, uint8_t master_cmd, uint8_t slave_cmd)
 {
-	uint32_t i;
-	uint8_t tempOriginal;
-	uint32_t tempcol = 0;
-	uint32_t templine = 0;
 	EPD_SetRAMMP();
 	EPD_SetRAMMA();
-	EPD_WR_REG(0x26);
-	for (i = 0; i < ALLSCREEN_BYTES; i++)
-	{
-		tempOriginal = *(ImageR + templine * Source_BYTES * 2 + tempcol);
-		templine++;
-		if (templine >= Gate_BITS)
-		{
-			tempcol++;
-			templine = 0;
-		}
-		EPD_WR_DATA8(tempOriginal);
-	}
+	EPD_WR_REG(master_cmd);
+	EPD_DataBegin();
+	EPD_UploadHalf(image, 0);
+	EPD_DataEnd();
 	EPD_SetRAMSP();
 	EPD_SetRAMSA();
-	EPD_WR_REG(0xA6);
-	for (i = 0; i < ALLSCREEN_BYTES; i++)
-	{
-		tempOriginal = *(ImageR + templine * Source_BYTES * 2 + tempcol);
-		templine++;
-		if (templine >= Gate_BITS)
-		{
-			tempcol++;
-			templine = 0;
-		}
-		EPD_WR_DATA8(tempOriginal);
-	}
+	EPD_WR_REG(slave_cmd);
+	EPD_DataBegin();
+	EPD_UploadHalf(image, Source_BYTES);
+	EPD_DataEnd();
+}
+
+void EPD_Display_BW(const uint8_t *ImageBW)
+{
+	EPD_UploadPlane(ImageBW, 0x24, 0xa4); // write RAM for black(0)/white (1)
+}
+
+void EPD_Display_R(const uint8_t *ImageR)
+{
+	EPD_UploadPlane(ImageR, 0x26, 0xA6);
 }
 
 void EPD_Display(const uint8_t *ImageBW, const uint8_t *ImageR)
 {
-	uint32_t i;
-	uint8_t tempOriginal;
-	uint32_t tempcol = 0;
-	uint32_t templine = 0;
-	EPD_SetRAMMP();
-	EPD_SetRAMMA();
-	EPD_WR_REG(0x24);
-	for (i = 0; i < ALLSCREEN_BYTES; i++)
-	{
-		tempOriginal = *(ImageBW + templine * Source_BYTES * 2 + tempcol);
-		templine++;
-		if (templine >= Gate_BITS)
-		{
-			tempcol++;
-			templine = 0;
-		}
-		EPD_WR_DATA8(tempOriginal);
-	}
-	EPD_SetRAMSP();
-	EPD_SetRAMSA();
-	EPD_WR_REG(0xa4); // write RAM for black(0)/white (1)
-	for (i = 0; i < ALLSCREEN_BYTES; i++)
+	EPD_Display_BW(ImageBW);
+	EPD_Display_R(ImageR);
+}
+
+// 主控 RAM 窗口：X 为字节列（递增），Y 为门线（从 ys 递减到 ye）
+static void EPD_SetRAMMWindow(uint8_t xs, uint8_t xe, uint16_t ys, uint16_t ye)
+{
+	EPD_WR_REG(0x11);
+	EPD_WR_DATA8(0x05);
+	EPD_WR_REG(0x44);
+	EPD_WR_DATA8(xs);
+	EPD_WR_DATA8(xe);
+	EPD_WR_REG(0x45);
+	EPD_WR_DATA8(ys & 0xFF);
+	EPD_WR_DATA8(ys >> 8);
+	EPD_WR_DATA8(ye & 0xFF);
+	EPD_WR_DATA8(ye >> 8);
+	EPD_WR_REG(0x4e);
+	EPD_WR_DATA8(xs);
+	EPD_WR_REG(0x4f);
+	EPD_WR_DATA8(ys & 0xFF);
+	EPD_WR_DATA8(ys >> 8);
+}
+
+// 从控 RAM 窗口：X 方向与主控相反（从 xs 递减到 xe）
+static void EPD_SetRAMSWindow(uint8_t xs, uint8_t xe, uint16_t ys, uint16_t ye)
+{
+	EPD_WR_REG(0x91);
+	EPD_WR_DATA8(0x04);
+	EPD_WR_REG(0xc4);
+	EPD_WR_DATA8(xs);
+	EPD_WR_DATA8(xe);
+	EPD_WR_REG(0xc5);
+	EPD_WR_DATA8(ys & 0xFF);
+	EPD_WR_DATA8(ys >> 8);
+	EPD_WR_DATA8(ye & 0xFF);
+	EPD_WR_DATA8(ye >> 8);
+	EPD_WR_REG(0xce);
+	EPD_WR_DATA8(xs);
+	EPD_WR_REG(0xcf);
+	EPD_WR_DATA8(ys & 0xFF);
+	EPD_WR_DATA8(ys >> 8);
+}
+
+void EPD_Display_Window(const uint8_t *lines, uint8_t plane, uint16_t xs, uint16_t ys, uint16_t xe, uint16_t ye)
+{
+	uint8_t master_cmd = (plane == EPD_PLANE_R) ? 0x26 : 0x24;
+	uint8_t slave_cmd = (plane == EPD_PLANE_R) ? 0xa6 : 0xa4;
+	uint32_t c0 = xs / 8;
+	uint32_t c1 = xe / 8;
+	c1 = (c1 < EPD_LINE_BYTES) ? c1 : (EPD_LINE_BYTES - 1);
+	ye = (ye < Gate_BITS) ? ye : (Gate_BITS - 1);
+	if (c0 > c1 || ys > ye)
 	{
-		tempOriginal = *(ImageBW + templine * Source_BYTES * 2 + tempcol);
-		templine++;
-		if (templine >= Gate_BITS)
-		{
-			tempcol++;
-			templine = 0;
-		}
-		EPD_WR_DATA8(tempOriginal);
+		return;
 	}
-	tempcol = 0;
-	templine = 0;
-	EPD_SetRAMMP();
-	EPD_SetRAMMA();
-	EPD_WR_REG(0x26);
-	for (i = 0; i < ALLSCREEN_BYTES; i++)
+	uint32_t nlines = ye - ys + 1;
+
+	if (c0 < Source_BYTES)
 	{
-		tempOriginal = *(ImageR + templine * Source_BYTES * 2 + tempcol);
-		templine++;
-		if (templine >= Gate_BITS)
-		{
-			tempcol++;
-			templine = 0;
-		}
-		EPD_WR_DATA8(tempOriginal);
+		uint32_t m1 = (c1 < Source_BYTES) ? c1 : (Source_BYTES - 1);
+		EPD_SetRAMMWindow(c0, m1, Gate_BITS - 1 - ys, Gate_BITS - 1 - ye);
+		EPD_WR_REG(master_cmd);
+		EPD_DataBegin();
+		EPD_UploadWindow(lines, c0, m1 - c0 + 1, nlines);
+		EPD_DataEnd();
 	}
-	EPD_SetRAMSP();
-	EPD_SetRAMSA();
-	EPD_WR_REG(0xA6);
-	for (i = 0; i < ALLSCREEN_BYTES; i++)
+	if (c1 >= Source_BYTES)
 	{
-		tempOriginal = *(ImageR + templine * Source_BYTES * 2 + tempcol);
-		templine++;
-		if (templine >= Gate_BITS)
-		{
-			tempcol++;
-			templine = 0;
-		}
-		EPD_WR_DATA8(tempOriginal);
+		uint32_t s0 = (c0 > Source_BYTES) ? c0 : Source_BYTES;
+		EPD_SetRAMSWindow(0x31 - (s0 - Source_BYTES), 0x31 - (c1 - Source_BYTES), Gate_BITS - 1 - ys,
+						  Gate_BITS - 1 - ye);
+		EPD_WR_REG(slave_cmd);
+		EPD_DataBegin();
+		EPD_UploadWindow(lines, s0, c1 - s0 + 1, nlines);
+		EPD_DataEnd();
 	}
 }
+
+void EPD_Update_Part(void)
+{
+	EPD_WR_REG(0x22);
+	EPD_WR_DATA8(EPD_PART_UPDATE_CTRL);
+	osal_msleep(10);
+	EPD_WR_REG(0x20);
+	osal_printk("Update part...\r\n");
+	EPD_READBUSY();
+}
@@ -4,7 +4,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#define EPD_ReadBusy uapi_gpio_get_val(13)
+#define EPD_BUSY_PIN 13
+#define EPD_ReadBusy uapi_gpio_get_val(EPD_BUSY_PIN)
 #define EPD_RES_Clr() uapi_gpio_set_val(14, GPIO_LEVEL_LOW)
 #define EPD_RES_Set() uapi_gpio_set_val(14, GPIO_LEVEL_HIGH)
 
@@ -32,6 +33,33 @@
 #define Gate_BITS 272
 #define ALLSCREEN_BYTES Source_BYTES *Gate_BITS
 
+// 传输层：优先使用硬件 SPI0（CLK=7, DO=9，DMA 可用时走 DMA），CS 仍由 GPIO8 控制以便整段 RAM 写入期间保持拉低；
+// 硬件 SPI 初始化失败或 EPD_USE_HW_SPI 为 0 时退回 GPIO 软件 SPI
+#ifndef EPD_USE_HW_SPI
+#define EPD_USE_HW_SPI 1
+#endif
+#define EPD_SPI_BUS_ID 0
+#define EPD_SPI_PIN_MODE 3
+#define EPD_SPI_FREQ_MHZ 10
+#define EPD_SPI_MAX_XFER 2048 // 单次 uapi_spi_master_write 的最大字节数
+#define EPD_STAGE_BYTES 512	  // EPD_DataPut 的暂存缓冲区大小
+
+// BUSY 等待：优先用 GPIO13 下降沿中断唤醒，中断不可用时按 EPD_BUSY_POLL_MS 轮询
+#define EPD_BUSY_TIMEOUT_MS 20000
+#define EPD_BUSY_POLL_MS 5
+
+// 局部刷新：0x22 选 Display Mode 2，控制器以 0x24 为新画面、0x26 为屏上的旧画面逐点比较，并需面板 OTP 提供该波形。
+// 本板是黑白红三色屏，0x26 存放红色平面，局刷会把红色数据当作旧画面，因此默认关闭，全部走全刷。
+// 仅在换用黑白屏时置 1：此时不再写红色平面，0x26 始终保存屏上的黑白画面
+#ifndef EPD_PARTIAL_ENABLE
+#define EPD_PARTIAL_ENABLE 0
+#endif
+#define EPD_PART_UPDATE_CTRL 0xFF
+
+// EPD_Display_Window 的颜色平面
+#define EPD_PLANE_BW 0
+#define EPD_PLANE_R 1
+
 // Procedure definitions
 void EPD_READBUSY(void);
 void EPD_HW_RESET(void);
@@ -45,15 +73,24 @@ void EPD_Display_Clear(void);                                    // 清屏
 void EPD_Display(const uint8_t *ImageBW, const uint8_t *ImageR); // 全部加载
 void EPD_Display_BW(const uint8_t *ImageBW);                     // 只加载黑白部分
 void EPD_Display_R(const uint8_t *ImageR);                       // 只加载红色部分
+void EPD_Display_Window(const uint8_t *lines, uint8_t plane, uint16_t xs, uint16_t ys, uint16_t xe, uint16_t ye); // 写一个平面的窗口，lines 指向第 ys 行（行宽 100 字节），可以是条带缓冲区
 
 void EPD_Update(void);       // load lut和update一起进行
 void EPD_Load_LUT_BWR(void); // 只进行load lut
 void EPD_Load_LUT_BW(void);  // 芯片手册有，但似乎这块屏幕不能进行只刷新黑白
 void EPD_Update_BWR(void);   // 只进行update
 void EPD_Update_BW(void);    // 实验失败，应该不支持
+void EPD_Update_Part(void);  // 局部刷新，配合 EPD_Display_Window 使用
 
 void EPD_WR_DATA8(uint8_t byte);
 void EPD_WR_REG(uint8_t byte);
 void EPD_WriteByte(uint8_t byte);
 
+void EPD_TransportInit(void);							// 选择硬件 SPI 或软件 SPI，EPD_Init 中自动调用
+uint8_t EPD_TransportIsHw(void);						// 当前是否使用硬件 SPI
+void EPD_DataBegin(void);								// 拉低 CS 开始一段连续数据写入（DC 保持数据态）
+void EPD_DataPut(uint8_t byte);							// 追加一个字节，暂存区满时整块发出
+void EPD_DataWrite(const uint8_t *buf, uint32_t len); // 追加一段位于 RAM 且 4 字节对齐的数据，直接整块发出（DMA 源地址）
+void EPD_DataEnd(void);									// 发出剩余数据并释放 CS
+
 #endif
\ No newline at end of file
@@ -1,4 +1,5 @@
-#include "EPD_font.h"
+#include <string.h>
+#include "EPD_atlas.h"
 #include "EPD_GUI.h"
 
 PAINT Paint;
@@ -21,6 +22,7 @@ void Paint_NewImage(uint8_t *image, uint16_t Width, uint16_t Height, uint16_t Ro
 	Paint.heightMemory = Height;
 	Paint.widthByte = (Width % 8 == 0) ? (Width / 8) : (Width / 8 + 1);
 	Paint.heightByte = Height;
+	Paint.lineOffset = 0;
 	Paint.rotate = Rotate;
 	if (Rotate == 0 || Rotate == 180)
 	{
@@ -42,6 +44,16 @@ void Paint_NewImage(uint8_t *image, uint16_t Width, uint16_t Height, uint16_t Ro
 void Paint_SelectImage(uint8_t *Image)
 {
 	Paint.Image = Image;
+	Paint.lineOffset = 0;
+	Paint.heightByte = Paint.heightMemory;
+}
+
+// 选择条带画布：Image 只存放内存第 line0 行起的 nlines 行，落在条带外的像素直接丢弃
+void Paint_SelectBand(uint8_t *Image, uint16_t line0, uint16_t nlines)
+{
+	Paint.Image = Image;
+	Paint.lineOffset = line0;
+	Paint.heightByte = nlines;
 }
 
 /*******************************************************************
@@ -51,30 +63,12 @@ void Paint_SelectImage(uint8_t *Image)
 *******************************************************************/
 void Paint_Clear(uint8_t Color)
 {
-	uint16_t X, Y;
-	uint32_t Addr;
-	for (Y = 0; Y < Paint.heightByte; Y++)
-	{
-		for (X = 0; X < Paint.widthByte; X++)
-		{
-			Addr = X + Y * Paint.widthByte; // 8 pixel =  1 byte
-			Paint.Image[Addr] = Color;
-		}
-	}
+	memset(Paint.Image, Color, (size_t)Paint.widthByte * Paint.heightByte); // 8 pixel =  1 byte
 }
 
-/*******************************************************************
-		º¯ÊýËµÃ÷£ºµãÁÁÒ»¸öÏñËØµã
-		½Ó¿ÚËµÃ÷£ºXpoint ÏñËØµãx×ø±ê²ÎÊý
-			  Ypoint ÏñËØµãY×ø±ê²ÎÊý
-			  Color  ÏñËØµãÑÕÉ«²ÎÊý
-		·µ»ØÖµ£º  ÎÞ
-*******************************************************************/
-void Paint_SetPixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color)
+// 逻辑坐标转内存坐标，含 rotate 0 时 396 列之后 8 像素间隙的修正；旋转角度非法时返回 0
+static uint8_t Paint_MapPoint(uint16_t Xpoint, uint16_t Ypoint, uint16_t *X, uint16_t *Y)
 {
-	uint16_t X, Y;
-	uint32_t Addr;
-	uint8_t Rdata;
 	switch (Paint.rotate)
 	{
 	case 0:
@@ -82,24 +76,24 @@ void Paint_SetPixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color)
 		{
 			Xpoint += 8;
 		}
-		X = Xpoint;
-		Y = Ypoint;
+		*X = Xpoint;
+		*Y = Ypoint;
 		break;
 	case 90:
 		if (Ypoint >= 396)
 		{
 			Ypoint += 8;
 		}
-		X = Paint.widthMemory - Ypoint - 1;
-		Y = Xpoint;
+		*X = Paint.widthMemory - Ypoint - 1;
+		*Y = Xpoint;
 		break;
 	case 180:
 		if (Xpoint >= 396)
 		{
 			Xpoint += 8;
 		}
-		X = Paint.widthMemory - Xpoint - 1;
-		Y = Paint.heightMemory - Ypoint - 1;
+		*X = Paint.widthMemory - Xpoint - 1;
+		*Y = Paint.heightMemory - Ypoint - 1;
 		break;
 
 	case 270:
@@ -107,13 +101,32 @@ void Paint_SetPixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color)
 		{
 			Ypoint += 8;
 		}
-		X = Ypoint;
-		Y = Paint.heightMemory - Xpoint - 1;
+		*X = Ypoint;
+		*Y = Paint.heightMemory - Xpoint - 1;
 		break;
 	default:
+		return 0;
+	}
+	return 1;
+}
+
+/*******************************************************************
+		º¯ÊýËµÃ÷£ºµãÁÁÒ»¸öÏñËØµã
+		½Ó¿ÚËµÃ÷£ºXpoint ÏñËØµãx×ø±ê²ÎÊý
+			  Ypoint ÏñËØµãY×ø±ê²ÎÊý
+			  Color  ÏñËØµãÑÕÉ«²ÎÊý
+		·µ»ØÖµ£º  ÎÞ
+*******************************************************************/
+void Paint_SetPixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color)
+{
+	uint16_t X, Y;
+	uint32_t Addr;
+	uint8_t Rdata;
+	if (!Paint_MapPoint(Xpoint, Ypoint, &X, &Y) || Y < Paint.lineOffset || Y - Paint.lineOffset >= Paint.heightByte)
+	{
 		return;
 	}
-	Addr = X / 8 + Y * Paint.widthByte;
+	Addr = X / 8 + (Y - Paint.lineOffset) * Paint.widthByte;
 	Rdata = Paint.Image[Addr];
 	if (Color == BLACK)
 	{
@@ -125,6 +138,127 @@ void Paint_SetPixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color)
 	}
 }
 
+// Paint_BlitBits 的合并方式：整段覆盖（可取反），或只改 src 中为 1 的像素（透明背景）
+#define PAINT_BLIT_COPY 0
+#define PAINT_BLIT_INVERT 1
+#define PAINT_BLIT_SET 2
+#define PAINT_BLIT_CLEAR 3
+
+// 把 src 中从第 srcBit 位起的 n 个像素（高位在前）按 op 合并到内存第 Y 行第 X 位起，按字节处理；超出行宽的部分丢弃
+static void Paint_BlitBits(const uint8_t *src, uint32_t srcBit, uint16_t X, uint16_t Y, uint16_t n, uint8_t op)
+{
+	uint16_t widthBits = Paint.widthByte * 8;
+	if (Y < Paint.lineOffset || Y - Paint.lineOffset >= Paint.heightByte || X >= widthBits)
+	{
+		return;
+	}
+	n = (n < widthBits - X) ? n : (widthBits - X);
+	uint8_t *line = &Paint.Image[(uint32_t)(Y - Paint.lineOffset) * Paint.widthByte];
+	while (n > 0)
+	{
+		uint8_t s = X % 8;
+		uint8_t c = (n < 8 - s) ? n : (8 - s);
+		const uint8_t *p = &src[srcBit / 8];
+		uint8_t o = srcBit % 8;
+		uint16_t win = (uint16_t)p[0] << 8;
+		if (o + c > 8)
+		{
+			win |= p[1];
+		}
+		uint8_t val = (uint8_t)((uint16_t)(win << o) >> 8);
+		val = (op == PAINT_BLIT_INVERT) ? (uint8_t)~val : val;
+		uint8_t mask = (uint8_t)(0xFF << (8 - c)) >> s;
+		uint8_t bits = (val >> s) & mask;
+		if (op == PAINT_BLIT_SET)
+		{
+			line[X / 8] |= bits;
+		}
+		else if (op == PAINT_BLIT_CLEAR)
+		{
+			line[X / 8] &= ~bits;
+		}
+		else
+		{
+			line[X / 8] = (line[X / 8] & ~mask) | bits;
+		}
+		X += c;
+		srcBit += c;
+		n -= c;
+	}
+}
+
+// rotate 0 时写一行：396 列之前内存坐标不变，之后右移 8 像素
+static void Paint_BlitRow(const uint8_t *src, uint32_t srcBit, uint16_t Xpoint, uint16_t Y, uint16_t n, uint8_t op)
+{
+	if (Xpoint < 396)
+	{
+		uint16_t left = (Xpoint + n <= 396) ? n : (396 - Xpoint);
+		Paint_BlitBits(src, srcBit, Xpoint, Y, left, op);
+		Xpoint += left;
+		srcBit += left;
+		n -= left;
+	}
+	if (n > 0)
+	{
+		Paint_BlitBits(src, srcBit, Xpoint + 8, Y, n, op);
+	}
+}
+
+// 逻辑坐标矩形对应的内存坐标外接矩形（含端点），用于计算局部刷新窗口
+void Paint_MapRect(uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint16_t *xs, uint16_t *ys, uint16_t *xe,
+				   uint16_t *ye)
+{
+	uint16_t X0, Y0, X1, Y1;
+	Paint_MapPoint(x, y, &X0, &Y0);
+	Paint_MapPoint(x + sizex - 1, y + sizey - 1, &X1, &Y1);
+	*xs = (X0 < X1) ? X0 : X1;
+	*xe = (X0 < X1) ? X1 : X0;
+	*ys = (Y0 < Y1) ? Y0 : Y1;
+	*ye = (Y0 < Y1) ? Y1 : Y0;
+}
+
+// 按显示列表把内存第 line0 行起的 nlines 行渲染进条带 band：先用 fill 铺底，再依次绘制与条带相交的元素
+void Paint_RenderBand(const PAINT_ITEM *items, uint16_t count, uint8_t *band, uint16_t line0, uint16_t nlines,
+					  uint8_t fill)
+{
+	uint16_t i, top, bottom;
+	Paint_SelectBand(band, line0, nlines);
+	Paint_Clear(fill);
+	for (i = 0; i < count; i++)
+	{
+		const PAINT_ITEM *it = &items[i];
+		top = it->y;
+		bottom = it->y + it->size;
+		if (it->type == PAINT_ITEM_WATCH)
+		{
+			top = (it->y > 6) ? (it->y - 6) : 0; // 冒号比数字高 6 行
+		}
+		else if (it->type == PAINT_ITEM_PICTURE)
+		{
+			bottom = it->y + it->sizey;
+		}
+		// 只有 rotate 0 时逻辑 y 才等于内存行，其他方向全部绘制，靠逐点裁剪
+		if (Paint.rotate == 0 && (bottom <= line0 || top >= line0 + nlines))
+		{
+			continue;
+		}
+		switch (it->type)
+		{
+		case PAINT_ITEM_PICTURE:
+			EPD_ShowPicture(it->x, it->y, it->sizex, it->sizey, it->pic, it->color);
+			break;
+		case PAINT_ITEM_STRING:
+			EPD_ShowString(it->x, it->y, (uint8_t *)it->text, it->size, it->color);
+			break;
+		case PAINT_ITEM_WATCH:
+			EPD_ShowWatch(it->x, it->y, it->num, it->len, it->pre, it->size, it->color);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
 /*******************************************************************
 		º¯ÊýËµÃ÷£º»®Ïßº¯Êý
 		½Ó¿ÚËµÃ÷£ºXstart ÏñËØxÆðÊ¼×ø±ê²ÎÊý
@@ -262,6 +396,121 @@ void EPD_DrawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius, uint1
 	}
 }
 
+// 字库索引的哈希函数，必须与 tools/gen_epd_atlas.py 中的 atlas_hash 一致
+static uint32_t EPD_AtlasHash(uint32_t key, uint32_t seed)
+{
+	uint32_t h = key ^ seed;
+	h ^= h >> 16;
+	h *= 0x7FEB352DU;
+	h ^= h >> 15;
+	h *= 0x846CA68BU;
+	h ^= h >> 16;
+	return h;
+}
+
+// 按字号和 Unicode 码点查字形：两次哈希定位到唯一槽位，再比对键值，不存在时返回 NULL
+static const EPD_GLYPH *EPD_AtlasFind(uint16_t size, uint32_t code)
+{
+	uint32_t key = ((uint32_t)size << 24) | code;
+	uint32_t seed = epd_atlas_seed[EPD_AtlasHash(key, 0) % EPD_ATLAS_BUCKETS];
+	const EPD_GLYPH *g = &epd_atlas_glyph[EPD_AtlasHash(key, seed) % EPD_ATLAS_SLOTS];
+	return (g->key == key) ? g : NULL;
+}
+
+// 画一个字形：rotate 0 时逐行按字节合并，其余方向逐点绘制；opaque 为 0 时背景像素保持不变
+static void EPD_DrawGlyph(uint16_t x, uint16_t y, const EPD_GLYPH *g, uint16_t color)
+{
+	const uint8_t *bits = &epd_atlas_bits[g->offset];
+	uint16_t stride = (g->w + 7) / 8;
+	uint16_t i, j;
+	if (Paint.rotate == 0)
+	{
+		uint8_t op;
+		if (g->opaque)
+		{
+			op = (color == BLACK) ? PAINT_BLIT_INVERT : PAINT_BLIT_COPY;
+		}
+		else
+		{
+			op = (color == BLACK) ? PAINT_BLIT_CLEAR : PAINT_BLIT_SET;
+		}
+		for (j = 0; j < g->h; j++)
+		{
+			Paint_BlitRow(&bits[j * stride], 0, x, y + j, g->w, op);
+		}
+		return;
+	}
+	for (j = 0; j < g->h; j++)
+	{
+		for (i = 0; i < g->w; i++)
+		{
+			if (bits[j * stride + i / 8] & (0x80 >> (i % 8)))
+			{
+				Paint_SetPixel(x + i, y + j, color);
+			}
+			else if (g->opaque)
+			{
+				Paint_SetPixel(x + i, y + j, !color);
+			}
+		}
+	}
+}
+
+// 解析一个 UTF-8 字符，返回其字节数；非法序列（含过长编码、代理区和超出 U+10FFFF 的码点）按单字节处理
+static uint8_t EPD_DecodeUtf8(const uint8_t *s, uint32_t *code)
+{
+	uint32_t c;
+	if (s[0] < 0x80)
+	{
+		*code = s[0];
+		return 1;
+	}
+	if ((s[0] & 0xE0) == 0xC0 && (s[1] & 0xC0) == 0x80)
+	{
+		c = ((uint32_t)(s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+		if (c >= 0x80)
+		{
+			*code = c;
+			return 2;
+		}
+	}
+	else if ((s[0] & 0xF0) == 0xE0 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80)
+	{
+		c = ((uint32_t)(s[0] & 0x0F) << 12) | ((uint32_t)(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+		if (c >= 0x800 && (c < 0xD800 || c > 0xDFFF))
+		{
+			*code = c;
+			return 3;
+		}
+	}
+	else if ((s[0] & 0xF8) == 0xF0 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80 && (s[3] & 0xC0) == 0x80)
+	{
+		c = ((uint32_t)(s[0] & 0x07) << 18) | ((uint32_t)(s[1] & 0x3F) << 12) | ((uint32_t)(s[2] & 0x3F) << 6) |
+			(s[3] & 0x3F);
+		if (c >= 0x10000 && c <= 0x10FFFF)
+		{
+			*code = c;
+			return 4;
+		}
+	}
+	*code = s[0];
+	return 1;
+}
+
+// 显示 s 开头的一个字符，*len 返回其字节数，函数返回占用的宽度；字库中没有的字符不绘制，按 sizey 留空
+static uint16_t EPD_ShowGlyph(uint16_t x, uint16_t y, const uint8_t *s, uint8_t *len, uint8_t sizey, uint16_t color)
+{
+	uint32_t code;
+	*len = EPD_DecodeUtf8(s, &code);
+	const EPD_GLYPH *g = EPD_AtlasFind(sizey, code);
+	if (g == NULL)
+	{
+		return sizey;
+	}
+	EPD_DrawGlyph(x, y, g, color);
+	return g->w;
+}
+
 /******************************************************************************
 	  º¯ÊýËµÃ÷£ºÏÔÊ¾ºº×Ö´®
 	  Èë¿ÚÊý¾Ý£ºx,yÏÔÊ¾×ø±ê
@@ -272,20 +521,11 @@ void EPD_DrawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius, uint1
 ******************************************************************************/
 void EPD_ShowChinese(uint16_t x, uint16_t y, uint8_t *s, uint8_t sizey, uint16_t color)
 {
+	uint8_t len;
 	while (*s != 0)
 	{
-		if (sizey == 12)
-			EPD_ShowChinese12x12(x, y, s, sizey, color);
-		else if (sizey == 16)
-			EPD_ShowChinese16x16(x, y, s, sizey, color);
-		else if (sizey == 24)
-			EPD_ShowChinese24x24(x, y, s, sizey, color);
-		else if (sizey == 32)
-			EPD_ShowChinese32x32(x, y, s, sizey, color);
-		else
-			return;
-		s += 2;
-		x += sizey;
+		x += EPD_ShowGlyph(x, y, s, &len, sizey, color);
+		s += len;
 	}
 }
 
@@ -299,35 +539,8 @@ void EPD_ShowChinese(uint16_t x, uint16_t y, uint8_t *s, uint8_t sizey, uint16_t
 ******************************************************************************/
 void EPD_ShowChinese12x12(uint16_t x, uint16_t y, uint8_t *s, uint8_t sizey, uint16_t color)
 {
-	uint8_t i, j;
-	uint16_t k;
-	uint16_t HZnum;		  // ºº×ÖÊýÄ¿
-	uint16_t TypefaceNum; // Ò»¸ö×Ö·ûËùÕ¼×Ö½Ú´óÐ¡
-	uint16_t x0 = x;
-	TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
-	HZnum = sizeof(tfont12) / sizeof(typFNT_GB12); // Í³¼Æºº×ÖÊýÄ¿
-	for (k = 0; k < HZnum; k++)
-	{
-		if ((tfont12[k].Index[0] == *(s)) && (tfont12[k].Index[1] == *(s + 1)))
-		{
-			for (i = 0; i < TypefaceNum; i++)
-			{
-				for (j = 0; j < 8; j++)
-				{
-					if (tfont12[k].Msk[i] & (0x01 << j))
-						Paint_SetPixel(x, y, color); // »­Ò»¸öµã
-					x++;
-					if ((x - x0) == sizey)
-					{
-						x = x0;
-						y++;
-						break;
-					}
-				}
-			}
-		}
-		continue; // ²éÕÒµ½¶ÔÓ¦µãÕó×Ö¿âÁ¢¼´ÍË³ö£¬·ÀÖ¹¶à¸öºº×ÖÖØ¸´È¡Ä£´øÀ´Ó°Ïì
-	}
+	uint8_t len;
+	EPD_ShowGlyph(x, y, s, &len, sizey, color);
 }
 
 /******************************************************************************
@@ -340,35 +553,8 @@ void EPD_ShowChinese12x12(uint16_t x, uint16_t y, uint8_t *s, uint8_t sizey, uin
 ******************************************************************************/
 void EPD_ShowChinese16x16(uint16_t x, uint16_t y, uint8_t *s, uint8_t sizey, uint16_t color)
 {
-	uint8_t i, j;
-	uint16_t k;
-	uint16_t HZnum;		  // ºº×ÖÊýÄ¿
-	uint16_t TypefaceNum; // Ò»¸ö×Ö·ûËùÕ¼×Ö½Ú´óÐ¡
-	uint16_t x0 = x;
-	TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
-	HZnum = sizeof(tfont16) / sizeof(typFNT_GB16); // Í³¼Æºº×ÖÊýÄ¿
-	for (k = 0; k < HZnum; k++)
-	{
-		if ((tfont16[k].Index[0] == *(s)) && (tfont16[k].Index[1] == *(s + 1)))
-		{
-			for (i = 0; i < TypefaceNum; i++)
-			{
-				for (j = 0; j < 8; j++)
-				{
-					if (tfont16[k].Msk[i] & (0x01 << j))
-						Paint_SetPixel(x, y, color); // »­Ò»¸öµã
-					x++;
-					if ((x - x0) == sizey)
-					{
-						x = x0;
-						y++;
-						break;
-					}
-				}
-			}
-		}
-		continue; // ²éÕÒµ½¶ÔÓ¦µãÕó×Ö¿âÁ¢¼´ÍË³ö£¬·ÀÖ¹¶à¸öºº×ÖÖØ¸´È¡Ä£´øÀ´Ó°Ïì
-	}
+	uint8_t len;
+	EPD_ShowGlyph(x, y, s, &len, sizey, color);
 }
 
 /******************************************************************************
@@ -381,35 +567,8 @@ void EPD_ShowChinese16x16(uint16_t x, uint16_t y, uint8_t *s, uint8_t sizey, uin
 ******************************************************************************/
 void EPD_ShowChinese24x24(uint16_t x, uint16_t y, uint8_t *s, uint8_t sizey, uint16_t color)
 {
-	uint8_t i, j;
-	uint16_t k;
-	uint16_t HZnum;		  // ºº×ÖÊýÄ¿
-	uint16_t TypefaceNum; // Ò»¸ö×Ö·ûËùÕ¼×Ö½Ú´óÐ¡
-	uint16_t x0 = x;
-	TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
-	HZnum = sizeof(tfont24) / sizeof(typFNT_GB24); // Í³¼Æºº×ÖÊýÄ¿
-	for (k = 0; k < HZnum; k++)
-	{
-		if ((tfont24[k].Index[0] == *(s)) && (tfont24[k].Index[1] == *(s + 1)))
-		{
-			for (i = 0; i < TypefaceNum; i++)
-			{
-				for (j = 0; j < 8; j++)
-				{
-					if (tfont24[k].Msk[i] & (0x01 << j))
-						Paint_SetPixel(x, y, color); // »­Ò»¸öµã
-					x++;
-					if ((x - x0) == sizey)
-					{
-						x = x0;
-						y++;
-						break;
-					}
-				}
-			}
-		}
-		continue; // ²éÕÒµ½¶ÔÓ¦µãÕó×Ö¿âÁ¢¼´ÍË³ö£¬·ÀÖ¹¶à¸öºº×ÖÖØ¸´È¡Ä£´øÀ´Ó°Ïì
-	}
+	uint8_t len;
+	EPD_ShowGlyph(x, y, s, &len, sizey, color);
 }
 
 /******************************************************************************
@@ -422,35 +581,8 @@ void EPD_ShowChinese24x24(uint16_t x, uint16_t y, uint8_t *s, uint8_t sizey, uin
 ******************************************************************************/
 void EPD_ShowChinese32x32(uint16_t x, uint16_t y, uint8_t *s, uint8_t sizey, uint16_t color)
 {
-	uint8_t i, j;
-	uint16_t k;
-	uint16_t HZnum;		  // ºº×ÖÊýÄ¿
-	uint16_t TypefaceNum; // Ò»¸ö×Ö·ûËùÕ¼×Ö½Ú´óÐ¡
-	uint16_t x0 = x;
-	TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
-	HZnum = sizeof(tfont32) / sizeof(typFNT_GB32); // Í³¼Æºº×ÖÊýÄ¿
-	for (k = 0; k < HZnum; k++)
-	{
-		if ((tfont32[k].Index[0] == *(s)) && (tfont32[k].Index[1] == *(s + 1)))
-		{
-			for (i = 0; i < TypefaceNum; i++)
-			{
-				for (j = 0; j < 8; j++)
-				{
-					if (tfont32[k].Msk[i] & (0x01 << j))
-						Paint_SetPixel(x, y, color); // »­Ò»¸öµã
-					x++;
-					if ((x - x0) == sizey)
-					{
-						x = x0;
-						y++;
-						break;
-					}
-				}
-			}
-		}
-		continue; // ²éÕÒµ½¶ÔÓ¦µãÕó×Ö¿âÁ¢¼´ÍË³ö£¬·ÀÖ¹¶à¸öºº×ÖÖØ¸´È¡Ä£´øÀ´Ó°Ïì
-	}
+	uint8_t len;
+	EPD_ShowGlyph(x, y, s, &len, sizey, color);
 }
 
 /*******************************************************************
@@ -464,54 +596,10 @@ void EPD_ShowChinese32x32(uint16_t x, uint16_t y, uint8_t *s, uint8_t sizey, uin
 *******************************************************************/
 void EPD_ShowChar(uint16_t x, uint16_t y, uint16_t chr, uint16_t size1, uint16_t color)
 {
-	uint16_t i, m, temp, size2, chr1;
-	uint16_t x0, y0;
-	x0 = x, y0 = y;
-	if (size1 == 8)
-		size2 = 6;
-	else
-		size2 = (size1 / 8 + ((size1 % 8) ? 1 : 0)) * (size1 / 2); // µÃµ½×ÖÌåÒ»¸ö×Ö·û¶ÔÓ¦µãÕó¼¯ËùÕ¼µÄ×Ö½ÚÊý
-	chr1 = chr - ' ';											   // ¼ÆËãÆ«ÒÆºóµÄÖµ
-	for (i = 0; i < size2; i++)
+	const EPD_GLYPH *g = EPD_AtlasFind(size1, chr);
+	if (g != NULL)
 	{
-		if (size1 == 8)
-		{
-			temp = asc2_0806[chr1][i];
-		} // µ÷ÓÃ0806×ÖÌå
-		else if (size1 == 12)
-		{
-			temp = asc2_1206[chr1][i];
-		} // µ÷ÓÃ1206×ÖÌå
-		else if (size1 == 16)
-		{
-			temp = asc2_1608[chr1][i];
-		} // µ÷ÓÃ1608×ÖÌå
-		else if (size1 == 24)
-		{
-			temp = asc2_2412[chr1][i];
-		} // µ÷ÓÃ2412×ÖÌå
-		else if (size1 == 48)
-		{
-			temp = asc2_4824[chr1][i];
-		} // µ÷ÓÃ2412×ÖÌå
-		else
-			return;
-		for (m = 0; m < 8; m++)
-		{
-			if (temp & 0x01)
-				Paint_SetPixel(x, y, color);
-			else
-				Paint_SetPixel(x, y, !color);
-			temp >>= 1;
-			y++;
-		}
-		x++;
-		if ((size1 != 8) && ((x - x0) == size1 / 2))
-		{
-			x = x0;
-			y0 = y0 + 8;
-		}
-		y = y0;
+		EPD_DrawGlyph(x, y, g, color);
 	}
 }
 
@@ -632,6 +720,18 @@ void EPD_ShowPicture(uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, con
 {
 	uint16_t j = 0, t;
 	uint16_t i, temp, x0, TypefaceNum = sizey * (sizex / 8 + ((sizex % 8) ? 1 : 0));
+	if (Paint.rotate == 0 && sizex % 8 == 0)
+	{
+		// 整行按字节合并写入，不再逐点调用 Paint_SetPixel；只遍历落在当前画布行范围内的行
+		uint16_t i0 = (Paint.lineOffset > y) ? (Paint.lineOffset - y) : 0;
+		uint16_t i1 = (Paint.lineOffset + Paint.heightByte > y) ? (Paint.lineOffset + Paint.heightByte - y) : 0;
+		i1 = (i1 < sizey) ? i1 : sizey;
+		for (i = i0; i < i1; i++)
+		{
+			Paint_BlitRow(BMP, (uint32_t)i * sizex, x, y + i, sizex, (Color != BLACK) ? PAINT_BLIT_INVERT : PAINT_BLIT_COPY);
+		}
+		return;
+	}
 	x0 = x;
 	for (i = 0; i < TypefaceNum; i++)
 	{
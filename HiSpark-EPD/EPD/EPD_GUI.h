@@ -14,16 +14,43 @@ typedef struct
 	uint16_t rotate;
 	uint16_t widthByte;
 	uint16_t heightByte;
+	uint16_t lineOffset; // Image 中第 0 行对应的内存行，整幅画布为 0，条带画布为条带起始行
 
 } PAINT;
 extern PAINT Paint;
 
 #define Rotation 0
 
+// 显示列表元素：条带渲染时按列表重绘整个场景
+#define PAINT_ITEM_PICTURE 0 // EPD_ShowPicture(x, y, sizex, sizey, pic, color)
+#define PAINT_ITEM_STRING 1	 // EPD_ShowString(x, y, text, size, color)
+#define PAINT_ITEM_WATCH 2	 // EPD_ShowWatch(x, y, num, len, pre, size, color)
+
+typedef struct
+{
+	uint8_t type;
+	uint8_t color;
+	uint16_t x;
+	uint16_t y;
+	uint16_t sizex;
+	uint16_t sizey;
+	uint16_t size;
+	uint8_t len;
+	uint8_t pre;
+	float num;
+	const uint8_t *pic;
+	const char *text;
+} PAINT_ITEM;
+
 void Paint_NewImage(uint8_t *image, uint16_t Width, uint16_t Height, uint16_t Rotate, uint16_t Color);
 void Paint_SetPixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color);
 void Paint_Clear(uint8_t Color);
 void Paint_SelectImage(uint8_t *Image);
+void Paint_SelectBand(uint8_t *Image, uint16_t line0, uint16_t nlines);
+void Paint_MapRect(uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint16_t *xs, uint16_t *ys, uint16_t *xe,
+				   uint16_t *ye);
+void Paint_RenderBand(const PAINT_ITEM *items, uint16_t count, uint8_t *band, uint16_t line0, uint16_t nlines,
+					  uint8_t fill);
 void EPD_DrawLine(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t Color);
 void EPD_DrawRectangle(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t Color, uint8_t mode);
 void EPD_DrawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius, uint16_t Color, uint8_t mode);
@@ -15,19 +15,38 @@
 #include "sle_connection_manager.h"
 #include "cJSON.h"
 #include "watchdog.h"
+#include "tcxo.h"
 // private
 #include "sle_uart_server.h"
 #include "EPD.h"
 #include "EPD_GUI.h"
+#include "EPD_Sched.h"
 #include "pic.h"
 
 // WatchDog相关参数
 #define TIME_OUT 2
 #define WDT_MODE 1
 
-#define EPD_TASK_STACK_SIZE 0x8000
+#define EPD_TASK_STACK_SIZE 0x2000
+#define EPD_UPDATE_TASK_STACK_SIZE 0x2000
 #define EPD_TASK_PRIO (osPriority_t)(17)
 
+// 连续局刷这么多次后强制全刷一次，清除残影
+#define EPD_FULL_REFRESH_EVERY 10
+// 时钟：EPD_ShowWatch(CLOCK_X, CLOCK_Y, time, 4, 2, 48)，冒号比数字高 6 行
+#define CLOCK_X 270
+#define CLOCK_Y 20
+#define CLOCK_W 120
+#define CLOCK_H 54
+// 天气图标统一为64宽度，50高度
+#define WEATHER_X 450
+#define WEATHER_Y 20
+#define WEATHER_W 64
+#define WEATHER_H 50
+#define EPD_HEARTBEAT_MS 1000 // 喂狗与 LED 心跳周期，也是等待事件的最长时间
+// 条带高度（行），272 行分 17 条渲染
+#define EPD_BAND_LINES 16
+
 // 占位数据
 uint16_t sg90_angles[4] = {0};
 uint8_t led_mode = 0;
@@ -42,13 +61,32 @@ double air = 0.0;
 uint8_t weather = 0; // 用于判断当前天气显示
 uint8_t caution = 0; // 用于判断当前警告信息显示
 double time = 12.58; // AI发来的时间信息
-// 转发用数组
-uint8_t ImageBW[27200];
-uint8_t ImageR[27200];
+// 条带缓冲区：两个颜色平面轮流按条带渲染后直接写入面板 RAM，不再保存整帧
+static uint8_t band_buf[EPD_BAND_LINES * EPD_W / 8];
+// 显示列表：黑白平面为背景、时钟、天气，红色平面为传感器数值、警告
+static PAINT_ITEM scene_bw[3];
+static uint16_t scene_bw_count = 0;
+static PAINT_ITEM scene_r[5];
+static uint16_t scene_r_count = 0;
 char temperature_string[30] = "";
 char humidity_string[30] = "";
 char light_string[30] = "";
 char air_string[30] = "";
+char *const sensor_strings[4] = {temperature_string, humidity_string, light_string, air_string};
+
+// 屏幕上当前显示的内容，用于判断哪些区域需要重绘
+static uint8_t shown_valid = 0;
+static uint16_t shown_time = 0;
+static uint8_t shown_weather = 0;
+static uint8_t shown_caution = 0;
+static char shown_strings[4][30];
+static uint32_t shown_hash = 0;
+static uint8_t partial_count = 0;
+
+// 星闪回调通知刷新任务有新数据
+static osal_event g_scene_event;
+
+static epd_sched_t g_sched;
 
 static errcode_t watchdog_callback(uintptr_t param)
 {
@@ -74,6 +112,7 @@ static void sle_server_write_cbk(uint8_t server_id, uint16_t conn_id, ssaps_req_
     if (data != NULL)
     {
         uapi_watchdog_kick();
+        uint32_t evt = 0;
         cJSON *message_array = cJSON_Parse((char *)data->value);
         if (message_array == NULL)
         {
@@ -118,6 +157,10 @@ static void sle_server_write_cbk(uint8_t server_id, uint16_t conn_id, ssaps_req_
                     else if (strcmp(topic->valuestring, "CautionReport") == 0)
                     {
                         value = cJSON_GetObjectItem(item, "caution");
+                        if (caution != (uint8_t)value->valueint)
+                        {
+                            evt |= EPD_SCENE_EVT_ALERT;
+                        }
                         caution = value->valueint;
                     }
                     else if (strcmp(topic->valuestring, "TimeReport") == 0)
@@ -125,6 +168,7 @@ static void sle_server_write_cbk(uint8_t server_id, uint16_t conn_id, ssaps_req_
                         value = cJSON_GetObjectItem(item, "time");
                         time = value->valuedouble;
                     }
+                    evt |= EPD_SCENE_EVT_DATA;
                     uapi_watchdog_kick();
                     cJSON_free(topic);
                     cJSON_free(value);
@@ -137,6 +181,10 @@ static void sle_server_write_cbk(uint8_t server_id, uint16_t conn_id, ssaps_req_
         osal_printk("%s\r\n", data->value);
         cJSON_free(message_array);
         // cJSON_Delete(message_array);
+        if (evt != 0)
+        {
+            (void)osal_event_write(&g_scene_event, evt);
+        }
     }
     uapi_watchdog_kick();
 }
@@ -179,68 +227,227 @@ void init_gpio(void)
     osal_msleep(100);
 }
 
-void draw_main_scene(void)
+static const uint8_t *weather_picture(void)
 {
-    // 显示文字的y坐标好像不能太小，原因未知
-    // y坐标向下递增，x坐标向右递增
-    uapi_watchdog_kick();
-    Paint_SelectImage(ImageBW);
-    Paint_Clear(WHITE);
-    EPD_ShowPicture(0, 0, 800, 272, UI_pic, BLACK);       // 显示背景图片
-    EPD_ShowWatch(270, 20, (float)time, 4, 2, 48, BLACK); // 显示当前时间
-    // 显示天气
-    if (weather == 0)
+    switch (weather)
     {
-        // 统一为64宽度，50高度，坐标450，20
-        EPD_ShowPicture(450, 20, 64, 50, gImage_weather_cloudy, BLACK);
+    case 0:
+        return gImage_weather_cloudy;
+    case 1:
+        return gImage_weather_snowy;
+    case 2:
+        return gImage_weather_rainy;
+    case 3:
+        return gImage_weather_sunny;
+    case 4:
+        return gImage_weather_overcast;
+    case 5:
+        return gImage_weather_thunder;
+    default:
+        return NULL;
     }
-    else if (weather == 1)
+}
+
+static void format_sensor_strings(void)
+{
+    snprintf(temperature_string, 30, "%.1lf", temperature);
+    snprintf(humidity_string, 30, "%.1lf", humidity);
+    snprintf(light_string, 30, "%d", light);
+    snprintf(air_string, 30, "%.1lf", air);
+}
+
+static void scene_add_picture(PAINT_ITEM *list, uint16_t *count, uint16_t x, uint16_t y, uint16_t sizex,
+                              uint16_t sizey, const uint8_t *pic, uint8_t color)
+{
+    list[(*count)++] = (PAINT_ITEM){
+        .type = PAINT_ITEM_PICTURE, .color = color, .x = x, .y = y, .sizex = sizex, .sizey = sizey, .pic = pic};
+}
+
+static void scene_add_string(PAINT_ITEM *list, uint16_t *count, uint16_t x, uint16_t y, const char *text,
+                             uint16_t size, uint8_t color)
+{
+    list[(*count)++] =
+        (PAINT_ITEM){.type = PAINT_ITEM_STRING, .color = color, .x = x, .y = y, .size = size, .text = text};
+}
+
+// 根据当前数据生成显示列表
+static void build_scene(void)
+{
+    // 显示文字的y坐标好像不能太小，原因未知
+    // y坐标向下递增，x坐标向右递增
+    const uint8_t *weather_pic = weather_picture();
+
+    scene_bw_count = 0;
+    scene_add_picture(scene_bw, &scene_bw_count, 0, 0, 800, 272, UI_pic, BLACK); // 显示背景图片
+    scene_bw[scene_bw_count++] = (PAINT_ITEM){.type = PAINT_ITEM_WATCH,
+                                              .color = BLACK,
+                                              .x = CLOCK_X,
+                                              .y = CLOCK_Y,
+                                              .size = 48,
+                                              .len = 4,
+                                              .pre = 2,
+                                              .num = (float)time}; // 显示当前时间
+    if (weather_pic != NULL)
     {
-        EPD_ShowPicture(450, 20, 64, 50, gImage_weather_snowy, BLACK);
+        // 显示天气
+        scene_add_picture(scene_bw, &scene_bw_count, WEATHER_X, WEATHER_Y, WEATHER_W, WEATHER_H, weather_pic, BLACK);
     }
-    else if (weather == 2)
+
+    format_sensor_strings();
+    scene_r_count = 0;
+    scene_add_string(scene_r, &scene_r_count, 125, 105, temperature_string, 48, WHITE);
+    scene_add_string(scene_r, &scene_r_count, 125, 205, humidity_string, 48, WHITE);
+    scene_add_string(scene_r, &scene_r_count, 410, 205, light_string, 48, WHITE);
+    scene_add_string(scene_r, &scene_r_count, 615, 205, air_string, 48, WHITE);
+    // 显示警告信息
+    if (caution == 0)
     {
-        EPD_ShowPicture(450, 20, 64, 50, gImage_weather_rainy, BLACK);
+        // 统一为280宽度，85高度，坐标400，85
+        scene_add_picture(scene_r, &scene_r_count, 410, 85, 280, 85, gImage_warning_common, WHITE);
     }
-    else if (weather == 3)
+}
+
+// 按条带渲染一个平面的 [ys, ye] 行，每条渲染完立即写入面板 RAM 的 [xs, xe] 列（内存坐标，含端点）
+static void render_plane(const PAINT_ITEM *items, uint16_t count, uint8_t plane, uint8_t fill, uint16_t xs,
+                         uint16_t ys, uint16_t xe, uint16_t ye)
+{
+    for (uint16_t line = ys; line <= ye; line += EPD_BAND_LINES)
     {
-        EPD_ShowPicture(450, 20, 64, 50, gImage_weather_sunny, BLACK);
+        uint16_t n = (ye - line + 1 < EPD_BAND_LINES) ? (ye - line + 1) : EPD_BAND_LINES;
+        Paint_RenderBand(items, count, band_buf, line, n, fill);
+        EPD_Display_Window(band_buf, plane, xs, line, xe, line + n - 1);
     }
-    else if (weather == 4)
+}
+
+void draw_main_scene(void)
+{
+    uapi_watchdog_kick();
+    build_scene();
+    render_plane(scene_bw, scene_bw_count, EPD_PLANE_BW, WHITE, 0, 0, EPD_W - 1, EPD_H - 1);
+    uapi_watchdog_kick();
+#if EPD_PARTIAL_ENABLE
+    // 黑白屏：0x26 写入同一画面，作为下一次局刷的旧画面
+    render_plane(scene_bw, scene_bw_count, EPD_PLANE_R, WHITE, 0, 0, EPD_W - 1, EPD_H - 1);
+#else
+    render_plane(scene_r, scene_r_count, EPD_PLANE_R, BLACK, 0, 0, EPD_W - 1, EPD_H - 1);
+#endif
+}
+
+// 把逻辑坐标矩形并入内存坐标窗口
+static void merge_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *xs, uint16_t *ys, uint16_t *xe,
+                         uint16_t *ye)
+{
+    uint16_t rxs, rys, rxe, rye;
+    Paint_MapRect(x, y, w, h, &rxs, &rys, &rxe, &rye);
+    *xs = (rxs < *xs) ? rxs : *xs;
+    *ys = (rys < *ys) ? rys : *ys;
+    *xe = (rxe > *xe) ? rxe : *xe;
+    *ye = (rye > *ye) ? rye : *ye;
+}
+
+// 记录屏幕上已显示的内容
+static void remember_scene(uint16_t now_time)
+{
+    shown_valid = 1;
+    shown_time = now_time;
+    shown_weather = weather;
+    shown_caution = caution;
+    for (uint8_t i = 0; i < 4; i++)
     {
-        EPD_ShowPicture(450, 20, 64, 50, gImage_weather_overcast, BLACK);
+        strcpy(shown_strings[i], sensor_strings[i]);
     }
-    else if (weather == 5)
+}
+
+// 显示列表的 FNV-1a 哈希，只取影响像素的字段，哈希不变则画面不变
+static uint32_t scene_hash_items(uint32_t h, const PAINT_ITEM *items, uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++)
     {
-        EPD_ShowPicture(450, 20, 64, 50, gImage_weather_thunder, BLACK);
+        const PAINT_ITEM *it = &items[i];
+        uint32_t words[6] = {it->type | (it->color << 8) | ((uint32_t)it->size << 16), it->x | ((uint32_t)it->y << 16),
+                             it->sizex | ((uint32_t)it->sizey << 16), (uint32_t)(uintptr_t)it->pic, 0, 0};
+        if (it->type == PAINT_ITEM_WATCH)
+        {
+            // 与 EPD_ShowWatch 一样按保留 pre 位小数取整
+            uint32_t scale = 1;
+            for (uint8_t k = 0; k < it->pre; k++)
+            {
+                scale *= 10;
+            }
+            words[4] = (uint16_t)(it->num * scale);
+            words[5] = it->len | ((uint32_t)it->pre << 8);
+        }
+        const uint8_t *p = (const uint8_t *)words;
+        for (uint32_t k = 0; k < sizeof(words); k++)
+        {
+            h = (h ^ p[k]) * 16777619u;
+        }
+        for (const char *c = it->text; c != NULL && *c != '\0'; c++)
+        {
+            h = (h ^ (uint8_t)*c) * 16777619u;
+        }
     }
+    return h;
+}
 
-    Paint_SelectImage(ImageR);
-    Paint_Clear(BLACK);
-
-    strcpy(temperature_string, "");
-    strcpy(humidity_string, "");
-    strcpy(light_string, "");
-    strcpy(air_string, "");
+static uint32_t scene_hash(void)
+{
+    uint32_t h = scene_hash_items(2166136261u, scene_bw, scene_bw_count);
+    return scene_hash_items(h, scene_r, scene_r_count);
+}
 
-    snprintf(temperature_string, 30, "%.1lf", temperature);
-    snprintf(humidity_string, 30, "%.1lf", humidity);
-    snprintf(light_string, 30, "%d", light);
-    snprintf(air_string, 30, "%.1lf", air);
+// 刷新屏幕：画面哈希不变时跳过；红色内容（传感器数值、警告）变化或局刷次数到上限时全刷，
+// 只有时钟、天气等黑白控件变化时只重绘并局刷它们所在的窗口。返回是否刷新了面板
+static uint8_t refresh_scene(void)
+{
+    uint16_t now_time = (uint16_t)((float)time * 100); // 与 EPD_ShowWatch 保留两位小数的取整一致
+    uint8_t red_changed = !shown_valid || caution != shown_caution;
 
-    EPD_ShowString(125, 105, (uint8_t *)temperature_string, 48, WHITE);
-    EPD_ShowString(125, 205, (uint8_t *)humidity_string, 48, WHITE);
-    EPD_ShowString(410, 205, (uint8_t *)light_string, 48, WHITE);
-    EPD_ShowString(615, 205, (uint8_t *)air_string, 48, WHITE);
+    build_scene();
+    uint32_t hash = scene_hash();
+    if (shown_valid && hash == shown_hash)
+    {
+        return 0;
+    }
+    shown_hash = hash;
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        red_changed |= (strcmp(shown_strings[i], sensor_strings[i]) != 0);
+    }
 
-    // 显示警告信息
-    if (caution == 0)
+    if (!EPD_PARTIAL_ENABLE || red_changed || partial_count >= EPD_FULL_REFRESH_EVERY)
     {
-        // 统一为280宽度，85高度，坐标400，85
-        EPD_ShowPicture(410, 85, 280, 85, gImage_warning_common, WHITE);
+        draw_main_scene();
+        uapi_watchdog_kick();
+        EPD_Update();
+        partial_count = 0;
+        remember_scene(now_time);
+        return 1;
     }
 
-    EPD_Display(ImageBW, ImageR);
+    uint16_t xs = EPD_W, ys = EPD_H, xe = 0, ye = 0;
+    if (now_time != shown_time)
+    {
+        merge_window(CLOCK_X, CLOCK_Y - 6, CLOCK_W, CLOCK_H, &xs, &ys, &xe, &ye);
+    }
+    if (weather != shown_weather)
+    {
+        merge_window(WEATHER_X, WEATHER_Y, WEATHER_W, WEATHER_H, &xs, &ys, &xe, &ye);
+    }
+    if (xs > xe)
+    {
+        remember_scene(now_time);
+        return 0;
+    }
+    osal_printk("Partial refresh x:%d-%d y:%d-%d\r\n", xs, xe, ys, ye);
+    uapi_watchdog_kick();
+    render_plane(scene_bw, scene_bw_count, EPD_PLANE_BW, WHITE, xs, ys, xe, ye);
+    EPD_Update_Part();
+    // 刷新完成后把新画面同步到 0x26，下一次局刷以它为旧画面
+    render_plane(scene_bw, scene_bw_count, EPD_PLANE_R, WHITE, xs, ys, xe, ye);
+    partial_count++;
+    remember_scene(now_time);
+    return 1;
 }
 
 void *EPD_Update_Task(const char *arg)
@@ -251,19 +458,37 @@ void *EPD_Update_Task(const char *arg)
     uapi_watchdog_kick();
     EPD_Init();
 
+    refresh_scene();
+    epd_sched_init(&g_sched, uapi_tcxo_get_ms());
+    uint64_t last_beat = g_sched.last_refresh;
+
     while (1)
     {
-        draw_main_scene();
-        uapi_watchdog_kick();
-        EPD_Update();
+        uint64_t now = uapi_tcxo_get_ms();
+        uint32_t wait = epd_sched_wait_ms(&g_sched, now);
+        if (wait == 0)
+        {
+            epd_sched_take(&g_sched);
+            if (refresh_scene())
+            {
+                epd_sched_refreshed(&g_sched, uapi_tcxo_get_ms());
+            }
+            continue;
+        }
 
-        for (uint8_t i = 0; i < 41; i++) // 其他工作的执行时间大概18.6s
+        // 最长等一个心跳周期，期间新数据或警告到达会提前唤醒
+        wait = (wait < EPD_HEARTBEAT_MS) ? wait : EPD_HEARTBEAT_MS;
+        int ret = osal_event_read(&g_scene_event, EPD_SCENE_EVT_DATA | EPD_SCENE_EVT_ALERT, wait,
+                                  OSAL_WAITMODE_OR | OSAL_WAITMODE_CLR);
+        now = uapi_tcxo_get_ms();
+        epd_sched_on_event(&g_sched, (ret == OSAL_FAILURE) ? 0 : (uint32_t)ret, now);
+
+        uapi_watchdog_kick();
+        if (now - last_beat >= EPD_HEARTBEAT_MS)
         {
-            osal_msleep(1000);
             uapi_gpio_toggle(2);
-            uapi_watchdog_kick();
+            last_beat = now;
         }
-        osal_msleep(400); // 三分钟刷新一次，测试时1分钟一次
     }
 }
 
@@ -281,17 +506,23 @@ static void *EPD_task(const char *arg)
     (void)uapi_watchdog_enable((wdt_mode_t)WDT_MODE);
     (void)uapi_register_watchdog_callback(watchdog_callback);
 
+    // 刷新事件需在星闪回调可能触发之前就绪
+    if (osal_event_init(&g_scene_event) != OSAL_SUCCESS)
+    {
+        osal_printk("scene event init fail\r\n");
+        return NULL;
+    }
+
     // 初始化星闪
     sle_uart_server_init(sle_server_read_cbk, sle_server_write_cbk);
 
     // 初始化引脚
     init_gpio();
 
-    // 创建画布，其中BW是黑白，R是红色
-    Paint_NewImage(ImageBW, EPD_W, EPD_H, 0, WHITE);
-    Paint_Clear(WHITE);
-    Paint_NewImage(ImageR, EPD_W, EPD_H, 0, WHITE);
-    Paint_Clear(WHITE);
+    // 创建画布，BW（黑白）与 R（红色）两个平面共用同一个条带缓冲区，按条带渲染；
+    // 画布尺寸仍为整屏（旋转换算需要），但缓冲区只有一条带高，立即选中第一条带
+    Paint_NewImage(band_buf, EPD_W, EPD_H, 0, WHITE);
+    Paint_SelectBand(band_buf, 0, EPD_BAND_LINES);
     uapi_watchdog_kick();
 
     osThreadAttr_t EPD_Update_task = {
@@ -300,7 +531,7 @@ static void *EPD_task(const char *arg)
         .cb_mem = NULL,
         .cb_size = 0U,
         .stack_mem = NULL,
-        .stack_size = 0x8000,
+        .stack_size = EPD_UPDATE_TASK_STACK_SIZE,
         .priority = 20};
     if (osThreadNew((osThreadFunc_t)EPD_Update_Task, NULL, &EPD_Update_task) == NULL)
     {
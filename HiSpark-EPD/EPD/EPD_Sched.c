@@ -0,0 +1,53 @@
+#include "EPD_Sched.h"
+
+void epd_sched_init(epd_sched_t *s, uint64_t now_ms)
+{
+    s->pending = 0;
+    s->urgent = 0;
+    s->first_change = now_ms;
+    s->last_refresh = now_ms;
+}
+
+void epd_sched_on_event(epd_sched_t *s, uint32_t evt, uint64_t now_ms)
+{
+    if (evt == 0)
+    {
+        return;
+    }
+    if (!s->pending)
+    {
+        s->pending = 1;
+        s->first_change = now_ms;
+    }
+    if (evt & EPD_SCENE_EVT_ALERT)
+    {
+        s->urgent = 1;
+    }
+}
+
+uint32_t epd_sched_wait_ms(const epd_sched_t *s, uint64_t now_ms)
+{
+    if (!s->pending)
+    {
+        return UINT32_MAX;
+    }
+    if (s->urgent)
+    {
+        return 0;
+    }
+    uint64_t due = s->first_change + EPD_SETTLE_MS;
+    uint64_t allowed = s->last_refresh + EPD_MIN_REFRESH_INTERVAL_MS;
+    due = (allowed > due) ? allowed : due;
+    return (due > now_ms) ? (uint32_t)(due - now_ms) : 0;
+}
+
+void epd_sched_take(epd_sched_t *s)
+{
+    s->pending = 0;
+    s->urgent = 0;
+}
+
+void epd_sched_refreshed(epd_sched_t *s, uint64_t now_ms)
+{
+    s->last_refresh = now_ms;
+}
@@ -0,0 +1,32 @@
+#ifndef _EPD_SCHED_H_
+#define _EPD_SCHED_H_
+#include <stdint.h>
+
+// 刷新调度：数据变化后再等 EPD_SETTLE_MS 合并后续变化，两次刷新至少间隔 EPD_MIN_REFRESH_INTERVAL_MS，
+// 警告变化不受这两个限制，立即刷新
+#define EPD_SETTLE_MS 2000
+#define EPD_MIN_REFRESH_INTERVAL_MS 60000
+// 星闪回调写给刷新任务的事件位
+#define EPD_SCENE_EVT_DATA 0x1
+#define EPD_SCENE_EVT_ALERT 0x2
+
+typedef struct
+{
+    uint8_t pending;       // 有尚未显示的数据变化
+    uint8_t urgent;        // 其中包含警告变化
+    uint64_t first_change; // 第一个未显示变化到达的时间
+    uint64_t last_refresh; // 上次刷新完成的时间
+} epd_sched_t;
+
+// 清空待显示的变化，并以 now_ms 作为上次刷新的时间
+void epd_sched_init(epd_sched_t *s, uint64_t now_ms);
+// 记录新到达的事件位，evt 为 0 时不做任何事
+void epd_sched_on_event(epd_sched_t *s, uint32_t evt, uint64_t now_ms);
+// 返回还需等待的毫秒数，0 表示现在刷新，UINT32_MAX 表示没有待显示的变化
+uint32_t epd_sched_wait_ms(const epd_sched_t *s, uint64_t now_ms);
+// 开始刷新：此前的变化都将被显示，之后到达的事件重新计时
+void epd_sched_take(epd_sched_t *s);
+// 面板实际刷新完成，最小间隔从 now_ms 起算
+void epd_sched_refreshed(epd_sched_t *s, uint64_t now_ms);
+
+#endif
@@ -20,7 +20,6 @@
 #define UUID_INDEX              14
 #define BT_INDEX_4              4
 #define BT_INDEX_0              0
-#define UART_BUFF_LENGTH        0x100
 
 /* 广播ID */
 #define SLE_ADV_HANDLE_DEFAULT  1
@@ -284,14 +283,14 @@ errcode_t sle_uart_server_send_report_by_uuid(const uint8_t *data, uint8_t len)
 errcode_t sle_uart_server_send_report_by_handle(const uint8_t *data, uint16_t len)
 {
     ssaps_ntf_ind_t param = {0};
-    uint8_t receive_buf[UART_BUFF_LENGTH] = { 0 }; /* max receive length. */
+    if (data == NULL || len == 0 || len > SLE_UART_SERVER_NTF_MAX_SIZE) {
+        return ERRCODE_SLE_FAIL;
+    }
+    /* 协议栈在 ssaps_notify_indicate 内部拷贝数据，无需再经过栈上缓冲区中转 */
     param.handle = g_property_handle;
     param.type = SSAP_PROPERTY_TYPE_VALUE;
-    param.value = receive_buf;
+    param.value = (uint8_t *)data;
     param.value_len = len;
-    if (memcpy_s(param.value, param.value_len, data, len) != EOK) {
-        return ERRCODE_SLE_FAIL;
-    }
     return ssaps_notify_indicate(g_server_id, g_sle_conn_hdl, &param);
 }
 
@@ -28,6 +28,8 @@ extern "C" {
 #define SLE_UART_SERVER_QUEUE_DELAY 0xFFFFFFFF
 #define SLE_UART_SERVER_BUFF_MAX_SIZE 800
 #define SLE_UART_SERVER_LOG "[sle uart server]"
+/* 单条 notify 的最大长度，不超过连接时协商的 MTU */
+#define SLE_UART_SERVER_NTF_MAX_SIZE 256
 
 /* Service UUID */
 #define SLE_UUID_SERVER_SERVICE        0x2000
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""
+把 EPD/EPD_font.h 中的 ASCII 字库（asc2_0806/1206/1608/2412/4824，按列、低位在上）和
+汉字字库（tfont12/16/24/32，按行、低位在左）统一转成画布原生格式，生成 EPD/EPD_atlas.h，
+供 EPD_ShowChar / EPD_ShowChinese 按字节写入画布。
+
+用法: python3 tools/gen_epd_atlas.py
+
+每个字形按行存放，每行 ceil(w/8) 个字节，高位在左，与画布和 EPD_ShowPicture 的位序一致。
+索引为两级完美哈希：键 (字号 << 24) | Unicode 码点，先按 EPD_AtlasHash(key, 0) 分桶，
+再用桶的种子 EPD_AtlasHash(key, seed) 落到唯一的槽位，槽位里存字形偏移与尺寸。
+"""
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC = os.path.join(HERE, "..", "EPD", "EPD_font.h")
+OUT_FILE = os.path.join(HERE, "..", "EPD", "EPD_atlas.h")
+
+FIRST_CHAR = 32
+ASCII_FONTS = [("asc2_0806", 8), ("asc2_1206", 12), ("asc2_1608", 16), ("asc2_2412", 24), ("asc2_4824", 48)]
+CHINESE_FONTS = [("tfont12", 12), ("tfont16", 16), ("tfont24", 24), ("tfont32", 32)]
+MASK32 = 0xFFFFFFFF
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def hex_bytes(body):
+    return [int(v, 16) for v in re.findall(r"0[xX]([0-9a-fA-F]{1,2})\b", body)]
+
+
+def table_body(text, name):
+    m = re.search(r"\b%s\s*\[[^=]*=\s*\{(.*?)\n\s*\};" % name, text, re.S)
+    if m is None:
+        sys.exit("font table %s not found" % name)
+    return m.group(1)
+
+
+def pack_rows(w, h, pixel):
+    stride = (w + 7) // 8
+    out = []
+    for y in range(h):
+        row = [0] * stride
+        for x in range(w):
+            if pixel(x, y):
+                row[x // 8] |= 0x80 >> (x % 8)
+        out += row
+    return out
+
+
+def ascii_glyphs(text, name, size):
+    data = hex_bytes(table_body(strip_comments(text), name))
+    if size == 8:
+        w, h, per = 6, 8, 6
+    else:
+        w, h = size // 2, (size + 7) // 8 * 8
+        per = (size + 7) // 8 * w
+    if len(data) % per:
+        sys.exit("%s: %d bytes is not a multiple of %d" % (name, len(data), per))
+    glyphs = []
+    for g in range(len(data) // per):
+        src = data[g * per:(g + 1) * per]
+        # EPD_ShowChar: 每字节为一列的 8 行（低位在上），扫完 w 列后换到下一条 8 行
+        glyphs.append((FIRST_CHAR + g, w, h, pack_rows(w, h, lambda x, y: src[(y // 8) * w + x] >> (y % 8) & 1)))
+    return glyphs
+
+
+def chinese_glyphs(text, name, size):
+    body = table_body(text, name)
+    stride = (size + 7) // 8
+    glyphs = []
+    for m in re.finditer(r'\{\s*\{\s*"(.+?)"\s*\}\s*,\s*\{(.*?)\}\s*\}', body, re.S):
+        cp = ord(m.group(1)[0])
+        src = hex_bytes(m.group(2))
+        # EPD_ShowChinese*: 每行 stride 个字节，低位在左，只画前 size 个像素
+        glyphs.append((cp, size, size, pack_rows(size, size, lambda x, y: src[y * stride + x // 8] >> (x % 8) & 1)))
+    return glyphs
+
+
+def atlas_hash(key, seed):
+    # 与 EPD_GUI.c 中的 EPD_AtlasHash 保持一致
+    h = (key ^ seed) & MASK32
+    h ^= h >> 16
+    h = (h * 0x7FEB352D) & MASK32
+    h ^= h >> 15
+    h = (h * 0x846CA68B) & MASK32
+    h ^= h >> 16
+    return h
+
+
+def build_index(keys):
+    nslots = len(keys)
+    nbuckets = max(1, (len(keys) + 3) // 4)
+    buckets = [[] for _ in range(nbuckets)]
+    for k in keys:
+        buckets[atlas_hash(k, 0) % nbuckets].append(k)
+    seeds = [0] * nbuckets
+    slots = [None] * nslots
+    for b in sorted(range(nbuckets), key=lambda i: -len(buckets[i])):
+        if not buckets[b]:
+            continue
+        for seed in range(1, 1 << 16):
+            pos = [atlas_hash(k, seed) % nslots for k in buckets[b]]
+            if len(set(pos)) == len(pos) and all(slots[p] is None for p in pos):
+                for k, p in zip(buckets[b], pos):
+                    slots[p] = k
+                seeds[b] = seed
+                break
+        else:
+            sys.exit("no seed for bucket %d" % b)
+    return seeds, slots
+
+
+def c_array(ctype, name, values, per_line, fmt):
+    lines = ["static const %s %s[%d] = {" % (ctype, name, len(values))]
+    for off in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[off:off + per_line]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    with open(SRC, encoding="utf-8") as f:
+        text = f.read()
+    glyphs = {}
+    for name, size in ASCII_FONTS:
+        for cp, w, h, bits in ascii_glyphs(text, name, size):
+            glyphs[(size << 24) | cp] = (w, h, 1, bits)
+    for name, size in CHINESE_FONTS:
+        for cp, w, h, bits in chinese_glyphs(text, name, size):
+            glyphs[(size << 24) | cp] = (w, h, 0, bits)
+
+    seeds, slots = build_index(sorted(glyphs))
+    data = []
+    entries = []
+    for key in slots:
+        w, h, opaque, bits = glyphs[key]
+        entries.append("    {0x%08X, %d, %d, %d, %d}," % (key, len(data), w, h, opaque))
+        data += bits
+    if len(data) > MASK32:
+        sys.exit("atlas too large")
+
+    parts = [
+        c_array("uint8_t", "epd_atlas_bits", data, 16, "0x%02X"),
+        c_array("uint16_t", "epd_atlas_seed", seeds, 16, "%d"),
+        "static const EPD_GLYPH epd_atlas_glyph[EPD_ATLAS_SLOTS] = {\n" + "\n".join(entries) + "\n};",
+    ]
+    header = [
+        "/* 由 tools/gen_epd_atlas.py 生成，请勿手工修改 */",
+        "/* %d 个字形，位图共 %d 字节 */" % (len(slots), len(data)),
+        "#ifndef _EPD_ATLAS_H_",
+        "#define _EPD_ATLAS_H_",
+        "#include <stdint.h>",
+        "",
+        "#define EPD_ATLAS_SLOTS %d" % len(slots),
+        "#define EPD_ATLAS_BUCKETS %d" % len(seeds),
+        "",
+        "typedef struct",
+        "{",
+        "\tuint32_t key;\t // (字号 << 24) | Unicode 码点",
+        "\tuint32_t offset; // 在 epd_atlas_bits 中的起始字节",
+        "\tuint8_t w;",
+        "\tuint8_t h;",
+        "\tuint8_t opaque; // 1: 背景像素也要写（ASCII），0: 只写前景（汉字）",
+        "} EPD_GLYPH;",
+        "",
+    ]
+    with open(OUT_FILE, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(header) + "\n" + "\n\n".join(parts) + "\n\n#endif\n")
+    print("%d glyphs, %d bytes of native glyph rows" % (len(slots), len(data)))
+
+
+if __name__ == "__main__":
+    main()
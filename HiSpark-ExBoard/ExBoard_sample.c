@@ -17,6 +17,8 @@
 #include "adc_porting.h"
 #include "cJSON.h"
 #include "string.h"
+#include "stdio.h"
+#include "tcxo.h"
 // private
 #include "aht20.h"
 #include "bh1750.h"
@@ -25,7 +27,12 @@
 #include "motor.h"
 #include "ssd1363.h"
 #include "button.h"
+#include "alert.h"
 #include "bmp.h"
+#include "sensor_sched.h"
+#include "adc_filter.h"
+#include "telemetry.h"
+#include "ctrl_cmd.h"
 
 #define ExBoard_TASK_STACK_SIZE 0x4000
 #define ExBoard_TASK_PRIO (osPriority_t)(17)
@@ -35,22 +42,90 @@
 #define WDT_MODE 1
 
 #define BUZZ_PIN 14
-
-// 电机舵机的线程控制（一般不动）
-uint8_t sg90_ctrl = 0;
-// 电机和舵机
-uint16_t sg90_angles[4] = {0};
+// 蜂鸣模式下蜂鸣器的通断周期
+#define BUZZ_TOGGLE_MS 5000
+
+// 执行器任务：电机、蜂鸣器命令到达后立即生效，不再等待传感器循环
+#define ACTUATOR_TASK_STACK_SIZE 0x800
+#define ACTUATOR_TASK_PRIO (osPriority_t)(18)
+#define ACTUATOR_EVT_UPDATE 0x1
+
+// 各传感器独立的采样周期与转换等待时间；是否上报由 g_metric_desc 中的规则决定，采样可以比上报密
+#define SENSOR_AHT20_PERIOD_MS 2000
+#define SENSOR_LIGHT_PERIOD_MS 2000
+#define SENSOR_AIR_PERIOD_MS 2000
+#define AIR_MV_PER_UNIT 40.0 // 空气质量读数 = 滤波后的电压(mV) / 40
+// 某个传感器的读数正在变化时临时改用的采样间隔
+#define SENSOR_FAST_PERIOD_MS 1000
+// 关键帧间隔：所有指标带最新值整体上报一次，供网关和 App 重新同步
+#define TELEMETRY_KEYFRAME_MS 60000
+
+// OLED 底部空白处的状态行：温度、湿度、光照，16 号字 21 个字符居中
+#define OLED_STATUS_X 44
+#define OLED_STATUS_Y 112
+#define OLED_STATUS_SIZE 16
+
+// 三路舵机引脚，下标即 PWM_ServoSetAngle 的通道号
+static const uint8_t sg90_gpios[3] = {PWM_GPIO_1, PWM_GPIO_2, PWM_GPIO_3};
 // 四个传感器
 double temperature = 0.0, humidity = 0.0, air = 0.0;
 uint16_t light = 0;
 uint8_t weather;
-// ws2812灯带
-uint8_t led_mode = 0;
-uint16_t rgbs[3] = {0};
-// 蜂鸣器
-uint8_t buzz_mode = 0;
+
+// 执行器状态：星闪命令先解码进工作副本，整条消息解码成功后在关中断下整体替换，各控制循环只读快照
+typedef struct
+{
+    uint8_t motor;     // SteeringControl.Start，非 0 时电机正转
+    uint8_t buzz;      // BuzzControl.Start，非 0 时蜂鸣器间歇鸣响
+    uint16_t servo[3]; // EngineControl_1..3.Angle
+    uint8_t led_mode;  // RGBControl.Mode，ws2812 灯带模式
+    uint16_t rgb[3];   // RGBControl.Red/Green/Blue
+} actuator_state_t;
+
+static actuator_state_t g_actuator_state = {.servo = {10, 10, 10}};
 // ADC参数
 adc_scan_config_t adc_config;
+// 空气质量传感器的滤波状态：ADC 回调写入，传感器任务关中断读取
+static adc_filter_t g_air_filter;
+static osal_event g_actuator_event;
+
+// 传感器在调度器驱动表中的下标，也是样本中的 id
+enum
+{
+    SENSOR_ID_AHT20,
+    SENSOR_ID_LIGHT,
+    SENSOR_ID_AIR,
+    SENSOR_ID_COUNT
+};
+
+// 上报的指标，一个传感器可以提供多个
+enum
+{
+    METRIC_TEMPERATURE,
+    METRIC_HUMIDITY,
+    METRIC_LIGHT,
+    METRIC_AIR,
+    METRIC_COUNT
+};
+
+typedef struct
+{
+    const char *topic;
+    const char *key;
+    uint8_t sensor; // 来源传感器的 id
+    uint8_t index;  // 在样本 value[] 中的下标
+    telemetry_rule_t rule;
+} metric_desc_t;
+
+// 上报规则：{死区, 变化率/秒, 下限, 上限, 最小间隔, 最大间隔}，下限大于上限表示不做阈值检查
+static const metric_desc_t g_metric_desc[METRIC_COUNT] = {
+    [METRIC_TEMPERATURE] = {"TemperatureSenser", "temperature", SENSOR_ID_AHT20, 0, {0.3, 0.2, 0.0, 35.0, 2000, 30000}},
+    [METRIC_HUMIDITY] = {"HumiditySenser", "humidity", SENSOR_ID_AHT20, 1, {2.0, 1.0, 20.0, 80.0, 2000, 30000}},
+    [METRIC_LIGHT] = {"LightSenser", "light", SENSOR_ID_LIGHT, 0, {20.0, 200.0, 1.0, 0.0, 2000, 30000}},
+    [METRIC_AIR] = {"AirSenser", "air", SENSOR_ID_AIR, 0, {0.5, 2.0, 1.0, 0.0, 2000, 30000}},
+};
+static telemetry_metric_t g_metrics[METRIC_COUNT];
+static uint64_t g_keyframe_ms = 0;
 
 static errcode_t watchdog_callback(uintptr_t param)
 {
@@ -59,194 +134,288 @@ static errcode_t watchdog_callback(uintptr_t param)
     return ERRCODE_SUCC;
 }
 
+// 把单个topic对象交给星闪notify合并层，同一窗口内的更新合成一条notify发出
+static void sensor_batch_put(cJSON *object, const char *topic, bool urgent)
+{
+    char *object_str = cJSON_PrintUnformatted(object);
+    if (object_str == NULL)
+    {
+        return;
+    }
+    sle_uart_server_batch_put(topic, (uint8_t *)object_str, (uint16_t)strlen(object_str), urgent);
+    cJSON_free(object_str);
+}
+
+// 按键中断：只把告警记录放入预分配队列，由高优先级告警任务发送
 void gpio_callback(pin_t pin, uintptr_t param)
 {
     UNUSED(pin);
     UNUSED(param);
-    cJSON *message = cJSON_CreateArray();
-
-    cJSON *cs_object = cJSON_CreateObject();
-    cJSON_AddStringToObject(cs_object, "topic", "CautionStatus");
-    cJSON_AddNumberToObject(cs_object, "caution", 1);
-    cJSON_AddItemToArray(message, cs_object);
+    alert_raise_from_isr(ALERT_TYPE_SOS);
+}
 
-    char *message_str = cJSON_Print(message);
+// ADC回调：通道 3 持续自动扫描，每批采样（mV）直接送入流式滤波
+void adc_callback(uint8_t ch, uint32_t *buffer, uint32_t length, bool *next)
+{
+    unused(ch);
+    unused(next);
+    adc_filter_push_block(&g_air_filter, buffer, length);
+}
 
-    osal_printk("%s length:%d\r\n", message_str, strlen(message_str + 1)); // 不支持直接输出浮点数
+static uint8_t aht20_read(double value[SENSOR_VALUE_MAX])
+{
+    return AHT20_Fetch(&value[0], &value[1]);
+}
 
-    // 星闪发送数据
-    if (sle_uart_client_is_connected())
+static uint8_t light_read(double value[SENSOR_VALUE_MAX])
+{
+    uint16_t lx;
+    if (BH1750_Fetch(&lx))
     {
-        // 发送数据给EPD client
-        sle_uart_server_send_report_by_handle((uint8_t *)message_str, strlen(message_str));
+        return 1;
     }
-    cJSON_Delete(message);
-    osal_msleep(200);
+    value[0] = lx;
+    return 0;
 }
 
-// ADC回调
-void adc_callback(uint8_t ch, uint32_t *buffer, uint32_t length, bool *next)
+// 取滤波器当前结果：value[0] 为中值、EMA 平滑后的读数
+static uint8_t air_read(double value[SENSOR_VALUE_MAX])
 {
-    unused(next);
-    uint32_t total = 0;
-    for (uint32_t i = 0; i < length; i++)
+    adc_filter_out_t out;
+    uint32_t irq = osal_irq_lock();
+    adc_filter_get(&g_air_filter, &out);
+    osal_irq_restore(irq);
+    if (out.samples == 0)
     {
-        total += buffer[i];
+        return 1;
     }
-    air = total / length / 40.0;
-    osal_printk("channel: %d, voltage: %dmv\r\n", ch, total / length);
+    air = out.ema / AIR_MV_PER_UNIT;
+    value[0] = air;
+    return 0;
 }
 
-// 发送数据后的回调函数
-static void sle_server_read_cbk(uint8_t server_id, uint16_t conn_id, ssaps_req_read_cb_t *read_cb_para,
-                                errcode_t status)
+static const sensor_driver_t g_sensor_drivers[SENSOR_ID_COUNT] = {
+    [SENSOR_ID_AHT20] = {SENSOR_AHT20_PERIOD_MS, AHT20_MEASURE_MS, AHT20_Trigger, aht20_read},
+    [SENSOR_ID_LIGHT] = {SENSOR_LIGHT_PERIOD_MS, BH1750_MEASURE_MS, BH1750_Trigger, light_read},
+    [SENSOR_ID_AIR] = {SENSOR_AIR_PERIOD_MS, 0, NULL, air_read},
+};
+
+static void sensor_publish_value(const metric_desc_t *desc, double value, bool urgent)
 {
-    osal_printk("%s ssaps read request cbk callback server_id:%x, conn_id:%x, handle:%x, status:%x\r\n",
-                SLE_UART_SERVER_LOG, server_id, conn_id, read_cb_para->handle, status);
+    cJSON *object = cJSON_CreateObject();
+    cJSON_AddStringToObject(object, "topic", desc->topic);
+    cJSON_AddNumberToObject(object, desc->key, value);
+    sensor_batch_put(object, desc->topic, urgent);
+    cJSON_Delete(object);
 }
 
-// 接收数据后的回调函数
-static void sle_server_write_cbk(uint8_t server_id, uint16_t conn_id, ssaps_req_write_cb_t *data,
-                                 errcode_t status)
+// 每个新样本更新对应的全局量，再逐个指标判定是否上报；读数在变化的传感器临时加快采样
+static void sensor_publish(const sensor_sample_t *sample)
 {
-    osal_printk("%s Write request received, server_id: %d, conn_id: %d, status: 0x%x\r\n",
-                SLE_UART_SERVER_LOG, server_id, conn_id, status);
-    if (data != NULL)
+    switch (sample->id)
     {
-        cJSON *message_array = cJSON_Parse((char *)data->value);
-        if (message_array == NULL)
+    case SENSOR_ID_AHT20:
+        temperature = sample->value[0];
+        humidity = sample->value[1];
+        break;
+    case SENSOR_ID_LIGHT:
+        light = (uint16_t)sample->value[0];
+        break;
+    default:
+        break;
+    }
+
+    uint8_t active = 0;
+    for (uint8_t i = 0; i < METRIC_COUNT; i++)
+    {
+        const metric_desc_t *desc = &g_metric_desc[i];
+        if (desc->sensor != sample->id)
         {
-            return;
+            continue;
         }
-        if (cJSON_IsArray(message_array))
+        double value = sample->value[desc->index];
+        telemetry_action_t action = telemetry_update(&g_metrics[i], &desc->rule, value, sample->t_ms, 0);
+        if (action != TELEMETRY_SKIP)
         {
-            int size = cJSON_GetArraySize(message_array);
-            for (int j = 0; j < size; j++)
-            {
-                cJSON *item = cJSON_GetArrayItem(message_array, j);
-                if (item != NULL && cJSON_IsObject(item))
-                {
-                    cJSON *topic = cJSON_GetObjectItem(item, "topic");
-                    uapi_watchdog_kick();
-                    if (strcmp(topic->valuestring, "EngineControl_1") == 0)
-                    {
-                        osal_printk("Engine_1\r\n");
-                        cJSON *value = cJSON_GetObjectItem(item, "Angle");
-                        sg90_angles[1] = value->valueint;
-                    }
-                    else if (strcmp(topic->valuestring, "EngineControl_2") == 0)
-                    {
-                        osal_printk("Engine_2\r\n");
-                        cJSON *value = cJSON_GetObjectItem(item, "Angle");
-                        sg90_angles[2] = value->valueint;
-                    }
-                    else if (strcmp(topic->valuestring, "EngineControl_3") == 0)
-                    {
-                        osal_printk("Engine_3\r\n");
-                        cJSON *value = cJSON_GetObjectItem(item, "Angle");
-                        sg90_angles[3] = value->valueint;
-                    }
-                    else if (strcmp(topic->valuestring, "SteeringControl") == 0)
-                    {
-                        osal_printk("Steering\r\n");
-                        cJSON *value = cJSON_GetObjectItem(item, "Start");
-                        sg90_angles[0] = value->valueint;
-                    }
-                    else if (strcmp(topic->valuestring, "RGBControl") == 0)
-                    {
-                        osal_printk("RGB\r\n");
-                        cJSON *value = cJSON_GetObjectItem(item, "Mode");
-                        led_mode = value->valueint;
-                        cJSON *value_r = cJSON_GetObjectItem(item, "Red");
-                        rgbs[0] = value_r->valueint;
-                        cJSON *value_g = cJSON_GetObjectItem(item, "Green");
-                        rgbs[1] = value_g->valueint;
-                        cJSON *value_b = cJSON_GetObjectItem(item, "Blue");
-                        rgbs[2] = value_b->valueint;
-                    }
-                    else if (strcmp(topic->valuestring, "BuzzControl") == 0)
-                    {
-                        osal_printk("Buzz\r\n");
-                        cJSON *value = cJSON_GetObjectItem(item, "Start");
-                        buzz_mode = value->valueint;
-                    }
-                    cJSON_free(topic);
-                }
-                cJSON_free(item);
-            }
+            sensor_publish_value(desc, value, action == TELEMETRY_URGENT);
         }
-        cJSON_Delete(message_array);
+        active |= (action == TELEMETRY_CHANGE || action == TELEMETRY_URGENT);
     }
-    osal_printk("%s Received data (len=%d):", SLE_UART_SERVER_LOG, data->length);
-    osal_printk("%s\r\n", data->value);
-    osal_printk("End Recieve\r\n");
+    sensor_sched_set_period(sample->id, active ? SENSOR_FAST_PERIOD_MS : g_sensor_drivers[sample->id].period_ms,
+                            sample->t_ms);
 }
 
-void *sg90_start(const char *arg)
+// 关键帧：所有采样过的指标带最新值上报一次，合并层会把它们拼成同一条 notify
+static void telemetry_keyframe(uint64_t now_ms)
 {
-    uint8_t gpio = *(uint8_t *)arg;
-    while (sg90_ctrl == 1)
+    for (uint8_t i = 0; i < METRIC_COUNT; i++)
     {
-        uint32_t high = (uint32_t)(500 + sg90_angles[gpio] * 11.11 + 0.5);
-        uint32_t low = 20000 - high;
-        uapi_gpio_set_val(gpio, GPIO_LEVEL_HIGH);
-        osal_udelay(high); // 会阻塞CPU
-        uapi_gpio_set_val(gpio, GPIO_LEVEL_LOW);
-        osal_msleep(low / 1000 - 10); // 较长的延迟（大于10ms）使用msleep，防止线程阻塞，可能有10ms左右的额外开销
+        if (g_metrics[i].sampled)
+        {
+            double value = g_metrics[i].last_value;
+            telemetry_update(&g_metrics[i], &g_metric_desc[i].rule, value, now_ms, 1);
+            sensor_publish_value(&g_metric_desc[i], value, false);
+        }
     }
-    return NULL;
+    g_keyframe_ms = now_ms + TELEMETRY_KEYFRAME_MS;
 }
 
-void *BH_AHT_start(const char *arg)
+// 把最新读数画进帧缓冲的状态行，只有变化的字符所在区域会被刷新到屏上
+static void oled_show_status(void)
 {
-    unused(arg);
-    while (1)
-    {
-        // 读取AHT20数据
-        AHT20_ReadData(&temperature, &humidity);
+    char line[32];
+    snprintf(line, sizeof(line), "%5.1lfC %5.1lf%% %5ulx", temperature, humidity, (unsigned int)light);
+    OLED_FB_ShowString(OLED_STATUS_X, OLED_STATUS_Y, (const uint8_t *)line, OLED_STATUS_SIZE, 0);
+    OLED_FB_Flush();
+}
+
+static void actuator_state_get(actuator_state_t *out)
+{
+    uint32_t irq = osal_irq_lock();
+    *out = g_actuator_state;
+    osal_irq_restore(irq);
+}
 
-        // 读取BH1750数据
-        light = BH1750_ReadLight();
+static void actuator_state_swap(const actuator_state_t *next)
+{
+    uint32_t irq = osal_irq_lock();
+    g_actuator_state = *next;
+    osal_irq_restore(irq);
+}
 
-        // adc空气传感器
-        uapi_adc_auto_scan_ch_enable(ADC_CHANNEL_3, adc_config, adc_callback);
-        uapi_adc_auto_scan_ch_disable(ADC_CHANNEL_3);
+static int32_t ctrl_clamp(int32_t v, int32_t lo, int32_t hi)
+{
+    return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
 
-        cJSON *message = cJSON_CreateArray();
+static void ctrl_set_servo(void *ctx, uint8_t arg, const int32_t value[CTRL_FIELD_MAX])
+{
+    ((actuator_state_t *)ctx)->servo[arg] = (uint16_t)ctrl_clamp(value[0], 0, PWM_SERVO_MAX_ANGLE);
+}
 
-        cJSON *ts_object = cJSON_CreateObject();
-        cJSON_AddStringToObject(ts_object, "topic", "TemperatureSenser");
-        cJSON_AddNumberToObject(ts_object, "temperature", temperature);
-        cJSON_AddItemToArray(message, ts_object);
+static void ctrl_set_motor(void *ctx, uint8_t arg, const int32_t value[CTRL_FIELD_MAX])
+{
+    unused(arg);
+    ((actuator_state_t *)ctx)->motor = (value[0] != 0);
+}
 
-        cJSON *hs_object = cJSON_CreateObject();
-        cJSON_AddStringToObject(hs_object, "topic", "HumiditySenser");
-        cJSON_AddNumberToObject(hs_object, "humidity", humidity);
-        cJSON_AddItemToArray(message, hs_object);
+static void ctrl_set_buzz(void *ctx, uint8_t arg, const int32_t value[CTRL_FIELD_MAX])
+{
+    unused(arg);
+    ((actuator_state_t *)ctx)->buzz = (value[0] != 0);
+}
 
-        cJSON *ls_object = cJSON_CreateObject();
-        cJSON_AddStringToObject(ls_object, "topic", "LightSenser");
-        cJSON_AddNumberToObject(ls_object, "light", light);
-        cJSON_AddItemToArray(message, ls_object);
+static void ctrl_set_rgb(void *ctx, uint8_t arg, const int32_t value[CTRL_FIELD_MAX])
+{
+    unused(arg);
+    actuator_state_t *st = (actuator_state_t *)ctx;
+    st->led_mode = (uint8_t)ctrl_clamp(value[0], 0, UINT8_MAX);
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        st->rgb[i] = (uint16_t)ctrl_clamp(value[i + 1], 0, UINT8_MAX);
+    }
+}
 
-        cJSON *as_object = cJSON_CreateObject();
-        cJSON_AddStringToObject(as_object, "topic", "AirSenser");
-        cJSON_AddNumberToObject(as_object, "air", air);
-        cJSON_AddItemToArray(message, as_object);
+// 星闪控制命令表：topic、需要的字段、写入执行器状态的函数
+static const ctrl_cmd_t g_ctrl_cmds[] = {
+    {"EngineControl_1", {"Angle"}, 0, ctrl_set_servo},
+    {"EngineControl_2", {"Angle"}, 1, ctrl_set_servo},
+    {"EngineControl_3", {"Angle"}, 2, ctrl_set_servo},
+    {"SteeringControl", {"Start"}, 0, ctrl_set_motor},
+    {"RGBControl", {"Mode", "Red", "Green", "Blue"}, 0, ctrl_set_rgb},
+    {"BuzzControl", {"Start"}, 0, ctrl_set_buzz},
+};
+
+// 通知执行器任务重新应用电机与蜂鸣器状态
+static void actuator_notify(void)
+{
+    (void)osal_event_write(&g_actuator_event, ACTUATOR_EVT_UPDATE);
+}
 
-        char *message_str = cJSON_Print(message);
+// 发送数据后的回调函数
+static void sle_server_read_cbk(uint8_t server_id, uint16_t conn_id, ssaps_req_read_cb_t *read_cb_para,
+                                errcode_t status)
+{
+    osal_printk("%s ssaps read request cbk callback server_id:%x, conn_id:%x, handle:%x, status:%x\r\n",
+                SLE_UART_SERVER_LOG, server_id, conn_id, read_cb_para->handle, status);
+}
 
-        osal_printk("%s length:%d\r\n", message_str, strlen(message_str + 1)); // 不支持直接输出浮点数
+// 接收数据后的回调函数
+static void sle_server_write_cbk(uint8_t server_id, uint16_t conn_id, ssaps_req_write_cb_t *data,
+                                 errcode_t status)
+{
+    osal_printk("%s Write request received, server_id: %d, conn_id: %d, status: 0x%x\r\n",
+                SLE_UART_SERVER_LOG, server_id, conn_id, status);
+    if (data == NULL)
+    {
+        return;
+    }
+    uapi_watchdog_kick();
+    actuator_state_t next;
+    actuator_state_get(&next);
+    int32_t n = ctrl_decode(g_ctrl_cmds, sizeof(g_ctrl_cmds) / sizeof(g_ctrl_cmds[0]), data->value, data->length,
+                            &next);
+    if (n > 0)
+    {
+        actuator_state_swap(&next);
+        actuator_notify();
+    }
+    osal_printk("%s Received data (len=%d), %d command(s)\r\n", SLE_UART_SERVER_LOG, data->length, n);
+}
 
-        // 星闪发送数据
-        if (sle_uart_client_is_connected())
+// 传感器任务：推进各传感器的状态机，睡到下一个到期事件，期间把新样本发布出去
+void *BH_AHT_start(const char *arg)
+{
+    unused(arg);
+    uint32_t cursor = 0;
+    sensor_sample_t sample;
+    sensor_sched_init(g_sensor_drivers, SENSOR_ID_COUNT, uapi_tcxo_get_ms());
+    for (uint8_t i = 0; i < METRIC_COUNT; i++)
+    {
+        telemetry_init(&g_metrics[i]);
+    }
+    g_keyframe_ms = uapi_tcxo_get_ms() + TELEMETRY_KEYFRAME_MS;
+    // 屏幕只由本任务绘制：开机画面整屏刷新一次，之后只更新状态行
+    OLED_FB_DrawSingleBMP(0, 0, OLED_WIDTH, OLED_HEIGHT, ExBoard_pic, 0);
+    OLED_FB_Flush();
+    while (1)
+    {
+        uint32_t wait = sensor_sched_step(uapi_tcxo_get_ms());
+        uint8_t fresh = 0;
+        while (sensor_ring_read(&cursor, &sample))
+        {
+            sensor_publish(&sample);
+            fresh = 1;
+        }
+        if (fresh)
         {
-            // 发送传感器数据给EPD client
-            sle_uart_server_send_report_by_handle((uint8_t *)message_str, strlen(message_str));
+            oled_show_status();
         }
-        cJSON_Delete(message);
+        uint64_t now = uapi_tcxo_get_ms();
+        if (now >= g_keyframe_ms)
+        {
+            telemetry_keyframe(now);
+        }
+        (void)uapi_watchdog_kick(); // 必须进行喂狗，不然会重启
+        osal_msleep(wait ? wait : 1);
+    }
+    return NULL;
+}
 
-        if (sg90_angles[0])
+// 执行器任务：平时阻塞在事件上，命令到达立即生效；蜂鸣模式下按 BUZZ_TOGGLE_MS 翻转
+void *actuator_start(const char *arg)
+{
+    unused(arg);
+    uint8_t buzzing = 0;
+    actuator_state_t st;
+    while (1)
+    {
+        actuator_state_get(&st);
+        for (uint8_t i = 0; i < 3; i++)
+        {
+            PWM_ServoSetAngle(i, st.servo[i]);
+        }
+        if (st.motor)
         {
             // 启动电机
             motor_forward();
@@ -255,17 +424,22 @@ void *BH_AHT_start(const char *arg)
         {
             motor_stop();
         }
-        // 蜂鸣器
-        if (buzz_mode)
+        if (st.buzz && !buzzing)
         {
-            uapi_gpio_toggle(BUZZ_PIN);
+            uapi_gpio_set_val(BUZZ_PIN, GPIO_LEVEL_LOW);
         }
-        else
+        else if (!st.buzz)
         {
             uapi_gpio_set_val(BUZZ_PIN, GPIO_LEVEL_HIGH);
         }
-        (void)uapi_watchdog_kick(); // 必须进行喂狗，不然会重启
-        osal_msleep(5000);
+        buzzing = st.buzz ? 1 : 0;
+
+        uint32_t timeout = buzzing ? BUZZ_TOGGLE_MS : OSAL_WAIT_FOREVER;
+        int ret = osal_event_read(&g_actuator_event, ACTUATOR_EVT_UPDATE, timeout, OSAL_WAITMODE_OR | OSAL_WAITMODE_CLR);
+        if (ret == OSAL_FAILURE && buzzing)
+        {
+            uapi_gpio_toggle(BUZZ_PIN);
+        }
     }
     return NULL;
 }
@@ -301,6 +475,7 @@ static void *ExBoard_task(const char *arg)
     spi_init();
     uapi_adc_init(ADC_CLOCK_500KHZ);
     uapi_adc_power_en(AFE_SCAN_MODE_MAX_NUM, true);
+    alert_init();
     uapi_gpio_register_isr_func(BUTTON_PIN, GPIO_INTERRUPT_DEDGE, gpio_callback);
     // 初始化蜂鸣器
     uapi_pin_set_mode(BUZZ_PIN, PIN_MODE_0);
@@ -308,42 +483,21 @@ static void *ExBoard_task(const char *arg)
     uapi_gpio_set_val(BUZZ_PIN, GPIO_LEVEL_HIGH);
     adc_config.type = 0;
     adc_config.freq = 2;
+    // 空气质量通道只开启一次，之后一直扫描
+    adc_filter_init(&g_air_filter);
+    uapi_adc_auto_scan_ch_enable(ADC_CHANNEL_3, adc_config, adc_callback);
+
+    if (osal_event_init(&g_actuator_event) != OSAL_SUCCESS)
+    {
+        osal_printk("actuator event init fail\r\n");
+    }
 
     // 初始化星闪
     sle_uart_server_init(sle_server_read_cbk, sle_server_write_cbk);
+    sle_uart_server_batch_init(SLE_UART_BATCH_WINDOW_MS_DEFAULT);
 
-    // 初始化sg90任务参数
-    sg90_ctrl = 1;
-    sg90_angles[0] = 0;
-    sg90_angles[1] = 10;
-    sg90_angles[2] = 10;
-    sg90_angles[3] = 10;
-
-    // 挂载sg90线程
-    osThreadAttr_t sg90_task = {
-        .name = "SG90Task_1",
-        .attr_bits = 0U,
-        .cb_mem = NULL,
-        .cb_size = 0U,
-        .stack_mem = NULL,
-        .stack_size = 0x1000,
-        .priority = 15};
-    uint8_t gpios[3] = {PWM_GPIO_1, PWM_GPIO_2, PWM_GPIO_3};
-    for (int i = 0; i < 3; i++)
-    {
-        osThreadNew((osThreadFunc_t)sg90_start, &gpios[i], &sg90_task);
-        if (i)
-        {
-            sg90_task.priority = 14;
-            sg90_task.name = "SG90Task_3";
-        }
-        else
-        {
-            sg90_task.priority = 13;
-            sg90_task.name = "SG90Task_2";
-        }
-        osal_printk("SG90Task create succ\r\n");
-    }
+    // 初始化舵机：三路脉冲由定时器中断统一产生，初始角度由执行器任务按 g_actuator_state 设置
+    PWM_ServoInit(sg90_gpios, 3);
 
     // 挂载传感器线程
     osThreadAttr_t BH_AHT_task = {
@@ -363,12 +517,26 @@ static void *ExBoard_task(const char *arg)
         osal_printk("BH_AHT_task create succ\r\n");
     }
 
-    OLED_Fill(0, 0, 256, 128, 0x00);
-    OLED_DrawSingleBMP(0, 0, 256, 128, ExBoard_pic, 0);
+    // 挂载执行器线程
+    osThreadAttr_t actuator_task = {
+        .name = "ActuatorTask",
+        .attr_bits = 0U,
+        .cb_mem = NULL,
+        .cb_size = 0U,
+        .stack_mem = NULL,
+        .stack_size = ACTUATOR_TASK_STACK_SIZE,
+        .priority = ACTUATOR_TASK_PRIO};
+    if (osThreadNew((osThreadFunc_t)actuator_start, NULL, &actuator_task) == NULL)
+    {
+        osal_printk("ActuatorTask create fail\r\n");
+    }
+
+    // 灯带按 WS2812_FRAME_MS 出帧，每次睡到下一帧到期；新的 RGBControl 最多晚一帧生效
+    actuator_state_t st;
     while (1)
     {
-        ws2812_next(led_mode, rgbs[0], rgbs[1], rgbs[2]);
-        osal_msleep(1);
+        actuator_state_get(&st);
+        osal_msleep(ws2812_next(st.led_mode, st.rgb[0], st.rgb[1], st.rgb[2]));
     }
 
     sle_uart_server_delete_msgqueue();
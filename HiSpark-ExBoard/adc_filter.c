@@ -0,0 +1,65 @@
+#include "adc_filter.h"
+
+void adc_filter_init(adc_filter_t *f)
+{
+    f->head = 0;
+    f->fill = 0;
+    f->ema_q8 = 0;
+    f->out.ema = 0;
+    f->out.samples = 0;
+}
+
+// 窗口很短，拷贝后插入排序取中间值比维护有序结构更省
+static uint16_t adc_filter_median(const adc_filter_t *f)
+{
+    uint16_t sorted[ADC_FILTER_MEDIAN_N];
+    uint8_t n = f->fill;
+    for (uint8_t i = 0; i < n; i++)
+    {
+        uint16_t v = f->ring[i];
+        uint8_t j = i;
+        while (j > 0 && sorted[j - 1] > v)
+        {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = v;
+    }
+    return sorted[n / 2];
+}
+
+void adc_filter_push(adc_filter_t *f, uint16_t sample)
+{
+    f->ring[f->head] = sample;
+    f->head = (f->head + 1 == ADC_FILTER_MEDIAN_N) ? 0 : f->head + 1;
+    if (f->fill < ADC_FILTER_MEDIAN_N)
+    {
+        f->fill++;
+    }
+    uint16_t med = adc_filter_median(f);
+
+    if (f->out.samples == 0)
+    {
+        f->ema_q8 = (int32_t)med << 8;
+    }
+    else
+    {
+        f->ema_q8 += (((int32_t)med << 8) - f->ema_q8) >> ADC_FILTER_EMA_SHIFT;
+    }
+
+    f->out.ema = (uint16_t)((f->ema_q8 + 0x80) >> 8);
+    f->out.samples++;
+}
+
+void adc_filter_push_block(adc_filter_t *f, const uint32_t *buf, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++)
+    {
+        adc_filter_push(f, (buf[i] > UINT16_MAX) ? UINT16_MAX : (uint16_t)buf[i]);
+    }
+}
+
+void adc_filter_get(const adc_filter_t *f, adc_filter_out_t *out)
+{
+    *out = f->out;
+}
@@ -0,0 +1,33 @@
+#ifndef _ADC_FILTER_H_
+#define _ADC_FILTER_H_
+#include <stddef.h>
+#include <stdint.h>
+
+// ADC 流式滤波：每个样本依次经过中值、EMA，全部为定点运算。
+// 写入在 ADC 回调中逐样本进行，读取只拷贝已算好的结果，与样本数无关
+#define ADC_FILTER_MEDIAN_N 5  // 中值窗口长度，须为奇数
+#define ADC_FILTER_EMA_SHIFT 3 // EMA 系数为 1 / 2^SHIFT
+
+typedef struct
+{
+    uint16_t ema;     // 最近 ADC_FILTER_MEDIAN_N 个样本的中值经 EMA 平滑后的值
+    uint32_t samples; // 累计样本数，为 0 时 ema 无效
+} adc_filter_out_t;
+
+typedef struct
+{
+    uint16_t ring[ADC_FILTER_MEDIAN_N]; // 中值窗口，按到达顺序循环覆盖
+    uint8_t head;
+    uint8_t fill;
+    int32_t ema_q8; // EMA 状态，低 8 位为小数
+    adc_filter_out_t out;
+} adc_filter_t;
+
+void adc_filter_init(adc_filter_t *f);
+void adc_filter_push(adc_filter_t *f, uint16_t sample);
+// 依次送入一段 ADC 采样，超过 16 位的值按上限截断
+void adc_filter_push_block(adc_filter_t *f, const uint32_t *buf, uint32_t len);
+// 写入可能发生在中断中，调用方需自行关中断或加锁后再读取
+void adc_filter_get(const adc_filter_t *f, adc_filter_out_t *out);
+
+#endif
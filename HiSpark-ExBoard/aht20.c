@@ -13,73 +13,31 @@
 
 void AHT20_Init(void)
 {
-    iic_init();
+    iic_bus_init();
     uint8_t cmd[3] = {0xBE, 0x08, 0x00}; // 初始化命令
 
-    iic_start();
-    iic_send_byte(AHT20_ADDRESS << 1);
-    iic_wait_ack();
-    iic_send_byte(cmd[0]);
-    iic_wait_ack();
-    iic_send_byte(cmd[1]);
-    iic_wait_ack();
-    iic_send_byte(cmd[2]);
-    iic_wait_ack();
-    iic_stop();
+    iic_bus_write(AHT20_ADDRESS, cmd, sizeof(cmd));
 
     osal_msleep(10); // 等待初始化完成
 }
 
-uint8_t AHT20_ReadData(double *temperature, double *humidity)
+uint8_t AHT20_Trigger(void)
 {
     uint8_t cmd[3] = {0xAC, 0x33, 0x00}; // 触发测量命令
-    uint8_t data[6] = {0};
 
-    // 发送测量命令
-    iic_start();
-    iic_send_byte(AHT20_ADDRESS << 1);
-    if (iic_wait_ack())
-    {
-        iic_stop();
-        return 1;
-    }
-    iic_send_byte(cmd[0]);
-    if (iic_wait_ack())
-    {
-        iic_stop();
-        return 1;
-    }
-    iic_send_byte(cmd[1]);
-    if (iic_wait_ack())
-    {
-        iic_stop();
-        return 1;
-    }
-    iic_send_byte(cmd[2]);
-    if (iic_wait_ack())
-    {
-        iic_stop();
-        return 1;
-    }
-    iic_stop();
+    return iic_bus_write(AHT20_ADDRESS, cmd, sizeof(cmd));
+}
 
-    osal_msleep(80); // 等待测量完成
+uint8_t AHT20_Fetch(double *temperature, double *humidity)
+{
+    uint8_t data[6] = {0};
 
     // 读取数据
-    iic_start();
-    iic_send_byte((AHT20_ADDRESS << 1) | 0x01);
-    if (iic_wait_ack())
+    if (iic_bus_read(AHT20_ADDRESS, data, sizeof(data)))
     {
-        iic_stop();
         return 1;
     }
 
-    for (int i = 0; i < 6; i++)
-    {
-        data[i] = iic_read_byte(i == 5 ? 0 : 1);
-    }
-    iic_stop();
-
     // 检查状态位
     if ((data[0] & 0x80) == 0x80)
     {
@@ -95,3 +53,13 @@ uint8_t AHT20_ReadData(double *temperature, double *humidity)
 
     return 0;
 }
+
+uint8_t AHT20_ReadData(double *temperature, double *humidity)
+{
+    if (AHT20_Trigger())
+    {
+        return 1;
+    }
+    osal_msleep(AHT20_MEASURE_MS); // 等待测量完成
+    return AHT20_Fetch(temperature, humidity);
+}
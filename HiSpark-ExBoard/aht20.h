@@ -4,8 +4,14 @@
 #include <stdint.h>
 
 #define AHT20_ADDRESS 0x38
+// 触发测量到数据就绪的时间
+#define AHT20_MEASURE_MS 80
 
 void AHT20_Init(void);
+// 阻塞读取：触发、等待 AHT20_MEASURE_MS、读取
 uint8_t AHT20_ReadData(double *temperature, double *humidity);
+// 分步读取，供调度器在等待期间做别的事；返回 0 成功，1 失败或设备忙
+uint8_t AHT20_Trigger(void);
+uint8_t AHT20_Fetch(double *temperature, double *humidity);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "alert.h"
+#include <stdio.h>
+#include <stdbool.h>
+#include "soc_osal.h"
+#include "tcxo.h"
+#include "common_def.h"
+#include "sle_uart_server.h"
+
+#define ALERT_TASK_NAME "AlertTask"
+#define ALERT_MSG_MAX_LEN 96
+
+// 预分配的告警环形队列，中断写、发送任务读
+static alert_record_t g_alert_queue[ALERT_QUEUE_LEN];
+static uint8_t g_alert_head = 0;
+static uint8_t g_alert_count = 0;
+static uint16_t g_alert_seq = 0;
+static uint64_t g_alert_last_us = 0;
+static osal_semaphore g_alert_sem;
+static bool g_alert_inited = false;
+
+void alert_raise_from_isr(uint8_t type)
+{
+    if (!g_alert_inited)
+    {
+        return;
+    }
+    uint64_t now = uapi_tcxo_get_us();
+    uint32_t irq = osal_irq_lock();
+    // 按键抖动及双边沿中断在去抖窗口内只记一次
+    if (g_alert_last_us != 0 && now - g_alert_last_us < ALERT_DEBOUNCE_US)
+    {
+        osal_irq_restore(irq);
+        return;
+    }
+    g_alert_last_us = now;
+    if (g_alert_count == ALERT_QUEUE_LEN)
+    {
+        // 队列满时覆盖最旧的记录，保证最新告警一定能发出
+        g_alert_head = (uint8_t)((g_alert_head + 1) % ALERT_QUEUE_LEN);
+        g_alert_count--;
+    }
+    alert_record_t *rec = &g_alert_queue[(g_alert_head + g_alert_count) % ALERT_QUEUE_LEN];
+    rec->seq = ++g_alert_seq;
+    rec->type = type;
+    rec->t_isr_us = now;
+    g_alert_count++;
+    osal_irq_restore(irq);
+
+    osal_sem_up(&g_alert_sem);
+}
+
+static bool alert_pop(alert_record_t *rec)
+{
+    bool ok = false;
+    uint32_t irq = osal_irq_lock();
+    if (g_alert_count > 0)
+    {
+        *rec = g_alert_queue[g_alert_head];
+        g_alert_head = (uint8_t)((g_alert_head + 1) % ALERT_QUEUE_LEN);
+        g_alert_count--;
+        ok = true;
+    }
+    osal_irq_restore(irq);
+    return ok;
+}
+
+// 发出队列中的全部告警
+static void alert_send_pending(void)
+{
+    alert_record_t rec;
+    char msg[ALERT_MSG_MAX_LEN];
+    while (alert_pop(&rec))
+    {
+        // ex_us: 本板中断到发出的耗时，网关据此与自身耗时累加得到端到端延迟
+        uint32_t ex_us = (uint32_t)(uapi_tcxo_get_us() - rec.t_isr_us);
+        int len = snprintf(msg, sizeof(msg),
+                           "[{\"topic\":\"CautionStatus\",\"caution\":%u,\"seq\":%u,\"ex_us\":%u}]",
+                           rec.type, rec.seq, ex_us);
+        if (len <= 0 || len >= (int)sizeof(msg))
+        {
+            continue;
+        }
+        // 直接notify，不经过合并窗口，也不排在遥测之后
+        if (!sle_uart_client_is_connected() ||
+            sle_uart_server_send_report_by_handle((uint8_t *)msg, (uint16_t)len) != ERRCODE_SUCC)
+        {
+            osal_printk("alert %u send fail\r\n", rec.seq);
+            continue;
+        }
+        osal_printk("alert %u sent, isr->tx %u us\r\n", rec.seq, ex_us);
+    }
+}
+
+static int alert_task(void *arg)
+{
+    unused(arg);
+    while (1)
+    {
+        (void)osal_sem_down(&g_alert_sem);
+        alert_send_pending();
+    }
+    return 0;
+}
+
+void alert_init(void)
+{
+    if (g_alert_inited)
+    {
+        return;
+    }
+    if (osal_sem_init(&g_alert_sem, 0) != OSAL_SUCCESS)
+    {
+        osal_printk("alert sem init fail\r\n");
+        return;
+    }
+
+    osal_task *task_handle = NULL;
+    osal_kthread_lock();
+    task_handle = osal_kthread_create(alert_task, NULL, ALERT_TASK_NAME, ALERT_TASK_STACK_SIZE);
+    if (task_handle != NULL)
+    {
+        osal_kthread_set_priority(task_handle, ALERT_TASK_PRIO);
+        osal_kfree(task_handle);
+    }
+    osal_kthread_unlock();
+    if (task_handle == NULL)
+    {
+        osal_printk("alert task create fail\r\n");
+        osal_sem_destroy(&g_alert_sem);
+        return;
+    }
+    g_alert_inited = true;
+}
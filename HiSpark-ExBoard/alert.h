@@ -0,0 +1,24 @@
+#ifndef _ALERT_H_
+#define _ALERT_H_
+#include <stdint.h>
+
+// 紧急告警快速通道：按键中断 -> 高优先级发送任务 -> 星闪notify，绕过遥测合并层
+#define ALERT_QUEUE_LEN 8
+#define ALERT_DEBOUNCE_US 200000
+#define ALERT_TASK_STACK_SIZE 0x800
+#define ALERT_TASK_PRIO OSAL_TASK_PRIORITY_HIGH
+
+#define ALERT_TYPE_SOS 1
+
+typedef struct
+{
+    uint16_t seq;
+    uint8_t type;
+    uint64_t t_isr_us; // 中断触发时刻
+} alert_record_t;
+
+void alert_init(void);
+// 仅在中断中做入队和唤醒，不分配内存、不阻塞
+void alert_raise_from_isr(uint8_t type);
+
+#endif
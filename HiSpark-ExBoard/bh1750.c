@@ -14,48 +14,39 @@
 void BH1750_Init(void)
 {
     uint8_t cmd = 0x01; // 电源开启
+    uint8_t mode = BH1750_ONE_TIME_HIGH_RES_MODE;
 
-    iic_start();
-    iic_send_byte(BH1750_ADDRESS << 1);
-    iic_wait_ack();
-    osal_udelay(150);
-
-    iic_send_byte(cmd);
-    iic_wait_ack();
-    osal_udelay(150);
-
-    iic_send_byte(BH1750_ONE_TIME_HIGH_RES_MODE);
-    iic_wait_ack();
+    iic_bus_init();
+    iic_bus_write(BH1750_ADDRESS, &cmd, 1);
+    iic_bus_write(BH1750_ADDRESS, &mode, 1);
     osal_msleep(120);
-    iic_stop();
 }
 
-uint16_t BH1750_ReadLight(void)
+uint8_t BH1750_Trigger(void)
 {
-    uint8_t data[2] = {0};
-
-    // 读取光照数据
-    iic_start();
-    iic_send_byte(BH1750_ADDRESS << 1);
-    iic_wait_ack();
-    osal_udelay(150);
-    iic_send_byte(BH1750_ONE_TIME_HIGH_RES_MODE);
-    iic_wait_ack();
-    iic_stop();
-    osal_msleep(120); // 等待单次测量完成
+    uint8_t mode = BH1750_ONE_TIME_HIGH_RES_MODE;
+    return iic_bus_write(BH1750_ADDRESS, &mode, 1);
+}
 
-    iic_start();
-    iic_send_byte((BH1750_ADDRESS << 1) | 1);
-    iic_wait_ack();
+uint8_t BH1750_Fetch(uint16_t *light)
+{
+    uint8_t data[2] = {0};
 
-    data[0] = iic_read_byte(1);
-    osal_udelay(120);
-    data[1] = iic_read_byte(0);
-    osal_udelay(120);
-    iic_stop();
+    if (iic_bus_read(BH1750_ADDRESS, data, sizeof(data)))
+    {
+        return 1;
+    }
 
     // 计算光照强度(lx)
-    uint16_t light = ((data[0] << 8) | data[1]) * 10 / 12;
+    *light = ((data[0] << 8) | data[1]) * 10 / 12;
+    return 0;
+}
 
+uint16_t BH1750_ReadLight(void)
+{
+    uint16_t light = 0;
+    BH1750_Trigger();
+    osal_msleep(BH1750_MEASURE_MS); // 等待单次测量完成
+    BH1750_Fetch(&light);
     return light;
 }
@@ -14,7 +14,13 @@
 #define BH1750_ONE_TIME_HIGH_RES_MODE_2 0x21
 #define BH1750_ONE_TIME_LOW_RES_MODE 0x23
 
+// 单次高分辨率测量的等待时间
+#define BH1750_MEASURE_MS 120
+
 void BH1750_Init(void);
 uint16_t BH1750_ReadLight(void);
+// 分步读取，返回 0 成功，1 无应答
+uint8_t BH1750_Trigger(void);
+uint8_t BH1750_Fetch(uint16_t *light);
 
 #endif
\ No newline at end of file
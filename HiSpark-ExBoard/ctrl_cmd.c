@@ -0,0 +1,367 @@
+#include "ctrl_cmd.h"
+#include <string.h>
+
+typedef struct
+{
+    const uint8_t *p;
+    const uint8_t *end;
+} ctrl_scan_t;
+
+// 指向输入缓冲区的一段字节，不以 '\0' 结尾
+typedef struct
+{
+    const uint8_t *ptr;
+    uint32_t len;
+} ctrl_slice_t;
+
+static uint8_t ctrl_is_digit(uint8_t c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// 跳过空白后返回下一个字节，到达末尾时返回 0
+static uint8_t ctrl_peek(ctrl_scan_t *s)
+{
+    while (s->p < s->end && (*s->p == ' ' || *s->p == '\t' || *s->p == '\r' || *s->p == '\n'))
+    {
+        s->p++;
+    }
+    return (s->p < s->end) ? *s->p : 0;
+}
+
+static uint8_t ctrl_expect(ctrl_scan_t *s, uint8_t c)
+{
+    if (ctrl_peek(s) != c)
+    {
+        return 1;
+    }
+    s->p++;
+    return 0;
+}
+
+static uint8_t ctrl_slice_eq(const ctrl_slice_t *a, const char *str)
+{
+    size_t n = strlen(str);
+    return a->len == n && memcmp(a->ptr, str, n) == 0;
+}
+
+// 字符串只定位起止，不处理转义，控制字符视为格式错误
+static uint8_t ctrl_string(ctrl_scan_t *s, ctrl_slice_t *out)
+{
+    if (ctrl_expect(s, '"'))
+    {
+        return 1;
+    }
+    out->ptr = s->p;
+    while (s->p < s->end && *s->p != '"')
+    {
+        if (*s->p < 0x20)
+        {
+            return 1;
+        }
+        s->p += (*s->p == '\\') ? 2 : 1;
+    }
+    if (s->p >= s->end)
+    {
+        return 1;
+    }
+    out->len = (uint32_t)(s->p - out->ptr);
+    s->p++;
+    return 0;
+}
+
+// 整数部分超出 int32 时饱和，小数和指数部分只跳过
+static uint8_t ctrl_number(ctrl_scan_t *s, int32_t *out)
+{
+    uint8_t neg = 0;
+    int64_t v = 0;
+    if (s->p < s->end && *s->p == '-')
+    {
+        neg = 1;
+        s->p++;
+    }
+    if (s->p >= s->end || !ctrl_is_digit(*s->p))
+    {
+        return 1;
+    }
+    while (s->p < s->end && ctrl_is_digit(*s->p))
+    {
+        v = (v > INT32_MAX) ? v : v * 10 + (*s->p - '0');
+        s->p++;
+    }
+    if (s->p < s->end && *s->p == '.')
+    {
+        s->p++;
+        while (s->p < s->end && ctrl_is_digit(*s->p))
+        {
+            s->p++;
+        }
+    }
+    if (s->p < s->end && (*s->p == 'e' || *s->p == 'E'))
+    {
+        s->p++;
+        if (s->p < s->end && (*s->p == '+' || *s->p == '-'))
+        {
+            s->p++;
+        }
+        while (s->p < s->end && ctrl_is_digit(*s->p))
+        {
+            s->p++;
+        }
+    }
+    v = neg ? -v : v;
+    v = (v > INT32_MAX) ? INT32_MAX : v;
+    *out = (int32_t)((v < INT32_MIN) ? INT32_MIN : v);
+    return 0;
+}
+
+static uint8_t ctrl_literal(ctrl_scan_t *s, const char *word)
+{
+    size_t n = strlen(word);
+    if ((size_t)(s->end - s->p) < n || memcmp(s->p, word, n) != 0)
+    {
+        return 1;
+    }
+    s->p += n;
+    return 0;
+}
+
+// 数值和布尔值返回 0 并写入 *out；字符串、null 等其它合法值返回 2；格式错误返回 1
+static uint8_t ctrl_scalar(ctrl_scan_t *s, int32_t *out)
+{
+    uint8_t c = ctrl_peek(s);
+    if (c == '-' || ctrl_is_digit(c))
+    {
+        return ctrl_number(s, out);
+    }
+    if (c == 't' || c == 'f')
+    {
+        *out = (c == 't') ? 1 : 0;
+        return ctrl_literal(s, (c == 't') ? "true" : "false");
+    }
+    if (c == 'n')
+    {
+        return ctrl_literal(s, "null") ? 1 : 2;
+    }
+    if (c == '"')
+    {
+        ctrl_slice_t str;
+        return ctrl_string(s, &str) ? 1 : 2;
+    }
+    return 1;
+}
+
+static uint8_t ctrl_skip_value(ctrl_scan_t *s, uint8_t depth);
+
+// 跳过对象或数组的剩余部分，调用时 s->p 指向 '{' 或 '['
+static uint8_t ctrl_skip_container(ctrl_scan_t *s, uint8_t depth)
+{
+    uint8_t close = (*s->p == '{') ? '}' : ']';
+    s->p++;
+    if (ctrl_peek(s) == close)
+    {
+        s->p++;
+        return 0;
+    }
+    while (1)
+    {
+        if (close == '}')
+        {
+            ctrl_slice_t key;
+            if (ctrl_string(s, &key) || ctrl_expect(s, ':'))
+            {
+                return 1;
+            }
+        }
+        if (ctrl_skip_value(s, depth + 1))
+        {
+            return 1;
+        }
+        uint8_t c = ctrl_peek(s);
+        if (c != ',' && c != close)
+        {
+            return 1;
+        }
+        s->p++;
+        if (c == close)
+        {
+            return 0;
+        }
+    }
+}
+
+static uint8_t ctrl_skip_value(ctrl_scan_t *s, uint8_t depth)
+{
+    uint8_t c = ctrl_peek(s);
+    if (c == '{' || c == '[')
+    {
+        return (depth >= CTRL_DEPTH_MAX) ? 1 : ctrl_skip_container(s, depth);
+    }
+    int32_t v;
+    return (ctrl_scalar(s, &v) == 1) ? 1 : 0;
+}
+
+static const ctrl_cmd_t *ctrl_find(const ctrl_cmd_t *table, uint8_t count, const ctrl_slice_t *topic)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (ctrl_slice_eq(topic, table[i].topic))
+        {
+            return &table[i];
+        }
+    }
+    return NULL;
+}
+
+// 解析一个对象：记下 topic 和各数值字段，对象结束后再按命令表取字段执行，因此 topic 可以出现在任意位置。
+// 返回 1 已执行，0 跳过，-1 格式错误
+static int8_t ctrl_object(ctrl_scan_t *s, const ctrl_cmd_t *table, uint8_t count, void *ctx)
+{
+    ctrl_slice_t topic = {NULL, 0};
+    ctrl_slice_t keys[CTRL_PAIR_MAX];
+    int32_t vals[CTRL_PAIR_MAX];
+    uint8_t n = 0;
+    if (ctrl_expect(s, '{'))
+    {
+        return -1;
+    }
+    if (ctrl_peek(s) == '}')
+    {
+        s->p++;
+        return 0;
+    }
+    while (1)
+    {
+        ctrl_slice_t key;
+        if (ctrl_string(s, &key) || ctrl_expect(s, ':'))
+        {
+            return -1;
+        }
+        uint8_t c = ctrl_peek(s);
+        if (c == '{' || c == '[')
+        {
+            if (ctrl_skip_value(s, 1))
+            {
+                return -1;
+            }
+        }
+        else if (c == '"' && ctrl_slice_eq(&key, "topic"))
+        {
+            if (ctrl_string(s, &topic))
+            {
+                return -1;
+            }
+        }
+        else
+        {
+            int32_t v;
+            uint8_t ret = ctrl_scalar(s, &v);
+            if (ret == 1)
+            {
+                return -1;
+            }
+            if (ret == 0 && n < CTRL_PAIR_MAX)
+            {
+                keys[n] = key;
+                vals[n++] = v;
+            }
+        }
+        c = ctrl_peek(s);
+        if (c != ',' && c != '}')
+        {
+            return -1;
+        }
+        s->p++;
+        if (c == '}')
+        {
+            break;
+        }
+    }
+
+    const ctrl_cmd_t *cmd = (topic.ptr != NULL) ? ctrl_find(table, count, &topic) : NULL;
+    if (cmd == NULL)
+    {
+        return 0;
+    }
+    int32_t value[CTRL_FIELD_MAX] = {0};
+    for (uint8_t f = 0; f < CTRL_FIELD_MAX && cmd->fields[f] != NULL; f++)
+    {
+        // 同名字段以最后一次出现为准
+        uint8_t k = n;
+        while (k > 0 && !ctrl_slice_eq(&keys[k - 1], cmd->fields[f]))
+        {
+            k--;
+        }
+        if (k == 0)
+        {
+            return 0;
+        }
+        value[f] = vals[k - 1];
+    }
+    cmd->apply(ctx, cmd->arg, value);
+    return 1;
+}
+
+int32_t ctrl_decode(const ctrl_cmd_t *table, uint8_t count, const uint8_t *buf, uint32_t len, void *ctx)
+{
+    ctrl_scan_t s = {buf, buf + len};
+    int32_t done = 0;
+    int8_t ret;
+    uint8_t c = ctrl_peek(&s);
+    if (c == '{')
+    {
+        ret = ctrl_object(&s, table, count, ctx);
+        if (ret < 0)
+        {
+            return -1;
+        }
+        done += ret;
+    }
+    else if (c == '[')
+    {
+        s.p++;
+        if (ctrl_peek(&s) == ']')
+        {
+            s.p++;
+        }
+        else
+        {
+            while (1)
+            {
+                if (ctrl_peek(&s) == '{')
+                {
+                    ret = ctrl_object(&s, table, count, ctx);
+                    if (ret < 0)
+                    {
+                        return -1;
+                    }
+                    done += ret;
+                }
+                else if (ctrl_skip_value(&s, 1))
+                {
+                    return -1;
+                }
+                c = ctrl_peek(&s);
+                if (c != ',' && c != ']')
+                {
+                    return -1;
+                }
+                s.p++;
+                if (c == ']')
+                {
+                    break;
+                }
+            }
+        }
+    }
+    else
+    {
+        return -1;
+    }
+    // 之后只允许空白和字符串结尾的 '\0'
+    while (ctrl_peek(&s) == 0 && s.p < s.end)
+    {
+        s.p++;
+    }
+    return (s.p == s.end) ? done : -1;
+}
@@ -0,0 +1,25 @@
+#ifndef _CTRL_CMD_H_
+#define _CTRL_CMD_H_
+#include <stddef.h>
+#include <stdint.h>
+
+// 控制命令解码：一遍扫描星闪收到的 JSON（一个对象或对象数组），不分配内存、不拷贝字符串，
+// 按 topic 在命令表中查到对应项，取出所需的数值字段后调用其 apply
+#define CTRL_FIELD_MAX 4 // 一条命令最多需要的字段数
+#define CTRL_PAIR_MAX 8  // 一个对象中最多记录的数值字段数，多出的忽略
+#define CTRL_DEPTH_MAX 8 // 跳过无关的嵌套值时允许的最大深度
+
+typedef struct
+{
+    const char *topic;
+    const char *fields[CTRL_FIELD_MAX]; // 需要的数值字段名，不足 CTRL_FIELD_MAX 个时以 NULL 结束
+    uint8_t arg;                        // 原样传给 apply，便于多条命令共用一个 apply
+    // value[i] 对应 fields[i]，小数按截断取整，true/false 为 1/0
+    void (*apply)(void *ctx, uint8_t arg, const int32_t value[CTRL_FIELD_MAX]);
+} ctrl_cmd_t;
+
+// 返回执行的命令数：topic 不在表中或缺少字段的对象跳过不计。
+// JSON 格式错误或不完整时返回 -1，此前已执行的命令可能改过 ctx，调用方应整体丢弃
+int32_t ctrl_decode(const ctrl_cmd_t *table, uint8_t count, const uint8_t *buf, uint32_t len, void *ctx);
+
+#endif
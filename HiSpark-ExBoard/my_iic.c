@@ -8,8 +8,12 @@
 #include <securec.h>
 #include "pinctrl.h"
 #include "gpio.h"
+#include "i2c.h"
 #include "soc_osal.h"
 
+static osal_mutex g_iic_mutex;
+static uint8_t g_iic_ready = 0;
+
 void iic_delay(void)
 {
     uint8_t t = 3;
@@ -145,3 +149,94 @@ uint8_t iic_read_byte(uint8_t ack)
 		iic_ack();
 	return receive;
 }
+
+#if !IIC_USE_HW
+// 模拟时序的一次写事务，任一字节无应答即结束（iic_wait_ack 超时已发停止位）
+static uint8_t iic_soft_write(uint8_t addr, const uint8_t *data, uint32_t len)
+{
+	iic_start();
+	iic_send_byte(addr << 1);
+	if (iic_wait_ack())
+	{
+		return 1;
+	}
+	for (uint32_t i = 0; i < len; i++)
+	{
+		iic_send_byte(data[i]);
+		if (iic_wait_ack())
+		{
+			return 1;
+		}
+	}
+	iic_stop();
+	return 0;
+}
+
+static uint8_t iic_soft_read(uint8_t addr, uint8_t *data, uint32_t len)
+{
+	iic_start();
+	iic_send_byte((addr << 1) | 0x01);
+	if (iic_wait_ack())
+	{
+		return 1;
+	}
+	for (uint32_t i = 0; i < len; i++)
+	{
+		data[i] = iic_read_byte(i + 1 < len);
+	}
+	iic_stop();
+	return 0;
+}
+#endif
+
+// 可重复调用，只有第一次生效
+void iic_bus_init(void)
+{
+	if (g_iic_ready)
+	{
+		return;
+	}
+	osal_mutex_init(&g_iic_mutex);
+#if IIC_USE_HW
+	uapi_pin_set_mode(SDA_PIN, IIC_HW_PIN_MODE);
+	uapi_pin_set_mode(SCL_PIN, IIC_HW_PIN_MODE);
+	uapi_pin_set_pull(SDA_PIN, PIN_PULL_TYPE_UP);
+	uapi_pin_set_pull(SCL_PIN, PIN_PULL_TYPE_UP);
+	uapi_i2c_master_init(IIC_BUS_ID, IIC_BAUDRATE, 0x0);
+#else
+	iic_init();
+#endif
+	g_iic_ready = 1;
+}
+
+uint8_t iic_bus_write(uint8_t addr, const uint8_t *data, uint32_t len)
+{
+	uint8_t ret;
+	osal_mutex_lock(&g_iic_mutex);
+#if IIC_USE_HW
+	i2c_data_t msg = {0};
+	msg.send_buf = (uint8_t *)data;
+	msg.send_len = len;
+	ret = (uapi_i2c_master_write(IIC_BUS_ID, addr, &msg) == 0) ? 0 : 1;
+#else
+	ret = iic_soft_write(addr, data, len);
+#endif
+	osal_mutex_unlock(&g_iic_mutex);
+	return ret;
+}
+
+uint8_t iic_bus_read(uint8_t addr, uint8_t *data, uint32_t len)
+{
+	uint8_t ret;
+	osal_mutex_lock(&g_iic_mutex);
+#if IIC_USE_HW
+	i2c_data_t msg = {0};
+	msg.receive_buf = data;
+	msg.receive_len = len;
+	ret = (uapi_i2c_master_read(IIC_BUS_ID, addr, &msg) == 0) ? 0 : 1;
+#else
+	ret = iic_soft_read(addr, data, len);
+#endif
+	osal_mutex_unlock(&g_iic_mutex);
+	return ret;
+}
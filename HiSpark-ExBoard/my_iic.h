@@ -14,6 +14,18 @@
 #define IIC_SDA_Clr() uapi_gpio_set_val(SDA_PIN, GPIO_LEVEL_LOW)
 #define IIC_SDA_Set() uapi_gpio_set_val(SDA_PIN, GPIO_LEVEL_HIGH)
 
+// 总线后端：1 使用硬件 I2C 控制器，0 使用下面的 GPIO 模拟时序
+#define IIC_USE_HW 1
+#define IIC_BUS_ID 1
+#define IIC_HW_PIN_MODE 2 // SDA/SCL 引脚的 I2C 功能模式
+#define IIC_BAUDRATE 400000
+
+// 总线级接口，OLED 与各传感器共用。每次调用是一个完整事务：起始、7 位地址、len 个字节、停止。
+// 多任务调用时按事务互斥；返回 0 成功，1 无应答或控制器出错
+void iic_bus_init(void);
+uint8_t iic_bus_write(uint8_t addr, const uint8_t *data, uint32_t len);
+uint8_t iic_bus_read(uint8_t addr, uint8_t *data, uint32_t len);
+
 void iic_init(void);
 void iic_start(void);
 void iic_stop(void);
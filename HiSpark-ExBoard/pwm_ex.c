@@ -44,3 +44,143 @@ void PWM_Update(uint8_t channel, uint16_t duty)
         uapi_pwm_start_group(PWM_GROUP_ID);
     }
 }
+
+typedef struct
+{
+    uint8_t gpio;
+    volatile uint16_t target_us; // 任务写、中断读
+    uint16_t pulse_us;           // 本周期实际输出的脉宽，0 表示不输出
+} pwm_servo_t;
+
+static pwm_servo_t g_servo[PWM_SERVO_MAX];
+static uint8_t g_servo_count = 0;
+static timer_handle_t g_servo_timer = NULL;
+static uint64_t g_servo_period_start = 0; // 名义周期起点，只用于排下一个周期
+static uint64_t g_servo_rise_us = 0;      // 本周期实际拉高的时刻，下降沿都相对它计算
+// 本周期输出的通道按脉宽从小到大排列，g_servo_next 指向下一个要拉低的通道
+static uint8_t g_servo_order[PWM_SERVO_MAX];
+static uint8_t g_servo_active = 0;
+static uint8_t g_servo_next = 0;
+
+static void PWM_ServoTimerCb(uintptr_t data);
+
+// 周期开始：各通道脉宽向目标逼近一步，拉高输出并按脉宽插入排序
+static void PWM_ServoPeriodStart(uint64_t now)
+{
+    g_servo_period_start += PWM_SERVO_PERIOD_US;
+    int64_t lag = (int64_t)(now - g_servo_period_start);
+    if (lag >= PWM_SERVO_PERIOD_US || lag <= -PWM_SERVO_PERIOD_US)
+    {
+        // 中断被耽误超过一个周期时重新对齐，不追补
+        g_servo_period_start = now;
+    }
+    g_servo_active = 0;
+    g_servo_next = 0;
+    for (uint8_t i = 0; i < g_servo_count; i++)
+    {
+        pwm_servo_t *s = &g_servo[i];
+        uint16_t target = s->target_us;
+        if (target == 0)
+        {
+            continue;
+        }
+        if (s->pulse_us == 0)
+        {
+            s->pulse_us = target;
+        }
+        else if (target > s->pulse_us + PWM_SERVO_SLEW_US)
+        {
+            s->pulse_us += PWM_SERVO_SLEW_US;
+        }
+        else if (target + PWM_SERVO_SLEW_US < s->pulse_us)
+        {
+            s->pulse_us -= PWM_SERVO_SLEW_US;
+        }
+        else
+        {
+            s->pulse_us = target;
+        }
+        uint8_t k = g_servo_active++;
+        while (k > 0 && g_servo[g_servo_order[k - 1]].pulse_us > s->pulse_us)
+        {
+            g_servo_order[k] = g_servo_order[k - 1];
+            k--;
+        }
+        g_servo_order[k] = i;
+    }
+    for (uint8_t k = 0; k < g_servo_active; k++)
+    {
+        uapi_gpio_set_val(g_servo[g_servo_order[k]].gpio, GPIO_LEVEL_HIGH);
+    }
+    g_servo_rise_us = uapi_tcxo_get_us();
+}
+
+// 边沿调度：处理此刻到期的边沿（周期开始，或一组相近的下降沿），返回下一个边沿的绝对时刻。
+// 只读写 GPIO 和时钟，不碰定时器
+static uint64_t PWM_ServoEdge(uint64_t now)
+{
+    if (g_servo_next >= g_servo_active)
+    {
+        PWM_ServoPeriodStart(now);
+    }
+    else
+    {
+        uint32_t elapsed = (now > g_servo_rise_us) ? (uint32_t)(now - g_servo_rise_us) : 0;
+        while (g_servo_next < g_servo_active &&
+               g_servo[g_servo_order[g_servo_next]].pulse_us <= elapsed + PWM_SERVO_MERGE_US)
+        {
+            uapi_gpio_set_val(g_servo[g_servo_order[g_servo_next]].gpio, GPIO_LEVEL_LOW);
+            g_servo_next++;
+        }
+    }
+    if (g_servo_next < g_servo_active)
+    {
+        return g_servo_rise_us + g_servo[g_servo_order[g_servo_next]].pulse_us;
+    }
+    return g_servo_period_start + PWM_SERVO_PERIOD_US;
+}
+
+// 按绝对时刻定时，中断延迟不会累积到后面的边沿
+static void PWM_ServoArm(uint64_t now, uint64_t deadline)
+{
+    uint32_t delay = (deadline > now) ? (uint32_t)(deadline - now) : 1;
+    uapi_timer_start(g_servo_timer, delay, PWM_ServoTimerCb, 0);
+}
+
+static void PWM_ServoTimerCb(uintptr_t data)
+{
+    unused(data);
+    uint64_t deadline = PWM_ServoEdge(uapi_tcxo_get_us());
+    PWM_ServoArm(uapi_tcxo_get_us(), deadline);
+}
+
+void PWM_ServoInit(const uint8_t *gpios, uint8_t count)
+{
+    g_servo_count = (count > PWM_SERVO_MAX) ? PWM_SERVO_MAX : count;
+    for (uint8_t i = 0; i < g_servo_count; i++)
+    {
+        g_servo[i].gpio = gpios[i];
+        g_servo[i].target_us = 0;
+        g_servo[i].pulse_us = 0;
+        uapi_gpio_set_val(gpios[i], GPIO_LEVEL_LOW);
+    }
+    g_servo_active = 0;
+    g_servo_next = 0;
+
+    uapi_timer_init();
+    uapi_timer_adapter(PWM_SERVO_TIMER_INDEX, TIMER_1_IRQN, PWM_SERVO_TIMER_PRIO);
+    uapi_timer_create(PWM_SERVO_TIMER_INDEX, &g_servo_timer);
+    g_servo_period_start = uapi_tcxo_get_us();
+    uapi_timer_start(g_servo_timer, PWM_SERVO_PERIOD_US, PWM_ServoTimerCb, 0);
+}
+
+void PWM_ServoSetAngle(uint8_t channel, uint16_t angle)
+{
+    if (channel >= g_servo_count)
+    {
+        return;
+    }
+    angle = (angle > PWM_SERVO_MAX_ANGLE) ? PWM_SERVO_MAX_ANGLE : angle;
+    g_servo[channel].target_us =
+        PWM_SERVO_MIN_US + (uint16_t)((uint32_t)angle * (PWM_SERVO_MAX_US - PWM_SERVO_MIN_US) / PWM_SERVO_MAX_ANGLE);
+}
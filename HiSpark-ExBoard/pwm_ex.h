@@ -8,6 +8,8 @@
 #include "gpio.h"
 #include "osal_debug.h"
 #include "cmsis_os2.h"
+#include "timer.h"
+#include "chip_core_irq.h"
 
 #define PWM_PIN_MODE 1
 #define PWM_GROUP_ID 0
@@ -23,4 +25,24 @@ void PWM_init(void);
 
 void PWM_Update(uint8_t channel, uint16_t duty);
 
+// 舵机：50Hz，0~180° 对应 500~2500us 高电平。硬件 PWM 出不了这么低的频率，
+// 由一个单次定时器在中断里按排好序的下降沿依次拉低各路 GPIO，不再每路一个忙等线程
+#define PWM_SERVO_MAX 4
+#define PWM_SERVO_TIMER_INDEX 1
+#define PWM_SERVO_TIMER_PRIO 1
+#define PWM_SERVO_PERIOD_US 20000
+#define PWM_SERVO_MIN_US 500
+#define PWM_SERVO_MAX_US 2500
+#define PWM_SERVO_MAX_ANGLE 180
+// 每个周期脉宽最多变化 60us，约 270°/s，避免大角度指令时舵机瞬间堵转拉低电源
+#define PWM_SERVO_SLEW_US 60
+// 相差不足该值的下降沿在同一次中断里处理，误差不到 1°
+#define PWM_SERVO_MERGE_US 8
+
+// gpios 为各通道引脚（需已配置为输出），通道号即下标；通道收到第一次角度指令前不输出脉冲
+void PWM_ServoInit(const uint8_t *gpios, uint8_t count);
+
+// 设置目标角度，实际脉宽按 PWM_SERVO_SLEW_US 每周期逐步逼近；首次设置直接到位
+void PWM_ServoSetAngle(uint8_t channel, uint16_t angle);
+
 #endif
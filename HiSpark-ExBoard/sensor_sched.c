@@ -0,0 +1,128 @@
+#include "sensor_sched.h"
+#include "soc_osal.h"
+
+typedef enum
+{
+    SENSOR_STATE_IDLE, // 等待下一次触发
+    SENSOR_STATE_WAIT, // 已触发，等待转换完成
+} sensor_state_t;
+
+typedef struct
+{
+    sensor_state_t state;
+    uint32_t period_ms; // 当前触发间隔，初始为驱动表中的值
+    uint64_t next_trigger_ms;
+    uint64_t ready_ms;
+} sensor_slot_t;
+
+static const sensor_driver_t *g_sensor_drivers = NULL;
+static sensor_slot_t g_sensor_slots[SENSOR_MAX];
+static uint8_t g_sensor_count = 0;
+
+// 单写多读的样本环：g_sensor_ring_seq 为已写入的样本总数
+static sensor_sample_t g_sensor_ring[SENSOR_RING_LEN];
+static uint32_t g_sensor_ring_seq = 0;
+
+static void sensor_ring_push(uint8_t id, uint64_t now_ms, const double *value)
+{
+    uint32_t irq = osal_irq_lock();
+    sensor_sample_t *s = &g_sensor_ring[g_sensor_ring_seq % SENSOR_RING_LEN];
+    s->id = id;
+    s->t_ms = now_ms;
+    for (uint8_t i = 0; i < SENSOR_VALUE_MAX; i++)
+    {
+        s->value[i] = value[i];
+    }
+    g_sensor_ring_seq++;
+    osal_irq_restore(irq);
+}
+
+uint8_t sensor_ring_read(uint32_t *cursor, sensor_sample_t *sample)
+{
+    uint8_t ok = 0;
+    uint32_t irq = osal_irq_lock();
+    if (g_sensor_ring_seq - *cursor > SENSOR_RING_LEN)
+    {
+        *cursor = g_sensor_ring_seq - SENSOR_RING_LEN;
+    }
+    if (*cursor != g_sensor_ring_seq)
+    {
+        *sample = g_sensor_ring[*cursor % SENSOR_RING_LEN];
+        (*cursor)++;
+        ok = 1;
+    }
+    osal_irq_restore(irq);
+    return ok;
+}
+
+void sensor_sched_init(const sensor_driver_t *drivers, uint8_t count, uint64_t now_ms)
+{
+    g_sensor_drivers = drivers;
+    g_sensor_count = (count > SENSOR_MAX) ? SENSOR_MAX : count;
+    for (uint8_t i = 0; i < g_sensor_count; i++)
+    {
+        g_sensor_slots[i].state = SENSOR_STATE_IDLE;
+        g_sensor_slots[i].period_ms = drivers[i].period_ms;
+        g_sensor_slots[i].next_trigger_ms = now_ms;
+        g_sensor_slots[i].ready_ms = now_ms;
+    }
+}
+
+// 周期从上一次计划的触发时刻起算；落后超过一个周期时不补测，从当前时刻重新计
+static void sensor_schedule_next(sensor_slot_t *slot, uint32_t period_ms, uint64_t now_ms)
+{
+    slot->next_trigger_ms += period_ms;
+    if (slot->next_trigger_ms <= now_ms)
+    {
+        slot->next_trigger_ms = now_ms + period_ms;
+    }
+}
+
+void sensor_sched_set_period(uint8_t id, uint32_t period_ms, uint64_t now_ms)
+{
+    if (id >= g_sensor_count || g_sensor_slots[id].period_ms == period_ms)
+    {
+        return;
+    }
+    sensor_slot_t *slot = &g_sensor_slots[id];
+    slot->period_ms = period_ms;
+    if (slot->state == SENSOR_STATE_IDLE && slot->next_trigger_ms > now_ms + period_ms)
+    {
+        slot->next_trigger_ms = now_ms + period_ms;
+    }
+}
+
+uint32_t sensor_sched_step(uint64_t now_ms)
+{
+    uint64_t next_ms = now_ms + SENSOR_SCHED_IDLE_MS;
+    for (uint8_t i = 0; i < g_sensor_count; i++)
+    {
+        const sensor_driver_t *drv = &g_sensor_drivers[i];
+        sensor_slot_t *slot = &g_sensor_slots[i];
+        if (slot->state == SENSOR_STATE_IDLE && now_ms >= slot->next_trigger_ms)
+        {
+            if (drv->trigger == NULL || drv->trigger() == 0)
+            {
+                slot->state = SENSOR_STATE_WAIT;
+                slot->ready_ms = now_ms + drv->wait_ms;
+            }
+            else
+            {
+                sensor_schedule_next(slot, slot->period_ms, now_ms);
+            }
+        }
+        if (slot->state == SENSOR_STATE_WAIT && now_ms >= slot->ready_ms)
+        {
+            double value[SENSOR_VALUE_MAX] = {0};
+            if (drv->read(value) == 0)
+            {
+                sensor_ring_push(i, now_ms, value);
+            }
+            slot->state = SENSOR_STATE_IDLE;
+            sensor_schedule_next(slot, slot->period_ms, now_ms);
+        }
+        uint64_t due = (slot->state == SENSOR_STATE_WAIT) ? slot->ready_ms : slot->next_trigger_ms;
+        next_ms = (due < next_ms) ? due : next_ms;
+    }
+    return (next_ms > now_ms) ? (uint32_t)(next_ms - now_ms) : 0;
+}
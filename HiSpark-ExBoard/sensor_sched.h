@@ -0,0 +1,39 @@
+#ifndef _SENSOR_SCHED_H_
+#define _SENSOR_SCHED_H_
+#include <stddef.h>
+#include <stdint.h>
+
+// 非阻塞传感器调度：每个传感器按“触发 -> 等待转换 -> 读取”的状态机推进，各自独立周期，
+// 读到的样本带时间戳写入共享环形缓冲区，由发布、显示等任务按各自的游标读取
+#define SENSOR_MAX 4
+#define SENSOR_VALUE_MAX 2
+#define SENSOR_RING_LEN 16
+// 没有任何传感器到期时调度任务最长睡眠时间
+#define SENSOR_SCHED_IDLE_MS 1000
+
+typedef struct
+{
+    uint32_t period_ms; // 两次触发的间隔
+    uint32_t wait_ms;   // 触发到可以读取的转换时间
+    // 返回 0 表示成功；trigger 可为 NULL（无需触发，直接读取）
+    uint8_t (*trigger)(void);
+    uint8_t (*read)(double value[SENSOR_VALUE_MAX]);
+} sensor_driver_t;
+
+typedef struct
+{
+    uint8_t id;    // 在驱动表中的下标
+    uint64_t t_ms; // 读取完成的时刻
+    double value[SENSOR_VALUE_MAX];
+} sensor_sample_t;
+
+// drivers 需在调度期间保持有效，所有传感器在 now_ms 立即进行第一次测量
+void sensor_sched_init(const sensor_driver_t *drivers, uint8_t count, uint64_t now_ms);
+// 调整第 id 个传感器的触发间隔；缩短时若下一次触发已排在新间隔之后，则提前到 now_ms + period_ms
+void sensor_sched_set_period(uint8_t id, uint32_t period_ms, uint64_t now_ms);
+// 推进所有到期的状态机，返回距离下一个事件的毫秒数；只应在一个任务中调用
+uint32_t sensor_sched_step(uint64_t now_ms);
+// 读取 *cursor 之后的下一个样本，成功返回 1 并前移游标；读者落后超过环长时跳过被覆盖的样本
+uint8_t sensor_ring_read(uint32_t *cursor, sensor_sample_t *sample);
+
+#endif
@@ -14,13 +14,13 @@
 #include "sle_device_discovery.h"
 #include "sle_low_latency.h"
 #include "securec.h"
+#include <string.h>
 #include "sle_uart_server.h"
 #define OCTET_BIT_LEN           8
 #define UUID_LEN_2              2
 #define UUID_INDEX              14
 #define BT_INDEX_4              4
 #define BT_INDEX_0              0
-#define UART_BUFF_LENGTH        0x100
 
 /* 广播ID */
 #define SLE_ADV_HANDLE_DEFAULT  1
@@ -284,15 +284,208 @@ errcode_t sle_uart_server_send_report_by_uuid(const uint8_t *data, uint8_t len)
 errcode_t sle_uart_server_send_report_by_handle(const uint8_t *data, uint16_t len)
 {
     ssaps_ntf_ind_t param = {0};
-    uint8_t receive_buf[UART_BUFF_LENGTH] = { 0 }; /* max receive length. */
+    if (data == NULL || len == 0 || len > SLE_UART_SERVER_NTF_MAX_SIZE) {
+        return ERRCODE_SLE_FAIL;
+    }
+    /* 协议栈在 ssaps_notify_indicate 内部拷贝数据，无需再经过栈上缓冲区中转 */
     param.handle = g_property_handle;
     param.type = SSAP_PROPERTY_TYPE_VALUE;
-    param.value = receive_buf;
+    param.value = (uint8_t *)data;
     param.value_len = len;
-    if (memcpy_s(param.value, param.value_len, data, len) != EOK) {
+    return ssaps_notify_indicate(g_server_id, g_sle_conn_hdl, &param);
+}
+
+/* ------------------------ notify 合并发送 ------------------------- */
+#define SLE_UART_BATCH_TASK_NAME "SleBatchTask"
+#define SLE_UART_BATCH_TASK_STACK_SIZE 0x800
+#define SLE_UART_BATCH_TASK_PRIO OSAL_TASK_PRIORITY_MIDDLE
+#define SLE_UART_BATCH_EVT_PENDING 0x1
+#define SLE_UART_BATCH_EVT_URGENT 0x2
+
+typedef struct {
+    char topic[SLE_UART_BATCH_TOPIC_MAX_LEN];
+    uint8_t obj[SLE_UART_BATCH_OBJ_MAX_SIZE];
+    uint16_t len;
+    uint8_t pending;
+    uint8_t urgent;
+} sle_uart_batch_slot_t;
+
+static sle_uart_batch_slot_t g_sle_uart_batch_slot[SLE_UART_BATCH_MAX_TOPICS];
+static sle_uart_batch_stats_t g_sle_uart_batch_stats = {0};
+static uint8_t g_sle_uart_batch_buf[SLE_UART_SERVER_NTF_MAX_SIZE];
+static uint32_t g_sle_uart_batch_window_ms = SLE_UART_BATCH_WINDOW_MS_DEFAULT;
+static osal_event g_sle_uart_batch_event;
+static bool g_sle_uart_batch_inited = false;
+
+/* 调用者需持有 osal_irq_lock；返回 topic 对应槽位，没有则分配空闲槽位 */
+static sle_uart_batch_slot_t *sle_uart_batch_slot_get(const char *topic)
+{
+    sle_uart_batch_slot_t *free_slot = NULL;
+    for (uint32_t i = 0; i < SLE_UART_BATCH_MAX_TOPICS; i++) {
+        sle_uart_batch_slot_t *slot = &g_sle_uart_batch_slot[i];
+        if (slot->topic[0] == '\0') {
+            if (free_slot == NULL) {
+                free_slot = slot;
+            }
+        } else if (strncmp(slot->topic, topic, SLE_UART_BATCH_TOPIC_MAX_LEN) == 0) {
+            return slot;
+        }
+    }
+    if (free_slot != NULL) {
+        (void)strncpy_s(free_slot->topic, SLE_UART_BATCH_TOPIC_MAX_LEN, topic, SLE_UART_BATCH_TOPIC_MAX_LEN - 1);
+    }
+    return free_slot;
+}
+
+/* 把一条 notify 发出去；未连接时直接丢弃 */
+static void sle_uart_batch_send(uint16_t len)
+{
+    g_sle_uart_batch_buf[len++] = ']';
+    bool sent = sle_uart_client_is_connected() &&
+        (sle_uart_server_send_report_by_handle(g_sle_uart_batch_buf, len) == ERRCODE_SLE_SUCCESS);
+    uint32_t irq = osal_irq_lock();
+    if (sent) {
+        g_sle_uart_batch_stats.notifies++;
+        g_sle_uart_batch_stats.bytes += len;
+    } else {
+        g_sle_uart_batch_stats.dropped++;
+    }
+    osal_irq_restore(irq);
+}
+
+/*
+ * 把所有待发送的 topic 拼成 JSON 数组 [obj,obj,...] 发送，超过 MTU 时拆成多条。
+ * 紧急 topic 排在最前面。仅由合并任务调用。
+ */
+static void sle_uart_batch_flush(void)
+{
+    uint16_t len = 0;
+    for (uint32_t pass = 0; pass < 2; pass++) {
+        for (uint32_t i = 0; i < SLE_UART_BATCH_MAX_TOPICS; i++) {
+            sle_uart_batch_slot_t *slot = &g_sle_uart_batch_slot[i];
+            uint32_t irq = osal_irq_lock();
+            if (!slot->pending || (pass == 0 && !slot->urgent)) {
+                osal_irq_restore(irq);
+                continue;
+            }
+            /* '[' 或 ',' 加上结尾的 ']' 共 2 字节 */
+            if (len != 0 && len + slot->len + 2 > SLE_UART_SERVER_NTF_MAX_SIZE) {
+                osal_irq_restore(irq);
+                sle_uart_batch_send(len);
+                len = 0;
+                irq = osal_irq_lock();
+            }
+            g_sle_uart_batch_buf[len] = (len == 0) ? '[' : ',';
+            len++;
+            (void)memcpy_s(&g_sle_uart_batch_buf[len], sizeof(g_sle_uart_batch_buf) - len, slot->obj, slot->len);
+            len += slot->len;
+            slot->pending = 0;
+            slot->urgent = 0;
+            osal_irq_restore(irq);
+        }
+    }
+    if (len != 0) {
+        sle_uart_batch_send(len);
+    }
+}
+
+/* 等到有更新后再等一个合并窗口，然后全部发出 */
+static void sle_uart_batch_wait_flush(void)
+{
+    uint32_t evt = (uint32_t)osal_event_read(&g_sle_uart_batch_event,
+        SLE_UART_BATCH_EVT_PENDING | SLE_UART_BATCH_EVT_URGENT, OSAL_WAIT_FOREVER,
+        OSAL_WAITMODE_OR | OSAL_WAITMODE_CLR);
+    if ((evt & SLE_UART_BATCH_EVT_URGENT) == 0 && g_sle_uart_batch_window_ms != 0) {
+        /* 合并窗口内继续收集更新，紧急 topic 到来时提前结束窗口 */
+        (void)osal_event_read(&g_sle_uart_batch_event, SLE_UART_BATCH_EVT_URGENT,
+            g_sle_uart_batch_window_ms, OSAL_WAITMODE_OR | OSAL_WAITMODE_CLR);
+    }
+    (void)osal_event_clear(&g_sle_uart_batch_event, SLE_UART_BATCH_EVT_PENDING | SLE_UART_BATCH_EVT_URGENT);
+    sle_uart_batch_flush();
+}
+
+static int sle_uart_batch_task(void *arg)
+{
+    unused(arg);
+    while (1) {
+        sle_uart_batch_wait_flush();
+    }
+    return 0;
+}
+
+errcode_t sle_uart_server_batch_init(uint32_t window_ms)
+{
+    if (g_sle_uart_batch_inited) {
+        g_sle_uart_batch_window_ms = window_ms;
+        return ERRCODE_SLE_SUCCESS;
+    }
+    g_sle_uart_batch_window_ms = window_ms;
+    if (osal_event_init(&g_sle_uart_batch_event) != OSAL_SUCCESS) {
+        sample_at_log_print("%s batch event init fail\r\n", SLE_UART_SERVER_LOG);
         return ERRCODE_SLE_FAIL;
     }
-    return ssaps_notify_indicate(g_server_id, g_sle_conn_hdl, &param);
+
+    osal_task *task_handle = NULL;
+    osal_kthread_lock();
+    task_handle = osal_kthread_create(sle_uart_batch_task, NULL, SLE_UART_BATCH_TASK_NAME,
+        SLE_UART_BATCH_TASK_STACK_SIZE);
+    if (task_handle != NULL) {
+        osal_kthread_set_priority(task_handle, SLE_UART_BATCH_TASK_PRIO);
+        osal_kfree(task_handle);
+    }
+    osal_kthread_unlock();
+    if (task_handle == NULL) {
+        sample_at_log_print("%s batch task create fail\r\n", SLE_UART_SERVER_LOG);
+        osal_event_destroy(&g_sle_uart_batch_event);
+        return ERRCODE_SLE_FAIL;
+    }
+    g_sle_uart_batch_inited = true;
+    return ERRCODE_SLE_SUCCESS;
+}
+
+/* 可在中断中调用：只拷贝数据并置事件位，真正的发送在合并任务中完成 */
+errcode_t sle_uart_server_batch_put(const char *topic, const uint8_t *obj, uint16_t len, bool urgent)
+{
+    if (!g_sle_uart_batch_inited) {
+        return ERRCODE_SLE_FAIL;
+    }
+    if (topic == NULL || obj == NULL || len == 0 || len > SLE_UART_BATCH_OBJ_MAX_SIZE) {
+        return ERRCODE_SLE_FAIL;
+    }
+
+    uint32_t irq = osal_irq_lock();
+    sle_uart_batch_slot_t *slot = sle_uart_batch_slot_get(topic);
+    if (slot == NULL) {
+        g_sle_uart_batch_stats.dropped++;
+        osal_irq_restore(irq);
+        return ERRCODE_SLE_FAIL;
+    }
+    if (slot->pending) {
+        /* 同一 topic 在窗口内多次更新，只保留最新值 */
+        g_sle_uart_batch_stats.coalesced++;
+    }
+    (void)memcpy_s(slot->obj, sizeof(slot->obj), obj, len);
+    slot->len = len;
+    slot->pending = 1;
+    slot->urgent |= urgent ? 1 : 0;
+    g_sle_uart_batch_stats.puts++;
+    if (urgent) {
+        g_sle_uart_batch_stats.urgent++;
+    }
+    osal_irq_restore(irq);
+
+    (void)osal_event_write(&g_sle_uart_batch_event, urgent ? SLE_UART_BATCH_EVT_URGENT : SLE_UART_BATCH_EVT_PENDING);
+    return ERRCODE_SLE_SUCCESS;
+}
+
+void sle_uart_server_batch_get_stats(sle_uart_batch_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    uint32_t irq = osal_irq_lock();
+    *stats = g_sle_uart_batch_stats;
+    osal_irq_restore(irq);
 }
 
 static void sle_connect_state_changed_cbk(uint16_t conn_id, const sle_addr_t *addr,
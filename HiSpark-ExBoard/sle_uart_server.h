@@ -11,6 +11,7 @@
 #define SLE_UART_SERVER_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "sle_ssap_server.h"
 #include "errcode.h"
 #include "sle_uart_server_adv.h"
@@ -28,6 +29,14 @@ extern "C" {
 #define SLE_UART_SERVER_QUEUE_DELAY 0xFFFFFFFF
 #define SLE_UART_SERVER_BUFF_MAX_SIZE 800
 #define SLE_UART_SERVER_LOG "[sle uart server]"
+/* 单条 notify 的最大长度，不超过连接时协商的 MTU */
+#define SLE_UART_SERVER_NTF_MAX_SIZE 256
+
+/* notify 合并发送参数 */
+#define SLE_UART_BATCH_WINDOW_MS_DEFAULT 20
+#define SLE_UART_BATCH_MAX_TOPICS 8
+#define SLE_UART_BATCH_TOPIC_MAX_LEN 24
+#define SLE_UART_BATCH_OBJ_MAX_SIZE 96
 
 /* Service UUID */
 #define SLE_UUID_SERVER_SERVICE        0x2000
@@ -53,6 +62,30 @@ errcode_t sle_uart_server_send_report_by_handle(const uint8_t *data, uint16_t le
 
 uint16_t sle_uart_client_is_connected(void);
 
+typedef struct {
+    uint32_t puts;      /* sle_uart_server_batch_put 调用次数 */
+    uint32_t coalesced; /* 被同 topic 新值覆盖而省掉的更新数 */
+    uint32_t urgent;    /* 紧急更新数 */
+    uint32_t notifies;  /* 实际发出的 notify 数 */
+    uint32_t bytes;     /* 实际发出的字节数 */
+    uint32_t dropped;   /* 超长/无槽位/未连接而丢弃的次数 */
+} sle_uart_batch_stats_t;
+
+/*
+ * 启动 notify 合并任务。window_ms 内对同一 topic 的更新只保留最新值，
+ * 所有待发送 topic 拼成一个 JSON 数组 notify 发出。重复调用仅更新窗口。
+ */
+errcode_t sle_uart_server_batch_init(uint32_t window_ms);
+
+/*
+ * 提交一个 topic 的最新 JSON 对象（不含外层 []），可在中断中调用。
+ * urgent 为 true 时立即结束合并窗口并排在最前面发送，用于越限或突变的遥测；
+ * 按键求助走 alert.c 的独立通道直接发送，不经过合并。
+ */
+errcode_t sle_uart_server_batch_put(const char *topic, const uint8_t *obj, uint16_t len, bool urgent);
+
+void sle_uart_server_batch_get_stats(sle_uart_batch_stats_t *stats);
+
 typedef void (*sle_uart_server_msg_queue)(uint8_t *buffer_addr, uint16_t buffer_size);
 
 void sle_uart_server_register_msg(sle_uart_server_msg_queue sle_uart_server_msg);
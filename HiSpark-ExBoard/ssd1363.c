@@ -1,5 +1,6 @@
 #include "ssd1363.h"
 #include "ssd1363_fonts.h"
+#include "my_iic.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -11,142 +12,137 @@
 #include "gpio.h"
 #include "soc_osal.h"
 
-void IIC_delay(void)
-{
-    //uint8_t t = 1;
-    //while (t--)
-    //    ;
-}
+/* 一次数据传输的最大负载，满了就先发出；SSD1363 的显存指针在相邻传输之间连续递增 */
+#define OLED_TX_CHUNK 4096
 
-void SDA_OLED_read_mode(void)
-{
-	uapi_pin_set_mode(OLED_SDA, PIN_MODE_0);
-	uapi_pin_set_pull(OLED_SDA, PIN_PULL_TYPE_UP);
-	uapi_gpio_set_dir(OLED_SDA, GPIO_DIRECTION_INPUT);
-}
+/* 显存数据发送缓冲区：[0] 固定为 0x40 控制字节，其后是待写的显存数据 */
+static uint8_t g_oled_tx[1 + OLED_TX_CHUNK];
+static uint32_t g_oled_tx_len = 0;
 
-void SDA_OLED_send_mode(void)
+void OLED_WR_REG(uint8_t reg)
 {
-	uapi_pin_set_mode(OLED_SDA, PIN_MODE_0);
-	uapi_gpio_set_dir(OLED_SDA, GPIO_DIRECTION_OUTPUT);
+    uint8_t buf[2] = {0x00, reg};
+    iic_bus_write(OLED_ADDRESS, buf, sizeof(buf));
 }
 
-void iic_OLED_init(void)
+void OLED_WR_Byte(uint8_t dat)
 {
-	uapi_pin_set_mode(OLED_SCL, PIN_MODE_0);
-	uapi_gpio_set_dir(OLED_SCL, GPIO_DIRECTION_OUTPUT);
-	uapi_gpio_set_val(OLED_SCL, GPIO_LEVEL_LOW);
+    uint8_t buf[2] = {0x40, dat};
+    iic_bus_write(OLED_ADDRESS, buf, sizeof(buf));
 }
 
-void iic_OLED_start(void)
+/* 1bpp 半字节（4 个像素，bit0 在最左）预先展开成 SSD1363 的 4bpp 字节对，按写入顺序排列 */
+static const uint8_t g_nibble_gray[16][2] = {
+    {0x00, 0x00}, {0x00, 0x0F}, {0x00, 0xF0}, {0x00, 0xFF},
+    {0x0F, 0x00}, {0x0F, 0x0F}, {0x0F, 0xF0}, {0x0F, 0xFF},
+    {0xF0, 0x00}, {0xF0, 0x0F}, {0xF0, 0xF0}, {0xF0, 0xFF},
+    {0xFF, 0x00}, {0xFF, 0x0F}, {0xFF, 0xF0}, {0xFF, 0xFF}};
+
+static void OLED_DataFlush(void)
 {
-	SDA_OLED_send_mode();
-	uapi_gpio_set_val(OLED_SDA, GPIO_LEVEL_HIGH);
-	uapi_gpio_set_val(OLED_SCL, GPIO_LEVEL_HIGH);
-	IIC_delay();
-	uapi_gpio_set_val(OLED_SDA, GPIO_LEVEL_LOW);
-	IIC_delay();
-	uapi_gpio_set_val(OLED_SCL, GPIO_LEVEL_LOW);
-	IIC_delay();
+    if (g_oled_tx_len > 0)
+    {
+        g_oled_tx[0] = 0x40;
+        iic_bus_write(OLED_ADDRESS, g_oled_tx, g_oled_tx_len + 1);
+        g_oled_tx_len = 0;
+    }
 }
 
-void iic_OLED_stop(void)
+/* 连续写显存：数据先攒进发送缓冲区，每 OLED_TX_CHUNK 字节以 0x40 控制字节开头发一次传输 */
+static void OLED_DataBegin(void)
 {
-	SDA_OLED_send_mode();
-	uapi_gpio_set_val(OLED_SCL, GPIO_LEVEL_LOW);
-	uapi_gpio_set_val(OLED_SDA, GPIO_LEVEL_LOW);
-	IIC_delay();
-	uapi_gpio_set_val(OLED_SCL, GPIO_LEVEL_HIGH);
-	IIC_delay();
-	uapi_gpio_set_val(OLED_SDA, GPIO_LEVEL_HIGH);
-	IIC_delay();
+    g_oled_tx_len = 0;
 }
 
-void iic_OLED_ack(void)
+static void OLED_DataByte(uint8_t dat)
 {
-	uapi_gpio_set_val(OLED_SCL, GPIO_LEVEL_LOW);
-	SDA_OLED_send_mode();
-	uapi_gpio_set_val(OLED_SDA, GPIO_LEVEL_LOW);
-	IIC_delay();
-	uapi_gpio_set_val(OLED_SCL, GPIO_LEVEL_HIGH);
-	IIC_delay();
-	uapi_gpio_set_val(OLED_SCL, GPIO_LEVEL_LOW);
+    g_oled_tx[1 + g_oled_tx_len++] = dat;
+    if (g_oled_tx_len == OLED_TX_CHUNK)
+    {
+        OLED_DataFlush();
+    }
 }
 
-void iic_OLED_send_byte(uint8_t byte)
+static void OLED_DataWrite(const uint8_t *buf, uint32_t len)
 {
-	uint8_t t;
-	SDA_OLED_send_mode();
-	uapi_gpio_set_val(OLED_SCL, GPIO_LEVEL_LOW);
-	for (t = 0; t < 8; t++)
-	{
-		// IIC_SDA=(txd&0x80)>>7;
-		if ((byte & 0x80) >> 7)
-			uapi_gpio_set_val(OLED_SDA, GPIO_LEVEL_HIGH);
-		else
-			uapi_gpio_set_val(OLED_SDA, GPIO_LEVEL_LOW);
-		byte <<= 1;
-		IIC_delay();
-		uapi_gpio_set_val(OLED_SCL, GPIO_LEVEL_HIGH);
-		IIC_delay();
-		uapi_gpio_set_val(OLED_SCL, GPIO_LEVEL_LOW);
-	}
+    while (len > 0)
+    {
+        uint32_t n = OLED_TX_CHUNK - g_oled_tx_len;
+        n = (n < len) ? n : len;
+        memcpy_s(&g_oled_tx[1 + g_oled_tx_len], OLED_TX_CHUNK - g_oled_tx_len, buf, n);
+        g_oled_tx_len += n;
+        buf += n;
+        len -= n;
+        if (g_oled_tx_len == OLED_TX_CHUNK)
+        {
+            OLED_DataFlush();
+        }
+    }
 }
 
-void OLED_WR_REG(uint8_t reg)
+static void OLED_DataEnd(void)
 {
-    iic_OLED_start();
-    iic_OLED_send_byte(0x78);
-    iic_OLED_ack();
-    iic_OLED_send_byte(0x00);
-    iic_OLED_ack();
-    iic_OLED_send_byte(reg);
-    iic_OLED_ack();
-    iic_OLED_stop();
+    OLED_DataFlush();
 }
 
-void OLED_WR_Byte(uint8_t dat)
+/* 把 1bpp 字节的低 count 个半字节（1 或 2）按查表结果写出，mode 非 0 时反显 */
+static void OLED_DataBits(uint8_t bits, uint8_t count, uint8_t mode)
 {
-    iic_OLED_start();
-    iic_OLED_send_byte(0x78);
-    iic_OLED_ack();
-    iic_OLED_send_byte(0x40);
-    iic_OLED_ack();
-    iic_OLED_send_byte(dat);
-    iic_OLED_ack();
-    iic_OLED_stop();
+    uint8_t inv = mode ? 0xFF : 0x00;
+    for (uint8_t k = 0; k < count; k++)
+    {
+        const uint8_t *px = g_nibble_gray[(bits >> (k * 4)) & 0x0F];
+        OLED_DataByte(px[0] ^ inv);
+        OLED_DataByte(px[1] ^ inv);
+    }
 }
 
+/*
+ * 命令和参数合成一次传输：每个字节前带一个控制字节，0x80/0xC0 表示命令/参数且后面还有控制字节，
+ * 0x00/0x40 表示最后一段命令/参数
+ */
 void Column_Address(uint8_t a, uint8_t b)
 {
-    OLED_WR_REG(0x15); // Set Column Address
-    OLED_WR_Byte(a + 0x08);
-    OLED_WR_Byte(b + 0x08);
+    uint8_t buf[6] = {0x80, 0x15, 0xC0, a + 0x08, 0x40, b + 0x08}; // Set Column Address
+    iic_bus_write(OLED_ADDRESS, buf, sizeof(buf));
 }
 
 void Row_Address(uint8_t a, uint8_t b)
 {
-    OLED_WR_REG(0x75); // Row Column Address
-    OLED_WR_Byte(a);
-    OLED_WR_Byte(b);
-    OLED_WR_REG(0x5C); // Ð´RAMÃüÁî
+    uint8_t buf[8] = {0x80, 0x75, 0xC0, a, 0xC0, b, 0x00, 0x5C}; // Row Column Address，随后进入写 RAM
+    iic_bus_write(OLED_ADDRESS, buf, sizeof(buf));
 }
 
 void OLED_Fill(uint16_t xstr, uint16_t ystr, uint16_t xend, uint16_t yend, uint8_t color)
 {
     uint8_t x, y;
-    xstr /= 4; // column address ¿ØÖÆ4ÁÐ
+    xstr /= 4; // column address 控制4列
     xend /= 4;
     Column_Address(xstr, xend - 1);
     Row_Address(ystr, yend - 1);
+    OLED_DataBegin();
     for (x = xstr; x < xend; x++)
     {
         for (y = ystr; y < yend; y++)
         {
-            OLED_WR_Byte(color);
-            OLED_WR_Byte(color);
+            OLED_DataByte(color);
+            OLED_DataByte(color);
         }
     }
+    OLED_DataEnd();
+}
+
+/* 整个字形一次传输写入：窗口设为 sizey x sizey，每个字节展开为两个半字节的灰度对 */
+static void OLED_BlitGlyph(uint8_t x, uint8_t y, const unsigned char *msk, uint16_t bytes, uint8_t sizey, uint8_t mode)
+{
+    Column_Address(x / 4, x / 4 + sizey / 4 - 1);
+    Row_Address(y, y + sizey - 1);
+    OLED_DataBegin();
+    for (uint16_t i = 0; i < bytes; i++)
+    {
+        OLED_DataBits(msk[i], 2, mode);
+    }
+    OLED_DataEnd();
 }
 
 void OLED_ShowChinese(uint8_t x, uint8_t y, uint8_t *s, uint8_t sizey, uint8_t mode)
@@ -168,233 +164,129 @@ void OLED_ShowChinese(uint8_t x, uint8_t y, uint8_t *s, uint8_t sizey, uint8_t m
 
 void OLED_ShowChinese16x16(uint8_t x, uint8_t y, uint8_t *s, uint8_t sizey, uint8_t mode)
 {
-    uint8_t i, j, k, DATA1 = 0, DATA2 = 0;
-    uint16_t HZnum;                                           
-    uint16_t TypefaceNum;                                      
-    TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey; 
-    HZnum = sizeof(tfont16) / sizeof(typFNT_GB16);     
-    Column_Address(x / 4, x / 4 + sizey / 4 - 1);
-    Row_Address(y, y + sizey - 1);
+    uint16_t k;
+    uint16_t HZnum = sizeof(tfont16) / sizeof(typFNT_GB16);
+    uint16_t TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
     for (k = 0; k < HZnum; k++)
     {
         if ((tfont16[k].Index[0] == *(s)) && (tfont16[k].Index[1] == *(s + 1)))
         {
-            for (i = 0; i < TypefaceNum; i++)
-            {
-                for (j = 0; j < 2; j++)
-                {
-                    if (tfont16[k].Msk[i] & (0x01 << (j * 4)))
-                    {
-                        DATA1 = 0x0F;
-                    }
-                    if (tfont16[k].Msk[i] & (0x01 << (j * 4 + 1)))
-                    {
-                        DATA1 |= 0xF0;
-                    }
-                    if (tfont16[k].Msk[i] & (0x01 << (j * 4 + 2)))
-                    {
-                        DATA2 = 0x0F;
-                    }
-                    if (tfont16[k].Msk[i] & (0x01 << (j * 4 + 3)))
-                    {
-                        DATA2 |= 0xF0;
-                    }
-                    if (mode)
-                    {
-                        OLED_WR_Byte(~DATA2);
-                        OLED_WR_Byte(~DATA1);
-                    }
-                    else
-                    {
-                        OLED_WR_Byte(DATA2);
-                        OLED_WR_Byte(DATA1);
-                    }
-                    DATA1 = 0;
-                    DATA2 = 0;
-                }
-            }
+            OLED_BlitGlyph(x, y, tfont16[k].Msk, TypefaceNum, sizey, mode);
+            return;
         }
-        continue; 
     }
 }
 
 void OLED_ShowChinese24x24(uint8_t x, uint8_t y, uint8_t *s, uint8_t sizey, uint8_t mode)
 {
-    uint8_t i, j, k, DATA1 = 0, DATA2 = 0;
-    uint16_t HZnum;                                         
-    uint16_t TypefaceNum;                                     
-    TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey; 
-    HZnum = sizeof(tfont24) / sizeof(typFNT_GB24);            
-    Column_Address(x / 4, x / 4 + sizey / 4 - 1);
-    Row_Address(y, y + sizey - 1);
+    uint16_t k;
+    uint16_t HZnum = sizeof(tfont24) / sizeof(typFNT_GB24);
+    uint16_t TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
     for (k = 0; k < HZnum; k++)
     {
         if ((tfont24[k].Index[0] == *(s)) && (tfont24[k].Index[1] == *(s + 1)))
         {
-            for (i = 0; i < TypefaceNum; i++)
-            {
-                for (j = 0; j < 2; j++)
-                {
-                    if (tfont24[k].Msk[i] & (0x01 << (j * 4)))
-                    {
-                        DATA1 = 0x0F;
-                    }
-                    if (tfont24[k].Msk[i] & (0x01 << (j * 4 + 1)))
-                    {
-                        DATA1 |= 0xF0;
-                    }
-                    if (tfont24[k].Msk[i] & (0x01 << (j * 4 + 2)))
-                    {
-                        DATA2 = 0x0F;
-                    }
-                    if (tfont24[k].Msk[i] & (0x01 << (j * 4 + 3)))
-                    {
-                        DATA2 |= 0xF0;
-                    }
-                    if (mode)
-                    {
-                        OLED_WR_Byte(~DATA2);
-                        OLED_WR_Byte(~DATA1);
-                    }
-                    else
-                    {
-                        OLED_WR_Byte(DATA2);
-                        OLED_WR_Byte(DATA1);
-                    }
-                    DATA1 = 0;
-                    DATA2 = 0;
-                }
-            }
+            OLED_BlitGlyph(x, y, tfont24[k].Msk, TypefaceNum, sizey, mode);
+            return;
         }
-        continue; 
     }
 }
 
 void OLED_ShowChinese32x32(uint8_t x, uint8_t y, uint8_t *s, uint8_t sizey, uint8_t mode)
 {
-    uint8_t i, j, k, DATA1 = 0, DATA2 = 0;
-    uint16_t HZnum;                                            
-    uint16_t TypefaceNum;                                      
-    TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
-    HZnum = sizeof(tfont32) / sizeof(typFNT_GB32);           
-    Column_Address(x / 4, x / 4 + sizey / 4 - 1);
-    Row_Address(y, y + sizey - 1);
+    uint16_t k;
+    uint16_t HZnum = sizeof(tfont32) / sizeof(typFNT_GB32);
+    uint16_t TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
     for (k = 0; k < HZnum; k++)
     {
         if ((tfont32[k].Index[0] == *(s)) && (tfont32[k].Index[1] == *(s + 1)))
         {
-            for (i = 0; i < TypefaceNum; i++)
-            {
-                for (j = 0; j < 2; j++)
-                {
-                    if (tfont32[k].Msk[i] & (0x01 << (j * 4)))
-                    {
-                        DATA1 = 0x0F;
-                    }
-                    if (tfont32[k].Msk[i] & (0x01 << (j * 4 + 1)))
-                    {
-                        DATA1 |= 0xF0;
-                    }
-                    if (tfont32[k].Msk[i] & (0x01 << (j * 4 + 2)))
-                    {
-                        DATA2 = 0x0F;
-                    }
-                    if (tfont32[k].Msk[i] & (0x01 << (j * 4 + 3)))
-                    {
-                        DATA2 |= 0xF0;
-                    }
-                    if (mode)
-                    {
-                        OLED_WR_Byte(~DATA2);
-                        OLED_WR_Byte(~DATA1);
-                    }
-                    else
-                    {
-                        OLED_WR_Byte(DATA2);
-                        OLED_WR_Byte(DATA1);
-                    }
-                    DATA1 = 0;
-                    DATA2 = 0;
-                }
-            }
+            OLED_BlitGlyph(x, y, tfont32[k].Msk, TypefaceNum, sizey, mode);
+            return;
         }
-        continue;
     }
 }
 
-void OLED_ShowChar(uint8_t x, uint8_t y, uint8_t chr, uint8_t sizey, uint8_t mode)
+/* 按字号取 ASCII 字库：字模首地址、每个字符的字节数和字符个数，不支持的字号返回 1 */
+static uint8_t OLED_AsciiFont(uint8_t sizey, const unsigned char **font, uint16_t *stride, uint16_t *glyphs)
+{
+    if (sizey == 16)
+    {
+        *font = &ascii_1608[0][0];
+        *stride = sizeof(ascii_1608[0]);
+        *glyphs = sizeof(ascii_1608) / sizeof(ascii_1608[0]);
+    }
+    else if (sizey == 24)
+    {
+        *font = &ascii_2412[0][0];
+        *stride = sizeof(ascii_2412[0]);
+        *glyphs = sizeof(ascii_2412) / sizeof(ascii_2412[0]);
+    }
+    else if (sizey == 32)
+    {
+        *font = &ascii_3216[0][0];
+        *stride = sizeof(ascii_3216[0]);
+        *glyphs = sizeof(ascii_3216) / sizeof(ascii_3216[0]);
+    }
+    else
+    {
+        return 1;
+    }
+    return 0;
+}
+
+/* 一次设置整串的显示窗口，再逐行把每个字符的该行像素连续写出，整串只需一次数据传输 */
+static void OLED_ShowAscii(uint8_t x, uint8_t y, const uint8_t *dp, uint16_t n, uint8_t sizey, uint8_t mode)
 {
-    uint8_t sizex, c, temp = 0, t = 2, DATA1 = 0, DATA2 = 0, m;
-    uint16_t i, k, size2;
+    const unsigned char *font;
+    uint16_t stride;
+    uint16_t glyphs;
+    if (OLED_AsciiFont(sizey, &font, &stride, &glyphs))
+    {
+        return;
+    }
+    uint8_t sizex = sizey / 2;       // 字符宽度（像素）
+    uint8_t bpr = stride / sizey;    // 字库每行字节数
+
     x /= 4;
-    sizex = sizey / 4 / 2;                                 
-    size2 = (sizey / 16 + ((sizey % 16) ? 1 : 0)) * sizey; 
-    c = chr - ' ';                                       
-    Column_Address(x, x + sizex - 1);                     
-    Row_Address(y, y + sizey - 1);                         
-    for (i = 0; i < size2; i++)
+    Column_Address(x, x + n * sizex / 4 - 1);
+    Row_Address(y, y + sizey - 1);
+    OLED_DataBegin();
+    for (uint8_t row = 0; row < sizey; row++)
     {
-        if (sizey == 16)
-        {
-            temp = ascii_1608[c][i];
-        }
-        else if (sizey == 24)
-        {
-            temp = ascii_2412[c][i];
-        }
-        else if (sizey == 32)
+        for (uint16_t i = 0; i < n; i++)
         {
-            temp = ascii_3216[c][i];
-        }
-        if (sizey % 16)
-        {
-            m = sizey / 16 + 1;
-            if (i % m)
-                t = 1;
-            else
-                t = 2;
-        }
-        for (k = 0; k < t; k++)
-        {
-            if (temp & (0x01 << (k * 4)))
-            {
-                DATA1 = 0x0F;
-            }
-            if (temp & (0x01 << (k * 4 + 1)))
+            uint16_t c = (uint16_t)(dp[i] - ' ');
+            c = (c < glyphs) ? c : 0;
+            const unsigned char *line = font + c * stride + row * bpr;
+            uint8_t remain = sizex;
+            for (uint8_t b = 0; b < bpr; b++)
             {
-                DATA1 |= 0xF0;
+                uint8_t nibbles = (remain >= 8) ? 2 : 1;
+                OLED_DataBits(line[b], nibbles, mode);
+                remain -= nibbles * 4;
             }
-            if (temp & (0x01 << (k * 4 + 2)))
-            {
-                DATA2 = 0x0F;
-            }
-            if (temp & (0x01 << (k * 4 + 3)))
-            {
-                DATA2 |= 0xF0;
-            }
-            if (mode)
-            {
-                OLED_WR_Byte(~DATA2);
-                OLED_WR_Byte(~DATA1);
-            }
-            else
-            {
-                OLED_WR_Byte(DATA2);
-                OLED_WR_Byte(DATA1);
-            }
-            DATA1 = 0;
-            DATA2 = 0;
         }
     }
+    OLED_DataEnd();
+}
+
+void OLED_ShowChar(uint8_t x, uint8_t y, uint8_t chr, uint8_t sizey, uint8_t mode)
+{
+    OLED_ShowAscii(x, y, &chr, 1, sizey, mode);
 }
 
 void OLED_ShowString(uint8_t x, uint8_t y, uint8_t *dp, uint8_t sizey, uint8_t mode)
 {
-    while (*dp != '\0')
+    uint16_t n = 0;
+    uint16_t sizex = sizey / 2;
+    while (dp[n] != '\0' && (uint16_t)x + (n + 1) * sizex <= 256)
     {
-        OLED_ShowChar(x, y, *dp, sizey, mode);
-        dp++;
-        x += sizey / 2;
+        n++;
+    }
+    if (n > 0)
+    {
+        OLED_ShowAscii(x, y, dp, n, sizey, mode);
     }
 }
 
@@ -430,78 +322,151 @@ void OLED_ShowNum(uint8_t x, uint8_t y, uint32_t num, uint8_t len, uint8_t sizey
 void OLED_DrawBMP(uint8_t x, uint8_t y, uint16_t length, uint8_t width, const uint8_t BMP[], uint8_t mode)
 {
     uint16_t i, num;
+    uint8_t inv = mode ? 0xFF : 0x00;
     length = (length / 4 + ((length % 4) ? 1 : 0)) * 4;
     num = length * width / 2 / 2;
     x /= 4;
     length /= 4;
     Column_Address(x, x + length - 1);
     Row_Address(y, y + width - 1);
+    OLED_DataBegin();
     for (i = 0; i < num; i++)
     {
-        if (mode)
-        {
-            OLED_WR_Byte(~BMP[i * 2 + 1]);
-            OLED_WR_Byte(~BMP[i * 2]);
-        }
-        else
-        {
-            OLED_WR_Byte(BMP[i * 2 + 1]);
-            OLED_WR_Byte(BMP[i * 2]);
-        }
+        OLED_DataByte(BMP[i * 2 + 1] ^ inv);
+        OLED_DataByte(BMP[i * 2] ^ inv);
     }
+    OLED_DataEnd();
 }
 
 // 用这个，勾选字节内像素数据相反
 void OLED_DrawSingleBMP(uint8_t x, uint8_t y, uint16_t length, uint8_t width, const uint8_t BMP[], uint8_t mode)
 {
-    uint8_t t = 2, DATA1 = 0, DATA2 = 0;
-    uint16_t i, k, num = 0;
+    uint16_t i, num = 0;
     length = (length / 8 + ((length % 8) ? 1 : 0)) * 8;
     num = length / 8 * width;
     x /= 4;
     length /= 4;
     Column_Address(x, x + length - 1);
     Row_Address(y, y + width - 1);
+    OLED_DataBegin();
     for (i = 0; i < num; i++)
     {
-        for (k = 0; k < t; k++)
+        OLED_DataBits(BMP[i], 2, mode);
+    }
+    OLED_DataEnd();
+}
+
+/*
+ * 4bpp 帧缓冲，按写入 GDDRAM 的顺序存放：每行 OLED_WIDTH / 2 字节，每 2 字节对应一个列地址（4 个像素）。
+ * 一组 4 个像素 p0~p3 存为 {p3 << 4 | p2, p1 << 4 | p0}，与 g_nibble_gray 的排列一致。
+ * OLED_FB_* 只改内存并记录脏区，OLED_FB_Flush 才把脏区写到屏上；直接绘制的函数不经过帧缓冲
+ */
+static uint8_t g_oled_fb[OLED_HEIGHT][OLED_WIDTH / 2];
+
+/* 脏区：行 [y0, y1]、列地址 [c0, c1]，y0 > y1 表示没有改动。上电时屏上内容未知，初始为整屏 */
+static uint8_t g_fb_y0 = 0;
+static uint8_t g_fb_y1 = OLED_HEIGHT - 1;
+static uint8_t g_fb_c0 = 0;
+static uint8_t g_fb_c1 = OLED_WIDTH / 4 - 1;
+
+/* 写一个像素的灰度（0~15），值没变时不扩大脏区 */
+static void OLED_FB_Put(uint16_t x, uint16_t y, uint8_t gray)
+{
+    if (x >= OLED_WIDTH || y >= OLED_HEIGHT)
+    {
+        return;
+    }
+    uint8_t *p = &g_oled_fb[y][(x / 4) * 2 + ((x & 2) ? 0 : 1)];
+    uint8_t shift = (x & 1) * 4;
+    uint8_t val = (uint8_t)((*p & ~(0x0F << shift)) | ((gray & 0x0F) << shift));
+    if (val == *p)
+    {
+        return;
+    }
+    *p = val;
+    uint8_t c = x / 4;
+    g_fb_y0 = (y < g_fb_y0) ? y : g_fb_y0;
+    g_fb_y1 = (y > g_fb_y1) ? y : g_fb_y1;
+    g_fb_c0 = (c < g_fb_c0) ? c : g_fb_c0;
+    g_fb_c1 = (c > g_fb_c1) ? c : g_fb_c1;
+}
+
+/* 画 1bpp 点阵（每行 bpr 字节，bit0 在最左），置位像素为 15、其余为 0，mode 非 0 时反显 */
+static void OLED_FB_Bits(uint16_t x, uint16_t y, const uint8_t *bits, uint16_t w, uint16_t h, uint16_t bpr, uint8_t mode)
+{
+    uint8_t on = mode ? 0x00 : 0x0F;
+    for (uint16_t j = 0; j < h; j++)
+    {
+        const uint8_t *line = bits + j * bpr;
+        for (uint16_t i = 0; i < w; i++)
         {
-            if (BMP[i] & (0x01 << (k * 4)))
-            {
-                DATA1 = 0x0F;
-            }
-            if (BMP[i] & (0x01 << (k * 4 + 1)))
-            {
-                DATA1 |= 0xF0;
-            }
-            if (BMP[i] & (0x01 << (k * 4 + 2)))
-            {
-                DATA2 = 0x0F;
-            }
-            if (BMP[i] & (0x01 << (k * 4 + 3)))
-            {
-                DATA2 |= 0xF0;
-            }
-            if (mode)
-            {
-                OLED_WR_Byte(~DATA2);
-                OLED_WR_Byte(~DATA1);
-            }
-            else
-            {
-                OLED_WR_Byte(DATA2);
-                OLED_WR_Byte(DATA1);
-            }
-            DATA1 = 0;
-            DATA2 = 0;
+            OLED_FB_Put(x + i, y + j, ((line[i / 8] >> (i % 8)) & 0x01) ? on : (on ^ 0x0F));
         }
     }
 }
 
+void OLED_FB_Fill(uint16_t xstr, uint16_t ystr, uint16_t xend, uint16_t yend, uint8_t gray)
+{
+    for (uint16_t y = ystr; y < yend; y++)
+    {
+        for (uint16_t x = xstr; x < xend; x++)
+        {
+            OLED_FB_Put(x, y, gray);
+        }
+    }
+}
+
+void OLED_FB_ShowString(uint16_t x, uint16_t y, const uint8_t *dp, uint8_t sizey, uint8_t mode)
+{
+    const unsigned char *font;
+    uint16_t stride;
+    uint16_t glyphs;
+    if (OLED_AsciiFont(sizey, &font, &stride, &glyphs))
+    {
+        return;
+    }
+    uint8_t sizex = sizey / 2;
+    while (*dp != '\0' && x + sizex <= OLED_WIDTH)
+    {
+        uint16_t c = (uint16_t)(*dp - ' ');
+        c = (c < glyphs) ? c : 0;
+        OLED_FB_Bits(x, y, font + c * stride, sizex, sizey, stride / sizey, mode);
+        x += sizex;
+        dp++;
+    }
+}
+
+void OLED_FB_DrawSingleBMP(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t BMP[], uint8_t mode)
+{
+    OLED_FB_Bits(x, y, BMP, length, width, (length + 7) / 8, mode);
+}
+
+/* 只把脏区所在的行和列地址范围开成窗口，逐行从帧缓冲拷出写入 */
+void OLED_FB_Flush(void)
+{
+    if (g_fb_y0 > g_fb_y1)
+    {
+        return;
+    }
+    uint16_t bytes = (g_fb_c1 - g_fb_c0 + 1) * 2;
+    Column_Address(g_fb_c0, g_fb_c1);
+    Row_Address(g_fb_y0, g_fb_y1);
+    OLED_DataBegin();
+    for (uint16_t y = g_fb_y0; y <= g_fb_y1; y++)
+    {
+        OLED_DataWrite(&g_oled_fb[y][g_fb_c0 * 2], bytes);
+    }
+    OLED_DataEnd();
+    g_fb_y0 = OLED_HEIGHT;
+    g_fb_y1 = 0;
+    g_fb_c0 = OLED_WIDTH / 4;
+    g_fb_c1 = 0;
+}
+
 // OLEDµÄ³õÊ¼»¯
 void OLED_Init(void)
 {
-    iic_OLED_init();
+    iic_bus_init();
     OLED_WR_REG(0xfd); /*Command Lock*/
     OLED_WR_Byte(0x12);
 
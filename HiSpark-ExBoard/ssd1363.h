@@ -9,6 +9,10 @@
 
 #define OLED_SDA 15
 #define OLED_SCL 16
+#define OLED_ADDRESS 0x3C // 7 位地址，写地址为 0x78
+
+#define OLED_WIDTH 256
+#define OLED_HEIGHT 128
 
 void OLED_WR_REG(uint8_t reg);//Ð´ÈëÒ»¸öÖ¸Áî
 void OLED_WR_Byte(uint8_t dat);//Ð´ÈëÒ»¸öÊý¾Ý
@@ -27,4 +31,10 @@ void OLED_DrawBMP(uint8_t x,uint8_t y,uint16_t length,uint8_t width,const uint8_
 void OLED_DrawSingleBMP(uint8_t x,uint8_t y,uint16_t length,uint8_t width,const uint8_t BMP[],uint8_t mode);//ÏÔÊ¾µ¥É«Í¼Æ¬
 void OLED_Init(void);
 
+// 帧缓冲绘制：只改内存，gray 为 0~15 的灰度，mode 非 0 时反显；OLED_FB_Flush 只发送改动过的区域
+void OLED_FB_Fill(uint16_t xstr, uint16_t ystr, uint16_t xend, uint16_t yend, uint8_t gray);
+void OLED_FB_ShowString(uint16_t x, uint16_t y, const uint8_t *dp, uint8_t sizey, uint8_t mode);
+void OLED_FB_DrawSingleBMP(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t BMP[], uint8_t mode);
+void OLED_FB_Flush(void);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include "telemetry.h"
+
+void telemetry_init(telemetry_metric_t *m)
+{
+    m->sampled = 0;
+    m->reported = 0;
+    m->zone = 0;
+    m->last_value = 0.0;
+    m->last_ms = 0;
+    m->sent_value = 0.0;
+    m->sent_ms = 0;
+}
+
+static double telemetry_abs(double v)
+{
+    return (v < 0) ? -v : v;
+}
+
+static int8_t telemetry_zone(const telemetry_rule_t *r, double value)
+{
+    if (r->low > r->high)
+    {
+        return 0;
+    }
+    if (value < r->low)
+    {
+        return -1;
+    }
+    return (value > r->high) ? 1 : 0;
+}
+
+static telemetry_action_t telemetry_decide(const telemetry_metric_t *m, const telemetry_rule_t *r, double value,
+                                           uint64_t now_ms, uint8_t force)
+{
+    if (force || !m->reported)
+    {
+        return TELEMETRY_HEARTBEAT;
+    }
+    if (telemetry_zone(r, value) != m->zone)
+    {
+        return TELEMETRY_URGENT;
+    }
+    if (r->rate > 0 && m->sampled && now_ms > m->last_ms &&
+        telemetry_abs(value - m->last_value) * 1000.0 >= r->rate * (double)(now_ms - m->last_ms))
+    {
+        return TELEMETRY_URGENT;
+    }
+    uint64_t elapsed = now_ms - m->sent_ms;
+    if (telemetry_abs(value - m->sent_value) >= r->deadband && elapsed >= r->min_ms)
+    {
+        return TELEMETRY_CHANGE;
+    }
+    return (elapsed >= r->max_ms) ? TELEMETRY_HEARTBEAT : TELEMETRY_SKIP;
+}
+
+telemetry_action_t telemetry_update(telemetry_metric_t *m, const telemetry_rule_t *r, double value, uint64_t now_ms,
+                                    uint8_t force)
+{
+    telemetry_action_t action = telemetry_decide(m, r, value, now_ms, force);
+    if (action != TELEMETRY_SKIP)
+    {
+        m->reported = 1;
+        m->zone = telemetry_zone(r, value);
+        m->sent_value = value;
+        m->sent_ms = now_ms;
+    }
+    m->sampled = 1;
+    m->last_value = value;
+    m->last_ms = now_ms;
+    return action;
+}
@@ -0,0 +1,42 @@
+#ifndef _TELEMETRY_H_
+#define _TELEMETRY_H_
+#include <stddef.h>
+#include <stdint.h>
+
+// 变化触发的上报判定：每个指标只在变化超过死区、越过阈值、变化过快或太久没报时才上报，
+// 其余样本只更新内部状态。本模块只做判定，不关心发送方式
+typedef struct
+{
+    double deadband; // 与上次上报值之差达到该值时上报
+    double rate;     // 相邻两个样本的变化率（每秒）达到该值时立即上报，0 表示不检查
+    double low;      // 越过 [low, high] 边界时立即上报，low > high 表示不检查
+    double high;
+    uint32_t min_ms; // 普通变化两次上报的最小间隔，立即上报不受限制
+    uint32_t max_ms; // 超过该时间没有上报时无论是否变化都上报一次
+} telemetry_rule_t;
+
+typedef enum
+{
+    TELEMETRY_SKIP,      // 不上报
+    TELEMETRY_HEARTBEAT, // 首次、超时或强制上报，数值未必变化
+    TELEMETRY_CHANGE,    // 超过死区的普通变化
+    TELEMETRY_URGENT,    // 越过阈值或变化过快，应立即发送
+} telemetry_action_t;
+
+typedef struct
+{
+    uint8_t sampled;  // 是否收到过样本
+    uint8_t reported; // 是否上报过
+    int8_t zone;      // 上次上报值相对阈值区间的位置：-1 低于、0 区间内、1 高于
+    double last_value;
+    uint64_t last_ms;
+    double sent_value;
+    uint64_t sent_ms;
+} telemetry_metric_t;
+
+void telemetry_init(telemetry_metric_t *m);
+// 送入一个样本，返回是否以及为何上报；返回值不为 TELEMETRY_SKIP 时视为已上报。force 非 0 时必定上报
+telemetry_action_t telemetry_update(telemetry_metric_t *m, const telemetry_rule_t *r, double value, uint64_t now_ms,
+                                    uint8_t force);
+
+#endif
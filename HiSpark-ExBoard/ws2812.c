@@ -1,20 +1,29 @@
 #include "ws2812.h"
-#include <math.h>
-#include <stdlib.h>
 #include <string.h>
-#include <stdarg.h>
-#include <stdio.h>
-#include <unistd.h>
-#include <securec.h>
 #include "pinctrl.h"
 #include "gpio.h"
 #include "soc_osal.h"
 #include "spi.h"
-
-float hue = 0;
-uint8_t led_mode_flag = 0;
-uint8_t r[LED_COUNT], g[LED_COUNT], b[LED_COUNT];
-uint8_t spi_data[LED_COUNT][24];
+#include "tcxo.h"
+#include "common_def.h"
+
+// 整条灯带的 SPI 数据：每颗灯 24 字节（GRB，高位在前），末尾补低电平作为复位/锁存，一次 DMA 发完
+static uint8_t g_ws2812_tx[LED_COUNT * WS2812_BYTES_PER_LED + WS2812_RESET_BYTES] __attribute__((aligned(4)));
+// 每个字节值对应的 8 个 SPI 字节，1 码为 0xF8，0 码为 0xC0
+static uint8_t g_ws2812_lut[256][8];
+// 本帧由效果函数写入，上一帧用于比较哪些灯变了
+static ws2812_rgb_t g_ws2812_frame[LED_COUNT];
+static ws2812_rgb_t g_ws2812_shown[LED_COUNT];
+static uint8_t g_ws2812_valid = 0; // g_ws2812_shown 是否已与灯带一致
+
+static ws2812_effect_t g_ws2812_effect = NULL;
+static void *g_ws2812_arg = NULL;
+static uint32_t g_ws2812_frame_no = 0;
+static uint16_t g_ws2812_frame_ms = WS2812_FRAME_MS;
+static uint64_t g_ws2812_last_ms = 0;
+
+// ws2812_next 的两种内置模式
+static ws2812_rgb_t g_ws2812_solid;
 
 void spi_gpio_init(void)
 {
@@ -23,6 +32,17 @@ void spi_gpio_init(void)
     uapi_pin_set_mode(SPI_CLK_PIN, 3);
 }
 
+static void ws2812_lut_init(void)
+{
+    for (uint16_t v = 0; v < 256; v++)
+    {
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            g_ws2812_lut[v][i] = (v & (0x80 >> i)) ? 0xF8 : 0xC0;
+        }
+    }
+}
+
 void spi_init(void)
 {
     spi_attr_t config = {0};
@@ -44,143 +64,145 @@ void spi_init(void)
     ext_config.tx_use_dma = true;
     spi_gpio_init();
     uapi_spi_init(SPI_ID, &config, &ext_config);
+
+    ws2812_lut_init();
+    memset(g_ws2812_tx, 0, sizeof(g_ws2812_tx));
+    g_ws2812_valid = 0;
 }
 
-void ws2812_send_rgb(uint8_t led_num)
+// 整数 HSV 转 RGB：h 为 0~359，s、v 为 0~255
+void ws2812_hsv2rgb(uint16_t h, uint8_t s, uint8_t v, ws2812_rgb_t *rgb)
 {
-    spi_xfer_data_t data;
-    data.tx_bytes = 24;
-
-    for (uint8_t i = 0; i < led_num; i++)
+    h %= 360;
+    uint8_t region = (uint8_t)(h / 60);
+    uint32_t rem = (uint32_t)(h % 60) * 255 / 60;
+    uint8_t p = (uint8_t)((uint32_t)v * (255 - s) / 255);
+    uint8_t q = (uint8_t)((uint32_t)v * (255 - (uint32_t)s * rem / 255) / 255);
+    uint8_t t = (uint8_t)((uint32_t)v * (255 - (uint32_t)s * (255 - rem) / 255) / 255);
+
+    switch (region)
     {
-        data.tx_buff = spi_data[i];
-        uapi_spi_master_write(SPI_ID, &data, 0xFFFFFFFF);
+    case 0:
+        rgb->r = v, rgb->g = t, rgb->b = p;
+        break;
+    case 1:
+        rgb->r = q, rgb->g = v, rgb->b = p;
+        break;
+    case 2:
+        rgb->r = p, rgb->g = v, rgb->b = t;
+        break;
+    case 3:
+        rgb->r = p, rgb->g = q, rgb->b = v;
+        break;
+    case 4:
+        rgb->r = t, rgb->g = p, rgb->b = v;
+        break;
+    default:
+        rgb->r = v, rgb->g = p, rgb->b = q;
+        break;
     }
 }
 
-void ws2812_reset(void)
+void ws2812_set_effect(ws2812_effect_t effect, void *arg)
 {
-    uint8_t reset_data[300] = {0}; // todo
-    spi_xfer_data_t data;
-    data.tx_buff = reset_data;
-    data.tx_bytes = 300;
-    uapi_spi_master_write(SPI_ID, &data, 0xFFFFFFFF);
+    if (effect != g_ws2812_effect)
+    {
+        // 切换效果时从第 0 帧开始，并立即出下一帧
+        g_ws2812_frame_no = 0;
+        g_ws2812_last_ms = 0;
+    }
+    g_ws2812_effect = effect;
+    g_ws2812_arg = arg;
 }
 
-// HSV转RGB函数
-void hsl2rgb(float h, float s, float l, uint8_t *r, uint8_t *g, uint8_t *b)
+void ws2812_set_frame_ms(uint16_t frame_ms)
 {
-    float c, x, m;
-    float r1, g1, b1;
+    g_ws2812_frame_ms = (frame_ms == 0) ? 1 : frame_ms;
+}
 
-    if (s == 0)
+// 只重新编码颜色变了的灯；返回是否有变化
+static uint8_t ws2812_encode(void)
+{
+    uint8_t changed = 0;
+    for (uint16_t i = 0; i < LED_COUNT; i++)
     {
-        *r = *g = *b = (uint8_t)(l * 255);
-        return;
+        const ws2812_rgb_t *c = &g_ws2812_frame[i];
+        if (g_ws2812_valid && memcmp(c, &g_ws2812_shown[i], sizeof(*c)) == 0)
+        {
+            continue;
+        }
+        uint8_t *p = &g_ws2812_tx[i * WS2812_BYTES_PER_LED];
+        memcpy(p, g_ws2812_lut[c->g], 8);
+        memcpy(p + 8, g_ws2812_lut[c->r], 8);
+        memcpy(p + 16, g_ws2812_lut[c->b], 8);
+        g_ws2812_shown[i] = *c;
+        changed = 1;
     }
+    g_ws2812_valid = 1;
+    return changed;
+}
 
-    c = (1 - fabs(2 * l - 1)) * s;
-    h /= 60;
-    x = c * (1 - fabs(fmod(h, 2) - 1));
-    m = l - c / 2;
-
-    if (h >= 0 && h < 1)
-    {
-        r1 = c;
-        g1 = x;
-        b1 = 0;
-    }
-    else if (h >= 1 && h < 2)
-    {
-        r1 = x;
-        g1 = c;
-        b1 = 0;
-    }
-    else if (h >= 2 && h < 3)
-    {
-        r1 = 0;
-        g1 = c;
-        b1 = x;
-    }
-    else if (h >= 3 && h < 4)
+uint32_t ws2812_poll(void)
+{
+    if (g_ws2812_effect == NULL)
     {
-        r1 = 0;
-        g1 = x;
-        b1 = c;
+        return g_ws2812_frame_ms;
     }
-    else if (h >= 4 && h < 5)
+    uint64_t now = uapi_tcxo_get_ms();
+    if (g_ws2812_last_ms != 0 && now - g_ws2812_last_ms < g_ws2812_frame_ms)
     {
-        r1 = x;
-        g1 = 0;
-        b1 = c;
+        return (uint32_t)(g_ws2812_frame_ms - (now - g_ws2812_last_ms));
     }
-    else
+    g_ws2812_last_ms = now;
+
+    g_ws2812_effect(g_ws2812_frame, LED_COUNT, g_ws2812_frame_no++, g_ws2812_arg);
+    if (ws2812_encode())
     {
-        r1 = c;
-        g1 = 0;
-        b1 = x;
+        spi_xfer_data_t data = {0};
+        data.tx_buff = g_ws2812_tx;
+        data.tx_bytes = sizeof(g_ws2812_tx);
+        uapi_spi_master_write(SPI_ID, &data, 0xFFFFFFFF);
     }
-
-    *r = (uint8_t)((r1 + m) * 255);
-    *g = (uint8_t)((g1 + m) * 255);
-    *b = (uint8_t)((b1 + m) * 255);
+    // 整条发送约 3ms（8MHz），从下一帧的间隔里扣掉
+    uint64_t spent = uapi_tcxo_get_ms() - now;
+    return (spent >= g_ws2812_frame_ms) ? 1 : (uint32_t)(g_ws2812_frame_ms - spent);
 }
 
-void rgb2spi(uint16_t r, uint16_t g, uint16_t b, uint16_t now_pos)
+// 整条灯带同色，色相每帧加 1，亮度与原先 HSL(l = 0.1) 一致
+void ws2812_effect_rainbow(ws2812_rgb_t *pixels, uint16_t count, uint32_t frame, void *arg)
 {
-    // 转换G分量（高位在前）
-    for (int i = 0; i < 8; i++)
-    {
-        spi_data[now_pos][i] = (g & (1 << (7 - i))) ? 0xF8 : 0xC0;
-    }
-
-    // 转换R分量
-    for (int i = 0; i < 8; i++)
+    unused(arg);
+    ws2812_rgb_t c;
+    ws2812_hsv2rgb((uint16_t)(frame % 360), 255, 51, &c);
+    for (uint16_t i = 0; i < count; i++)
     {
-        spi_data[now_pos][8 + i] = (r & (1 << (7 - i))) ? 0xF8 : 0xC0;
+        pixels[i] = c;
     }
+}
 
-    // 转换B分量
-    for (int i = 0; i < 8; i++)
+// arg 指向 ws2812_rgb_t
+void ws2812_effect_solid(ws2812_rgb_t *pixels, uint16_t count, uint32_t frame, void *arg)
+{
+    unused(frame);
+    const ws2812_rgb_t *c = (const ws2812_rgb_t *)arg;
+    for (uint16_t i = 0; i < count; i++)
     {
-        spi_data[now_pos][16 + i] = (b & (1 << (7 - i))) ? 0xF8 : 0xC0;
+        pixels[i] = *c;
     }
 }
 
-void ws2812_next(uint16_t mode,uint16_t red,uint16_t green, uint16_t blue)
+uint32_t ws2812_next(uint16_t mode, uint16_t red, uint16_t green, uint16_t blue)
 {
     if (mode == 0)
     {
-        if (led_mode_flag != mode)
-        {
-            hue = 0;
-            led_mode_flag = mode;
-        }
-        for (int i = 0; i < LED_COUNT; i++)
-        {
-            // float led_hue = fmod(hue + i * 12, 360.0);
-            hsl2rgb(hue, 1.0, 0.1, r + i, g + i, b + i);
-            rgb2spi(r[i], g[i], b[i], i);
-        }
-        ws2812_send_rgb(LED_COUNT);
-        //        for (int i = 0; i < LED_COUNT; i++)
-        //            osal_printk("\t\trgb: %d.%d.%d\n", r[i], g[i], b[i]);
-        //        osal_printk("\n\n");
-        // ws2812_reset();
-        hue = fmod(hue + 1, 360.0); // 色相变化
+        ws2812_set_effect(ws2812_effect_rainbow, NULL);
     }
     else if (mode == 1)
     {
-        if (led_mode_flag != mode)
-        {
-            hue = 0;
-            led_mode_flag = mode;
-        }
-        for (int i = 0; i < LED_COUNT; i++)
-        {
-            rgb2spi(red, green, blue, i);
-        }
-        ws2812_send_rgb(LED_COUNT);
-        // ws2812_reset();不用清空
+        g_ws2812_solid.r = (uint8_t)red;
+        g_ws2812_solid.g = (uint8_t)green;
+        g_ws2812_solid.b = (uint8_t)blue;
+        ws2812_set_effect(ws2812_effect_solid, &g_ws2812_solid);
     }
+    return ws2812_poll();
 }
@@ -20,12 +20,33 @@
 #define SPI_TMOD 0
 #define SPI_WAIT_CYCLES 0x10
 
+// 8MHz 下每个 SPI 字节 1us，一个数据位用一个字节表示
+#define WS2812_BYTES_PER_LED 24
+// 帧尾保持低电平 300us，满足新旧批次 WS2812 的复位时间
+#define WS2812_RESET_BYTES 300
+// 默认帧间隔，效果函数每帧调用一次
+#define WS2812_FRAME_MS 5
+
+typedef struct
+{
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} ws2812_rgb_t;
+
+// 效果函数：把第 frame 帧的颜色写进 pixels[0..count)，颜色没变的灯不会重新编码，整帧没变则不发送
+typedef void (*ws2812_effect_t)(ws2812_rgb_t *pixels, uint16_t count, uint32_t frame, void *arg);
+
 void spi_gpio_init(void);
 void spi_init(void);
-void ws2812_send_rgb(uint8_t led_num);
-void ws2812_reset(void);
-void hsl2rgb(float h, float s, float l, uint8_t *r, uint8_t *g, uint8_t *b);
-void rgb2spi(uint16_t r, uint16_t g, uint16_t b, uint16_t now_pos);
-void ws2812_next(uint16_t mode,uint16_t red,uint16_t green, uint16_t blue);
+void ws2812_hsv2rgb(uint16_t h, uint8_t s, uint8_t v, ws2812_rgb_t *rgb);
+void ws2812_set_effect(ws2812_effect_t effect, void *arg);
+void ws2812_set_frame_ms(uint16_t frame_ms);
+// 到帧间隔时生成一帧并在有变化时整条发送；返回距下一帧到期的毫秒数（至少 1），调用方可以睡这么久再调用
+uint32_t ws2812_poll(void);
+void ws2812_effect_rainbow(ws2812_rgb_t *pixels, uint16_t count, uint32_t frame, void *arg);
+void ws2812_effect_solid(ws2812_rgb_t *pixels, uint16_t count, uint32_t frame, void *arg);
+// mode 0：彩虹渐变；mode 1：整条显示 red/green/blue；返回值同 ws2812_poll
+uint32_t ws2812_next(uint16_t mode,uint16_t red,uint16_t green, uint16_t blue);
 
 #endif
\ No newline at end of file
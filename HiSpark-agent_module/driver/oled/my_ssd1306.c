@@ -34,8 +34,16 @@
 #define SSD1306_MASK_CONT (0x1 << 7)
 #define DOUBLE 2
 #define SSD1306_INVERSE_COLOR
+/* 一页的寻址命令：页地址、列地址低 4 位、列地址高 4 位 */
+#define SSD1306_PAGE_CMD_LEN 3
 #if defined(SSD1306_USE_I2C)
 
+/*
+ * 发送缓冲区：一页最多 3 条寻址命令（各带 Co=1 的控制字节）+ 1 个数据控制字节 + 一整页数据，
+ * 整页在一次 I2C 事务中发出。静态分配，避免每次在栈上拷贝。
+ */
+static uint8_t g_ssd1306_tx_buf[SSD1306_PAGE_CMD_LEN * DOUBLE + 1 + SSD1306_WIDTH];
+
 void ssd1306_Reset(void)
 {
     /* for I2C - do nothing */
@@ -68,21 +76,38 @@ void ssd1306_WriteCommand(uint8_t byte)
     ssd1306_WiteByte(SSD1306_CTRL_CMD, byte);
 }
 
-// Send data
+// Send data: 一个 Co=0 的数据控制字节之后的字节全部按数据写入 GDDRAM
 void ssd1306_WriteData(uint8_t *buffer, uint32_t buff_size)
 {
-    uint8_t data[SSD1306_WIDTH * DOUBLE] = {0};
-    for (uint32_t i = 0; i < buff_size; i++)
+    if (buff_size == 0 || buff_size > SSD1306_WIDTH)
     {
-        data[i * DOUBLE] = SSD1306_CTRL_DATA | SSD1306_MASK_CONT;
-        data[i * DOUBLE + 1] = buffer[i];
+        return;
     }
-    data[(buff_size - 1) * DOUBLE] = SSD1306_CTRL_DATA;
-    ssd1306_SendData(data, sizeof(data));
+    g_ssd1306_tx_buf[0] = SSD1306_CTRL_DATA;
+    memcpy_s(&g_ssd1306_tx_buf[1], sizeof(g_ssd1306_tx_buf) - 1, buffer, buff_size);
+    ssd1306_SendData(g_ssd1306_tx_buf, buff_size + 1);
+}
+
+// 设置页/列地址并写入 len 字节数据，合并为一次 I2C 事务
+static void ssd1306_WritePage(uint8_t page, uint8_t col, const uint8_t *buffer, uint32_t len)
+{
+    uint8_t column = col + SSD1306_X_OFFSET;
+    uint32_t n = 0;
+    g_ssd1306_tx_buf[n++] = SSD1306_CTRL_CMD | SSD1306_MASK_CONT;
+    g_ssd1306_tx_buf[n++] = 0xB0 + page; // Set the current RAM page address.
+    g_ssd1306_tx_buf[n++] = SSD1306_CTRL_CMD | SSD1306_MASK_CONT;
+    g_ssd1306_tx_buf[n++] = 0x00 + (column & 0x0F);
+    g_ssd1306_tx_buf[n++] = SSD1306_CTRL_CMD | SSD1306_MASK_CONT;
+    g_ssd1306_tx_buf[n++] = 0x10 + ((column >> 4) & 0x07);
+    g_ssd1306_tx_buf[n++] = SSD1306_CTRL_DATA;
+    memcpy_s(&g_ssd1306_tx_buf[n], sizeof(g_ssd1306_tx_buf) - n, buffer, len);
+    ssd1306_SendData(g_ssd1306_tx_buf, n + len);
 }
 
 #elif defined(SSD1306_USE_SPI)
 
+#define SSD1306_DC_PIN 12
+
 void ssd1306_Reset(void)
 {
     // CS = High (not selected)
@@ -97,21 +122,26 @@ void ssd1306_Reset(void)
     osal_mdelay(10);
 }
 
-static uint32_t ssd1306_SendData(uint8_t *buffer, uint32_t size)
+// 在已拉低的 CS 下发送一段数据，uapi_spi_master_write 返回时传输已完成，无需额外延时
+static uint32_t ssd1306_SpiWrite(const uint8_t *buffer, uint32_t size)
 {
     spi_xfer_data_t data = {0};
-    data.tx_buff = buffer;
+    data.tx_buff = (uint8_t *)buffer;
     data.tx_bytes = size;
-    uapi_gpio_set_val(CONFIG_SPI_CS_MASTER_PIN, GPIO_LEVEL_LOW);
     uint32_t ret = uapi_spi_master_write(CONFIG_SPI_MASTER_BUS_ID, &data, 0xFFFFFFFF);
     if (ret != 0)
     {
         printf("spi = %0x master send failed\r\n", ret);
-        return ret;
     }
-    osal_mdelay(1);
+    return ret;
+}
+
+static uint32_t ssd1306_SendData(uint8_t *buffer, uint32_t size)
+{
+    uapi_gpio_set_val(CONFIG_SPI_CS_MASTER_PIN, GPIO_LEVEL_LOW);
+    uint32_t ret = ssd1306_SpiWrite(buffer, size);
     uapi_gpio_set_val(CONFIG_SPI_CS_MASTER_PIN, GPIO_LEVEL_HIGH);
-    return 0;
+    return ret;
 }
 
 static uint32_t ssd1306_WiteByte(uint8_t byte)
@@ -123,21 +153,28 @@ static uint32_t ssd1306_WiteByte(uint8_t byte)
 // Send a byte to the command register
 void ssd1306_WriteCommand(uint8_t byte)
 {
-    uapi_gpio_set_val(12, GPIO_LEVEL_LOW);
+    uapi_gpio_set_val(SSD1306_DC_PIN, GPIO_LEVEL_LOW);
     ssd1306_WiteByte(byte);
 }
 
 // Send data
 void ssd1306_WriteData(uint8_t *buffer, uint32_t buff_size)
 {
-    uapi_gpio_set_val(12, GPIO_LEVEL_HIGH);
-    uint8_t data[SSD1306_WIDTH] = {0};
-    for (uint32_t i = 0; i < buff_size; i++)
-    {
-        data[i] = buffer[i];
-    }
-    // data[(buff_size - 1) * DOUBLE] = SSD1306_CTRL_DATA;
-    ssd1306_SendData(data, sizeof(data));
+    uapi_gpio_set_val(SSD1306_DC_PIN, GPIO_LEVEL_HIGH);
+    ssd1306_SendData(buffer, buff_size);
+}
+
+// 设置页/列地址并写入 len 字节数据：CS 保持拉低，仅在命令与数据之间切换 DC
+static void ssd1306_WritePage(uint8_t page, uint8_t col, const uint8_t *buffer, uint32_t len)
+{
+    uint8_t column = col + SSD1306_X_OFFSET;
+    uint8_t cmd[SSD1306_PAGE_CMD_LEN] = {0xB0 + page, 0x00 + (column & 0x0F), 0x10 + ((column >> 4) & 0x07)};
+    uapi_gpio_set_val(CONFIG_SPI_CS_MASTER_PIN, GPIO_LEVEL_LOW);
+    uapi_gpio_set_val(SSD1306_DC_PIN, GPIO_LEVEL_LOW);
+    ssd1306_SpiWrite(cmd, sizeof(cmd));
+    uapi_gpio_set_val(SSD1306_DC_PIN, GPIO_LEVEL_HIGH);
+    ssd1306_SpiWrite(buffer, len);
+    uapi_gpio_set_val(CONFIG_SPI_CS_MASTER_PIN, GPIO_LEVEL_HIGH);
 }
 
 #else
@@ -146,6 +183,9 @@ void ssd1306_WriteData(uint8_t *buffer, uint32_t buff_size)
 
 // Screenbuffer
 static uint8_t SSD1306_Buffer[SSD1306_BUFFER_SIZE];
+// 屏幕 GDDRAM 当前内容的影子副本，UpdateScreen 只发送与之不同的列范围
+static uint8_t SSD1306_Shadow[SSD1306_BUFFER_SIZE];
+static uint8_t SSD1306_ShadowValid = 0;
 
 // Screen object
 static SSD1306_t SSD1306;
@@ -199,6 +239,7 @@ void ssd1306_Init(void)
 {
     // Reset OLED
     ssd1306_Reset();
+    ssd1306_InvalidateScreen();
     // Init OLED
     ssd1306_SetDisplayOn(0); // display off
 
@@ -276,6 +317,11 @@ void ssd1306_Fill(SSD1306_COLOR color)
     }
 }
 
+void ssd1306_InvalidateScreen(void)
+{
+    SSD1306_ShadowValid = 0;
+}
+
 // Write the screenbuffer with changed to the screen
 void ssd1306_UpdateScreen(void)
 {
@@ -285,13 +331,32 @@ void ssd1306_UpdateScreen(void)
     //  * 32px   ==  4 pages
     //  * 64px   ==  8 pages
     //  * 128px  ==  16 pages
+    // 每页只发送首个到最后一个变化列之间的数据，未变化的页直接跳过
     for (uint8_t i = 0; i < SSD1306_HEIGHT / 8; i++)
     {
-        ssd1306_WriteCommand(0xB0 + i); // Set the current RAM page address.
-        ssd1306_WriteCommand(0x00 + SSD1306_X_OFFSET_LOWER);
-        ssd1306_WriteCommand(0x10 + SSD1306_X_OFFSET_UPPER);
-        ssd1306_WriteData(&SSD1306_Buffer[SSD1306_WIDTH * i], SSD1306_WIDTH);
+        uint8_t *page = &SSD1306_Buffer[SSD1306_WIDTH * i];
+        uint8_t *shadow = &SSD1306_Shadow[SSD1306_WIDTH * i];
+        uint32_t first = 0;
+        uint32_t last = SSD1306_WIDTH - 1;
+        if (SSD1306_ShadowValid)
+        {
+            if (memcmp(page, shadow, SSD1306_WIDTH) == 0)
+            {
+                continue;
+            }
+            while (page[first] == shadow[first])
+            {
+                first++;
+            }
+            while (page[last] == shadow[last])
+            {
+                last--;
+            }
+        }
+        ssd1306_WritePage(i, (uint8_t)first, &page[first], last - first + 1);
+        memcpy_s(&shadow[first], SSD1306_WIDTH - first, &page[first], last - first + 1);
     }
+    SSD1306_ShadowValid = 1;
 }
 
 //    Draw one pixel in the screenbuffer
@@ -324,6 +389,40 @@ void ssd1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color)
     }
 }
 
+// Copy one pre-rasterized glyph into the screenbuffer a column at a time
+static void ssd1306_BlitGlyph(const uint8_t *glyph, uint8_t w, uint8_t h, uint8_t x, uint8_t y, SSD1306_COLOR color)
+{
+    const uint32_t c = 8;
+    uint32_t pages = (h + c - 1) / c;
+    uint32_t shift = y % c;
+    uint32_t first = y / c;
+    uint32_t last = (y + h - 1) / c;
+    uint64_t mask = ((((uint64_t)1) << h) - 1) << shift;
+
+    for (uint32_t col = 0; col < w; col++)
+    {
+        uint64_t bits = 0;
+        for (uint32_t p = 0; p < pages; p++)
+        {
+            bits |= (uint64_t)glyph[col * pages + p] << (p * c);
+        }
+        if (color == Black)
+        {
+            bits = ~bits;
+        }
+        bits = (bits << shift) & mask;
+
+        uint8_t *dst = &SSD1306_Buffer[first * SSD1306_WIDTH + x + col];
+        for (uint32_t page = first; page <= last; page++)
+        {
+            uint32_t s = (page - first) * c;
+            uint8_t m = (uint8_t)(mask >> s);
+            *dst = (uint8_t)((*dst & ~m) | (uint8_t)(bits >> s));
+            dst += SSD1306_WIDTH;
+        }
+    }
+}
+
 // Draw 1 char to the screen buffer
 // ch       => char om weg te schrijven
 // Font     => Font waarmee we gaan schrijven
@@ -347,19 +446,29 @@ char ssd1306_DrawChar(char ch, FontDef Font, SSD1306_COLOR color)
         return 0;
     }
 
-    // Use the font to write
-    for (i = 0; i < Font.FontHeight; i++)
+    if (Font.cols != NULL)
+    {
+        // Pre-rasterized font: whole columns straight into the page buffer
+        uint32_t glyph_size = Font.FontWidth * ((Font.FontHeight + 7) / 8);
+        ssd1306_BlitGlyph(&Font.cols[((uint32_t)ch - ch_min) * glyph_size], Font.FontWidth, Font.FontHeight,
+                          SSD1306.CurrentX, SSD1306.CurrentY, color);
+    }
+    else
     {
-        b = Font.data[(ch - ch_min) * Font.FontHeight + i];
-        for (j = 0; j < Font.FontWidth; j++)
+        // Use the font to write
+        for (i = 0; i < Font.FontHeight; i++)
         {
-            if ((b << j) & 0x8000)
-            {
-                ssd1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i), (SSD1306_COLOR)color);
-            }
-            else
+            b = Font.data[(ch - ch_min) * Font.FontHeight + i];
+            for (j = 0; j < Font.FontWidth; j++)
             {
-                ssd1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i), (SSD1306_COLOR)!color);
+                if ((b << j) & 0x8000)
+                {
+                    ssd1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i), (SSD1306_COLOR)color);
+                }
+                else
+                {
+                    ssd1306_DrawPixel(SSD1306.CurrentX + j, (SSD1306.CurrentY + i), (SSD1306_COLOR)!color);
+                }
             }
         }
     }
@@ -374,6 +483,28 @@ char ssd1306_DrawChar(char ch, FontDef Font, SSD1306_COLOR color)
 // Write full string to screenbuffer
 char ssd1306_DrawString(char *str, FontDef Font, SSD1306_COLOR color)
 {
+    // Lay the string out once: clip to the glyphs that fit, then blit them back to back
+    if (Font.cols != NULL && Font.FontWidth != 0 && SSD1306.CurrentY + Font.FontHeight <= SSD1306_HEIGHT &&
+        SSD1306.CurrentX <= SSD1306_WIDTH)
+    {
+        const uint32_t ch_min = 32;
+        const uint32_t ch_max = 126;
+        uint32_t glyph_size = Font.FontWidth * ((Font.FontHeight + 7) / 8);
+        uint32_t room = (SSD1306_WIDTH - SSD1306.CurrentX) / Font.FontWidth;
+        char *p = str;
+        for (; *p && room > 0; p++, room--)
+        {
+            if ((uint32_t)*p < ch_min || (uint32_t)*p > ch_max)
+            {
+                return *p;
+            }
+            ssd1306_BlitGlyph(&Font.cols[((uint32_t)*p - ch_min) * glyph_size], Font.FontWidth, Font.FontHeight,
+                              SSD1306.CurrentX, SSD1306.CurrentY, color);
+            SSD1306.CurrentX += Font.FontWidth;
+        }
+        return *p;
+    }
+
     // Write until null-byte
     char *str1 = str;
     while (*str1)
@@ -514,6 +645,34 @@ void ssd1306_DrawRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD13
     ssd1306_DrawLine(x1, y2, x1, y1, color);
 }
 
+// Fill rectangle (inclusive corners), written a page byte at a time
+void ssd1306_FillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color)
+{
+    const uint32_t c = 8;
+    uint8_t xs = (x1 < x2) ? x1 : x2;
+    uint8_t xe = (x1 < x2) ? x2 : x1;
+    uint8_t ys = (y1 < y2) ? y1 : y2;
+    uint8_t ye = (y1 < y2) ? y2 : y1;
+    if (xs >= SSD1306_WIDTH || ys >= SSD1306_HEIGHT)
+    {
+        return;
+    }
+    xe = (xe < SSD1306_WIDTH) ? xe : (SSD1306_WIDTH - 1);
+    ye = (ye < SSD1306_HEIGHT) ? ye : (SSD1306_HEIGHT - 1);
+
+    for (uint32_t page = ys / c; page <= ye / c; page++)
+    {
+        uint32_t top = (page == ys / c) ? (ys % c) : 0;
+        uint32_t bottom = (page == ye / c) ? (ye % c) : (c - 1);
+        uint8_t mask = (uint8_t)((0xFFu << top) & (0xFFu >> (c - 1 - bottom)));
+        uint8_t *row = &SSD1306_Buffer[page * SSD1306_WIDTH];
+        for (uint32_t x = xs; x <= xe; x++)
+        {
+            row[x] = (color == White) ? (uint8_t)(row[x] | mask) : (uint8_t)(row[x] & ~mask);
+        }
+    }
+}
+
 void ssd1306_DrawBitmap(const uint8_t *bitmap, uint32_t size)
 {
     unsigned int c = 8;
@@ -533,6 +692,47 @@ void ssd1306_DrawBitmap(const uint8_t *bitmap, uint32_t size)
     }
 }
 
+/* 差分流格式与 tools/gen_oled_frames.py 保持一致 */
+#define SSD1306_DELTA_SKIP_FLAG 0x80
+#define SSD1306_DELTA_FILL_FLAG 0x40
+#define SSD1306_DELTA_SKIP_MASK 0x7F
+#define SSD1306_DELTA_RUN_MASK 0x3F
+
+void ssd1306_ApplyDelta(const uint8_t *delta, uint32_t len)
+{
+    uint32_t pos = 0;
+    uint32_t i = 0;
+    while (i < len && pos < SSD1306_BUFFER_SIZE)
+    {
+        uint8_t op = delta[i++];
+        if (op & SSD1306_DELTA_SKIP_FLAG)
+        {
+            pos += (op & SSD1306_DELTA_SKIP_MASK) + 1;
+            continue;
+        }
+        uint32_t run = (op & SSD1306_DELTA_RUN_MASK) + 1;
+        uint32_t room = SSD1306_BUFFER_SIZE - pos;
+        if (op & SSD1306_DELTA_FILL_FLAG)
+        {
+            if (i >= len)
+            {
+                break;
+            }
+            (void)memset_s(&SSD1306_Buffer[pos], room, delta[i++], run);
+        }
+        else
+        {
+            if (i + run > len)
+            {
+                break;
+            }
+            (void)memcpy_s(&SSD1306_Buffer[pos], room, &delta[i], run);
+            i += run;
+        }
+        pos += run;
+    }
+}
+
 void ssd1306_DrawRegion(uint8_t x, uint8_t y, uint8_t w, const uint8_t *data, uint32_t size)
 {
     uint32_t stride = w;
@@ -37,6 +37,7 @@
  */
 
 #include "my_ssd1306_fonts.h"
+#include "oled_fonts_packed.h" /* 页格式字形列，由 tools/gen_oled_fonts.py 生成 */
 
 /************************************6*8的点阵************************************/
 const unsigned char g_f6X8[][6] = {
@@ -813,7 +814,7 @@ static const unsigned short Font6x8[] = {
     0x4000, 0xa800, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // ~
 };
 
-FontDef Font_7x10 = {7, 10, Font7x10};
-FontDef Font_6x8 = {6, 8, Font6x8};
-FontDef Font_11x18 = {11, 18, Font11x18};
-FontDef Font_16x26 = {16, 26, Font16x26};
\ No newline at end of file
+FontDef Font_7x10 = {7, 10, Font7x10, Font7x10Cols};
+FontDef Font_6x8 = {6, 8, Font6x8, Font6x8Cols};
+FontDef Font_11x18 = {11, 18, Font11x18, Font11x18Cols};
+FontDef Font_16x26 = {16, 26, Font16x26, Font16x26Cols};
\ No newline at end of file
@@ -38,6 +38,35 @@
 static const uint8_t g_p_server_addr[6] = P_SERVER_ADDR_INIT;
 static const uint8_t g_e_server_addr[6] = E_SERVER_ADDR_INIT;
 
+/* 发送队列：每个连接一个 TX 环形队列，发送信用由 write_cfm 回调归还 */
+#define SLE_UART_TX_QUEUE_LEN 16
+#define SLE_UART_TX_CREDITS 4
+#define SLE_UART_INVALID_CONN_ID 0xFFFF
+/* 置 1 时以 DEBUG 级别打印发送内容，默认关闭（逐条打印 payload 会占用数毫秒串口时间） */
+#ifndef SLE_UART_CLIENT_LOG_PAYLOAD
+#define SLE_UART_CLIENT_LOG_PAYLOAD 0
+#endif
+#define SLE_UART_CLIENT_LOG_PAYLOAD_MAX 64
+
+typedef struct
+{
+    uint8_t *buf; /* osal_vmalloc 分配，由发送队列负责释放 */
+    uint16_t len;
+    uint8_t client_id;
+} sle_uart_tx_item_t;
+
+typedef struct
+{
+    uint16_t conn_id; /* SLE_UART_INVALID_CONN_ID 表示空闲 */
+    uint8_t credits;  /* 可立即下发的写请求数 */
+    uint8_t busy;     /* 已有线程在 pump 此队列 */
+    uint8_t head;
+    uint8_t count;
+    uint32_t sent;
+    uint32_t dropped;
+    sle_uart_tx_item_t items[SLE_UART_TX_QUEUE_LEN];
+} sle_uart_tx_queue_t;
+
 static ssapc_find_service_result_t g_sle_uart_find_service_result = {0};
 static sle_announce_seek_callbacks_t g_sle_uart_seek_cbk = {0};
 static sle_connection_callbacks_t g_sle_uart_connect_cbk = {0};
@@ -46,6 +75,7 @@ static sle_addr_t g_sle_uart_remote_addr = {0};
 ssapc_write_param_t g_sle_uart_send_param = {0};
 uint16_t g_sle_uart_conn_id[SLE_UART_CLIENT_MAX_CON] = {0};
 uint16_t g_sle_uart_conn_num = 0;
+static sle_uart_tx_queue_t g_sle_uart_tx_queue[SLE_UART_CLIENT_MAX_CON];
 
 static char identify_server_type(const sle_addr_t *addr)
 {
@@ -69,6 +99,125 @@ ssapc_write_param_t *get_g_sle_uart_send_param(void)
     return &g_sle_uart_send_param;
 }
 
+/* 调用者需持有 osal_irq_lock */
+static sle_uart_tx_queue_t *sle_uart_tx_queue_find(uint16_t conn_id)
+{
+    for (uint16_t i = 0; i < SLE_UART_CLIENT_MAX_CON; i++)
+    {
+        if (g_sle_uart_tx_queue[i].conn_id == conn_id)
+        {
+            return &g_sle_uart_tx_queue[i];
+        }
+    }
+    return NULL;
+}
+
+/* 丢弃队列中尚未发送的数据并释放缓冲区，conn_id 置为 new_conn_id */
+static void sle_uart_tx_queue_reset(uint16_t conn_id, uint16_t new_conn_id)
+{
+    sle_uart_tx_item_t pending[SLE_UART_TX_QUEUE_LEN];
+    uint8_t pending_cnt = 0;
+
+    uint32_t irq = osal_irq_lock();
+    sle_uart_tx_queue_t *q = sle_uart_tx_queue_find(conn_id);
+    if (q != NULL)
+    {
+        while (q->count > 0)
+        {
+            pending[pending_cnt++] = q->items[q->head];
+            q->head = (uint8_t)((q->head + 1) % SLE_UART_TX_QUEUE_LEN);
+            q->count--;
+        }
+        q->conn_id = new_conn_id;
+        q->credits = SLE_UART_TX_CREDITS;
+        q->busy = 0;
+        q->head = 0;
+        q->sent = 0;
+        q->dropped = 0;
+    }
+    osal_irq_restore(irq);
+
+    for (uint8_t i = 0; i < pending_cnt; i++)
+    {
+        osal_vfree(pending[i].buf);
+    }
+}
+
+/* 为新连接占用一个空闲队列；已有队列时直接复用，没有空闲队列时返回 ERRCODE_FAIL */
+static errcode_t sle_uart_tx_queue_open(uint16_t conn_id)
+{
+    uint32_t irq = osal_irq_lock();
+    bool exists = (sle_uart_tx_queue_find(conn_id) != NULL);
+    osal_irq_restore(irq);
+    if (!exists)
+    {
+        sle_uart_tx_queue_reset(SLE_UART_INVALID_CONN_ID, conn_id);
+        irq = osal_irq_lock();
+        exists = (sle_uart_tx_queue_find(conn_id) != NULL);
+        osal_irq_restore(irq);
+    }
+    return exists ? ERRCODE_SUCC : ERRCODE_FAIL;
+}
+
+/*
+ * 在有发送信用时把队头数据交给协议栈。ssapc_write_req 返回时数据已被协议栈拷贝，
+ * 缓冲区可立即释放；信用在对应的 write_cfm 到达后归还。
+ * busy 标志保证同一队列只有一个线程在下发，从而保持报文顺序。
+ */
+static void sle_uart_tx_pump(uint16_t conn_id)
+{
+    uint32_t irq = osal_irq_lock();
+    sle_uart_tx_queue_t *q = sle_uart_tx_queue_find(conn_id);
+    if (q == NULL || q->busy)
+    {
+        osal_irq_restore(irq);
+        return;
+    }
+    q->busy = 1;
+
+    while (1)
+    {
+        if (q->count == 0 || q->credits == 0 || q->conn_id != conn_id)
+        {
+            q->busy = 0;
+            osal_irq_restore(irq);
+            return;
+        }
+        sle_uart_tx_item_t item = q->items[q->head];
+        q->head = (uint8_t)((q->head + 1) % SLE_UART_TX_QUEUE_LEN);
+        q->count--;
+        q->credits--;
+        osal_irq_restore(irq);
+
+        ssapc_write_param_t param = g_sle_uart_send_param;
+        param.data = item.buf;
+        param.data_len = item.len;
+        param.type = SSAP_PROPERTY_TYPE_VALUE;
+        errcode_t ret = ssapc_write_req(item.client_id, conn_id, &param);
+#if SLE_UART_CLIENT_LOG_PAYLOAD
+        log_debug("sent[%u]:%.*s\r\n", conn_id,
+                  (item.len > SLE_UART_CLIENT_LOG_PAYLOAD_MAX) ? SLE_UART_CLIENT_LOG_PAYLOAD_MAX : item.len,
+                  (const char *)item.buf);
+#endif
+        osal_vfree(item.buf);
+
+        irq = osal_irq_lock();
+        if (ret != ERRCODE_SUCC)
+        {
+            /* 请求未进入协议栈，不会有 write_cfm，立即归还信用 */
+            q->credits++;
+            q->dropped++;
+            osal_irq_restore(irq);
+            log_error("%s write_req fail conn_id:%d ret:0x%x\r\n", SLE_UART_CLIENT_LOG, conn_id, ret);
+            irq = osal_irq_lock();
+        }
+        else
+        {
+            q->sent++;
+        }
+    }
+}
+
 void sle_uart_start_scan(void)
 {
     sle_seek_param_t param = {0};
@@ -164,6 +313,11 @@ static void sle_uart_client_sample_connect_state_changed_cbk(uint16_t conn_id, c
             g_sle_uart_conn_id[g_sle_uart_conn_num] = conn_id;
             g_sle_uart_conn_num++;
         }
+        if (sle_uart_tx_queue_open(conn_id) != ERRCODE_SUCC)
+        {
+            /* 所有发送队列都被占用，此连接上的发送都会失败 */
+            log_error("%s no tx queue for conn_id:%d\r\n", SLE_UART_CLIENT_LOG, conn_id);
+        }
         ssap_exchange_info_t info = {0};
         info.mtu_size = SLE_MTU_SIZE_DEFAULT;
         info.version = 1;
@@ -198,6 +352,7 @@ static void sle_uart_client_sample_connect_state_changed_cbk(uint16_t conn_id, c
         {
             g_sle_uart_conn_num--;
         }
+        sle_uart_tx_queue_reset(conn_id, SLE_UART_INVALID_CONN_ID);
         /* Clear mapping if it matches */
         char srv_type = identify_server_type(addr);
         if (srv_type)
@@ -285,8 +440,20 @@ static void sle_uart_client_sample_find_structure_cmp_cbk(uint8_t client_id, uin
 static void sle_uart_client_sample_write_cfm_cb(uint8_t client_id, uint16_t conn_id,
                                                 ssapc_write_result_t *write_result, errcode_t status)
 {
-    osal_printk("%s sle_uart_client_sample_write_cfm_cb, conn_id:%d client id:%d status:%d handle:%02x type:%02x\r\n",
-                SLE_UART_CLIENT_LOG, conn_id, client_id, status, write_result->handle, write_result->type);
+    if (status != ERRCODE_SUCC)
+    {
+        osal_printk("%s sle_uart_client_sample_write_cfm_cb, conn_id:%d client id:%d status:%d handle:%02x type:%02x\r\n",
+                    SLE_UART_CLIENT_LOG, conn_id, client_id, status, write_result->handle, write_result->type);
+    }
+    /* 归还一个发送信用，并继续下发排队中的数据 */
+    uint32_t irq = osal_irq_lock();
+    sle_uart_tx_queue_t *q = sle_uart_tx_queue_find(conn_id);
+    if (q != NULL && q->credits < SLE_UART_TX_CREDITS)
+    {
+        q->credits++;
+    }
+    osal_irq_restore(irq);
+    sle_uart_tx_pump(conn_id);
 }
 
 static void sle_uart_client_sample_ssapc_cbk_register(ssapc_notification_callback notification_cb,
@@ -302,29 +469,84 @@ static void sle_uart_client_sample_ssapc_cbk_register(ssapc_notification_callbac
     ssapc_register_callbacks(&g_sle_uart_ssapc_cbk);
 }
 
-errcode_t sle_uart_client_send_data(const uint8_t *data, uint16_t len, uint16_t client_id, uint16_t conn_id)
+errcode_t sle_uart_client_send_data_owned(uint8_t *data, uint16_t len, uint16_t client_id, uint16_t conn_id)
 {
-    /* Directly send data to the specified conn_id */
-    ssapc_write_param_t *param = get_g_sle_uart_send_param();
+    if (data == NULL || len == 0)
+    {
+        if (data != NULL)
+        {
+            osal_vfree(data);
+        }
+        return ERRCODE_INVALID_PARAM;
+    }
 
-    uint8_t *send_buf = (uint8_t *)osal_vmalloc(len);
-    memcpy_s(send_buf, len, data, len);
+    uint32_t irq = osal_irq_lock();
+    sle_uart_tx_queue_t *q = (conn_id == SLE_UART_INVALID_CONN_ID) ? NULL : sle_uart_tx_queue_find(conn_id);
+    if (q == NULL || q->count >= SLE_UART_TX_QUEUE_LEN)
+    {
+        if (q != NULL)
+        {
+            q->dropped++;
+        }
+        osal_irq_restore(irq);
+        osal_vfree(data);
+        return ERRCODE_FAIL;
+    }
+    sle_uart_tx_item_t *item = &q->items[(q->head + q->count) % SLE_UART_TX_QUEUE_LEN];
+    item->buf = data;
+    item->len = len;
+    item->client_id = (uint8_t)client_id;
+    q->count++;
+    osal_irq_restore(irq);
+
+    sle_uart_tx_pump(conn_id);
+    return ERRCODE_SUCC;
+}
+
+errcode_t sle_uart_client_get_tx_stats(uint16_t conn_id, sle_uart_tx_stats_t *stats)
+{
+    if (stats == NULL)
+    {
+        return ERRCODE_INVALID_PARAM;
+    }
+    uint32_t irq = osal_irq_lock();
+    sle_uart_tx_queue_t *q = (conn_id == SLE_UART_INVALID_CONN_ID) ? NULL : sle_uart_tx_queue_find(conn_id);
+    if (q != NULL)
+    {
+        stats->queued = q->count;
+        stats->credits = q->credits;
+        stats->sent = q->sent;
+        stats->dropped = q->dropped;
+    }
+    osal_irq_restore(irq);
+    return (q != NULL) ? ERRCODE_SUCC : ERRCODE_FAIL;
+}
 
-    param->data = send_buf;
-    param->data_len = len;
-    param->type = SSAP_PROPERTY_TYPE_VALUE;
+errcode_t sle_uart_client_send_data(const uint8_t *data, uint16_t len, uint16_t client_id, uint16_t conn_id)
+{
+    if (data == NULL || len == 0)
+    {
+        return ERRCODE_INVALID_PARAM;
+    }
 
-    errcode_t ret = ssapc_write_req(client_id, conn_id, param);
-    log_info("sent:%s\r\n", data);
-    osal_vfree(send_buf);
+    uint8_t *send_buf = (uint8_t *)osal_vmalloc(len);
+    if (send_buf == NULL)
+    {
+        return ERRCODE_FAIL;
+    }
+    (void)memcpy_s(send_buf, len, data, len);
 
-    return ret;
+    return sle_uart_client_send_data_owned(send_buf, len, client_id, conn_id);
 }
 
 void sle_uart_client_init(ssapc_notification_callback notification_cb, ssapc_indication_callback indication_cb)
 {
     (void)osal_msleep(1000); /* 延时5s，等待SLE初始化完毕 */
     osal_printk("[SLE Client] try enable.\r\n");
+    for (uint16_t i = 0; i < SLE_UART_CLIENT_MAX_CON; i++)
+    {
+        g_sle_uart_tx_queue[i].conn_id = SLE_UART_INVALID_CONN_ID;
+    }
     sle_uart_client_sample_seek_cbk_register();
     sle_uart_client_sample_connect_cbk_register();
     sle_uart_client_sample_ssapc_cbk_register(notification_cb, indication_cb);
@@ -23,13 +23,11 @@
 #define SSD1306_USE_I2C
 // #define SSD1306_USE_SPI
 
-#ifdef SSD1306_X_OFFSET
+#ifndef SSD1306_X_OFFSET
+#define SSD1306_X_OFFSET 0
+#endif
 #define SSD1306_X_OFFSET_LOWER (SSD1306_X_OFFSET & 0x0F)
 #define SSD1306_X_OFFSET_UPPER ((SSD1306_X_OFFSET >> 4) & 0x07)
-#else
-#define SSD1306_X_OFFSET_LOWER 0
-#define SSD1306_X_OFFSET_UPPER 0
-#endif
 
 // SSD1306 OLED height in pixels
 #ifndef SSD1306_HEIGHT
@@ -80,6 +78,10 @@ void ssd1306_Init(void);
 void ssd1306_Fill(SSD1306_COLOR color);
 void ssd1306_SetCursor(uint8_t x, uint8_t y);
 void ssd1306_UpdateScreen(void);
+/**
+ * @brief Forget what is on the panel so the next ssd1306_UpdateScreen rewrites every page.
+ */
+void ssd1306_InvalidateScreen(void);
 
 char ssd1306_DrawChar(char ch, FontDef Font, SSD1306_COLOR color);
 char ssd1306_DrawString(char *str, FontDef Font, SSD1306_COLOR color);
@@ -88,9 +90,16 @@ void ssd1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color);
 void ssd1306_DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color);
 void ssd1306_DrawPolyline(const SSD1306_VERTEX *par_vertex, uint16_t par_size, SSD1306_COLOR color);
 void ssd1306_DrawRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color);
+void ssd1306_FillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, SSD1306_COLOR color);
 void ssd1306_DrawCircle(uint8_t par_x, uint8_t par_y, uint8_t par_r, SSD1306_COLOR par_color);
 void ssd1306_DrawBitmap(const uint8_t *bitmap, uint32_t size);
 void ssd1306_DrawRegion(uint8_t x, uint8_t y, uint8_t w, const uint8_t *data, uint32_t size);
+/**
+ * @brief Patch the frame buffer in place with a delta stream (see tools/gen_oled_frames.py).
+ * @param[in] delta encoded skip/literal/fill records against the current buffer.
+ * @param[in] len length of the delta stream in bytes.
+ */
+void ssd1306_ApplyDelta(const uint8_t *delta, uint32_t len);
 
 /**
  * @brief Sets the contrast of the display.
@@ -114,7 +123,7 @@ uint8_t ssd1306_GetDisplayOn(void);
 // Low-level procedures
 void ssd1306_Reset(void);
 void ssd1306_WriteCommand(uint8_t byte);
-void ssd1306_WriteData(uint8_t *buffer, size_t buff_size);
+void ssd1306_WriteData(uint8_t *buffer, uint32_t buff_size);
 SSD1306_Error_t ssd1306_FillBuffer(uint8_t *buf, uint32_t len);
 void ssd1306_ClearOLED(void);
 void ssd1306_printf(char *fmt, ...);
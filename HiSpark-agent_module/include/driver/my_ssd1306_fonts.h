@@ -44,6 +44,7 @@ typedef struct {
     const unsigned char FontWidth; /*!< Font width in pixels */
     unsigned char FontHeight;      /*!< Font height in pixels */
     const unsigned short *data;    /*!< Pointer to data font data array */
+    const unsigned char *cols;     /*!< Page-native glyph columns, ceil(height/8) bytes per column */
 } FontDef;
 
 extern FontDef Font_7x10;
@@ -13,8 +13,31 @@
 
 void sle_uart_client_init(ssapc_notification_callback notification_cb, ssapc_indication_callback indication_cb);
 
+typedef struct
+{
+    uint8_t queued;   /* 队列中等待下发的条数 */
+    uint8_t credits;  /* 当前可立即下发的写请求数 */
+    uint32_t sent;    /* 已被 ssapc_write_req 接受的条数 */
+    uint32_t dropped; /* 队列满或 ssapc_write_req 失败而丢弃的条数 */
+} sle_uart_tx_stats_t;
+
+/*
+ * 拷贝 data 后放入 conn_id 对应的发送队列，立即返回。
+ * 返回 ERRCODE_SUCC 只表示已入队，不表示已发出：之后 ssapc_write_req 失败时只打印错误日志并计入
+ * dropped，不会再通知调用者，需要确认送达的调用者应通过 sle_uart_client_get_tx_stats 查看。
+ * 连接不存在、未分到发送队列或队列已满时返回 ERRCODE_FAIL。
+ */
 errcode_t sle_uart_client_send_data(const uint8_t *data, uint16_t len, uint16_t client_id, uint16_t conn_id);
 
+/*
+ * 零拷贝发送：data 必须由 osal_vmalloc 分配，调用后所有权转移给发送队列，
+ * 无论成功与否调用者都不得再访问或释放该缓冲区。返回值含义同 sle_uart_client_send_data。
+ */
+errcode_t sle_uart_client_send_data_owned(uint8_t *data, uint16_t len, uint16_t client_id, uint16_t conn_id);
+
+/* 读取 conn_id 发送队列的计数，连接断开时计数清零；conn_id 没有发送队列时返回 ERRCODE_FAIL */
+errcode_t sle_uart_client_get_tx_stats(uint16_t conn_id, sle_uart_tx_stats_t *stats);
+
 void sle_uart_start_scan(void);
 
 uint16_t get_g_sle_uart_conn_id(void);
@@ -0,0 +1,166 @@
+/* 由 tools/gen_oled_frames.py 生成，请勿手工修改 */
+/* 原始帧 17408 字节，编码后 2159 字节 */
+#ifndef OLED_FRAMES_PACKED_H
+#define OLED_FRAMES_PACKED_H
+#include <stdint.h>
+
+static const uint8_t g_oled_eye_key[354] = {
+    0x5B, 0xFF, 0x42, 0x3F, 0x46, 0xCF, 0x50, 0x3F, 0x01, 0xCF, 0xCF, 0x51, 0xF3, 0x01, 0xCF, 0xCF,
+    0x45, 0x3F, 0x4D, 0xCF, 0x46, 0x3F, 0x6A, 0xFF, 0x08, 0x7F, 0x7F, 0x8F, 0x8F, 0x83, 0xF3, 0xF3,
+    0xFD, 0xFD, 0x42, 0xFE, 0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0x44, 0xFE, 0x0A, 0xFF, 0xFE, 0xFD, 0xFD,
+    0xF3, 0xF3, 0xB3, 0x8F, 0x8F, 0x7F, 0x7F, 0x5E, 0xFF, 0x42, 0x03, 0x01, 0xFC, 0xFC, 0x49, 0xFF,
+    0x01, 0x3F, 0x3F, 0x44, 0x0F, 0x03, 0x01, 0x01, 0x81, 0x81, 0x4C, 0xF1, 0x05, 0x8F, 0x0F, 0x1F,
+    0x1F, 0x7F, 0x7F, 0x49, 0xFF, 0x05, 0x7F, 0x7F, 0x1F, 0x1F, 0x0F, 0x8F, 0x4C, 0xF1, 0x03, 0x81,
+    0x81, 0x01, 0x01, 0x44, 0x0F, 0x01, 0x3F, 0x3F, 0x49, 0xFF, 0x01, 0xFC, 0xFC, 0x42, 0x03, 0x59,
+    0xFF, 0x81, 0x48, 0xFF, 0x05, 0x3F, 0x3F, 0x07, 0x07, 0x01, 0x01, 0x84, 0x05, 0xF0, 0xF0, 0xFE,
+    0xFE, 0xFF, 0xFF, 0x43, 0xC1, 0x01, 0xF1, 0xF1, 0x47, 0xFF, 0x0E, 0xFE, 0xFE, 0xF2, 0xF0, 0xF8,
+    0x01, 0x01, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F, 0x3F, 0x01, 0x01, 0x42, 0xF0, 0x03, 0xFE, 0xFE, 0xFF,
+    0xDF, 0x42, 0xC1, 0x01, 0xF1, 0xF1, 0x48, 0xFF, 0x03, 0xFE, 0xFE, 0xF0, 0xF0, 0x84, 0x05, 0x01,
+    0x01, 0x07, 0x07, 0x3F, 0x3F, 0x48, 0xFF, 0x81, 0x57, 0xFF, 0x81, 0x48, 0xFF, 0x05, 0xFE, 0xFE,
+    0xF8, 0xF8, 0xC0, 0xC0, 0x84, 0x03, 0x07, 0x07, 0x3F, 0x3F, 0x4F, 0xFF, 0x13, 0x3F, 0x3F, 0x07,
+    0x87, 0x87, 0xC0, 0xC0, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFE, 0xC0, 0xC0, 0x87, 0x87, 0x07, 0x3F,
+    0x3F, 0x4F, 0xFF, 0x03, 0x3F, 0x3F, 0x07, 0x07, 0x84, 0x05, 0xC0, 0xC0, 0xF8, 0xF8, 0xFE, 0xFE,
+    0x48, 0xFF, 0x81, 0x59, 0xFF, 0x42, 0xFC, 0x01, 0x03, 0x03, 0x4B, 0xFF, 0x44, 0xF8, 0x43, 0xE0,
+    0x4C, 0xE7, 0x03, 0xF8, 0xF8, 0xFE, 0xFE, 0x4D, 0xFF, 0x04, 0xFE, 0xFE, 0xFC, 0xF8, 0xE2, 0x4B,
+    0xE7, 0x43, 0xE0, 0x44, 0xF8, 0x4B, 0xFF, 0x01, 0x03, 0x03, 0x42, 0xFC, 0x5E, 0xFF, 0x08, 0xF8,
+    0xF8, 0xE7, 0xE7, 0xC7, 0x9F, 0x9F, 0x7F, 0x7F, 0x48, 0xFF, 0x01, 0x7F, 0x7F, 0x46, 0x9F, 0x45,
+    0x7F, 0x73, 0xFF, 0x08, 0x7F, 0x7F, 0x9F, 0x9F, 0x8F, 0xE7, 0xE7, 0xF8, 0xF8, 0x68, 0xFF, 0x01,
+    0xFE, 0xFE, 0x44, 0xF3, 0x05, 0xF1, 0xF1, 0xF3, 0xF3, 0xFE, 0xFE, 0x46, 0xFF, 0x48, 0xFC, 0x01,
+    0xF3, 0xF3, 0x51, 0xCF, 0x01, 0xF3, 0xF3, 0x4E, 0xFC, 0x00, 0xF1, 0x4A, 0xF3, 0x01, 0xFE, 0xFE,
+    0x55, 0xFF,
+};
+
+static const uint8_t g_oled_eye_delta[598] = {
+    0xFF, 0x9B, 0x42, 0xFE, 0xC9, 0x00, 0xFD, 0x81, 0x00, 0xB3, 0xB1, 0x01, 0x3F, 0x3F, 0x44, 0x0F,
+    0x03, 0x01, 0x01, 0x81, 0x81, 0x4C, 0xF1, 0x05, 0x8F, 0x0F, 0x1F, 0x1F, 0x7F, 0x7F, 0x89, 0x05,
+    0x7F, 0x7F, 0x1F, 0x1F, 0x0F, 0x8F, 0x4C, 0xF1, 0x03, 0x81, 0x81, 0x01, 0x01, 0x44, 0x0F, 0x01,
+    0x3F, 0x3F, 0xB3, 0x05, 0x3F, 0x3F, 0x07, 0x07, 0x01, 0x01, 0x44, 0x00, 0x03, 0xF0, 0xF0, 0xFE,
+    0xFE, 0x81, 0x43, 0xC1, 0x01, 0xF1, 0xF1, 0x83, 0x43, 0xFF, 0x08, 0xFE, 0xFE, 0xF2, 0xF0, 0xF8,
+    0x01, 0x01, 0x3F, 0x3F, 0x81, 0x03, 0x3F, 0x3F, 0x01, 0x01, 0x42, 0xF0, 0x03, 0xFE, 0xFE, 0xFF,
+    0xDF, 0x42, 0xC1, 0x01, 0xF1, 0xF1, 0x83, 0x01, 0xFF, 0xFF, 0x82, 0x03, 0xFE, 0xFE, 0xF0, 0xF0,
+    0x44, 0x00, 0x05, 0x01, 0x01, 0x07, 0x07, 0x3F, 0x3F, 0xAD, 0x07, 0xFE, 0xFE, 0xF8, 0xF8, 0xC0,
+    0xC0, 0x00, 0x00, 0x99, 0x03, 0x87, 0x87, 0xC0, 0xC0, 0x85, 0x03, 0xC0, 0xC0, 0x87, 0x87, 0x99,
+    0x07, 0x00, 0x00, 0xC0, 0xC0, 0xF8, 0xF8, 0xFE, 0xFE, 0xB5, 0x44, 0xF8, 0x43, 0xE0, 0x4C, 0xE7,
+    0x01, 0xF8, 0xF8, 0x91, 0x02, 0xFC, 0xF8, 0xE2, 0x4B, 0xE7, 0x43, 0xE0, 0x44, 0xF8, 0xFF, 0xB8,
+    0x44, 0xF3, 0x81, 0x01, 0xF3, 0xF3, 0xB7, 0x4A, 0xF3, 0xFF, 0x9B, 0x42, 0xFF, 0xC9, 0x00, 0xFC,
+    0x81, 0x00, 0xAF, 0xB1, 0x5D, 0xFF, 0x89, 0x5D, 0xFF, 0xB3, 0x03, 0xFF, 0x3F, 0x3F, 0x1F, 0x46,
+    0x03, 0x03, 0xF3, 0xF3, 0xFF, 0xFF, 0x81, 0x42, 0x03, 0x02, 0x83, 0xE3, 0xE3, 0x83, 0x43, 0xF7,
+    0x01, 0xFF, 0xFF, 0x42, 0xF3, 0x03, 0x03, 0x03, 0x7F, 0x7F, 0x81, 0x03, 0x7F, 0x7F, 0x07, 0x03,
+    0x42, 0xF3, 0x42, 0xFF, 0x00, 0x87, 0x42, 0x83, 0x01, 0xE3, 0xE3, 0x83, 0x01, 0xE7, 0xE7, 0x82,
+    0x03, 0xFF, 0xFF, 0xF3, 0xF3, 0x45, 0x03, 0x04, 0x07, 0x1F, 0x3F, 0x7F, 0xFF, 0xAD, 0x07, 0xFF,
+    0xFE, 0xFE, 0xF8, 0xF0, 0xF0, 0xC0, 0xC0, 0x99, 0x03, 0xC7, 0xC7, 0xF0, 0xF0, 0x85, 0x03, 0xF0,
+    0xF0, 0xC7, 0xC7, 0x99, 0x07, 0x80, 0xC0, 0xF0, 0xF0, 0xF8, 0xFE, 0xFE, 0xFF, 0xB5, 0x48, 0xFE,
+    0x4B, 0xFF, 0x42, 0xFE, 0x91, 0x42, 0xFE, 0x4B, 0xFF, 0x48, 0xFE, 0xFF, 0xB8, 0x44, 0xF1, 0x81,
+    0x01, 0xF1, 0xF1, 0xB7, 0x4A, 0xF1, 0xFF, 0x96, 0x00, 0xC3, 0x81, 0x01, 0xFC, 0xFC, 0xC4, 0x44,
+    0xFF, 0x81, 0x00, 0xFC, 0x82, 0x00, 0xEF, 0xFF, 0xAC, 0x02, 0xFF, 0x7F, 0x7F, 0x46, 0x3F, 0x01,
+    0xFF, 0xFF, 0x83, 0x43, 0x3F, 0x01, 0xFF, 0xFF, 0x83, 0x43, 0xFF, 0x81, 0x42, 0xFF, 0x01, 0x3F,
+    0x3F, 0x85, 0x01, 0x3F, 0x3F, 0x42, 0xFF, 0x82, 0x00, 0xFF, 0x42, 0x3F, 0x01, 0xFF, 0xFF, 0x83,
+    0x01, 0xFF, 0xFF, 0x84, 0x01, 0xFF, 0xFF, 0x46, 0x3F, 0x02, 0x7F, 0x7F, 0xFF, 0xAF, 0x06, 0xFF,
+    0xFE, 0xFE, 0xF8, 0xF8, 0xE0, 0xE0, 0x84, 0x01, 0x1F, 0x1F, 0x81, 0x43, 0xFE, 0x89, 0x06, 0x1F,
+    0x1F, 0x07, 0xE7, 0xE7, 0xF8, 0xF8, 0x85, 0x06, 0xF8, 0xF8, 0xE7, 0xE7, 0x07, 0x1F, 0x1F, 0x81,
+    0x42, 0xFE, 0x8A, 0x01, 0x1F, 0x1F, 0x84, 0x06, 0xE0, 0xE0, 0xF8, 0xF8, 0xFE, 0xFE, 0xFF, 0xB6,
+    0x48, 0xFF, 0x8B, 0x44, 0xFF, 0x8D, 0x44, 0xFF, 0x8B, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x00,
+    0x83, 0x81, 0x01, 0xFD, 0xFD, 0xC4, 0x44, 0xFE, 0x81, 0x00, 0xFD, 0x82, 0x00, 0xAF, 0xFF, 0xAC,
+    0x02, 0x3F, 0x3F, 0x1F, 0x46, 0x03, 0x01, 0xF3, 0xF3, 0x83, 0x42, 0x03, 0x02, 0x83, 0xE3, 0xE3,
+    0x83, 0x43, 0xF7, 0x81, 0x42, 0xF3, 0x01, 0x03, 0x03, 0x85, 0x01, 0x07, 0x03, 0x42, 0xF3, 0x82,
+    0x00, 0x87, 0x42, 0x83, 0x01, 0xE3, 0xE3, 0x83, 0x01, 0xE7, 0xE7, 0x84, 0x01, 0xF3, 0xF3, 0x45,
+    0x03, 0x03, 0x07, 0x1F, 0x3F, 0x7F, 0xAF, 0x06, 0xFE, 0xFE, 0xF8, 0xF0, 0xF0, 0xC0, 0xC0, 0x84,
+    0x01, 0x3F, 0x3F, 0x81, 0x43, 0xFF, 0x89, 0x06, 0x3F, 0x3F, 0x07, 0xC7, 0xC7, 0xF0, 0xF0, 0x85,
+    0x06, 0xF0, 0xF0, 0xC7, 0xC7, 0x07, 0x3F, 0x3F, 0x81, 0x42, 0xFF, 0x8A, 0x01, 0x3F, 0x3F, 0x84,
+    0x06, 0x80, 0xC0, 0xF0, 0xF0, 0xF8, 0xFE, 0xFE, 0xB6, 0x48, 0xFE, 0x8B, 0x44, 0xFE, 0x8D, 0x44,
+    0xFE, 0x8B, 0x48, 0xFE, 0xFF, 0xFF,
+};
+
+static const uint16_t g_oled_eye_delta_offsets[5] = {
+    0, 185, 326, 461, 598,
+};
+
+#define OLED_EYE_FRAME_COUNT 4
+
+static const uint8_t g_oled_audio_key[108] = {
+    0xC4, 0x00, 0x80, 0x44, 0xC0, 0x00, 0x80, 0xE7, 0x01, 0xC0, 0xE0, 0x43, 0xF0, 0x01, 0xE0, 0xC0,
+    0x87, 0x47, 0xFF, 0xD7, 0x00, 0xC0, 0x45, 0xF0, 0x00, 0xE0, 0x87, 0x47, 0xFF, 0x87, 0x47, 0xFF,
+    0x87, 0x00, 0xC0, 0x45, 0xF0, 0x00, 0xE0, 0xC7, 0x47, 0xFF, 0x87, 0x47, 0xFF, 0x87, 0x47, 0xFF,
+    0x87, 0x47, 0xFF, 0xC7, 0x47, 0xFF, 0x87, 0x47, 0xFF, 0x87, 0x47, 0xFF, 0x87, 0x47, 0xFF, 0xC7,
+    0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x87, 0x47, 0xFF, 0x87, 0x47, 0xFF, 0x87,
+    0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0xD7, 0x01, 0x03, 0x07, 0x43, 0x0F, 0x01,
+    0x07, 0x03, 0x87, 0x47, 0xFF, 0xF8, 0x00, 0x01, 0x44, 0x03, 0x00, 0x01,
+};
+
+static const uint8_t g_oled_audio_delta[1059] = {
+    0xC4, 0x00, 0x80, 0x44, 0xC0, 0x00, 0x80, 0xDA, 0x42, 0x00, 0x89, 0x01, 0xC0, 0xE0, 0x43, 0xF0,
+    0x01, 0xE0, 0xC0, 0x87, 0x47, 0xFF, 0x8A, 0x42, 0x00, 0xC9, 0x00, 0xC0, 0x45, 0xF0, 0x00, 0xE0,
+    0xA7, 0x00, 0xC0, 0x45, 0xF0, 0x00, 0xE0, 0xFF, 0xFF, 0xC7, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F,
+    0x0F, 0x0F, 0x07, 0xA7, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0xC9, 0x43, 0x00,
+    0x89, 0x01, 0x03, 0x07, 0x43, 0x0F, 0x01, 0x07, 0x03, 0x87, 0x47, 0xFF, 0x89, 0x43, 0x00, 0xEA,
+    0x00, 0x01, 0x44, 0x03, 0x00, 0x01, 0xC4, 0x46, 0x00, 0xE7, 0x01, 0xF0, 0xF8, 0x44, 0xFC, 0x00,
+    0xF8, 0x87, 0x01, 0xFC, 0xFE, 0x83, 0x01, 0xFE, 0xFC, 0xD7, 0x01, 0xF0, 0xF8, 0x43, 0xFC, 0x01,
+    0xF8, 0xF0, 0xA7, 0x01, 0xF0, 0xF8, 0x43, 0xFC, 0x01, 0xF8, 0xF0, 0xFF, 0xFF, 0xC7, 0x01, 0x0F,
+    0x1F, 0x43, 0x3F, 0x01, 0x1F, 0x0F, 0xA7, 0x01, 0x0F, 0x1F, 0x43, 0x3F, 0x01, 0x1F, 0x0F, 0xD7,
+    0x00, 0x0F, 0x45, 0x3F, 0x00, 0x1F, 0x87, 0x01, 0x3F, 0x7F, 0x83, 0x01, 0x7F, 0x3F, 0xF8, 0x46,
+    0x00, 0xFF, 0xB3, 0x02, 0xF8, 0xFC, 0xFC, 0x42, 0xFE, 0x8B, 0x00, 0xFE, 0x81, 0x00, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xAE, 0x00, 0x1F, 0xD7, 0x01, 0x1F, 0x3F, 0x43, 0x7F, 0x8B, 0x00,
+    0x7F, 0x81, 0x00, 0x7F, 0xFF, 0xFF, 0xB3, 0x01, 0xFC, 0xFE, 0x43, 0xFF, 0x01, 0xFE, 0xFC, 0x87,
+    0x07, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xD7, 0x07, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE,
+    0xFC, 0xFC, 0xF8, 0xA7, 0x07, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xFF, 0xFF, 0xC7,
+    0x02, 0x1F, 0x3F, 0x3F, 0x42, 0x7F, 0x00, 0x3F, 0xA8, 0x02, 0x1F, 0x3F, 0x3F, 0x42, 0x7F, 0x00,
+    0x3F, 0xD8, 0x01, 0x3F, 0x7F, 0x43, 0xFF, 0x01, 0x7F, 0x3F, 0x87, 0x02, 0x1F, 0x3F, 0x3F, 0x42,
+    0x7F, 0x01, 0x3F, 0x1F, 0xFF, 0xB6, 0x42, 0x80, 0xF9, 0x01, 0xFE, 0xFF, 0x83, 0x01, 0xFF, 0xFE,
+    0x87, 0x02, 0xF0, 0xF8, 0xF8, 0x42, 0xFC, 0x01, 0xF8, 0xF0, 0xD9, 0x00, 0xFE, 0x81, 0x02, 0xFE,
+    0xFC, 0xFC, 0xA9, 0x00, 0xFE, 0x81, 0x02, 0xFE, 0xFC, 0xFC, 0xFF, 0xFF, 0xC9, 0x00, 0x7F, 0x82,
+    0x01, 0x7F, 0x3F, 0xA9, 0x00, 0x7F, 0x82, 0x01, 0x7F, 0x3F, 0xD7, 0x01, 0x7F, 0xFF, 0x83, 0x01,
+    0xFF, 0x7F, 0x87, 0x01, 0x0F, 0x1F, 0x43, 0x3F, 0x01, 0x1F, 0x0F, 0xE9, 0x43, 0x01, 0xB4, 0x01,
+    0x80, 0x80, 0x82, 0x00, 0x80, 0xFF, 0x00, 0xFF, 0x87, 0x01, 0xC0, 0xE0, 0x43, 0xF0, 0x01, 0xE0,
+    0xC0, 0xD7, 0x01, 0xFC, 0xFE, 0x44, 0xFF, 0x00, 0xFE, 0xA7, 0x01, 0xFC, 0xFE, 0x44, 0xFF, 0x00,
+    0xFE, 0xFF, 0xFF, 0xC7, 0x00, 0x3F, 0x45, 0xFF, 0x00, 0x7F, 0xA7, 0x00, 0x3F, 0x45, 0xFF, 0x00,
+    0x7F, 0xDE, 0x00, 0xFF, 0x87, 0x01, 0x03, 0x07, 0x43, 0x0F, 0x01, 0x07, 0x03, 0xE8, 0x00, 0x01,
+    0x83, 0x00, 0x01, 0xB4, 0x45, 0x00, 0xE9, 0x45, 0x80, 0x88, 0x02, 0xF8, 0xFC, 0xFC, 0x42, 0xFE,
+    0x01, 0xFC, 0xF8, 0x87, 0x02, 0x00, 0x80, 0x80, 0x42, 0xC0, 0x01, 0x80, 0x00, 0x88, 0x45, 0x80,
+    0xC8, 0x01, 0xFE, 0xFF, 0x84, 0x00, 0xFF, 0xA7, 0x01, 0xFE, 0xFF, 0x84, 0x00, 0xFF, 0xFF, 0xFF,
+    0xC7, 0x00, 0xFF, 0x85, 0x00, 0xFF, 0xA7, 0x00, 0xFF, 0x85, 0x00, 0xFF, 0xC8, 0x05, 0x01, 0x01,
+    0x03, 0x03, 0x01, 0x01, 0x88, 0x01, 0x1F, 0x3F, 0x43, 0x7F, 0x01, 0x3F, 0x1F, 0x87, 0x01, 0x00,
+    0x01, 0x43, 0x03, 0x01, 0x01, 0x00, 0x88, 0x05, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0xD9, 0x45,
+    0x00, 0xFF, 0xA5, 0x43, 0xC0, 0x01, 0x80, 0x80, 0x87, 0x01, 0xE0, 0xF0, 0x43, 0xF8, 0x01, 0xF0,
+    0xE0, 0x88, 0x45, 0x00, 0x8A, 0x43, 0xC0, 0x01, 0x80, 0x80, 0xC7, 0x00, 0xFF, 0x9E, 0x00, 0xFC,
+    0x85, 0x00, 0xFE, 0x87, 0x00, 0xFF, 0xFF, 0xFF, 0xEE, 0x00, 0x7F, 0x85, 0x00, 0x7F, 0xD9, 0x00,
+    0x03, 0x81, 0x02, 0x03, 0x03, 0x01, 0x87, 0x01, 0x07, 0x0F, 0x44, 0x1F, 0x00, 0x0F, 0x88, 0x05,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x8A, 0x00, 0x03, 0x81, 0x02, 0x03, 0x03, 0x01, 0xFF, 0xFF,
+    0xA3, 0x01, 0x80, 0xC0, 0x43, 0xE0, 0x00, 0xC0, 0x88, 0x00, 0x80, 0x45, 0xE0, 0x00, 0xC0, 0x97,
+    0x01, 0x80, 0xC0, 0x43, 0xE0, 0x00, 0xC0, 0xE8, 0x01, 0xF8, 0xFC, 0x43, 0xFE, 0x01, 0xFC, 0xFC,
+    0xFF, 0xFF, 0xF7, 0x01, 0x1F, 0x3F, 0x44, 0x7F, 0x00, 0x3F, 0xD7, 0x01, 0x01, 0x03, 0x43, 0x07,
+    0x89, 0x00, 0x01, 0x45, 0x07, 0x00, 0x03, 0x8A, 0x01, 0x00, 0x00, 0x8A, 0x01, 0x01, 0x03, 0x43,
+    0x07, 0xFF, 0xFF, 0xA4, 0x00, 0xE0, 0x83, 0x01, 0xE0, 0xC0, 0x87, 0x03, 0x00, 0xC0, 0xC0, 0xE0,
+    0x42, 0xC0, 0x00, 0x80, 0x98, 0x00, 0xE0, 0x83, 0x01, 0xE0, 0xC0, 0xE7, 0x00, 0xF0, 0x45, 0xFC,
+    0x00, 0xF8, 0xFF, 0xFF, 0xF9, 0x00, 0x3F, 0x81, 0x02, 0x3F, 0x3F, 0x1F, 0xD8, 0x00, 0x07, 0x83,
+    0x01, 0x07, 0x03, 0x88, 0x42, 0x03, 0x03, 0x07, 0x03, 0x03, 0x01, 0x98, 0x00, 0x07, 0x83, 0x01,
+    0x07, 0x03, 0xFF, 0xFF, 0xA3, 0x00, 0xC0, 0x81, 0x42, 0xF0, 0x8A, 0x06, 0x80, 0x80, 0xC0, 0xC0,
+    0x80, 0x80, 0x00, 0x97, 0x00, 0xC0, 0x81, 0x42, 0xF0, 0xEA, 0x00, 0xF8, 0x83, 0x01, 0xF8, 0xF0,
+    0xFF, 0xFF, 0xF7, 0x01, 0x0F, 0x1F, 0x43, 0x3F, 0x01, 0x1F, 0x0F, 0xD7, 0x01, 0x03, 0x07, 0x43,
+    0x0F, 0x89, 0x02, 0x00, 0x01, 0x01, 0x42, 0x03, 0x01, 0x01, 0x00, 0x97, 0x01, 0x03, 0x07, 0x43,
+    0x0F, 0xFF, 0xFF, 0xA3, 0x02, 0xE0, 0xF0, 0xF0, 0x82, 0x01, 0xF0, 0xE0, 0x88, 0x45, 0x00, 0x98,
+    0x02, 0xE0, 0xF0, 0xF0, 0x82, 0x01, 0xF0, 0xE0, 0xD7, 0x01, 0xFC, 0xFE, 0x83, 0x01, 0xFE, 0xFC,
+    0x87, 0x00, 0xC0, 0x45, 0xF0, 0x00, 0xE0, 0xFF, 0xFF, 0xE7, 0x01, 0x3F, 0x7F, 0x83, 0x01, 0x7F,
+    0x3F, 0x87, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0xD7, 0x07, 0x07, 0x0F, 0x0F,
+    0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x88, 0x45, 0x00, 0x98, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x0F,
+    0x0F, 0x07, 0xFF, 0xFF, 0xA3, 0x01, 0x00, 0x80, 0x43, 0xC0, 0x01, 0x80, 0x00, 0x89, 0x43, 0x80,
+    0x8C, 0x01, 0x80, 0x80, 0x8A, 0x01, 0x00, 0x80, 0x43, 0xC0, 0x01, 0x80, 0x00, 0xD7, 0x01, 0xFE,
+    0xFF, 0x83, 0x01, 0xFF, 0xFF, 0x87, 0x00, 0xFE, 0x45, 0xFF, 0x00, 0xFE, 0xFF, 0xFF, 0xE7, 0x01,
+    0x7F, 0xFF, 0x83, 0x01, 0xFF, 0xFF, 0x87, 0x00, 0x7F, 0x45, 0xFF, 0x00, 0x7F, 0xD7, 0x01, 0x00,
+    0x01, 0x43, 0x03, 0x01, 0x01, 0x01, 0x89, 0x44, 0x01, 0x8A, 0x43, 0x01, 0x89, 0x01, 0x00, 0x01,
+    0x43, 0x03, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xA4, 0x01, 0x00, 0x00, 0x42, 0x80, 0x00, 0x00, 0x89,
+    0x05, 0x80, 0x80, 0xC0, 0xC0, 0x80, 0x80, 0x88, 0x01, 0x80, 0xC0, 0x43, 0xE0, 0x01, 0xC0, 0x80,
+    0x88, 0x01, 0x00, 0x00, 0x42, 0x80, 0x00, 0x00, 0xC8, 0x00, 0xFE, 0x85, 0x00, 0xFE, 0x87, 0x00,
+    0xFF, 0x8E, 0x00, 0xFF, 0x85, 0x00, 0xFF, 0x87, 0x00, 0xFE, 0x85, 0x00, 0xFE, 0xFF, 0xFF, 0xC7,
+    0x00, 0x7F, 0x85, 0x00, 0x7F, 0x87, 0x00, 0xFF, 0x8E, 0x00, 0xFF, 0x85, 0x00, 0xFF, 0x87, 0x00,
+    0x7F, 0x85, 0x00, 0x7F, 0xC8, 0x00, 0x00, 0x43, 0x01, 0x01, 0x00, 0x00, 0x88, 0x00, 0x01, 0x43,
+    0x03, 0x89, 0x01, 0x01, 0x03, 0x43, 0x07, 0x01, 0x03, 0x01, 0x88, 0x00, 0x00, 0x43, 0x01, 0x01,
+    0x00, 0x00, 0xFF,
+};
+
+static const uint16_t g_oled_audio_delta_offsets[15] = {
+    0, 86, 161, 197, 277, 350, 419, 513, 591, 658, 723, 786, 867, 950, 1059,
+};
+
+#define OLED_AUDIO_FRAME_COUNT 14
+
+#endif
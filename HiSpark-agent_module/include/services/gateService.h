@@ -1,4 +1,6 @@
 #include "sle_ssap_client.h"
+#include <stddef.h>
+#include <stdint.h>
 // 数据接收回调函数
 void sle_uart_indication_cb(uint8_t client_id, uint16_t conn_id, ssapc_handle_value_t *data,
                             errcode_t status);
@@ -6,11 +8,26 @@ void sle_uart_indication_cb(uint8_t client_id, uint16_t conn_id, ssapc_handle_va
 // 接收数据后的回调函数
 void sle_uart_notification_cb(uint8_t client_id, uint16_t conn_id, ssapc_handle_value_t *data,
                               errcode_t status);
+/* 修改 broker 地址（如 "tcp://192.168.1.111:1883"），需在 MqttInit 之前调用 */
+int MqttSetServerAddress(const char *address);
+
 int MqttInit(void);
 int MqttStartSubscribeTask(const char *topic);
 
-/* 预订阅主题，在接收线程启动前调用 */
+/*
+ * 消息处理函数，topic/payload 直接指向 MQTT 接收缓冲区（不以 NUL 结尾），
+ * 仅在回调期间有效。
+ */
+typedef void (*MqttMsgHandler)(const char *topic, size_t topic_len, const uint8_t *payload, size_t len, void *arg);
+
+/*
+ * 为订阅过滤器（支持 '+'/'#'）注册处理函数，可在任意线程随时调用；同一消息会分发给所有匹配的处理函数。
+ * 处理函数在 Paho 接收线程中持订阅表锁调用，其中不能再调用 MqttRegisterHandler/MqttPreSubscribe。
+ */
+int MqttRegisterHandler(const char *filter, MqttMsgHandler handler, void *arg);
+
+/* 向 broker 订阅主题并记入订阅表，断线重连后自动恢复；未连接时先调用 MqttInit */
 int MqttPreSubscribe(const char *topic);
 
-/* 启动阻塞接收线程（只调用一次）*/
+/* 启动 MQTT 守护线程（只调用一次），消息通过注册的处理函数回调 */
 int MqttStartRecvTask(void);
\ No newline at end of file
@@ -56,6 +56,20 @@ extern "C"
     /* 关闭录音硬件 */
     void sound_recorder_close(void);
 
+    /* 最近一块录音的电平（采样绝对值，0~32767） */
+    typedef struct
+    {
+        uint16_t rms;
+        uint16_t peak;
+    } sound_level_t;
+
+    /*
+     * 读取电平邮箱，只保留最新一块的结果，可在任意任务中无锁调用
+     * @param level  输出 RMS/峰值，可为 NULL
+     * @return       块序号，每次 sound_recorder_read 成功后递增，用于判断是否有新数据
+     */
+    uint32_t sound_recorder_get_level(sound_level_t *level);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,60 @@
+#ifndef TOPIC_TRIE_H
+#define TOPIC_TRIE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+    /*
+     * MQTT 主题过滤器前缀树，支持 '+'（单层）与 '#'（多层）通配符。
+     * 每个过滤器可挂一个消息处理函数，并记录是否需要向 broker 订阅，
+     * 断线重连时按同一张表恢复订阅。
+     */
+
+    /* 消息处理函数，topic/payload 均直接指向接收缓冲区，不保证以 NUL 结尾 */
+    typedef void (*topic_trie_handler_t)(const char *topic, size_t topic_len,
+                                         const uint8_t *payload, size_t len, void *arg);
+
+    typedef struct topic_trie_node
+    {
+        char *level;                   /* 本层名称 */
+        size_t level_len;
+        struct topic_trie_node *child; /* 第一个子节点 */
+        struct topic_trie_node *next;  /* 下一个兄弟节点 */
+        char *filter;                  /* 完整过滤器，仅在注册过的节点上非空 */
+        topic_trie_handler_t handler;
+        void *arg;
+        int qos;
+        bool subscribed; /* 是否需要向 broker 订阅 */
+    } topic_trie_node_t;
+
+    typedef struct
+    {
+        topic_trie_node_t root;
+        size_t count; /* 已注册的过滤器数量 */
+    } topic_trie_t;
+
+    /* 为过滤器设置处理函数（handler 可为 NULL），已存在时覆盖，成功返回 0 */
+    int topic_trie_set_handler(topic_trie_t *trie, const char *filter, topic_trie_handler_t handler, void *arg);
+
+    /* 标记过滤器需要向 broker 订阅，成功返回 0 */
+    int topic_trie_set_subscribed(topic_trie_t *trie, const char *filter, int qos);
+
+    /* 把消息分发给所有匹配的处理函数，返回被调用的处理函数个数 */
+    int topic_trie_dispatch(const topic_trie_t *trie, const char *topic, size_t topic_len,
+                            const uint8_t *payload, size_t len);
+
+    /* 遍历所有需要订阅的过滤器 */
+    typedef void (*topic_trie_visit_t)(const char *filter, int qos, void *ctx);
+    void topic_trie_foreach_subscribed(const topic_trie_t *trie, topic_trie_visit_t visit, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOPIC_TRIE_H */
@@ -4,30 +4,141 @@
 #include "osal_debug.h"
 #include "debugUtils.h"
 #include "sle_uart_client.h"
+#include "gateService.h"
 #include "agent_module_main.h"
 #include "cJSON.h"
 #include "MQTTClient.h"
+#include "topicTrie.h"
 #include <string.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include "osal_task.h"
 #include "soc_osal.h"
 #include "watchdog.h"
+#include "tcxo.h"
 
-// MQTT 服务器地址及客户端标识，可根据实际情况修改
+// MQTT 服务器地址及客户端标识，可在编译时覆盖或运行时通过 MqttSetServerAddress 修改
+#ifndef MQTT_ADDRESS
 #define MQTT_ADDRESS "tcp://192.168.1.111:1883"
+#endif
+#define MQTT_ADDRESS_MAX_LEN 64
 #define MQTT_CLIENT_ID "GateServiceClient"
 #define MQTT_QOS 0
+#define MQTT_ALERT_QOS 1
 #define MQTT_RETAINED 1
+#define MQTT_KEEPALIVE_S 120
+/* QoS 1/2 在途窗口，发布不等待 PUBACK，由 Paho 后台线程确认 */
+#define MQTT_MAX_INFLIGHT 64
+#define MQTT_SUPERVISOR_PERIOD_MS 1000
+/* 断线期间积压的 QoS 1 报文，队满时丢弃最旧的 */
+#define MQTT_PENDING_MAX 8
+#define MQTT_PENDING_TOPIC_LEN 32
+#define MQTT_PENDING_PAYLOAD_LEN 192
 
 static MQTTClient g_mqtt_client;
 static bool g_mqtt_inited = false;
 static bool g_lib_inited = false; /* Paho 库初始化标记 */
+static char g_mqtt_address[MQTT_ADDRESS_MAX_LEN] = MQTT_ADDRESS;
+/* connection_lost 回调唤醒守护线程重连 */
+static osal_semaphore g_mqtt_event_sem;
+static osal_mutex g_mqtt_reconnect_mutex;
+static bool g_sync_inited = false;
+
+/*
+ * 订阅路由表：过滤器 -> 处理函数，断线重连后也按此表重新订阅。
+ * 注册、订阅记录与 Paho 接收线程中的分发都要持 g_sub_table_mutex；
+ * 节点只增不删，过滤器字符串在解锁后仍然有效。
+ */
+static topic_trie_t g_sub_table = {0};
+static osal_mutex g_sub_table_mutex;
+
+/*
+ * 补发队列：发布线程（如 SLE 回调）断线时只入队并唤醒守护线程，
+ * 由守护线程重连后按入队顺序发布，发布线程不会阻塞在重连上
+ */
+typedef struct
+{
+    char topic[MQTT_PENDING_TOPIC_LEN];
+    uint8_t payload[MQTT_PENDING_PAYLOAD_LEN];
+    uint16_t len;
+    uint8_t qos;
+} mqtt_pending_t;
+
+static mqtt_pending_t g_mqtt_pending[MQTT_PENDING_MAX];
+static uint8_t g_mqtt_pending_head = 0;
+static uint8_t g_mqtt_pending_count = 0;
+/* 守护线程正在补发：取出的报文还没发出，新的 QoS 1 报文也要排在它之后 */
+static bool g_mqtt_pending_flushing = false;
+static osal_mutex g_mqtt_pending_mutex;
+
+/* 信号量与互斥锁只初始化一次，首次调用应在启动阶段的单个线程中完成 */
+static int mqtt_sync_init(void)
+{
+    if (g_sync_inited)
+    {
+        return 0;
+    }
+    if (osal_sem_init(&g_mqtt_event_sem, 0) != OSAL_SUCCESS ||
+        osal_mutex_init(&g_mqtt_reconnect_mutex) != OSAL_SUCCESS ||
+        osal_mutex_init(&g_sub_table_mutex) != OSAL_SUCCESS ||
+        osal_mutex_init(&g_mqtt_pending_mutex) != OSAL_SUCCESS)
+    {
+        log_error("MQTT sync objects init failed\r\n");
+        return -1;
+    }
+    g_sync_inited = true;
+    return 0;
+}
+
+int MqttSetServerAddress(const char *address)
+{
+    if (address == NULL || g_mqtt_inited || strlen(address) >= sizeof(g_mqtt_address))
+    {
+        return -1;
+    }
+    strcpy(g_mqtt_address, address);
+    return 0;
+}
 
-/* 记录已订阅主题列表，便于断线重连后重新订阅 */
-#define MAX_SUB_TOPICS 8
-static char *g_sub_topics[MAX_SUB_TOPICS] = {0};
-static int g_sub_count = 0;
+static void mqtt_fill_conn_opts(MQTTClient_connectOptions *conn_opts)
+{
+    conn_opts->struct_version = 6; /* 使 maxInflightMessages 字段生效 */
+    conn_opts->keepAliveInterval = MQTT_KEEPALIVE_S;
+    conn_opts->cleansession = 1;
+    /* 允许并发在途消息，避免 -4 错误 */
+    conn_opts->reliable = 0;
+    conn_opts->maxInflightMessages = MQTT_MAX_INFLIGHT;
+}
+
+/* Paho 后台线程收到消息后直接回调，按订阅表分发，不再轮询 MQTTClient_receive */
+static int mqtt_message_arrived_cb(void *context, char *topic, int topic_len, MQTTClient_message *msg)
+{
+    unused(context);
+    if (topic != NULL && msg != NULL && msg->payloadlen > 0 && msg->payload != NULL)
+    {
+        /* topic_len 为 0 表示 topic 以 NUL 结尾 */
+        size_t tlen = (topic_len > 0) ? (size_t)topic_len : strlen(topic);
+        osal_mutex_lock(&g_sub_table_mutex);
+        int hits = topic_trie_dispatch(&g_sub_table, topic, tlen, (const uint8_t *)msg->payload,
+                                       (size_t)msg->payloadlen);
+        osal_mutex_unlock(&g_sub_table_mutex);
+        if (hits == 0)
+        {
+            log_info("MQTT payload on %.*s: %.*s\r\n", (int)tlen, topic, msg->payloadlen,
+                     (const char *)msg->payload);
+        }
+    }
+    MQTTClient_freeMessage(&msg);
+    MQTTClient_free(topic);
+    return 1;
+}
+
+static void mqtt_connection_lost_cb(void *context, char *cause)
+{
+    unused(context);
+    log_error("MQTT connection lost: %s\r\n", cause ? cause : "unknown");
+    osal_sem_up(&g_mqtt_event_sem);
+}
 
 /* 初始化 MQTT（单例） */
 int MqttInit(void)
@@ -41,10 +152,14 @@ int MqttInit(void)
     {
         MQTTClient_init_options init_opts = MQTTClient_init_options_initializer;
         MQTTClient_global_init(&init_opts); /* 创建内部互斥锁等资源 */
+        if (mqtt_sync_init() != 0)
+        {
+            return -1;
+        }
         g_lib_inited = true;
     }
 
-    int rc = MQTTClient_create(&g_mqtt_client, MQTT_ADDRESS, MQTT_CLIENT_ID,
+    int rc = MQTTClient_create(&g_mqtt_client, g_mqtt_address, MQTT_CLIENT_ID,
                                MQTTCLIENT_PERSISTENCE_NONE, NULL);
     if (rc != MQTTCLIENT_SUCCESS)
     {
@@ -52,52 +167,149 @@ int MqttInit(void)
         return rc;
     }
 
+    /* 必须在 connect 之前设置，之后消息由 Paho 后台线程回调 */
+    rc = MQTTClient_setCallbacks(g_mqtt_client, NULL, mqtt_connection_lost_cb, mqtt_message_arrived_cb, NULL);
+    if (rc != MQTTCLIENT_SUCCESS)
+    {
+        log_error("MQTT set callbacks failed: %d (%s)\r\n", rc, MQTTClient_strerror(rc));
+        MQTTClient_destroy(&g_mqtt_client);
+        return rc;
+    }
+
     MQTTClient_connectOptions conn_opts = MQTTClient_connectOptions_initializer;
-    conn_opts.struct_version = 6; /* 使 maxInflightMessages 字段生效 */
-    conn_opts.keepAliveInterval = 120;
-    conn_opts.cleansession = 1;
-    /* 允许并发在途消息，避免 -4 错误 */
-    conn_opts.reliable = 0;
-    conn_opts.maxInflightMessages = 50; /* 进一步放大队列上限 */
+    mqtt_fill_conn_opts(&conn_opts);
 
     rc = MQTTClient_connect(g_mqtt_client, &conn_opts);
     if (rc != MQTTCLIENT_SUCCESS)
     {
         log_error("MQTT connect failed: %d (%s)\r\n", rc, MQTTClient_strerror(rc));
+        MQTTClient_destroy(&g_mqtt_client);
         return rc;
     }
 
     g_mqtt_inited = true;
-    log_info("MQTT connected to %s\r\n", MQTT_ADDRESS);
+    log_info("MQTT connected to %s\r\n", g_mqtt_address);
     return 0;
 }
 
-/* 发布数据到指定 topic */
 static void mqtt_try_reconnect(void);
 
-static void MqttPublish(const char *topic, const char *payload)
+/* 入队一条报文，队满时丢弃最旧的；报文或主题过长返回 -1 */
+static int mqtt_pending_push(const char *topic, const void *payload, size_t len, int qos)
+{
+    if (strlen(topic) >= MQTT_PENDING_TOPIC_LEN || len > MQTT_PENDING_PAYLOAD_LEN)
+    {
+        log_error("MQTT pending %s too long, dropped\r\n", topic);
+        return -1;
+    }
+    osal_mutex_lock(&g_mqtt_pending_mutex);
+    if (g_mqtt_pending_count == MQTT_PENDING_MAX)
+    {
+        log_error("MQTT pending queue full, drop oldest on %s\r\n", g_mqtt_pending[g_mqtt_pending_head].topic);
+        g_mqtt_pending_head = (g_mqtt_pending_head + 1) % MQTT_PENDING_MAX;
+        g_mqtt_pending_count--;
+    }
+    mqtt_pending_t *item = &g_mqtt_pending[(g_mqtt_pending_head + g_mqtt_pending_count) % MQTT_PENDING_MAX];
+    strcpy(item->topic, topic);
+    memcpy(item->payload, payload, len);
+    item->len = (uint16_t)len;
+    item->qos = (uint8_t)qos;
+    g_mqtt_pending_count++;
+    osal_mutex_unlock(&g_mqtt_pending_mutex);
+    return 0;
+}
+
+/* 由守护线程在连接正常时调用；再次断线时放回队首，等下一轮 */
+static void mqtt_pending_flush(void)
+{
+    mqtt_pending_t item;
+    while (1)
+    {
+        osal_mutex_lock(&g_mqtt_pending_mutex);
+        if (g_mqtt_pending_count == 0)
+        {
+            g_mqtt_pending_flushing = false;
+            osal_mutex_unlock(&g_mqtt_pending_mutex);
+            return;
+        }
+        g_mqtt_pending_flushing = true;
+        item = g_mqtt_pending[g_mqtt_pending_head];
+        g_mqtt_pending_head = (g_mqtt_pending_head + 1) % MQTT_PENDING_MAX;
+        g_mqtt_pending_count--;
+        osal_mutex_unlock(&g_mqtt_pending_mutex);
+
+        int rc = MQTTClient_publish(g_mqtt_client, item.topic, item.len, item.payload, item.qos, MQTT_RETAINED,
+                                    NULL);
+        if (rc == MQTTCLIENT_DISCONNECTED)
+        {
+            osal_mutex_lock(&g_mqtt_pending_mutex);
+            if (g_mqtt_pending_count < MQTT_PENDING_MAX)
+            {
+                g_mqtt_pending_head = (g_mqtt_pending_head + MQTT_PENDING_MAX - 1) % MQTT_PENDING_MAX;
+                g_mqtt_pending[g_mqtt_pending_head] = item;
+                g_mqtt_pending_count++;
+            }
+            g_mqtt_pending_flushing = false;
+            osal_mutex_unlock(&g_mqtt_pending_mutex);
+            return;
+        }
+        log_info("MQTT pending %s published rc=%d\r\n", item.topic, rc);
+    }
+}
+
+/* 队列中有积压或守护线程正在补发 */
+static bool mqtt_pending_busy(void)
+{
+    osal_mutex_lock(&g_mqtt_pending_mutex);
+    bool busy = (g_mqtt_pending_count > 0) || g_mqtt_pending_flushing;
+    osal_mutex_unlock(&g_mqtt_pending_mutex);
+    return busy;
+}
+
+/*
+ * 发布不等待 PUBACK：QoS 1 报文在 MQTT_MAX_INFLIGHT 窗口内流水线发送。
+ * 断线时 QoS 0 直接丢弃，QoS 1 入补发队列，两者都只唤醒守护线程重连，不在调用线程里重连。
+ * 队列中还有积压或正在补发时新的 QoS 1 报文也入队，保证发布顺序。
+ */
+static int MqttPublishQos(const char *topic, const void *payload, size_t len, int qos)
 {
     if ((topic == NULL) || (payload == NULL))
     {
-        return;
+        return -1;
     }
 
     if (!g_mqtt_inited && (MqttInit() != 0))
     {
-        return;
+        return -1;
     }
 
-    int rc = MQTTClient_publish(g_mqtt_client, topic, (int)strlen(payload), (void *)payload, MQTT_QOS, MQTT_RETAINED, NULL);
+    int rc = MQTTCLIENT_DISCONNECTED;
+    if (qos == 0 || !mqtt_pending_busy())
+    {
+        rc = MQTTClient_publish(g_mqtt_client, topic, (int)len, payload, qos, MQTT_RETAINED, NULL);
+    }
     if (rc == MQTTCLIENT_DISCONNECTED)
     {
-        log_error("MQTT publish disconnected, try reconnect\r\n");
-        mqtt_try_reconnect();
-        rc = MQTTClient_publish(g_mqtt_client, topic, (int)strlen(payload), (void *)payload, MQTT_QOS, MQTT_RETAINED, NULL);
+        if (qos > 0)
+        {
+            (void)mqtt_pending_push(topic, payload, len, qos);
+        }
+        osal_sem_up(&g_mqtt_event_sem);
+        return rc;
     }
     if (rc != MQTTCLIENT_SUCCESS)
     {
         osal_printk("MQTT publish failed: %d\r\n", rc);
     }
+    return rc;
+}
+
+static void MqttPublish(const char *topic, const char *payload)
+{
+    if (payload != NULL)
+    {
+        (void)MqttPublishQos(topic, payload, strlen(payload), MQTT_QOS);
+    }
 }
 
 /* 处理单个 Json 对象并发布 */
@@ -157,14 +369,15 @@ static void HandleJsonObject(cJSON *object)
 }
 
 /* 解析 JSON 字符串，支持数组或单对象 */
-static void ParseAndPublishJson(const char *jsonStr)
+static void ParseAndPublishJson(const char *jsonStr, size_t len)
 {
-    if (jsonStr == NULL)
+    if (jsonStr == NULL || len == 0)
     {
         return;
     }
 
-    cJSON *root = cJSON_Parse(jsonStr);
+    /* SLE 报文不保证以 NUL 结尾 */
+    cJSON *root = cJSON_ParseWithLength(jsonStr, len);
     if (root == NULL)
     {
         osal_printk("cJSON parse error\r\n");
@@ -192,12 +405,16 @@ static void ParseAndPublishJson(const char *jsonStr)
 }
 
 /* 解析 report 主题的 JSON，有效字段：weather(int), caution(int), time(double) */
-static void process_report_payload(const char *json)
+static void process_report_payload(const char *topic, size_t topic_len, const uint8_t *payload, size_t len,
+                                   void *arg)
 {
-    if (json == NULL)
+    unused(topic);
+    unused(topic_len);
+    unused(arg);
+    if (payload == NULL || len == 0)
         return;
 
-    cJSON *root = cJSON_Parse(json);
+    cJSON *root = cJSON_ParseWithLength((const char *)payload, len);
     if (!root)
     {
         log_error("[MQTT] parse report json fail\r\n");
@@ -247,6 +464,47 @@ static void process_report_payload(const char *json)
     cJSON_Delete(root);
 }
 
+/* ExBoard 告警快速通道的报文前缀，见 HiSpark-ExBoard/alert.c */
+#define ALERT_MSG_PREFIX "[{\"topic\":\"CautionStatus\",\"caution\":"
+#define ALERT_MSG_MAX_LEN 160
+
+/*
+ * 告警报文不经过 cJSON，收到后先以 QoS 1 发布再做其它处理。
+ * ex_us 为 ExBoard 中断到发出的耗时，gw_us 为网关收到到发布前的耗时。
+ */
+static bool HandleAlertPayload(const uint8_t *data, uint16_t len, uint64_t t_rx_us)
+{
+    size_t prefix_len = sizeof(ALERT_MSG_PREFIX) - 1;
+    if (len <= prefix_len + 2 || len >= ALERT_MSG_MAX_LEN ||
+        memcmp(data, ALERT_MSG_PREFIX, prefix_len) != 0)
+    {
+        return false;
+    }
+    /* 去掉外层 []，追加网关耗时字段 */
+    char payload[ALERT_MSG_MAX_LEN + 24];
+    size_t obj_len = len - 2;
+    if (data[len - 1] == '\0')
+    {
+        obj_len--;
+    }
+    if (obj_len < 2 || data[obj_len] != '}')
+    {
+        return false;
+    }
+    memcpy(payload, data + 1, obj_len - 1);
+    uint32_t gw_us = (uint32_t)(uapi_tcxo_get_us() - t_rx_us);
+    snprintf(payload + obj_len - 1, sizeof(payload) - (obj_len - 1), ",\"gw_us\":%u}", gw_us);
+
+    int rc = MqttPublishQos("CautionStatus", payload, strlen(payload), MQTT_ALERT_QOS);
+    if (rc == MQTTCLIENT_DISCONNECTED)
+    {
+        log_info("alert queued until reconnect\r\n");
+        return true;
+    }
+    log_info("alert published rc=%d, rx->publish %u us\r\n", rc, (uint32_t)(uapi_tcxo_get_us() - t_rx_us));
+    return true;
+}
+
 // 接收信息的回调函数
 void sle_uart_notification_cb(uint8_t client_id, uint16_t conn_id, ssapc_handle_value_t *data,
                               errcode_t status)
@@ -255,10 +513,17 @@ void sle_uart_notification_cb(uint8_t client_id, uint16_t conn_id, ssapc_handle_
     unused(status);
     if (get_conn_id('E') == conn_id)
     {
-        log_info("data?%s", data->data);
+        uint64_t t_rx_us = uapi_tcxo_get_us();
+        if (HandleAlertPayload(data->data, data->data_len, t_rx_us))
+        {
+            /* 告警已发布，再转发给 P 板显示 */
+            sle_uart_client_send_data(data->data, data->data_len, 0, get_conn_id('P'));
+            return;
+        }
+        log_info("data?%.*s", (int)data->data_len, (const char *)data->data);
         /* 解析 JSON 并通过 MQTT 发布 */
         const char *jsonPayload = (const char *)(data->data);
-        ParseAndPublishJson(jsonPayload);
+        ParseAndPublishJson(jsonPayload, data->data_len);
         sle_uart_client_send_data(data->data, data->data_len, 0, get_conn_id('P'));
     }
 }
@@ -271,13 +536,69 @@ void sle_uart_indication_cb(uint8_t client_id, uint16_t conn_id, ssapc_handle_va
     unused(status);
 }
 
-/* ------------------------ MQTT 阻塞式订阅实现 ------------------------- */
+/* ------------------------ MQTT 回调式订阅实现 ------------------------- */
 
 #define MQTT_SUB_TASK_STACK_SIZE 0x2000
 #define MQTT_SUB_TASK_NAME "MqttSubTask"
 #define MQTT_SUB_TASK_PRIO OSAL_TASK_PRIORITY_LOW
 
-/* MQTT 订阅线程 */
+/* Control/# 主题：在 payload 两端添加 '[' 和 ']' 后转发给 ExBoard */
+static void process_control_payload(const char *topic, size_t topic_len, const uint8_t *payload, size_t len,
+                                    void *arg)
+{
+    unused(topic);
+    unused(topic_len);
+    unused(arg);
+    if (len + 2 > UINT16_MAX)
+    {
+        return;
+    }
+    uint16_t send_len = (uint16_t)(len + 2);
+    uint8_t *send_buf = (uint8_t *)osal_vmalloc(send_len);
+    if (send_buf == NULL)
+    {
+        return;
+    }
+    send_buf[0] = '[';
+    memcpy(send_buf + 1, payload, len);
+    send_buf[len + 1] = ']';
+
+    /* 缓冲区所有权交给 SLE 发送队列，由其负责释放 */
+    sle_uart_client_send_data_owned(send_buf, send_len, 0, get_conn_id('E'));
+}
+
+/* 注册网关自身处理的主题，只需调用一次 */
+static void mqtt_register_default_handlers(void)
+{
+    static bool registered = false;
+    if (registered)
+    {
+        return;
+    }
+    registered = true;
+    MqttRegisterHandler("report", process_report_payload, NULL);
+    MqttRegisterHandler("devices/report", process_report_payload, NULL);
+    MqttRegisterHandler("Control/#", process_control_payload, NULL);
+}
+
+/* 守护线程的一轮：平时阻塞在信号量上，connection_lost 或发布断线时被唤醒；超时只用于喂狗 */
+static void mqtt_supervise_once(void)
+{
+    (void)osal_sem_down_timeout(&g_mqtt_event_sem, MQTT_SUPERVISOR_PERIOD_MS);
+    uapi_watchdog_kick();
+
+    if (!MQTTClient_isConnected(g_mqtt_client))
+    {
+        log_error("MQTT disconnected, try reconnect\r\n");
+        mqtt_try_reconnect();
+    }
+    if (MQTTClient_isConnected(g_mqtt_client))
+    {
+        mqtt_pending_flush();
+    }
+}
+
+/* MQTT 守护线程：消息由 Paho 回调分发，这里负责断线重连和补发 */
 static int mqtt_sub_task(void *arg)
 {
     (void)arg; /* 线程启动后不再需要额外参数 */
@@ -287,78 +608,40 @@ static int mqtt_sub_task(void *arg)
     {
         return -1;
     }
+    mqtt_register_default_handlers();
 
     while (1)
     {
-        /* 喂狗防止系统复位 */
-        uapi_watchdog_kick();
-
-        char *recv_topic = NULL;
-        int topic_len = 0;
-        MQTTClient_message *msg = NULL;
-
-        /* 阻塞等待消息，超时 1 秒，方便循环中维持喂狗 */
-        int rc = MQTTClient_receive(g_mqtt_client, &recv_topic, &topic_len, &msg, 1000);
-        if (rc == MQTTCLIENT_SUCCESS && msg != NULL)
-        {
-            if (msg->payloadlen > 0 && msg->payload != NULL)
-            {
-                /* 确保字符串结尾 */
-                int copy_len = msg->payloadlen;
-                if (copy_len >= 1024)
-                    copy_len = 1023;
-                char buf[1024];
-                memcpy(buf, msg->payload, copy_len);
-                buf[copy_len] = '\0';
-
-                /* 如果主题是 report，则解析字段 */
-                if (recv_topic && (strcmp(recv_topic, "report") == 0 || strcmp(recv_topic, "devices/report") == 0))
-                {
-                    process_report_payload(buf);
-                }
-                else if (recv_topic && (recv_topic[0] == 'C' && recv_topic[1] == 'o'))
-                {
-                    /* 在字符串两端添加 '[' 和 ']' 再发送，避免大数组占用线程栈 */
-                    uint16_t send_len = (uint16_t)(copy_len + 2); /* 不含结尾 NUL */
-                    uint8_t *send_buf = (uint8_t *)osal_vmalloc(send_len);
-                    if (send_buf != NULL)
-                    {
-                        send_buf[0] = '[';
-                        memcpy(send_buf + 1, buf, copy_len);
-                        send_buf[copy_len + 1] = ']';
-
-                        sle_uart_client_send_data(send_buf, send_len, 0, get_conn_id('E'));
-
-                        osal_vfree(send_buf);
-                    }
-                }
-                else
-                {
-                    log_info("MQTT payload: %s\r\n", buf);
-                }
-            }
-            MQTTClient_freeMessage(&msg);
-            MQTTClient_free(recv_topic);
-        }
-        else if (rc == MQTTCLIENT_DISCONNECTED)
-        {
-            /* 非超时错误，打印日志 */
-            log_error("MQTT disconnected, try reconnect\r\n");
-            mqtt_try_reconnect();
-            osal_msleep(500);
-        }
+        mqtt_supervise_once();
     }
 
     /* 不会执行到此处 */
     return 0;
 }
 
+int MqttRegisterHandler(const char *filter, MqttMsgHandler handler, void *arg)
+{
+    if (filter == NULL || mqtt_sync_init() != 0)
+        return -1;
+
+    osal_mutex_lock(&g_sub_table_mutex);
+    int rc = topic_trie_set_handler(&g_sub_table, filter, handler, arg);
+    osal_mutex_unlock(&g_sub_table_mutex);
+    if (rc != 0)
+    {
+        log_error("MQTT register handler for %s failed\r\n", filter);
+    }
+    return rc;
+}
+
 /* 仅做订阅，不会创建接收线程（需保证在任何线程调用网络 API 前）*/
 int MqttPreSubscribe(const char *topic)
 {
     if (topic == NULL)
         return -1;
 
+    mqtt_register_default_handlers();
+
     /* 确保连接 */
     if (!g_mqtt_inited && (MqttInit() != 0))
         return -1;
@@ -366,19 +649,13 @@ int MqttPreSubscribe(const char *topic)
     int rc_sub = MQTTClient_subscribe(g_mqtt_client, topic, MQTT_QOS);
     if (rc_sub == MQTTCLIENT_SUCCESS)
     {
-        /* 记录 topic */
-        int found = 0;
-        for (int i = 0; i < g_sub_count; ++i)
+        /* 记录到订阅表，重连时恢复 */
+        osal_mutex_lock(&g_sub_table_mutex);
+        int rc_rec = topic_trie_set_subscribed(&g_sub_table, topic, MQTT_QOS);
+        osal_mutex_unlock(&g_sub_table_mutex);
+        if (rc_rec != 0)
         {
-            if (strcmp(g_sub_topics[i], topic) == 0)
-            {
-                found = 1;
-                break;
-            }
-        }
-        if (!found && g_sub_count < MAX_SUB_TOPICS)
-        {
-            g_sub_topics[g_sub_count++] = strdup(topic);
+            log_error("MQTT record subscription %s failed\r\n", topic);
         }
         log_info("MQTT pre-subscribed to %s\r\n", topic);
     }
@@ -409,18 +686,77 @@ int MqttStartRecvTask(void)
     return 0;
 }
 
+typedef struct
+{
+    const char *filter;
+    int qos;
+} mqtt_sub_entry_t;
+
+typedef struct
+{
+    mqtt_sub_entry_t *items;
+    size_t count;
+    size_t cap;
+} mqtt_sub_list_t;
+
+static void mqtt_collect_sub(const char *filter, int qos, void *ctx)
+{
+    mqtt_sub_list_t *list = (mqtt_sub_list_t *)ctx;
+    if (list->count < list->cap)
+    {
+        list->items[list->count].filter = filter;
+        list->items[list->count].qos = qos;
+        list->count++;
+    }
+}
+
+/*
+ * 持锁只拷贝订阅列表，解锁后再逐个订阅：MQTTClient_subscribe 要等 SUBACK，
+ * 而接收线程此时可能正在分发消息并等待 g_sub_table_mutex
+ */
+static void mqtt_resubscribe_all(void)
+{
+    mqtt_sub_list_t list = {NULL, 0, 0};
+    osal_mutex_lock(&g_sub_table_mutex);
+    if (g_sub_table.count > 0)
+    {
+        list.items = (mqtt_sub_entry_t *)osal_vmalloc(g_sub_table.count * sizeof(mqtt_sub_entry_t));
+        list.cap = (list.items != NULL) ? g_sub_table.count : 0;
+        topic_trie_foreach_subscribed(&g_sub_table, mqtt_collect_sub, &list);
+    }
+    osal_mutex_unlock(&g_sub_table_mutex);
+    if (g_sub_table.count > 0 && list.items == NULL)
+    {
+        log_error("MQTT resubscribe list alloc failed\r\n");
+        return;
+    }
+
+    for (size_t i = 0; i < list.count; i++)
+    {
+        int rc = MQTTClient_subscribe(g_mqtt_client, list.items[i].filter, list.items[i].qos);
+        if (rc != MQTTCLIENT_SUCCESS)
+        {
+            log_error("MQTT resubscribe %s failed rc=%d\r\n", list.items[i].filter, rc);
+        }
+    }
+    if (list.items != NULL)
+    {
+        osal_vfree(list.items);
+    }
+}
+
 /* 重新连接并重新订阅（供内部使用）*/
 static void mqtt_try_reconnect(void)
 {
+    osal_mutex_lock(&g_mqtt_reconnect_mutex);
     if (MQTTClient_isConnected(g_mqtt_client))
+    {
+        osal_mutex_unlock(&g_mqtt_reconnect_mutex);
         return;
+    }
 
     MQTTClient_connectOptions conn_opts = MQTTClient_connectOptions_initializer;
-    conn_opts.struct_version = 6;
-    conn_opts.keepAliveInterval = 120;
-    conn_opts.cleansession = 1;
-    conn_opts.reliable = 0;
-    conn_opts.maxInflightMessages = 50;
+    mqtt_fill_conn_opts(&conn_opts);
 
     for (int retry = 0; retry < 5; ++retry)
     {
@@ -428,14 +764,13 @@ static void mqtt_try_reconnect(void)
         if (rc == MQTTCLIENT_SUCCESS)
         {
             log_info("MQTT reconnect ok\r\n");
-            /* 重新订阅 */
-            for (int i = 0; i < g_sub_count; ++i)
-            {
-                MQTTClient_subscribe(g_mqtt_client, g_sub_topics[i], MQTT_QOS);
-            }
+            /* 按订阅表重新订阅 */
+            mqtt_resubscribe_all();
+            osal_mutex_unlock(&g_mqtt_reconnect_mutex);
             return;
         }
         log_error("MQTT reconnect failed rc=%d\r\n", rc);
         osal_msleep(1000);
     }
+    osal_mutex_unlock(&g_mqtt_reconnect_mutex);
 }
\ No newline at end of file
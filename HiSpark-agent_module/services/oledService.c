@@ -4,37 +4,35 @@
 #include "pinctrl.h"
 #include "soc_osal.h"
 #include "i2c.h"
+#include "tcxo.h"
 #include <stdlib.h>
+#include <stdbool.h>
 #define I2C_MASTER_PIN_MODE 2   // I2C功能模式
 #define I2C_SET_BAUDRATE 400000 // 400kHz
 #define I2C_TASK_DURATION_MS 500
 #define CONFIG_I2C_MASTER_BUS_ID 1
 
-#include "frame_1.h"
-#include "frame_2.h"
-#include "frame_3.h"
-#include "frame_audio_1.h"
-#include "frame_audio_2.h"
-#include "frame_audio_3.h"
-#include "frame_audio_4.h"
-#include "frame_audio_5.h"
-#include "frame_audio_6.h"
-#include "frame_audio_7.h"
-#include "frame_audio_8.h"
-#include "frame_audio_9.h"
-#include "frame_audio_10.h"
-#include "frame_audio_11.h"
-#include "frame_audio_12.h"
-#include "frame_audio_13.h"
-#include "frame_audio_14.h"
+#include "oled_frames_packed.h"
 #include "oledService.h"
-#define FRAME_BUF_SIZE (SSD1306_WIDTH * SSD1306_HEIGHT / 8)
+#include "soundService.h"
 #define OPEN_EYE_DELAY_MS 2000
 #define HALF_EYE_DELAY_MS 150
 #define CLOSE_EYE_DELAY_MS 100
 #define MIN_BLINK_INTERVAL_MS 1000    // 1s
 #define MAX_BLINK_INTERVAL_MS 5000    // 5s
-#define AUDIO_FRAME_DELAY_MS 100
+/* 音频动画帧周期，保持原来的 100 ms 播放速度，刷新耗时从休眠中扣除 */
+#define AUDIO_FRAME_PERIOD_MS 100
+/* 超过该时间未收到新电平（如仍在建立连接）则播放预置音频动画 */
+#define VU_LEVEL_TIMEOUT_MS 200
+/* 音量表布局：RMS 实心条 + 峰值保持竖线 + 底部刻度 */
+#define VU_BAR_TOP 20
+#define VU_BAR_BOTTOM 43
+#define VU_PEAK_TOP 14
+#define VU_PEAK_BOTTOM 49
+#define VU_SCALE_TOP 56
+#define VU_SCALE_BOTTOM 59
+#define VU_SCALE_STEP 16
+#define VU_PEAK_DECAY_PX 2
 
 /* OLED 当前模式（默认为 IDLE） */
 static volatile int g_oled_mode = OLED_MODE_IDLE;
@@ -53,12 +51,158 @@ static void OledInitPins(void)
     uapi_pin_set_pull(16, PIN_PULL_TYPE_UP);
 }
 
-static void ShowFrame(const unsigned char *frame)
+/* 预编码动画：首帧关键帧 + 相邻帧差分，delta[offsets[i]..offsets[i+1]) 为第 i-1 帧到第 i 帧 */
+typedef struct
 {
-    ssd1306_DrawBitmap(frame, FRAME_BUF_SIZE);
+    const uint8_t *key;
+    uint32_t key_len;
+    const uint8_t *delta;
+    const uint16_t *offsets;
+    uint32_t count;
+} OledAnim;
+
+static const OledAnim g_eye_anim = {
+    g_oled_eye_key, sizeof(g_oled_eye_key), g_oled_eye_delta, g_oled_eye_delta_offsets, OLED_EYE_FRAME_COUNT};
+static const OledAnim g_audio_anim = {
+    g_oled_audio_key, sizeof(g_oled_audio_key), g_oled_audio_delta, g_oled_audio_delta_offsets,
+    OLED_AUDIO_FRAME_COUNT};
+
+/* 当前缓冲区中的动画与帧号，用于判断能否直接套用差分 */
+static const OledAnim *g_cur_anim = NULL;
+static uint32_t g_cur_frame = 0;
+
+static void ShowFrame(const OledAnim *anim, uint32_t idx)
+{
+    if (g_cur_anim != anim || idx != (g_cur_frame + 1) % anim->count)
+    {
+        /* 切换动画或跳帧：从关键帧重建，再依次套用差分 */
+        ssd1306_Fill(Black);
+        ssd1306_ApplyDelta(anim->key, anim->key_len);
+        for (uint32_t i = 1; i <= idx; ++i)
+        {
+            ssd1306_ApplyDelta(&anim->delta[anim->offsets[i]], anim->offsets[i + 1] - anim->offsets[i]);
+        }
+    }
+    else
+    {
+        ssd1306_ApplyDelta(&anim->delta[anim->offsets[idx]], anim->offsets[idx + 1] - anim->offsets[idx]);
+    }
+    g_cur_anim = anim;
+    g_cur_frame = idx;
     ssd1306_UpdateScreen();
 }
 
+/* 音量表当前状态（像素宽度），只在两次之间变化的列上改写缓冲区 */
+static bool g_vu_active = false;
+static uint8_t g_vu_bar = 0;
+static uint8_t g_vu_peak = 0;
+
+/* 对数刻度：log2 取 Q3 定点，电平 16~32767 映射到 0~SSD1306_WIDTH */
+static uint8_t VuLevelToPx(uint16_t level)
+{
+    if (level < 16)
+    {
+        return 0;
+    }
+    uint32_t msb = 31 - (uint32_t)__builtin_clz(level);
+    uint32_t q3 = msb * 8 + ((level >> (msb - 3)) & 7);
+    uint32_t px = (q3 - 32) * SSD1306_WIDTH / 88;
+    return (uint8_t)(px > SSD1306_WIDTH ? SSD1306_WIDTH : px);
+}
+
+static void VuBegin(void)
+{
+    ssd1306_Fill(Black);
+    for (uint8_t x = 0; x < SSD1306_WIDTH; x += VU_SCALE_STEP)
+    {
+        ssd1306_FillRectangle(x, VU_SCALE_TOP, x, VU_SCALE_BOTTOM, White);
+    }
+    g_vu_bar = 0;
+    g_vu_peak = 0;
+    g_vu_active = true;
+    /* 缓冲区已被改写，下次显示动画需从关键帧重建 */
+    g_cur_anim = NULL;
+}
+
+/* 返回缓冲区是否有改动 */
+static bool VuRender(const sound_level_t *lv)
+{
+    uint8_t bar = VuLevelToPx(lv->rms);
+    uint8_t peak = VuLevelToPx(lv->peak);
+    uint8_t held = (g_vu_peak > VU_PEAK_DECAY_PX) ? (uint8_t)(g_vu_peak - VU_PEAK_DECAY_PX) : 0;
+    peak = (peak > held) ? peak : held;
+    peak = (peak > bar) ? peak : bar;
+    if (bar == g_vu_bar && peak == g_vu_peak)
+    {
+        return false;
+    }
+
+    if (bar > g_vu_bar)
+    {
+        ssd1306_FillRectangle(g_vu_bar, VU_BAR_TOP, bar - 1, VU_BAR_BOTTOM, White);
+    }
+    else if (bar < g_vu_bar)
+    {
+        ssd1306_FillRectangle(bar, VU_BAR_TOP, g_vu_bar - 1, VU_BAR_BOTTOM, Black);
+    }
+
+    if (peak != g_vu_peak && g_vu_peak > 0)
+    {
+        uint8_t x = g_vu_peak - 1;
+        ssd1306_FillRectangle(x, VU_PEAK_TOP, x, VU_PEAK_BOTTOM, Black);
+        if (x < bar)
+        {
+            ssd1306_FillRectangle(x, VU_BAR_TOP, x, VU_BAR_BOTTOM, White);
+        }
+    }
+    /* 峰值不变时条缩短也可能擦掉峰值线在条区域内的一段，总是重画；未变的字节不会下发 */
+    if (peak > 0)
+    {
+        ssd1306_FillRectangle(peak - 1, VU_PEAK_TOP, peak - 1, VU_PEAK_BOTTOM, White);
+    }
+    g_vu_bar = bar;
+    g_vu_peak = peak;
+    return true;
+}
+
+static uint32_t g_audio_idx = 0;
+static uint32_t g_last_level_seq = 0;
+static uint64_t g_last_level_ms = 0;
+
+/* 录音模式下的一帧：有新电平时画音量表，否则播放预置音频动画；返回距下一帧应休眠的毫秒数 */
+static uint32_t OledAudioFrame(void)
+{
+    uint64_t start = uapi_tcxo_get_ms();
+    sound_level_t lv;
+    uint32_t seq = sound_recorder_get_level(&lv);
+    if (seq != g_last_level_seq)
+    {
+        g_last_level_seq = seq;
+        g_last_level_ms = start;
+    }
+
+    if (start - g_last_level_ms < VU_LEVEL_TIMEOUT_MS)
+    {
+        /* 采集在跑：按最新电平绘制音量表，UpdateScreen 只下发变化的列 */
+        if (!g_vu_active)
+        {
+            VuBegin();
+        }
+        if (VuRender(&lv))
+        {
+            ssd1306_UpdateScreen();
+        }
+    }
+    else
+    {
+        g_vu_active = false;
+        ShowFrame(&g_audio_anim, g_audio_idx);
+        g_audio_idx = (g_audio_idx + 1) % g_audio_anim.count;
+    }
+    uint32_t cost = (uint32_t)(uapi_tcxo_get_ms() - start);
+    return cost < AUDIO_FRAME_PERIOD_MS ? AUDIO_FRAME_PERIOD_MS - cost : 1;
+}
+
 void *OledTask(const char *arg)
 {
     (void)arg;
@@ -70,39 +214,28 @@ void *OledTask(const char *arg)
     ssd1306_Fill(Black);
     ssd1306_UpdateScreen();
 
-    /* 机器人眼睛帧序列与对应延时 */
-    const unsigned char *eye_frames[] = {gImage_frame_1, gImage_frame_2, gImage_frame_3, gImage_frame_2};
-    uint32_t eye_delays[] = {OPEN_EYE_DELAY_MS, HALF_EYE_DELAY_MS, CLOSE_EYE_DELAY_MS, HALF_EYE_DELAY_MS};
-    const uint32_t eye_frameCnt = sizeof(eye_frames) / sizeof(eye_frames[0]);
-
-    /* 音频动画帧序列 */
-    const unsigned char *audio_frames[] = {
-        gImage_frame_audio_1, gImage_frame_audio_2, gImage_frame_audio_3, gImage_frame_audio_4,
-        gImage_frame_audio_5, gImage_frame_audio_6, gImage_frame_audio_7, gImage_frame_audio_8,
-        gImage_frame_audio_9, gImage_frame_audio_10, gImage_frame_audio_11, gImage_frame_audio_12,
-        gImage_frame_audio_13, gImage_frame_audio_14};
-    const uint32_t audio_frameCnt = sizeof(audio_frames) / sizeof(audio_frames[0]);
+    /* 机器人眼睛帧（睁-半-闭-半）对应延时 */
+    uint32_t eye_delays[OLED_EYE_FRAME_COUNT] = {OPEN_EYE_DELAY_MS, HALF_EYE_DELAY_MS, CLOSE_EYE_DELAY_MS,
+                                                 HALF_EYE_DELAY_MS};
+    g_last_level_seq = sound_recorder_get_level(NULL);
 
     while (1)
     {
         if (g_oled_mode == OLED_MODE_AUDIO)
         {
-            /* 循环显示音频帧，直到模式切回 IDLE */
-            for (uint32_t i = 0; i < audio_frameCnt && g_oled_mode == OLED_MODE_AUDIO; ++i)
-            {
-                ShowFrame(audio_frames[i]);
-                osal_msleep(AUDIO_FRAME_DELAY_MS);
-            }
+            osal_msleep(OledAudioFrame());
             continue; /* 重新检查模式 */
         }
+        g_vu_active = false;
+        g_audio_idx = 0;
 
         /* 为睁眼帧设置 1~5 秒的随机停留时间 */
         uint32_t rnd = (uint32_t)(rand() % (MAX_BLINK_INTERVAL_MS - MIN_BLINK_INTERVAL_MS + 1));
         eye_delays[0] = MIN_BLINK_INTERVAL_MS + rnd;
 
-        for (uint32_t i = 0; i < eye_frameCnt; ++i)
+        for (uint32_t i = 0; i < g_eye_anim.count; ++i)
         {
-            ShowFrame(eye_frames[i]);
+            ShowFrame(&g_eye_anim, i);
             osal_msleep(eye_delays[i]);
             if (g_oled_mode == OLED_MODE_AUDIO)
             {
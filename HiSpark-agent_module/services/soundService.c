@@ -33,6 +33,50 @@ static volatile size_t g_rec_frames = 0;
 /* 录音硬件启停状态 */
 static int g_rec_hw_open = 0;
 
+/* 电平邮箱：高 16 位 RMS、低 16 位峰值，单写者单字写入，读者无需加锁；序号每块递增 */
+static volatile uint32_t g_level_word = 0;
+static volatile uint32_t g_level_seq = 0;
+
+static uint32_t level_isqrt(uint32_t v)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > v)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (v >= root + bit)
+        {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+static void level_publish(uint64_t sum_sq, uint32_t peak, size_t n)
+{
+    uint32_t rms = (n == 0) ? 0 : level_isqrt((uint32_t)(sum_sq / n));
+    peak = (peak > 0x7FFF) ? 0x7FFF : peak;
+    g_level_word = (rms << 16) | peak;
+    g_level_seq++;
+}
+
+static inline void level_accumulate(uint16_t raw, uint64_t *sum_sq, uint32_t *peak)
+{
+    int32_t s = (int16_t)raw;
+    uint32_t mag = (uint32_t)((s < 0) ? -s : s);
+    *sum_sq += mag * mag;
+    *peak = (mag > *peak) ? mag : *peak;
+}
+
 /* I2S RX 中断回调，将接收到的数据拷贝到录音缓冲 */
 static void i2s_rx_callback(uint32_t *left_buff, uint32_t *right_buff, uint32_t length)
 {
@@ -235,17 +279,21 @@ size_t sound_recorder_read(uint16_t *buf, size_t max_samples)
 
     /* Merge 数据格式：低 16 位为左声道，高 16 位为右声道。*/
     size_t out_idx = 0;
+    uint64_t sum_sq = 0;
+    uint32_t peak = 0;
     for (size_t i = 0; i < max_samples; ++i)
     {
         uint32_t frame = rx_tmp[i];
         buf[out_idx++] = (uint16_t)(frame & 0xFFFF); // L
         buf[out_idx++] = (uint16_t)(frame & 0xFFFF); // R
+        level_accumulate((uint16_t)(frame & 0xFFFF), &sum_sq, &peak);
         if ((i & 0x3F) == 0)
         { /* 每 64 个采样踢一次狗 */
             uapi_watchdog_kick();
         }
     }
     uapi_watchdog_kick();
+    level_publish(sum_sq, peak, max_samples);
     return max_samples * 2;
 
 #else
@@ -268,6 +316,13 @@ size_t sound_recorder_read(uint16_t *buf, size_t max_samples)
         osal_udelay(20);
     }
 
+    uint64_t sum_sq = 0;
+    uint32_t peak = 0;
+    for (size_t i = 0; i < g_rec_frames; ++i)
+    {
+        level_accumulate(buf[i], &sum_sq, &peak);
+    }
+    level_publish(sum_sq, peak, g_rec_frames);
     return g_rec_frames;
 #endif
 }
@@ -290,4 +345,16 @@ void sound_recorder_close(void)
     g_dma_attr_configured = 0;
     g_tx_dma_started = 0;
 #endif
+}
+
+uint32_t sound_recorder_get_level(sound_level_t *level)
+{
+    uint32_t seq = g_level_seq;
+    uint32_t word = g_level_word;
+    if (level != NULL)
+    {
+        level->rms = (uint16_t)(word >> 16);
+        level->peak = (uint16_t)(word & 0xFFFF);
+    }
+    return seq;
 }
\ No newline at end of file
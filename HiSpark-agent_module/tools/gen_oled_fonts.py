@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+把 driver/oled/my_ssd1306_fonts.c 中行优先的 FontWxH 字库预先栅格化为 SSD1306 原生的
+页格式列数据，生成 include/resources/oled_fonts_packed.h，供 ssd1306_DrawChar 整列拷贝。
+
+用法: python3 tools/gen_oled_fonts.py
+
+每个字形按列存放，每列 ceil(H/8) 个字节，第 p 个字节的 bit n 为第 p*8+n 行。
+"""
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC = os.path.join(HERE, "..", "driver", "oled", "my_ssd1306_fonts.c")
+OUT_FILE = os.path.join(HERE, "..", "include", "resources", "oled_fonts_packed.h")
+
+FIRST_CHAR = 32
+LAST_CHAR = 126
+
+
+def load_fonts(text):
+    fonts = {}
+    for m in re.finditer(r"FontDef\s+Font_(\d+)x(\d+)\s*=\s*\{\s*\d+\s*,\s*\d+\s*,\s*(\w+)", text):
+        fonts[m.group(3)] = (int(m.group(1)), int(m.group(2)))
+    result = []
+    for name, (w, h) in fonts.items():
+        body = re.search(r"static const unsigned short %s\[\]\s*=\s*\{(.*?)\};" % name, text, re.S)
+        if body is None:
+            sys.exit("font table %s not found" % name)
+        code = re.sub(r"//[^\n]*", "", body.group(1))
+        rows = [int(v, 16) for v in re.findall(r"0[xX][0-9a-fA-F]+", code)]
+        glyphs = LAST_CHAR - FIRST_CHAR + 1
+        if len(rows) != glyphs * h:
+            sys.exit("%s: expected %d rows, got %d" % (name, glyphs * h, len(rows)))
+        result.append((name, w, h, rows))
+    return result
+
+
+def rasterize(w, h, rows):
+    pages = (h + 7) // 8
+    out = []
+    for g in range(LAST_CHAR - FIRST_CHAR + 1):
+        glyph = rows[g * h:(g + 1) * h]
+        for x in range(w):
+            col = [0] * pages
+            for y in range(h):
+                if (glyph[y] << x) & 0x8000:
+                    col[y // 8] |= 1 << (y % 8)
+            out += col
+    return out
+
+
+def main():
+    with open(SRC, encoding="utf-8") as f:
+        text = f.read()
+    parts = []
+    total = 0
+    for name, w, h, rows in load_fonts(text):
+        data = rasterize(w, h, rows)
+        total += len(data)
+        lines = ["static const uint8_t %sCols[%d] = {" % (name, len(data))]
+        for off in range(0, len(data), 16):
+            lines.append("    " + ", ".join("0x%02X" % v for v in data[off:off + 16]) + ",")
+        lines.append("};")
+        parts.append("\n".join(lines))
+
+    header = [
+        "/* 由 tools/gen_oled_fonts.py 生成，请勿手工修改 */",
+        "/* 预栅格化字库共 %d 字节 */" % total,
+        "#ifndef OLED_FONTS_PACKED_H",
+        "#define OLED_FONTS_PACKED_H",
+        "#include <stdint.h>",
+        "",
+    ]
+    with open(OUT_FILE, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(header) + "\n" + "\n\n".join(parts) + "\n\n#endif\n")
+    print("%d bytes of page-native glyph columns" % total)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""
+把 include/resources 下行优先 1bpp 的 OLED 动画帧转换为 SSD1306 原生页格式，
+并按帧间差分 + RLE 编码，生成 include/resources/oled_frames_packed.h。
+
+用法: python3 tools/gen_oled_frames.py
+
+编码格式（解码见 ssd1306_ApplyDelta）:
+    0b00nnnnnn  后跟 n+1 个字节，原样写入
+    0b01nnnnnn v  连续 n+1 个字节写入 v
+    0b1nnnnnnn  跳过 n+1 个字节（与上一帧相同）
+每个动画序列保存首帧的关键帧（相对全 0 缓冲区）以及相邻帧之间的差分，
+第 0 个差分为末帧回到首帧。
+"""
+import os
+import re
+import sys
+
+WIDTH = 128
+HEIGHT = 64
+FRAME_SIZE = WIDTH * HEIGHT // 8
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+RES_DIR = os.path.join(HERE, "..", "include", "resources")
+OUT_FILE = os.path.join(RES_DIR, "oled_frames_packed.h")
+
+# 序列名 -> 帧头文件（按播放顺序）
+SEQUENCES = [
+    ("eye", ["frame_1", "frame_2", "frame_3", "frame_2"]),
+    ("audio", ["frame_audio_%d" % i for i in range(1, 15)]),
+]
+
+
+def load_row_major(name):
+    with open(os.path.join(RES_DIR, name + ".h"), encoding="utf-8") as f:
+        text = f.read()
+    body = text[text.index("{") + 1:text.rindex("}")]
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.S)
+    data = [int(v, 16) for v in re.findall(r"0[xX][0-9a-fA-F]{1,2}", body)]
+    if len(data) != FRAME_SIZE:
+        sys.exit("%s: expected %d bytes, got %d" % (name, FRAME_SIZE, len(data)))
+    return data
+
+
+def to_page_major(rows):
+    """行优先、MSB 在左 -> SSD1306 页格式（buf[x + page*WIDTH] 的 bit n 为第 page*8+n 行）"""
+    out = [0] * FRAME_SIZE
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if rows[y * WIDTH // 8 + x // 8] & (0x80 >> (x % 8)):
+                out[x + (y // 8) * WIDTH] |= 1 << (y % 8)
+    return out
+
+
+def encode(base, target):
+    out = []
+    i = 0
+    n = len(target)
+    while i < n:
+        if base[i] == target[i]:
+            j = i
+            while j < n and base[j] == target[j] and j - i < 128:
+                j += 1
+            if j == n:
+                break  # 末尾不变的部分无需编码
+            out.append(0x80 | (j - i - 1))
+            i = j
+            continue
+        # 变化段：直到出现连续 2 个不变字节为止
+        j = i
+        while j < n and not (base[j] == target[j] and (j + 1 >= n or base[j + 1] == target[j + 1])):
+            j += 1
+        k = i
+        lit = []
+        while k < j:
+            r = k
+            while r < j and target[r] == target[k] and r - k < 64:
+                r += 1
+            if r - k >= 3:
+                flush_literal(out, lit)
+                out += [0x40 | (r - k - 1), target[k]]
+                k = r
+            else:
+                lit.append(target[k])
+                k += 1
+        flush_literal(out, lit)
+        i = j
+    return out
+
+
+def flush_literal(out, lit):
+    while lit:
+        chunk = lit[:64]
+        del lit[:64]
+        out.append(len(chunk) - 1)
+        out += chunk
+
+
+def decode(base, stream):
+    buf = list(base)
+    pos = 0
+    i = 0
+    while i < len(stream):
+        op = stream[i]
+        i += 1
+        if op & 0x80:
+            pos += (op & 0x7F) + 1
+        elif op & 0x40:
+            cnt = (op & 0x3F) + 1
+            buf[pos:pos + cnt] = [stream[i]] * cnt
+            pos += cnt
+            i += 1
+        else:
+            cnt = op + 1
+            buf[pos:pos + cnt] = stream[i:i + cnt]
+            pos += cnt
+            i += cnt
+    return buf
+
+
+def c_array(name, data, ctype="uint8_t"):
+    lines = ["static const %s %s[%d] = {" % (ctype, name, len(data))]
+    for off in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02X" % v if ctype == "uint8_t" else str(v)
+                                        for v in data[off:off + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parts = []
+    raw_total = 0
+    packed_total = 0
+    seen = set()
+    for seq, names in SEQUENCES:
+        frames = [to_page_major(load_row_major(n)) for n in names]
+        raw_total += FRAME_SIZE * len(set(names) - seen)
+        seen |= set(names)
+        key = encode([0] * FRAME_SIZE, frames[0])
+        deltas = []
+        offsets = [0]
+        for i in range(len(frames)):
+            d = encode(frames[i - 1], frames[i])
+            assert decode(frames[i - 1], d) == frames[i]
+            deltas += d
+            offsets.append(len(deltas))
+        assert decode([0] * FRAME_SIZE, key) == frames[0]
+        packed_total += len(key) + len(deltas) + 2 * len(offsets)
+        parts.append(c_array("g_oled_%s_key" % seq, key))
+        parts.append(c_array("g_oled_%s_delta" % seq, deltas))
+        parts.append(c_array("g_oled_%s_delta_offsets" % seq, offsets, "uint16_t"))
+        parts.append("#define OLED_%s_FRAME_COUNT %d" % (seq.upper(), len(frames)))
+
+    header = [
+        "/* 由 tools/gen_oled_frames.py 生成，请勿手工修改 */",
+        "/* 原始帧 %d 字节，编码后 %d 字节 */" % (raw_total, packed_total),
+        "#ifndef OLED_FRAMES_PACKED_H",
+        "#define OLED_FRAMES_PACKED_H",
+        "#include <stdint.h>",
+        "",
+    ]
+    with open(OUT_FILE, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(header) + "\n" + "\n\n".join(parts) + "\n\n#endif\n")
+    print("raw %d bytes -> packed %d bytes" % (raw_total, packed_total))
+
+
+if __name__ == "__main__":
+    main()
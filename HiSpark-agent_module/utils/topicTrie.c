@@ -0,0 +1,195 @@
+#include "topicTrie.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* 返回从 s 开始的本层长度（到 '/' 或结尾） */
+static size_t level_length(const char *s, size_t remain)
+{
+    const char *slash = memchr(s, '/', remain);
+    return slash ? (size_t)(slash - s) : remain;
+}
+
+static bool level_is(const topic_trie_node_t *node, char wildcard)
+{
+    return node->level_len == 1 && node->level[0] == wildcard;
+}
+
+/* 查找或创建 filter 对应的节点 */
+static topic_trie_node_t *topic_trie_get_node(topic_trie_t *trie, const char *filter)
+{
+    if (trie == NULL || filter == NULL || filter[0] == '\0')
+    {
+        return NULL;
+    }
+    size_t remain = strlen(filter);
+    const char *p = filter;
+    topic_trie_node_t *node = &trie->root;
+
+    while (1)
+    {
+        size_t len = level_length(p, remain);
+        /* '#' 只能是最后一层，'+'/'#' 必须独占一层 */
+        if ((memchr(p, '#', len) && (len != 1 || len != remain)) || (memchr(p, '+', len) && len != 1))
+        {
+            return NULL;
+        }
+
+        topic_trie_node_t *child = node->child;
+        while (child && !(child->level_len == len && memcmp(child->level, p, len) == 0))
+        {
+            child = child->next;
+        }
+        if (child == NULL)
+        {
+            child = (topic_trie_node_t *)calloc(1, sizeof(topic_trie_node_t));
+            if (child == NULL)
+            {
+                return NULL;
+            }
+            child->level = (char *)malloc(len + 1);
+            if (child->level == NULL)
+            {
+                free(child);
+                return NULL;
+            }
+            memcpy(child->level, p, len);
+            child->level[len] = '\0';
+            child->level_len = len;
+            child->next = node->child;
+            node->child = child;
+        }
+        node = child;
+
+        if (len == remain)
+        {
+            break;
+        }
+        p += len + 1;
+        remain -= len + 1;
+    }
+
+    if (node->filter == NULL)
+    {
+        node->filter = strdup(filter);
+        if (node->filter == NULL)
+        {
+            return NULL;
+        }
+        trie->count++;
+    }
+    return node;
+}
+
+int topic_trie_set_handler(topic_trie_t *trie, const char *filter, topic_trie_handler_t handler, void *arg)
+{
+    topic_trie_node_t *node = topic_trie_get_node(trie, filter);
+    if (node == NULL)
+    {
+        return -1;
+    }
+    node->handler = handler;
+    node->arg = arg;
+    return 0;
+}
+
+int topic_trie_set_subscribed(topic_trie_t *trie, const char *filter, int qos)
+{
+    topic_trie_node_t *node = topic_trie_get_node(trie, filter);
+    if (node == NULL)
+    {
+        return -1;
+    }
+    node->subscribed = true;
+    node->qos = qos;
+    return 0;
+}
+
+typedef struct
+{
+    const char *topic;
+    size_t topic_len;
+    const uint8_t *payload;
+    size_t len;
+} topic_trie_msg_t;
+
+static int call_handler(const topic_trie_node_t *node, const topic_trie_msg_t *msg)
+{
+    if (node->handler == NULL)
+    {
+        return 0;
+    }
+    node->handler(msg->topic, msg->topic_len, msg->payload, msg->len, node->arg);
+    return 1;
+}
+
+/* p/remain 为当前待匹配的层；p 为 NULL 表示主题已经匹配完 */
+static int match_level(const topic_trie_node_t *node, const char *p, size_t remain, bool first,
+                       const topic_trie_msg_t *msg)
+{
+    int hits = 0;
+    /* 以 '$' 开头的主题不被首层通配符匹配 */
+    bool sys = first && p != NULL && remain > 0 && p[0] == '$';
+    size_t len = (p != NULL) ? level_length(p, remain) : 0;
+
+    for (const topic_trie_node_t *child = node->child; child; child = child->next)
+    {
+        if (level_is(child, '#'))
+        {
+            /* "a/#" 同时匹配 "a" 本身 */
+            if (!sys)
+            {
+                hits += call_handler(child, msg);
+            }
+            continue;
+        }
+        if (p == NULL)
+        {
+            continue;
+        }
+        if ((level_is(child, '+') && !sys) || (child->level_len == len && memcmp(child->level, p, len) == 0))
+        {
+            if (len == remain)
+            {
+                hits += call_handler(child, msg);
+                hits += match_level(child, NULL, 0, false, msg);
+            }
+            else
+            {
+                hits += match_level(child, p + len + 1, remain - len - 1, false, msg);
+            }
+        }
+    }
+    return hits;
+}
+
+int topic_trie_dispatch(const topic_trie_t *trie, const char *topic, size_t topic_len,
+                        const uint8_t *payload, size_t len)
+{
+    if (trie == NULL || topic == NULL || topic_len == 0)
+    {
+        return 0;
+    }
+    topic_trie_msg_t msg = {topic, topic_len, payload, len};
+    return match_level(&trie->root, topic, topic_len, true, &msg);
+}
+
+static void foreach_node(const topic_trie_node_t *node, topic_trie_visit_t visit, void *ctx)
+{
+    for (const topic_trie_node_t *child = node->child; child; child = child->next)
+    {
+        if (child->subscribed && child->filter)
+        {
+            visit(child->filter, child->qos, ctx);
+        }
+        foreach_node(child, visit, ctx);
+    }
+}
+
+void topic_trie_foreach_subscribed(const topic_trie_t *trie, topic_trie_visit_t visit, void *ctx)
+{
+    if (trie == NULL || visit == NULL)
+    {
+        return;
+    }
+    foreach_node(&trie->root, visit, ctx);
+}
@@ -0,0 +1,78 @@
+/*
+ * 控制命令解码基准：网关下发格式（Python json.dumps）的单条命令、六条命令的数组和带大块无关字段的消息，
+ * 每条消息的解码时间和每字节的时间。命令表与 ExBoard_sample.c 的相同，apply 只计数
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ctrl_cmd.h"
+#include "host_test.h"
+
+static uint64_t g_applied = 0;
+
+static void count_apply(void *ctx, uint8_t arg, const int32_t value[CTRL_FIELD_MAX])
+{
+    (void)ctx;
+    g_applied += (uint64_t)arg + 1 + (uint32_t)value[0];
+}
+
+static const ctrl_cmd_t g_cmds[] = {
+    {"EngineControl_1", {"Angle"}, 0, count_apply},
+    {"EngineControl_2", {"Angle"}, 1, count_apply},
+    {"EngineControl_3", {"Angle"}, 2, count_apply},
+    {"SteeringControl", {"Start"}, 0, count_apply},
+    {"RGBControl", {"Mode", "Red", "Green", "Blue"}, 0, count_apply},
+    {"BuzzControl", {"Start"}, 0, count_apply},
+};
+
+typedef struct
+{
+    const char *name;
+    const char *json;
+    int32_t commands;
+} bench_msg_t;
+
+static const bench_msg_t g_msgs[] = {
+    {"servo", "{\"topic\": \"EngineControl_3\", \"Angle\": 135}", 1},
+    {"rgb", "{\"topic\": \"RGBControl\", \"Mode\": 2, \"Red\": 255, \"Green\": 128, \"Blue\": 0}", 1},
+    {"all six",
+     "[{\"topic\": \"EngineControl_1\", \"Angle\": 30}, {\"topic\": \"EngineControl_2\", \"Angle\": 60}, "
+     "{\"topic\": \"EngineControl_3\", \"Angle\": 90}, {\"topic\": \"SteeringControl\", \"Start\": 1}, "
+     "{\"topic\": \"RGBControl\", \"Mode\": 1, \"Red\": 10, \"Green\": 20, \"Blue\": 30}, "
+     "{\"topic\": \"BuzzControl\", \"Start\": 0}]",
+     6},
+    {"with metadata",
+     "{\"meta\": {\"source\": \"agent\", \"trace\": [1, 2, 3, 4, 5, 6, 7, 8], \"note\": \"turn \\\"left\\\" slowly\", "
+     "\"ts\": 1718000000.125, \"tags\": [{\"k\": \"room\", \"v\": \"lab\"}, {\"k\": \"user\", \"v\": null}]}, "
+     "\"topic\": \"EngineControl_1\", \"Angle\": 45, \"seq\": 1024}",
+     1},
+    {"unknown topic", "{\"topic\": \"FanControl\", \"Speed\": 3}", 0},
+};
+
+int main(int argc, char **argv)
+{
+    uint32_t rounds = (argc > 1) ? (uint32_t)atoi(argv[1]) : 200000;
+    uint8_t count = sizeof(g_cmds) / sizeof(g_cmds[0]);
+    for (uint32_t m = 0; m < sizeof(g_msgs) / sizeof(g_msgs[0]); m++)
+    {
+        const bench_msg_t *msg = &g_msgs[m];
+        const uint8_t *buf = (const uint8_t *)msg->json;
+        uint32_t len = (uint32_t)strlen(msg->json);
+        if (ctrl_decode(g_cmds, count, buf, len, NULL) != msg->commands)
+        {
+            fprintf(stderr, "%s: unexpected result\n", msg->name);
+            return 1;
+        }
+        uint64_t t0 = host_now_ns();
+        for (uint32_t r = 0; r < rounds; r++)
+        {
+            __asm__ volatile("" : : "r"(buf) : "memory");
+            (void)ctrl_decode(g_cmds, count, buf, len, NULL);
+        }
+        double ns = (double)(host_now_ns() - t0) / rounds;
+        printf("%-14s %4u bytes, %d command(s): %7.1f ns/message, %.2f ns/byte\n", msg->name, len, msg->commands, ns,
+               ns / len);
+    }
+    printf("(checksum %llu)\n", (unsigned long long)g_applied);
+    return 0;
+}
@@ -0,0 +1,185 @@
+/*
+ * draw_main_scene 基准：渲染两个平面并经硬件 SPI 路径送出，传输只计字节数。
+ * 与改动前的写法对比：两张整帧画布上逐像素 Paint_SetPixel 画背景、控件和文字，再整帧 EPD_Display
+ */
+#include "EPD_Sample.c"
+#include "EPD_font.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+
+static uint64_t g_spi_bytes = 0;
+
+static errcode_t count_spi(spi_bus_t bus, const uint8_t *buf, uint32_t len)
+{
+    (void)bus;
+    (void)buf;
+    g_spi_bytes += len;
+    return ERRCODE_SUCC;
+}
+
+static uint8_t ref_bw[EPD_W / 8 * EPD_H];
+static uint8_t ref_r[EPD_W / 8 * EPD_H];
+
+// 改动前的 EPD_ShowPicture：每个像素一次 Paint_SetPixel
+static void ref_show_picture(uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, const uint8_t BMP[],
+                             uint16_t Color)
+{
+    uint16_t x0 = x;
+    uint32_t bytes = (uint32_t)sizey * (sizex / 8 + ((sizex % 8) ? 1 : 0));
+    for (uint32_t i = 0; i < bytes; i++)
+    {
+        uint8_t temp = BMP[i];
+        for (uint8_t t = 0; t < 8; t++)
+        {
+            Paint_SetPixel(x, y, (temp & 0x80) ? !Color : Color);
+            x++;
+            temp <<= 1;
+        }
+        if ((x - x0) == sizex)
+        {
+            x = x0;
+            y++;
+        }
+    }
+}
+
+// 改动前的 EPD_ShowChar（场景里只用到 48 号字）：按列取字模，每列 8 个像素逐个写
+static void ref_show_char48(uint16_t x, uint16_t y, uint16_t chr, uint16_t color)
+{
+    uint16_t x0 = x;
+    uint16_t y0 = y;
+    for (uint16_t i = 0; i < sizeof(asc2_4824[0]); i++)
+    {
+        uint8_t temp = asc2_4824[chr - ' '][i];
+        for (uint8_t m = 0; m < 8; m++)
+        {
+            Paint_SetPixel(x, y, (temp & 0x01) ? color : !color);
+            temp >>= 1;
+            y++;
+        }
+        x++;
+        if ((x - x0) == 48 / 2)
+        {
+            x = x0;
+            y0 = y0 + 8;
+        }
+        y = y0;
+    }
+}
+
+static void ref_show_string48(uint16_t x, uint16_t y, const char *s, uint16_t color)
+{
+    for (; *s != '\0'; s++, x += 48 / 2)
+    {
+        ref_show_char48(x, y, (uint8_t)*s, color);
+    }
+}
+
+// 改动前的 EPD_ShowWatch(x, y, num, 4, 2, 48, color)
+static void ref_show_watch(uint16_t x, uint16_t y, float num, uint8_t color)
+{
+    uint8_t len = 4;
+    uint8_t pre = 2;
+    uint8_t sizex = 48 / 2;
+    uint16_t num1 = num * 100;
+    for (uint8_t t = 0; t < len; t++)
+    {
+        uint16_t div = 1;
+        for (uint8_t k = 0; k < len - t - 1; k++)
+        {
+            div *= 10;
+        }
+        uint8_t temp = (num1 / div) % 10;
+        if (t == (len - pre))
+        {
+            ref_show_char48(x + (len - pre) * sizex + (sizex / 2 - 2), y - 6, ':', color);
+            t++;
+            len += 1;
+        }
+        ref_show_char48(x + t * sizex, y, temp + 48, color);
+    }
+}
+
+// 改动前的 draw_main_scene
+static void ref_draw_main_scene(void)
+{
+    uapi_watchdog_kick();
+    Paint_SelectImage(ref_bw);
+    memset(ref_bw, WHITE, sizeof(ref_bw));
+    ref_show_picture(0, 0, 800, 272, UI_pic, BLACK);
+    ref_show_watch(CLOCK_X, CLOCK_Y, (float)time, BLACK);
+    const uint8_t *weather_pic = weather_picture();
+    if (weather_pic != NULL)
+    {
+        ref_show_picture(WEATHER_X, WEATHER_Y, WEATHER_W, WEATHER_H, weather_pic, BLACK);
+    }
+
+    Paint_SelectImage(ref_r);
+    memset(ref_r, BLACK, sizeof(ref_r));
+    format_sensor_strings();
+    ref_show_string48(125, 105, temperature_string, WHITE);
+    ref_show_string48(125, 205, humidity_string, WHITE);
+    ref_show_string48(410, 205, light_string, WHITE);
+    ref_show_string48(615, 205, air_string, WHITE);
+    if (caution == 0)
+    {
+        ref_show_picture(410, 85, 280, 85, gImage_warning_common, WHITE);
+    }
+
+    EPD_Display(ref_bw, ref_r);
+}
+
+// 两种写法画出的两个平面必须逐字节相同，否则计时没有意义
+static int same_frames(void)
+{
+    static uint8_t frame[EPD_W / 8 * EPD_H];
+    ref_draw_main_scene();
+    build_scene();
+    Paint_RenderBand(scene_bw, scene_bw_count, frame, 0, EPD_H, WHITE);
+    int same = (memcmp(frame, ref_bw, sizeof(frame)) == 0);
+    Paint_RenderBand(scene_r, scene_r_count, frame, 0, EPD_H, BLACK);
+    return same && (memcmp(frame, ref_r, sizeof(frame)) == 0);
+}
+
+static void bench(const char *name, void (*draw)(void), uint32_t iters)
+{
+    draw(); // 预热
+    g_spi_bytes = 0;
+    uint64_t t0 = host_now_ns();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        time = 12.0 + (i % 60) / 100.0;
+        draw();
+    }
+    uint64_t ns = (host_now_ns() - t0) / iters;
+    uint64_t bytes = g_spi_bytes / iters;
+    printf("%-24s %9llu ns/frame (host), %llu SPI bytes/frame, %.1f ms on the bus at %d MHz\n", name,
+           (unsigned long long)ns, (unsigned long long)bytes, bytes * 8.0 / (EPD_SPI_FREQ_MHZ * 1000.0),
+           EPD_SPI_FREQ_MHZ);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t iters = (argc > 1) ? (uint32_t)atoi(argv[1]) : 200;
+    fake_sdk_reset();
+    fake_spi_set_hook(count_spi);
+    EPD_Init();
+    Paint_NewImage(band_buf, EPD_W, EPD_H, 0, WHITE);
+    Paint_SelectBand(band_buf, 0, EPD_BAND_LINES);
+
+    temperature = 23.5;
+    humidity = 41.2;
+    light = 320;
+    air = 3.4;
+    weather = 3;
+    caution = 0;
+    if (!same_frames())
+    {
+        fprintf(stderr, "per-pixel reference and draw_main_scene differ\n");
+        return 1;
+    }
+
+    bench("per-pixel full frame", ref_draw_main_scene, iters);
+    bench("draw_main_scene", draw_main_scene, iters);
+    return 0;
+}
@@ -0,0 +1,209 @@
+/*
+ * EPD 文字基准：一行 20 个汉字（字库里只有“中”）和一行 20 个 ASCII 字符画到整帧画布上，改动前后对比。
+ * 改动前：按字号线性扫描 tfontNN/asc2_NNNN，逐像素 Paint_SetPixel；改动后：EPD_ShowChinese/EPD_ShowString 查字形索引、按行合并。
+ * 原来的 EPD_ShowChinese 每个字只前进 2 个字节，UTF-8 汉字串从第二个字起就错位，这里的参考写法按 3 个字节前进
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "EPD_GUI.h"
+#include "EPD_font.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+
+#define LINE_CHARS 20
+
+static uint8_t g_canvas[EPD_W / 8 * EPD_H];
+static uint8_t g_want[EPD_W / 8 * EPD_H];
+static char g_zh[LINE_CHARS * 3 + 1];
+static char g_ascii[LINE_CHARS + 1] = "Temp 23.5C Hum 41.2%";
+
+// 改动前的 EPD_ShowChineseNNxNN：线性扫描字库，按行、低位在前逐像素写前景
+static void ref_show_chinese_one(uint16_t x, uint16_t y, const uint8_t *s, uint8_t sizey, uint16_t color)
+{
+    const unsigned char *base;
+    uint32_t count;
+    uint32_t stride;
+    if (sizey == 12)
+    {
+        base = tfont12[0].Index, count = sizeof(tfont12) / sizeof(tfont12[0]), stride = sizeof(tfont12[0]);
+    }
+    else if (sizey == 16)
+    {
+        base = tfont16[0].Index, count = sizeof(tfont16) / sizeof(tfont16[0]), stride = sizeof(tfont16[0]);
+    }
+    else if (sizey == 24)
+    {
+        base = tfont24[0].Index, count = sizeof(tfont24) / sizeof(tfont24[0]), stride = sizeof(tfont24[0]);
+    }
+    else
+    {
+        base = tfont32[0].Index, count = sizeof(tfont32) / sizeof(tfont32[0]), stride = sizeof(tfont32[0]);
+    }
+    uint16_t bytes = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
+    uint16_t x0 = x;
+    for (uint32_t k = 0; k < count; k++)
+    {
+        const unsigned char *index = base + k * stride;
+        const unsigned char *msk = index + 4; // Index[4] 之后紧跟 Msk
+        if (index[0] != s[0] || index[1] != s[1])
+        {
+            continue;
+        }
+        for (uint16_t i = 0; i < bytes; i++)
+        {
+            for (uint8_t j = 0; j < 8; j++)
+            {
+                if (msk[i] & (0x01 << j))
+                {
+                    Paint_SetPixel(x, y, color);
+                }
+                x++;
+                if ((x - x0) == sizey)
+                {
+                    x = x0;
+                    y++;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+static void ref_show_chinese(uint16_t x, uint16_t y, const uint8_t *s, uint8_t sizey, uint16_t color)
+{
+    for (; *s != 0; s += 3, x += sizey)
+    {
+        ref_show_chinese_one(x, y, s, sizey, color);
+    }
+}
+
+// 改动前的 EPD_ShowChar：按列取字模，每列 8 个像素逐个写（背景也写）
+static void ref_show_char(uint16_t x, uint16_t y, uint16_t chr, uint16_t size1, uint16_t color)
+{
+    uint16_t x0 = x;
+    uint16_t y0 = y;
+    uint16_t size2 = (size1 == 8) ? 6 : (size1 / 8 + ((size1 % 8) ? 1 : 0)) * (size1 / 2);
+    uint16_t c = chr - ' ';
+    for (uint16_t i = 0; i < size2; i++)
+    {
+        uint8_t temp;
+        if (size1 == 8)
+        {
+            temp = asc2_0806[c][i];
+        }
+        else if (size1 == 12)
+        {
+            temp = asc2_1206[c][i];
+        }
+        else if (size1 == 16)
+        {
+            temp = asc2_1608[c][i];
+        }
+        else if (size1 == 24)
+        {
+            temp = asc2_2412[c][i];
+        }
+        else
+        {
+            temp = asc2_4824[c][i];
+        }
+        for (uint8_t m = 0; m < 8; m++)
+        {
+            Paint_SetPixel(x, y, (temp & 0x01) ? color : !color);
+            temp >>= 1;
+            y++;
+        }
+        x++;
+        if ((size1 != 8) && ((x - x0) == size1 / 2))
+        {
+            x = x0;
+            y0 = y0 + 8;
+        }
+        y = y0;
+    }
+}
+
+static void ref_show_string(uint16_t x, uint16_t y, const uint8_t *s, uint8_t size1, uint16_t color)
+{
+    for (; *s != 0; s++, x += size1 / 2)
+    {
+        ref_show_char(x, y, *s, size1, color);
+    }
+}
+
+static void new_show_chinese(uint16_t x, uint16_t y, const uint8_t *s, uint8_t sizey, uint16_t color)
+{
+    EPD_ShowChinese(x, y, (uint8_t *)s, sizey, color);
+}
+
+static void new_show_string(uint16_t x, uint16_t y, const uint8_t *s, uint8_t sizey, uint16_t color)
+{
+    EPD_ShowString(x, y, (uint8_t *)s, sizey, color);
+}
+
+typedef void (*show_fn)(uint16_t x, uint16_t y, const uint8_t *s, uint8_t sizey, uint16_t color);
+
+static double time_line(show_fn show, const char *text, uint8_t sizey, uint32_t iters)
+{
+    uint64_t t0 = host_now_ns();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        show(13, 40, (const uint8_t *)text, sizey, (i & 1) ? WHITE : BLACK);
+    }
+    return (double)(host_now_ns() - t0) / iters / 1000.0;
+}
+
+// 同一行文字两种写法画出的画布必须相同
+static int same_line(show_fn ref, show_fn now, const char *text, uint8_t sizey)
+{
+    Paint_SelectImage(g_want);
+    Paint_Clear(WHITE);
+    ref(13, 40, (const uint8_t *)text, sizey, BLACK);
+    Paint_SelectImage(g_canvas);
+    Paint_Clear(WHITE);
+    now(13, 40, (const uint8_t *)text, sizey, BLACK);
+    return memcmp(g_canvas, g_want, sizeof(g_canvas)) == 0;
+}
+
+static int bench(const char *what, show_fn ref, show_fn now, const char *text, uint8_t sizey, uint32_t iters)
+{
+    if (!same_line(ref, now, text, sizey))
+    {
+        fprintf(stderr, "%s size %u: reference and new output differ\n", what, sizey);
+        return 0;
+    }
+    double before = time_line(ref, text, sizey, iters);
+    double after = time_line(now, text, sizey, iters);
+    printf("%-8s size %2u: %7.2f us/line before, %6.2f us/line after (%.1fx)\n", what, sizey, before, after,
+           before / after);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t iters = (argc > 1) ? (uint32_t)atoi(argv[1]) : 5000;
+    fake_sdk_reset();
+    Paint_NewImage(g_canvas, EPD_W, EPD_H, 0, WHITE);
+    for (uint32_t i = 0; i < LINE_CHARS; i++)
+    {
+        memcpy(&g_zh[i * 3], tfont16[0].Index, 3);
+    }
+
+    static const uint8_t zh_sizes[] = {12, 16, 24, 32};
+    for (uint32_t s = 0; s < sizeof(zh_sizes); s++)
+    {
+        if (!bench("chinese", ref_show_chinese, new_show_chinese, g_zh, zh_sizes[s], iters))
+        {
+            return 1;
+        }
+    }
+    static const uint8_t ascii_sizes[] = {16, 24, 48};
+    for (uint32_t s = 0; s < sizeof(ascii_sizes); s++)
+    {
+        if (!bench("ascii", ref_show_string, new_show_string, g_ascii, ascii_sizes[s], iters))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
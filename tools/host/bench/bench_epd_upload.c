@@ -0,0 +1,84 @@
+/* 平面上传基准：原来按列逐字节 EPD_DataPut 与转置条带整块发送的 CPU 耗时和 SPI 传输次数 */
+#include <stdlib.h>
+#include "EPD.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+
+#define PLANE_BYTES (EPD_LINE_BYTES * Gate_BITS)
+
+static uint8_t g_image[PLANE_BYTES];
+static uint64_t g_spi_bytes = 0;
+static uint64_t g_spi_xfers = 0;
+
+static errcode_t count_spi(spi_bus_t bus, const uint8_t *buf, uint32_t len)
+{
+    (void)bus;
+    (void)buf;
+    g_spi_bytes += len;
+    g_spi_xfers++;
+    return ERRCODE_SUCC;
+}
+
+// 改动前的写法：每个字节从画布上跨 EPD_LINE_BYTES 读出，再逐个放进暂存区
+static void per_byte_plane(const uint8_t *image)
+{
+    uint32_t tempcol = 0;
+    uint32_t templine = 0;
+    for (uint8_t half = 0; half < 2; half++)
+    {
+        EPD_DataBegin();
+        for (uint32_t i = 0; i < ALLSCREEN_BYTES; i++)
+        {
+            uint8_t temp = image[templine * EPD_LINE_BYTES + tempcol];
+            templine++;
+            if (templine >= Gate_BITS)
+            {
+                tempcol++;
+                templine = 0;
+            }
+            EPD_DataPut(temp);
+        }
+        EPD_DataEnd();
+    }
+}
+
+static void strip_plane(const uint8_t *image)
+{
+    for (uint8_t half = 0; half < 2; half++)
+    {
+        EPD_DataBegin();
+        EPD_UploadHalf(image, half * Source_BYTES);
+        EPD_DataEnd();
+    }
+}
+
+static void bench(const char *name, void (*upload)(const uint8_t *), uint32_t iters)
+{
+    upload(g_image); // 预热
+    g_spi_bytes = 0;
+    g_spi_xfers = 0;
+    uint64_t t0 = host_now_ns();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        upload(g_image);
+    }
+    uint64_t ns = (host_now_ns() - t0) / iters;
+    printf("%-10s %7llu ns/plane (host), %llu SPI bytes in %llu transfers per plane\n", name, (unsigned long long)ns,
+           (unsigned long long)(g_spi_bytes / iters), (unsigned long long)(g_spi_xfers / iters));
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t iters = (argc > 1) ? (uint32_t)atoi(argv[1]) : 2000;
+    fake_sdk_reset();
+    EPD_Init();
+    fake_spi_set_hook(count_spi);
+    srand(1);
+    for (uint32_t i = 0; i < PLANE_BYTES; i++)
+    {
+        g_image[i] = (uint8_t)rand();
+    }
+    bench("per-byte", per_byte_plane, iters);
+    bench("strip", strip_plane, iters);
+    return 0;
+}
@@ -0,0 +1,43 @@
+/* ExBoard 开机画面基准：正、反显交替绘制，每次都整屏写入，统计耗时与 I2C 总线字节数 */
+#include <stdlib.h>
+#include "bmp.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "my_iic.h"
+#include "ssd1363.h"
+
+static uint64_t g_bus_bytes = 0;
+static uint64_t g_transfers = 0;
+
+static errcode_t count_i2c(i2c_bus_t bus, uint16_t addr, const uint8_t *buf, uint32_t len)
+{
+    (void)bus;
+    (void)addr;
+    (void)buf;
+    g_bus_bytes += len + 1;
+    g_transfers++;
+    return ERRCODE_SUCC;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t iters = (argc > 1) ? (uint32_t)atoi(argv[1]) : 500;
+    fake_sdk_reset();
+    fake_i2c_set_hooks(count_i2c, NULL);
+    OLED_Init();
+
+    g_bus_bytes = 0;
+    g_transfers = 0;
+    uint64_t t0 = host_now_ns();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        OLED_FB_DrawSingleBMP(0, 0, OLED_WIDTH, OLED_HEIGHT, ExBoard_pic, (uint8_t)(i & 1));
+        OLED_FB_Flush();
+    }
+    uint64_t ns = (host_now_ns() - t0) / iters;
+    double bytes = (double)g_bus_bytes / iters;
+    printf("splash: %llu ns/frame (host), %.0f I2C bytes/frame in %.1f transfers, %.1f ms on the bus at %d Hz\n",
+           (unsigned long long)ns, bytes, (double)g_transfers / iters, bytes * 9 * 1000.0 / IIC_BAUDRATE,
+           IIC_BAUDRATE);
+    return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * 网关 MQTT 基准：broker 替身为 fake_mqtt.c，发布立即成功，投递在调用线程里直接回调。
+ *   发布吞吐：QoS 0 遥测经 MqttPublishQos，QoS 1 告警从 SLE 通知回调进入（含 gw_us 拼接和转发给 P 板）
+ *   订阅时延：broker 投递 Control/ 主题消息到 ssapc_write_req 把它交给 ExBoard 连接的主机时间
+ * fake 只记录前 FAKE_MQTT_LOG_MAX 条报文，之后的发布不拷贝，时间基本是网关这一侧的开销。
+ * 最后统计 broker 离线时 SLE 回调在假时钟上被占用的时间（重连只在守护线程里做）
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "gateService.c"
+#include "fake_agent.h"
+#include "fake_mqtt.h"
+#include "fake_sdk.h"
+#include "fake_sle.h"
+#include "host_test.h"
+
+#define CONN_E 1
+#define CONN_P 2
+
+static uint64_t g_write_ns = 0;
+static uint32_t g_writes_e = 0;
+
+static errcode_t stack_write(uint8_t client_id, uint16_t conn_id, const ssapc_write_param_t *param)
+{
+    (void)client_id;
+    (void)param;
+    if (conn_id == CONN_E)
+    {
+        g_write_ns = host_now_ns();
+        g_writes_e++;
+    }
+    return ERRCODE_SUCC;
+}
+
+static void connect_boards(void)
+{
+    fake_sdk_reset();
+    fake_sle_reset();
+    fake_agent_reset();
+    fake_mqtt_reset();
+    fake_ssapc_set_write_hook(stack_write);
+    sle_uart_client_init(NULL, NULL);
+    sle_addr_t e = {0, {0x20, 1, 0, 0, 0, 0}};
+    sle_addr_t p = {0, {0x20, 2, 0, 0, 0, 0}};
+    fake_sle_connect(CONN_E, &e);
+    fake_sle_connect(CONN_P, &p);
+    set_conn_id('E', CONN_E);
+    set_conn_id('P', CONN_P);
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t n = (argc > 1) ? (uint32_t)atoi(argv[1]) : 200000;
+    connect_boards();
+    if (MqttInit() != 0)
+    {
+        fprintf(stderr, "MqttInit failed\n");
+        return 1;
+    }
+    mqtt_register_default_handlers();
+
+    // QoS 0 遥测
+    static const char telemetry[] = "{\"topic\":\"TemperatureSenser\",\"temperature\":24.6,\"t_ms\":123456}";
+    uint64_t t0 = host_now_ns();
+    for (uint32_t i = 0; i < n; i++)
+    {
+        (void)MqttPublishQos("devices/TemperatureSenser", telemetry, sizeof(telemetry) - 1, MQTT_QOS);
+    }
+    double qos0_ns = (double)(host_now_ns() - t0) / n;
+
+    // QoS 1 告警：SLE 通知 -> 发布 -> 转发给 P 板
+    char alert[64];
+    int alert_len = snprintf(alert, sizeof(alert), "[{\"topic\":\"CautionStatus\",\"caution\":1,\"ex_us\":35}]");
+    ssapc_handle_value_t value = {0};
+    value.data = (uint8_t *)alert;
+    value.data_len = (uint16_t)alert_len;
+    uint32_t alerts = n / 4;
+    uint32_t before = fake_mqtt_published();
+    t0 = host_now_ns();
+    for (uint32_t i = 0; i < alerts; i++)
+    {
+        sle_uart_notification_cb(0, CONN_E, &value, ERRCODE_SUCC);
+        fake_ssapc_write_cfm(0, CONN_P, ERRCODE_SUCC);
+    }
+    double qos1_ns = (double)(host_now_ns() - t0) / alerts;
+    uint32_t alert_pubs = fake_mqtt_published() - before;
+
+    printf("publish: QoS 0 %.0f ns/message (%.2f M/s), QoS 1 alert from SLE %.0f ns (%.2f M/s), %u/%u published\n",
+           qos0_ns, 1e3 / qos0_ns, qos1_ns, 1e3 / qos1_ns, alert_pubs, alerts);
+
+    // 订阅时延：Control/# 经订阅表分发，加上 [] 后交给 ExBoard 的发送队列
+    static const char control[] = "{\"topic\":\"EngineControl_1\",\"Angle\":90}";
+    uint32_t samples = (n < 100000) ? n : 100000;
+    uint64_t *lat = malloc(samples * sizeof(uint64_t));
+    uint32_t got = 0;
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        uint32_t writes = g_writes_e;
+        t0 = host_now_ns();
+        fake_mqtt_deliver("Control/EngineControl_1", control, (int)sizeof(control) - 1);
+        if (g_writes_e == writes + 1)
+        {
+            lat[got++] = g_write_ns - t0;
+        }
+        fake_ssapc_write_cfm(0, CONN_E, ERRCODE_SUCC);
+    }
+    qsort(lat, got, sizeof(uint64_t), cmp_u64);
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < got; i++)
+    {
+        sum += lat[i];
+    }
+    printf("subscribe: broker deliver -> ssapc_write_req mean %.0f ns, p50 %llu ns, p99 %llu ns (%u/%u forwarded)\n",
+           got ? (double)sum / got : 0.0, got ? (unsigned long long)lat[got / 2] : 0ULL,
+           got ? (unsigned long long)lat[got * 99 / 100] : 0ULL, got, samples);
+    free(lat);
+
+    // broker 离线：告警入队，SLE 回调不重连、不睡眠
+    fake_mqtt_set_broker(0);
+    uint64_t clock0 = fake_clock_us();
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        sle_uart_notification_cb(0, CONN_E, &value, ERRCODE_SUCC);
+        fake_ssapc_write_cfm(0, CONN_P, ERRCODE_SUCC);
+    }
+    printf("broker offline: 100 alerts held the SLE callback for %llu us of device time, %u queued for resend\n",
+           (unsigned long long)(fake_clock_us() - clock0), g_mqtt_pending_count);
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * 16 个字符的字符串绘制基准，改动前后对比：
+ *   agent_module SSD1306：ssd1306_DrawString 的预栅格化按列写入 vs 逐像素 DrawPixel，只写帧缓冲
+ *   ExBoard SSD1363：OLED_ShowString 整串一次传输 vs 每字符设窗口、每字节一次 OLED_WR_Byte，
+ *   另外统计每串的 I2C 传输次数、总线字节数和按 IIC_BAUDRATE 折算的总线时间
+ * 改动前的写法与 test_oled_glyphs、test_exboard_text 比对所用的是同一份（common/ref_*.h）
+ */
+#include <stdlib.h>
+#include "ssd1363.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "my_ssd1306.h"
+#include "my_ssd1306_fonts.h"
+#include "ref_ssd1306_glyphs.h"
+#include "ref_ssd1363_text.h"
+
+#define STRING_LEN 16
+
+static const char g_text[STRING_LEN + 1] = "T:24.6C H:51% ok";
+static uint64_t g_bus_bytes = 0;
+static uint64_t g_transfers = 0;
+
+static errcode_t count_i2c(i2c_bus_t bus, uint16_t addr, const uint8_t *buf, uint32_t len)
+{
+    (void)bus;
+    (void)addr;
+    (void)buf;
+    g_bus_bytes += len + 1;
+    g_transfers++;
+    return ERRCODE_SUCC;
+}
+
+static void ssd1306_ref(const FontDef *font, SSD1306_COLOR color)
+{
+    (void)ref_draw_string(0, 0, g_text, font, color);
+}
+
+static void ssd1306_new(const FontDef *font, SSD1306_COLOR color)
+{
+    ssd1306_SetCursor(0, 0);
+    (void)ssd1306_DrawString((char *)g_text, *font, color);
+}
+
+static double time_ssd1306(void (*draw)(const FontDef *, SSD1306_COLOR), const FontDef *font, uint32_t iters)
+{
+    uint64_t t0 = host_now_ns();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        draw(font, (SSD1306_COLOR)(i & 1));
+    }
+    return (double)(host_now_ns() - t0) / iters / 1000.0;
+}
+
+static void bench_ssd1363(const char *name, void (*show)(uint8_t, uint8_t, const uint8_t *, uint8_t, uint8_t),
+                          uint8_t sizey, uint32_t iters)
+{
+    g_bus_bytes = 0;
+    g_transfers = 0;
+    uint64_t t0 = host_now_ns();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        show(0, 0, (const uint8_t *)g_text, sizey, (uint8_t)(i & 1));
+    }
+    double us = (double)(host_now_ns() - t0) / iters / 1000.0;
+    double bytes = (double)g_bus_bytes / iters;
+    printf("  %-9s %7.2f us/string (host), %6.0f transfers, %6.0f I2C bytes, %6.2f ms on the bus\n", name, us,
+           (double)g_transfers / iters, bytes, bytes * 9 * 1000.0 / IIC_BAUDRATE);
+}
+
+static void show_new(uint8_t x, uint8_t y, const uint8_t *dp, uint8_t sizey, uint8_t mode)
+{
+    OLED_ShowString(x, y, (uint8_t *)dp, sizey, mode);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t iters = (argc > 1) ? (uint32_t)atoi(argv[1]) : 20000;
+    fake_sdk_reset();
+    fake_i2c_set_hooks(count_i2c, NULL);
+
+    static const FontDef *const fonts[] = {&Font_6x8, &Font_7x10};
+    static const char *const names[] = {"6x8", "7x10"};
+    ssd1306_Init();
+    for (uint32_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++)
+    {
+        double ref = time_ssd1306(ssd1306_ref, fonts[f], iters);
+        double now = time_ssd1306(ssd1306_new, fonts[f], iters);
+        printf("SSD1306 %-5s per-pixel %6.2f us/string, column blit %6.2f us/string (%.1fx)\n", names[f], ref, now,
+               ref / now);
+    }
+
+    OLED_Init();
+    static const uint8_t sizes[] = {16, 24, 32};
+    for (uint32_t s = 0; s < sizeof(sizes); s++)
+    {
+        printf("SSD1363 size %u:\n", sizes[s]);
+        bench_ssd1363("per-byte", ref_show_string, sizes[s], iters / 10);
+        bench_ssd1363("one burst", show_new, sizes[s], iters);
+    }
+    return 0;
+}
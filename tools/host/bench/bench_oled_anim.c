@@ -0,0 +1,47 @@
+/* ShowFrame 基准：循环播放眼睛与音频动画，统计每帧耗时与 I2C 总线字节数 */
+#include "oledService.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+
+#define I2C_BAUDRATE 400000
+
+static uint64_t g_bus_bytes = 0;
+static uint64_t g_transfers = 0;
+
+static errcode_t count_i2c(i2c_bus_t bus, uint16_t addr, const uint8_t *buf, uint32_t len)
+{
+    (void)bus;
+    (void)addr;
+    (void)buf;
+    g_bus_bytes += len + 1; // 地址字节
+    g_transfers++;
+    return ERRCODE_SUCC;
+}
+
+static void bench_anim(const char *name, const OledAnim *anim, uint32_t loops)
+{
+    ShowFrame(anim, 0);
+    g_bus_bytes = 0;
+    g_transfers = 0;
+    uint32_t frames = loops * anim->count;
+    uint64_t t0 = host_now_ns();
+    for (uint32_t i = 1; i <= frames; i++)
+    {
+        ShowFrame(anim, i % anim->count);
+    }
+    uint64_t ns = (host_now_ns() - t0) / frames;
+    double bytes = (double)g_bus_bytes / frames;
+    printf("ShowFrame(%s): %llu ns/frame (host), %.1f I2C bytes/frame in %.1f transfers, %.2f ms on the bus\n", name,
+           (unsigned long long)ns, bytes, (double)g_transfers / frames, bytes * 9 * 1000.0 / I2C_BAUDRATE);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t loops = (argc > 1) ? (uint32_t)atoi(argv[1]) : 2000;
+    fake_sdk_reset();
+    fake_i2c_set_hooks(count_i2c, NULL);
+    ssd1306_Init();
+    bench_anim("eye", &g_eye_anim, loops);
+    bench_anim("audio", &g_audio_anim, loops);
+    return 0;
+}
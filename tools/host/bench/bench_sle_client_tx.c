@@ -0,0 +1,172 @@
+/*
+ * 星闪客户端发送吞吐：生产者把每个连接的发送队列保持填满，链路替身按连接事件确认写请求，
+ * 统计 1 个和多个对端时持续的消息数/秒，以及每条消息在主机上的入队+下发开销。
+ *
+ * 链路模型：每个连接每 BENCH_INTERVAL_US 一个连接事件，一个事件发出一个写请求，
+ * 其 write_cfm 在下一个事件到达；各连接的事件错开，不考虑空口冲突。
+ * 旧实现每条消息都以 log_info 打印整条 payload，按 115200 波特率折算串口时间作对照。
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "fake_agent.h"
+#include "fake_sdk.h"
+#include "fake_sle.h"
+#include "host_test.h"
+#include "sle_uart_client.h"
+
+#define BENCH_INTERVAL_US 1000
+#define BENCH_SIM_US 2000000
+#define BENCH_PAYLOAD 64
+#define BENCH_PEERS_MAX 8
+#define BENCH_PIPE 64
+#define BENCH_UART_BAUD 115200
+#define BENCH_LOG_PREFIX 32 // 旧日志行中 payload 以外的字节数
+
+typedef struct
+{
+    uint16_t conn_id;
+    uint32_t pending;  // 已交给协议栈、尚未在空口发出的写请求
+    uint8_t in_flight; // 上个事件已发出、等待本事件确认
+    uint64_t next_event_us;
+    uint32_t confirmed;
+} peer_t;
+
+static peer_t g_peers[BENCH_PEERS_MAX];
+static uint32_t g_peer_count = 0;
+
+static peer_t *peer_of(uint16_t conn_id)
+{
+    for (uint32_t i = 0; i < g_peer_count; i++)
+    {
+        if (g_peers[i].conn_id == conn_id)
+        {
+            return &g_peers[i];
+        }
+    }
+    return NULL;
+}
+
+static errcode_t stack_write(uint8_t client_id, uint16_t conn_id, const ssapc_write_param_t *param)
+{
+    (void)client_id;
+    (void)param;
+    peer_t *p = peer_of(conn_id);
+    if (p == NULL || p->pending >= BENCH_PIPE)
+    {
+        return ERRCODE_FAIL;
+    }
+    p->pending++;
+    return ERRCODE_SUCC;
+}
+
+static void fill_queue(uint16_t conn_id, const uint8_t *payload)
+{
+    sle_uart_tx_stats_t st;
+    while (sle_uart_client_get_tx_stats(conn_id, &st) == ERRCODE_SUCC && st.queued < 16)
+    {
+        if (sle_uart_client_send_data(payload, BENCH_PAYLOAD, 0, conn_id) != ERRCODE_SUCC)
+        {
+            break;
+        }
+    }
+}
+
+static double run_peers(uint32_t peers)
+{
+    uint8_t payload[BENCH_PAYLOAD];
+    memset(payload, 'x', sizeof(payload));
+    fake_sdk_reset();
+    fake_sle_reset();
+    fake_agent_reset();
+    fake_ssapc_set_write_hook(stack_write);
+    sle_uart_client_init(NULL, NULL);
+    uint64_t start = fake_clock_us();
+
+    g_peer_count = peers;
+    for (uint32_t i = 0; i < peers; i++)
+    {
+        sle_addr_t addr = {0, {0x10, (uint8_t)i, 0, 0, 0, 0}};
+        memset(&g_peers[i], 0, sizeof(g_peers[i]));
+        g_peers[i].conn_id = (uint16_t)(i + 1);
+        g_peers[i].next_event_us = start + (uint64_t)BENCH_INTERVAL_US * i / peers;
+        fake_sle_connect(g_peers[i].conn_id, &addr);
+    }
+
+    uint64_t end = start + BENCH_SIM_US;
+    while (1)
+    {
+        peer_t *p = &g_peers[0];
+        for (uint32_t i = 1; i < peers; i++)
+        {
+            p = (g_peers[i].next_event_us < p->next_event_us) ? &g_peers[i] : p;
+        }
+        if (p->next_event_us >= end)
+        {
+            break;
+        }
+        fake_clock_advance_us(p->next_event_us - fake_clock_us());
+        fill_queue(p->conn_id, payload);
+        // 先在本事件发出一个写请求，再确认上个事件发出的那个
+        uint8_t acked = p->in_flight;
+        p->in_flight = (p->pending > 0);
+        p->pending -= p->in_flight;
+        if (acked)
+        {
+            p->confirmed++;
+            fake_ssapc_write_cfm(0, p->conn_id, ERRCODE_SUCC);
+        }
+        p->next_event_us += BENCH_INTERVAL_US;
+    }
+
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < peers; i++)
+    {
+        total += g_peers[i].confirmed;
+    }
+    return total * 1e6 / BENCH_SIM_US;
+}
+
+// 只测主机上入队加下发的代码开销：写请求立即确认
+static errcode_t stack_write_nop(uint8_t client_id, uint16_t conn_id, const ssapc_write_param_t *param)
+{
+    (void)client_id;
+    (void)conn_id;
+    (void)param;
+    return ERRCODE_SUCC;
+}
+
+static void bench_cpu(uint32_t loops)
+{
+    uint8_t payload[BENCH_PAYLOAD];
+    memset(payload, 'x', sizeof(payload));
+    sle_addr_t addr = {0, {0x10, 0, 0, 0, 0, 0}};
+    fake_sdk_reset();
+    fake_sle_reset();
+    fake_agent_reset();
+    fake_ssapc_set_write_hook(stack_write_nop);
+    sle_uart_client_init(NULL, NULL);
+    fake_sle_connect(1, &addr);
+    uint64_t t0 = host_now_ns();
+    for (uint32_t i = 0; i < loops; i++)
+    {
+        sle_uart_client_send_data(payload, BENCH_PAYLOAD, 0, 1);
+        fake_ssapc_write_cfm(0, 1, ERRCODE_SUCC);
+    }
+    printf("send_data + write_cfm: %llu ns/msg (host)\n", (unsigned long long)((host_now_ns() - t0) / loops));
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t loops = (argc > 1) ? (uint32_t)atoi(argv[1]) : 1000000;
+    static const uint32_t peer_counts[] = {1, 2, 4, 8};
+    double log_ms = (BENCH_PAYLOAD + BENCH_LOG_PREFIX) * 10 * 1000.0 / BENCH_UART_BAUD;
+    printf("link: %u us connection interval, %u-byte payload\n", BENCH_INTERVAL_US, BENCH_PAYLOAD);
+    for (uint32_t i = 0; i < sizeof(peer_counts) / sizeof(peer_counts[0]); i++)
+    {
+        printf("  %u peer(s): %.0f msgs/s sustained\n", peer_counts[i], run_peers(peer_counts[i]));
+    }
+    printf("payload log at %u baud: %.2f ms/msg, caps the old path at %.0f msgs/s for all peers\n", BENCH_UART_BAUD,
+           log_ms, 1000.0 / log_ms);
+    bench_cpu(loops);
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * notify 合并基准：按 ExBoard 的上报节奏提交 topic 更新，比较不同合并窗口下每秒的 notify 数、
+ * 字节数和更新从提交到发出的平均延迟。合并任务用假时钟按 1 ms 步进模拟：
+ * 有更新后开一个窗口，窗口结束或紧急更新到来时调用 sle_uart_batch_flush。
+ *
+ * 负载：温湿度每 1000 ms 同时更新，光照每 200 ms，空气每 100 ms，按键状态平均每 2 s 一次（紧急），
+ * 各传感器相位错开。不合并时每个更新一条 notify，即 updates/s。
+ */
+#include "sle_uart_server.c"
+#include <stdlib.h>
+#include "fake_sdk.h"
+#include "fake_sle.h"
+#include "host_test.h"
+
+#define BENCH_SIM_MS 60000
+
+typedef struct
+{
+    const char *topic;
+    uint32_t period_ms;
+    uint32_t phase_ms;
+} bench_source_t;
+
+static const bench_source_t g_sources[] = {
+    {"TemperatureSenser", 1000, 3},
+    {"HumiditySenser", 1000, 3},
+    {"LightSenser", 200, 41},
+    {"AirSenser", 100, 67},
+};
+
+static uint32_t g_notifies = 0;
+static uint64_t g_bytes = 0;
+
+static errcode_t count_notify(uint16_t conn_id, const uint8_t *data, uint16_t len)
+{
+    (void)conn_id;
+    (void)data;
+    g_notifies++;
+    g_bytes += len;
+    return ERRCODE_SUCC;
+}
+
+static uint32_t g_rng = 12345;
+
+static uint32_t bench_rand(void)
+{
+    g_rng = g_rng * 1103515245u + 12345u;
+    return g_rng >> 16;
+}
+
+static void put_topic(const char *topic, uint32_t now_ms, bool urgent)
+{
+    char obj[SLE_UART_BATCH_OBJ_MAX_SIZE];
+    int len = snprintf(obj, sizeof(obj), "{\"topic\":\"%s\",\"value\":%u}", topic, now_ms % 1000);
+    sle_uart_server_batch_put(topic, (const uint8_t *)obj, (uint16_t)len, urgent);
+}
+
+static void run_window(uint32_t window_ms)
+{
+    g_rng = 12345;
+    g_notifies = 0;
+    g_bytes = 0;
+    memset(g_sle_uart_batch_slot, 0, sizeof(g_sle_uart_batch_slot));
+    memset(&g_sle_uart_batch_stats, 0, sizeof(g_sle_uart_batch_stats));
+    sle_uart_server_batch_init(window_ms);
+
+    uint64_t latency_ms = 0;
+    uint32_t waiting = 0;  // 当前窗口内已提交、尚未发出的更新数
+    uint64_t age_sum = 0;  // 这些更新的提交时刻之和
+    int64_t deadline = -1; // 当前窗口结束时刻，-1 表示没有打开的窗口
+    for (uint32_t now = 0; now < BENCH_SIM_MS; now++)
+    {
+        bool urgent = false;
+        for (uint32_t i = 0; i < sizeof(g_sources) / sizeof(g_sources[0]); i++)
+        {
+            if (now % g_sources[i].period_ms == g_sources[i].phase_ms)
+            {
+                put_topic(g_sources[i].topic, now, false);
+                waiting++;
+                age_sum += now;
+            }
+        }
+        if (bench_rand() % 2000 == 0)
+        {
+            put_topic("CautionStatus", now, true);
+            waiting++;
+            age_sum += now;
+            urgent = true;
+        }
+        if (waiting > 0 && deadline < 0)
+        {
+            deadline = (int64_t)now + window_ms;
+        }
+        if (deadline >= 0 && (urgent || (int64_t)now >= deadline))
+        {
+            sle_uart_batch_flush();
+            latency_ms += (uint64_t)waiting * now - age_sum;
+            waiting = 0;
+            age_sum = 0;
+            deadline = -1;
+        }
+    }
+    sle_uart_batch_stats_t st;
+    sle_uart_server_batch_get_stats(&st);
+    printf("window %3u ms: %5.1f updates/s -> %5.1f notifies/s, %4.0f bytes/s, %4.1f%% coalesced, %6.2f ms mean delay\n",
+           window_ms, st.puts * 1000.0 / BENCH_SIM_MS, g_notifies * 1000.0 / BENCH_SIM_MS, g_bytes * 1000.0 / BENCH_SIM_MS, st.coalesced * 100.0 / st.puts,
+           (double)latency_ms / st.puts);
+}
+
+int main(void)
+{
+    static const sle_addr_t addr = {0, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06}};
+    static const uint32_t windows[] = {0, 5, 10, 20, 50, 100, 200};
+    fake_sdk_reset();
+    fake_sle_reset();
+    fake_ssaps_set_notify_hook(count_notify);
+    sle_uart_server_init(NULL, NULL);
+    fake_sle_connect(1, &addr);
+    fake_sle_pair_complete(1, &addr);
+    for (uint32_t i = 0; i < sizeof(windows) / sizeof(windows[0]); i++)
+    {
+        run_window(windows[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,168 @@
+/* 订阅路由表基准：100 个过滤器下逐条分发，与逐个过滤器线性匹配对比 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_test.h"
+#include "topicTrie.h"
+
+#define PATTERNS 100
+#define TOPICS 64
+
+static char g_filters[PATTERNS][40];
+static char g_topics[TOPICS][40];
+static uint64_t g_calls;
+
+static void on_msg(const char *topic, size_t topic_len, const uint8_t *payload, size_t len, void *arg)
+{
+    (void)topic;
+    (void)topic_len;
+    (void)payload;
+    (void)len;
+    (void)arg;
+    g_calls++;
+}
+
+// 按 MQTT 规则匹配一个过滤器，作为线性扫描的基线
+static int filter_match(const char *f, const char *t, size_t tlen)
+{
+    const char *end = t + tlen;
+    if (*t == '$' && (*f == '+' || *f == '#'))
+    {
+        return 0;
+    }
+    while (*f)
+    {
+        if (*f == '#')
+        {
+            return 1;
+        }
+        const char *slash = memchr(t, '/', (size_t)(end - t));
+        const char *lend = slash ? slash : end;
+        if (*f == '+')
+        {
+            f++;
+        }
+        else
+        {
+            size_t n = (size_t)(lend - t);
+            if (strncmp(f, t, n) != 0 || (f[n] != '/' && f[n] != '\0'))
+            {
+                return 0;
+            }
+            f += n;
+        }
+        if (*f == '\0')
+        {
+            return slash == NULL;
+        }
+        f++; // '/'
+        if (slash == NULL)
+        {
+            // "a/#" 匹配 "a"
+            return strcmp(f, "#") == 0;
+        }
+        t = slash + 1;
+    }
+    return 0;
+}
+
+static void build_patterns(void)
+{
+    int n = 0;
+    for (int i = 0; i < 60; i++)
+    {
+        snprintf(g_filters[n++], sizeof(g_filters[0]), "devices/node%02d/report", i);
+    }
+    for (int i = 0; i < 20; i++)
+    {
+        snprintf(g_filters[n++], sizeof(g_filters[0]), "Control/board%02d/#", i);
+    }
+    for (int i = 0; i < 15; i++)
+    {
+        snprintf(g_filters[n++], sizeof(g_filters[0]), "sensor/+/ch%02d", i);
+    }
+    snprintf(g_filters[n++], sizeof(g_filters[0]), "report");
+    snprintf(g_filters[n++], sizeof(g_filters[0]), "devices/report");
+    snprintf(g_filters[n++], sizeof(g_filters[0]), "devices/+/status");
+    snprintf(g_filters[n++], sizeof(g_filters[0]), "CautionStatus");
+    snprintf(g_filters[n++], sizeof(g_filters[0]), "Control/#");
+
+    for (int i = 0; i < TOPICS; i++)
+    {
+        switch (i % 4)
+        {
+            case 0:
+                snprintf(g_topics[i], sizeof(g_topics[0]), "devices/node%02d/report", (i * 7) % 64);
+                break;
+            case 1:
+                snprintf(g_topics[i], sizeof(g_topics[0]), "Control/board%02d/led", (i * 3) % 24);
+                break;
+            case 2:
+                snprintf(g_topics[i], sizeof(g_topics[0]), "sensor/%d/ch%02d", i, i % 20);
+                break;
+            default:
+                snprintf(g_topics[i], sizeof(g_topics[0]), "devices/node%02d/status", i);
+                break;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t loops = (argc > 1) ? (uint32_t)atoi(argv[1]) : 20000;
+    static topic_trie_t trie;
+    build_patterns();
+    for (int i = 0; i < PATTERNS; i++)
+    {
+        if (topic_trie_set_handler(&trie, g_filters[i], on_msg, NULL) != 0)
+        {
+            printf("bad filter %s\n", g_filters[i]);
+            return 1;
+        }
+    }
+    size_t tlen[TOPICS];
+    for (int i = 0; i < TOPICS; i++)
+    {
+        tlen[i] = strlen(g_topics[i]);
+    }
+
+    uint64_t msgs = (uint64_t)loops * TOPICS;
+    g_calls = 0;
+    uint64_t t0 = host_now_ns();
+    for (uint32_t l = 0; l < loops; l++)
+    {
+        for (int i = 0; i < TOPICS; i++)
+        {
+            topic_trie_dispatch(&trie, g_topics[i], tlen[i], (const uint8_t *)"{}", 2);
+        }
+    }
+    uint64_t trie_ns = host_now_ns() - t0;
+    uint64_t trie_calls = g_calls;
+
+    g_calls = 0;
+    t0 = host_now_ns();
+    for (uint32_t l = 0; l < loops; l++)
+    {
+        for (int i = 0; i < TOPICS; i++)
+        {
+            for (int p = 0; p < PATTERNS; p++)
+            {
+                if (filter_match(g_filters[p], g_topics[i], tlen[i]))
+                {
+                    on_msg(g_topics[i], tlen[i], (const uint8_t *)"{}", 2, NULL);
+                }
+            }
+        }
+    }
+    uint64_t linear_ns = host_now_ns() - t0;
+
+    printf("%d filters, %d topics: trie %.1f ns/msg, linear scan %.1f ns/msg (host), %.2f handlers/msg\n",
+           PATTERNS, TOPICS, (double)trie_ns / msgs, (double)linear_ns / msgs, (double)trie_calls / msgs);
+    if (trie_calls != g_calls)
+    {
+        printf("handler count mismatch: trie %llu, linear %llu\n", (unsigned long long)trie_calls,
+               (unsigned long long)g_calls);
+        return 1;
+    }
+    return 0;
+}
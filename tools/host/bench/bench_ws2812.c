@@ -0,0 +1,143 @@
+/*
+ * WS2812 基准，改动前后对比：
+ *   每帧编码：浮点 hsl2rgb + 逐位 rgb2spi、每颗灯一次 24 字节 SPI 写 vs 整数 HSV + 查表整条重编码、一次写完
+ *   一秒主循环（假时钟，SPI 每字节 1us）：ws2812_next + osal_msleep(1) vs 按 ws2812_next 的返回值睡眠，
+ *   统计醒来次数、SPI 写次数和占用总线的时间
+ * 编码结果与改动前逐字节一致、HSV 与 HSL 相差不超过 1，由 test_ws2812 保证
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "ws2812.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "ref_ws2812.h"
+
+static uint64_t g_writes = 0;
+static uint64_t g_bytes = 0;
+
+static errcode_t count_spi(spi_bus_t bus, const uint8_t *buf, uint32_t len)
+{
+    (void)bus;
+    (void)buf;
+    g_writes++;
+    g_bytes += len;
+    fake_clock_advance_us(len);
+    return ERRCODE_SUCC;
+}
+
+// 改动前的 ws2812_next：每次调用都整条换算、编码，每颗灯一次 SPI 写
+static uint8_t ref_spi_data[LED_COUNT][WS2812_BYTES_PER_LED];
+static float ref_hue = 0;
+
+static uint32_t ref_next(uint16_t mode, uint16_t red, uint16_t green, uint16_t blue)
+{
+    for (int i = 0; i < LED_COUNT; i++)
+    {
+        if (mode == 0)
+        {
+            uint8_t r, g, b;
+            ref_hsl2rgb(ref_hue, 1.0, 0.1, &r, &g, &b);
+            ref_rgb2spi(r, g, b, ref_spi_data[i]);
+        }
+        else
+        {
+            ref_rgb2spi((uint8_t)red, (uint8_t)green, (uint8_t)blue, ref_spi_data[i]);
+        }
+    }
+    spi_xfer_data_t data;
+    data.tx_bytes = WS2812_BYTES_PER_LED;
+    for (int i = 0; i < LED_COUNT; i++)
+    {
+        data.tx_buff = ref_spi_data[i];
+        uapi_spi_master_write(SPI_ID, &data, 0xFFFFFFFF);
+    }
+    if (mode == 0)
+    {
+        ref_hue = fmod(ref_hue + 1, 360.0);
+    }
+    return 1; // 原来的主循环固定 osal_msleep(1)
+}
+
+// 改动后整条重编码一帧（不跳过没变的灯）并发送
+static uint32_t new_full_frame(uint16_t mode, uint16_t red, uint16_t green, uint16_t blue)
+{
+    if (mode == 0)
+    {
+        ws2812_effect_rainbow(g_ws2812_frame, LED_COUNT, g_ws2812_frame_no++, NULL);
+    }
+    else
+    {
+        ws2812_rgb_t c = {(uint8_t)red, (uint8_t)green, (uint8_t)blue};
+        ws2812_effect_solid(g_ws2812_frame, LED_COUNT, 0, &c);
+    }
+    g_ws2812_valid = 0;
+    (void)ws2812_encode();
+    spi_xfer_data_t data = {0};
+    data.tx_buff = g_ws2812_tx;
+    data.tx_bytes = sizeof(g_ws2812_tx);
+    uapi_spi_master_write(SPI_ID, &data, 0xFFFFFFFF);
+    return 0;
+}
+
+typedef uint32_t (*next_fn)(uint16_t mode, uint16_t red, uint16_t green, uint16_t blue);
+
+static void reset(void)
+{
+    fake_sdk_reset();
+    fake_spi_set_hook(count_spi);
+    fake_clock_advance_us(1000 * 1000); // tcxo 为 0 是 ws2812_poll 的“从未出帧”标记
+    spi_init();
+    ws2812_set_effect(NULL, NULL);
+    ref_hue = 0;
+    g_writes = 0;
+    g_bytes = 0;
+}
+
+static double time_encode(next_fn next, uint16_t mode, uint32_t iters)
+{
+    reset();
+    uint64_t t0 = host_now_ns();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        (void)next(mode, 0x20, (uint16_t)(i & 0xFF), 0x05);
+    }
+    return (double)(host_now_ns() - t0) / iters / 1000.0;
+}
+
+static void bench_encode(const char *what, uint16_t mode, uint32_t iters)
+{
+    double before = time_encode(ref_next, mode, iters);
+    uint64_t writes = g_writes / iters;
+    double after = time_encode(new_full_frame, mode, iters);
+    printf("%-7s encode %6.2f us/frame, %3llu SPI writes before; %5.2f us/frame, %llu SPI write after (%.1fx)\n",
+           what, before, (unsigned long long)writes, after, (unsigned long long)(g_writes / iters), before / after);
+}
+
+// 一秒假时钟里的主循环：每次醒来调用一次 next，再睡它返回的毫秒数
+static void bench_loop(const char *what, next_fn next, uint16_t mode, uint16_t red)
+{
+    reset();
+    uint32_t wakeups = 0;
+    uint64_t end = fake_clock_us() + 1000 * 1000;
+    while (fake_clock_us() < end)
+    {
+        osal_msleep(next(mode, red, 0x10, 0x05));
+        wakeups++;
+    }
+    printf("  %-22s %4u wakeups, %6llu SPI writes, %7llu SPI bytes, %5.1f ms/s on the bus\n", what, wakeups,
+           (unsigned long long)g_writes, (unsigned long long)g_bytes, g_bytes / 1000.0);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t iters = (argc > 1) ? (uint32_t)atoi(argv[1]) : 20000;
+    bench_encode("rainbow", 0, iters);
+    bench_encode("solid", 1, iters);
+
+    printf("one second of ExBoard_task, frame interval %u ms:\n", WS2812_FRAME_MS);
+    bench_loop("rainbow, msleep(1)", ref_next, 0, 0x20);
+    bench_loop("rainbow, sleep to due", ws2812_next, 0, 0x20);
+    bench_loop("solid, msleep(1)", ref_next, 1, 0x20);
+    bench_loop("solid, sleep to due", ws2812_next, 1, 0x20);
+    return 0;
+}
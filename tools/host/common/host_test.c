@@ -0,0 +1,30 @@
+#include <stdio.h>
+#include <time.h>
+#include "host_test.h"
+
+int g_host_failures = 0;
+
+int host_test_done(const char *name)
+{
+    if (g_host_failures != 0)
+    {
+        printf("%s: %d check(s) failed\n", name, g_host_failures);
+        return 1;
+    }
+    printf("%s: ok\n", name);
+    return 0;
+}
+
+uint64_t host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+const char *host_data_path(const char *name)
+{
+    static char path[512];
+    snprintf(path, sizeof(path), "%s/%s", HOST_DATA_DIR, name);
+    return path;
+}
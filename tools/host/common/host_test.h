@@ -0,0 +1,43 @@
+/* 主机测试的公共断言与计时 */
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+extern int g_host_failures;
+
+// 条件不成立时打印位置并记一次失败，测试继续执行
+#define CHECK(cond)                                                                                      \
+    do                                                                                                   \
+    {                                                                                                    \
+        if (!(cond))                                                                                     \
+        {                                                                                                \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);                     \
+            g_host_failures++;                                                                           \
+        }                                                                                                \
+    } while (0)
+
+#define CHECK_EQ(a, b)                                                                                   \
+    do                                                                                                   \
+    {                                                                                                    \
+        long long va_ = (long long)(a);                                                                  \
+        long long vb_ = (long long)(b);                                                                  \
+        if (va_ != vb_)                                                                                  \
+        {                                                                                                \
+            fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n", __FILE__, __LINE__, #a, #b, \
+                    va_, vb_);                                                                           \
+            g_host_failures++;                                                                           \
+        }                                                                                                \
+    } while (0)
+
+// 打印结果并返回 main 的退出码
+int host_test_done(const char *name);
+
+// 单调时钟，纳秒；放在单独的编译单元里，避免 <time.h> 与被测源码中的全局变量 time 冲突
+uint64_t host_now_ns(void);
+
+// 数据文件目录（tools/host/data），由 CMake 通过 HOST_DATA_DIR 传入
+const char *host_data_path(const char *name);
+
+#endif
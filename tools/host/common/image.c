@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "image.h"
+
+host_image_t *image_new(uint16_t width, uint16_t height, uint8_t maxval)
+{
+    host_image_t *img = malloc(sizeof(*img));
+    img->width = width;
+    img->height = height;
+    img->maxval = maxval;
+    img->pixels = calloc((size_t)width * height, 1);
+    return img;
+}
+
+void image_free(host_image_t *img)
+{
+    if (img != NULL)
+    {
+        free(img->pixels);
+        free(img);
+    }
+}
+
+int image_write(const host_image_t *img, const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        return -1;
+    }
+    if (img->maxval == 1)
+    {
+        fprintf(f, "P4\n%u %u\n", img->width, img->height);
+        uint32_t stride = (img->width + 7) / 8;
+        uint8_t *row = calloc(stride, 1);
+        for (uint32_t y = 0; y < img->height; y++)
+        {
+            memset(row, 0, stride);
+            for (uint32_t x = 0; x < img->width; x++)
+            {
+                if (img->pixels[y * img->width + x])
+                {
+                    row[x / 8] |= 0x80 >> (x % 8);
+                }
+            }
+            fwrite(row, 1, stride, f);
+        }
+        free(row);
+    }
+    else
+    {
+        fprintf(f, "P5\n%u %u\n%u\n", img->width, img->height, img->maxval);
+        fwrite(img->pixels, 1, (size_t)img->width * img->height, f);
+    }
+    return fclose(f);
+}
+
+// 读取头部的一个十进制数，跳过空白和注释
+static int image_header_int(FILE *f)
+{
+    int c = fgetc(f);
+    while (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '#')
+    {
+        if (c == '#')
+        {
+            while (c != '\n' && c != EOF)
+            {
+                c = fgetc(f);
+            }
+        }
+        c = fgetc(f);
+    }
+    int v = 0;
+    while (c >= '0' && c <= '9')
+    {
+        v = v * 10 + (c - '0');
+        c = fgetc(f);
+    }
+    return v;
+}
+
+host_image_t *image_read(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        return NULL;
+    }
+    char magic[2];
+    if (fread(magic, 1, 2, f) != 2 || magic[0] != 'P' || (magic[1] != '4' && magic[1] != '5'))
+    {
+        fclose(f);
+        return NULL;
+    }
+    int w = image_header_int(f);
+    int h = image_header_int(f);
+    int maxval = (magic[1] == '4') ? 1 : image_header_int(f);
+    host_image_t *img = image_new((uint16_t)w, (uint16_t)h, (uint8_t)maxval);
+    if (maxval == 1)
+    {
+        uint32_t stride = (w + 7) / 8;
+        uint8_t *row = malloc(stride);
+        for (int y = 0; y < h; y++)
+        {
+            if (fread(row, 1, stride, f) != stride)
+            {
+                break;
+            }
+            for (int x = 0; x < w; x++)
+            {
+                img->pixels[y * w + x] = (row[x / 8] >> (7 - x % 8)) & 1;
+            }
+        }
+        free(row);
+    }
+    else if (fread(img->pixels, 1, (size_t)w * h, f) != (size_t)w * h)
+    {
+        memset(img->pixels, 0, (size_t)w * h);
+    }
+    fclose(f);
+    return img;
+}
+
+long image_check_golden(const host_image_t *img, const char *name)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", HOST_GOLDEN_DIR, name);
+    const char *update = getenv("HOST_UPDATE_GOLDEN");
+    if (update != NULL && strcmp(update, "1") == 0)
+    {
+        return (image_write(img, path) == 0) ? 0 : -1;
+    }
+
+    host_image_t *golden = image_read(path);
+    long diff = -1;
+    if (golden != NULL && golden->width == img->width && golden->height == img->height &&
+        golden->maxval == img->maxval)
+    {
+        diff = 0;
+        for (size_t i = 0; i < (size_t)img->width * img->height; i++)
+        {
+            diff += (golden->pixels[i] != img->pixels[i]);
+        }
+    }
+    image_free(golden);
+    if (diff != 0)
+    {
+        char actual[512];
+        snprintf(actual, sizeof(actual), "%s.actual", name);
+        image_write(img, actual);
+        fprintf(stderr, "%s: %ld pixel(s) differ from golden, wrote %s\n", name, diff, actual);
+    }
+    return diff;
+}
@@ -0,0 +1,24 @@
+/* 黑白 PBM（P4）与灰度 PGM（P5）图像，用于保存和比对显示模型重建出的画面 */
+#ifndef HOST_IMAGE_H
+#define HOST_IMAGE_H
+
+#include <stdint.h>
+
+typedef struct
+{
+    uint16_t width;
+    uint16_t height;
+    uint8_t maxval; // 1 表示 PBM（1 为黑），否则为 PGM 的最大灰度
+    uint8_t *pixels; // 每像素一个字节，行优先
+} host_image_t;
+
+host_image_t *image_new(uint16_t width, uint16_t height, uint8_t maxval);
+void image_free(host_image_t *img);
+int image_write(const host_image_t *img, const char *path);
+host_image_t *image_read(const char *path);
+
+// 与 golden 目录下的同名文件比对，返回不同的像素数（文件缺失或尺寸不符时返回 -1）。
+// 环境变量 HOST_UPDATE_GOLDEN=1 时改为写入 golden 文件；不一致时在当前目录留下 <name>.actual 便于查看
+long image_check_golden(const host_image_t *img, const char *name);
+
+#endif
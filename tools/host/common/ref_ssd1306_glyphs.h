@@ -0,0 +1,44 @@
+/* agent_module SSD1306 改动前的字符绘制：按行取 16 位字模逐像素 DrawPixel，供 test_oled_glyphs 比对、bench_glyph_string 计时 */
+#ifndef REF_SSD1306_GLYPHS_H
+#define REF_SSD1306_GLYPHS_H
+
+#include "my_ssd1306.h"
+#include "my_ssd1306_fonts.h"
+
+// 改动前的 ssd1306_DrawChar：光标由调用方维护
+static inline char ref_draw_char(uint8_t *x, uint8_t y, char ch, const FontDef *font, SSD1306_COLOR color)
+{
+    if ((uint32_t)ch < 32 || (uint32_t)ch > 126)
+    {
+        return 0;
+    }
+    if (SSD1306_WIDTH < (*x + font->FontWidth) || SSD1306_HEIGHT < (y + font->FontHeight))
+    {
+        return 0;
+    }
+    for (uint32_t i = 0; i < font->FontHeight; i++)
+    {
+        uint32_t b = font->data[(ch - 32) * font->FontHeight + i];
+        for (uint32_t j = 0; j < font->FontWidth; j++)
+        {
+            ssd1306_DrawPixel(*x + j, y + i, ((b << j) & 0x8000) ? color : (SSD1306_COLOR)!color);
+        }
+    }
+    *x += font->FontWidth;
+    return ch;
+}
+
+static inline char ref_draw_string(uint8_t x, uint8_t y, const char *str, const FontDef *font, SSD1306_COLOR color)
+{
+    while (*str)
+    {
+        if (ref_draw_char(&x, y, *str, font, color) != *str)
+        {
+            return *str;
+        }
+        str++;
+    }
+    return *str;
+}
+
+#endif
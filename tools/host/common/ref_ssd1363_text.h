@@ -0,0 +1,93 @@
+/*
+ * ExBoard SSD1363 改动前的文字写法：每个字符单独设窗口，每个显存字节一次 OLED_WR_Byte（一次 I2C 传输），
+ * 供 test_exboard_text 比对、bench_glyph_string 计时。字库数组定义在 ssd1363_fonts.h 里，
+ * 须在 #include "ssd1363.c" 之后包含
+ */
+#ifndef REF_SSD1363_TEXT_H
+#define REF_SSD1363_TEXT_H
+
+#include <stdint.h>
+
+// 1bpp 字节中从 bit(k*4) 开始的 4 个像素，按改动前的顺序写出 DATA2、DATA1
+static inline void ref_nibble(uint8_t temp, uint8_t k, uint8_t mode)
+{
+    uint8_t data1 = 0;
+    uint8_t data2 = 0;
+    if (temp & (0x01 << (k * 4)))
+    {
+        data1 = 0x0F;
+    }
+    if (temp & (0x01 << (k * 4 + 1)))
+    {
+        data1 |= 0xF0;
+    }
+    if (temp & (0x01 << (k * 4 + 2)))
+    {
+        data2 = 0x0F;
+    }
+    if (temp & (0x01 << (k * 4 + 3)))
+    {
+        data2 |= 0xF0;
+    }
+    OLED_WR_Byte(mode ? (uint8_t)~data2 : data2);
+    OLED_WR_Byte(mode ? (uint8_t)~data1 : data1);
+}
+
+// 改动前的 OLED_ShowChar
+static inline void ref_show_char(uint8_t x, uint8_t y, uint8_t chr, uint8_t sizey, uint8_t mode)
+{
+    uint8_t t = 2;
+    uint8_t temp = 0;
+    uint8_t c = chr - ' ';
+    uint16_t size2 = (sizey / 16 + ((sizey % 16) ? 1 : 0)) * sizey;
+    x /= 4;
+    Column_Address(x, x + sizey / 8 - 1);
+    Row_Address(y, y + sizey - 1);
+    for (uint16_t i = 0; i < size2; i++)
+    {
+        if (sizey == 16)
+        {
+            temp = ascii_1608[c][i];
+        }
+        else if (sizey == 24)
+        {
+            temp = ascii_2412[c][i];
+        }
+        else if (sizey == 32)
+        {
+            temp = ascii_3216[c][i];
+        }
+        if (sizey % 16)
+        {
+            t = (i % (sizey / 16 + 1)) ? 1 : 2;
+        }
+        for (uint8_t k = 0; k < t; k++)
+        {
+            ref_nibble(temp, k, mode);
+        }
+    }
+}
+
+static inline void ref_show_string(uint8_t x, uint8_t y, const uint8_t *dp, uint8_t sizey, uint8_t mode)
+{
+    while (*dp != '\0')
+    {
+        ref_show_char(x, y, *dp, sizey, mode);
+        dp++;
+        x += sizey / 2;
+    }
+}
+
+static inline void ref_show_chinese(uint8_t x, uint8_t y, const unsigned char *msk, uint8_t sizey, uint8_t mode)
+{
+    uint16_t bytes = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
+    Column_Address(x / 4, x / 4 + sizey / 4 - 1);
+    Row_Address(y, y + sizey - 1);
+    for (uint16_t i = 0; i < bytes; i++)
+    {
+        ref_nibble(msk[i], 0, mode);
+        ref_nibble(msk[i], 1, mode);
+    }
+}
+
+#endif
@@ -0,0 +1,57 @@
+/* ExBoard WS2812 改动前的颜色换算与编码：浮点 hsl2rgb、逐位 rgb2spi，供 test_ws2812 比对、bench_ws2812 计时 */
+#ifndef REF_WS2812_H
+#define REF_WS2812_H
+
+#include <math.h>
+#include <stdint.h>
+#include "ws2812.h"
+
+// 改动前的 rgb2spi：GRB 顺序，每位一个 SPI 字节，1 为 0xF8、0 为 0xC0
+static inline void ref_rgb2spi(uint8_t r, uint8_t g, uint8_t b, uint8_t out[WS2812_BYTES_PER_LED])
+{
+    for (int i = 0; i < 8; i++)
+    {
+        out[i] = (g & (1 << (7 - i))) ? 0xF8 : 0xC0;
+        out[8 + i] = (r & (1 << (7 - i))) ? 0xF8 : 0xC0;
+        out[16 + i] = (b & (1 << (7 - i))) ? 0xF8 : 0xC0;
+    }
+}
+
+// 改动前的 hsl2rgb
+static inline void ref_hsl2rgb(float h, float s, float l, uint8_t *r, uint8_t *g, uint8_t *b)
+{
+    float c = (1 - fabs(2 * l - 1)) * s;
+    h /= 60;
+    float x = c * (1 - fabs(fmod(h, 2) - 1));
+    float m = l - c / 2;
+    float r1, g1, b1;
+    if (h < 1)
+    {
+        r1 = c, g1 = x, b1 = 0;
+    }
+    else if (h < 2)
+    {
+        r1 = x, g1 = c, b1 = 0;
+    }
+    else if (h < 3)
+    {
+        r1 = 0, g1 = c, b1 = x;
+    }
+    else if (h < 4)
+    {
+        r1 = 0, g1 = x, b1 = c;
+    }
+    else if (h < 5)
+    {
+        r1 = x, g1 = 0, b1 = c;
+    }
+    else
+    {
+        r1 = c, g1 = 0, b1 = x;
+    }
+    *r = (uint8_t)((r1 + m) * 255);
+    *g = (uint8_t)((g1 + m) * 255);
+    *b = (uint8_t)((b1 + m) * 255);
+}
+
+#endif
@@ -0,0 +1,93 @@
+/* agent_module 中被星闪客户端引用、但不在被测源码里的符号：连接映射、日志与网关回调 */
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include "agent_module_main.h"
+#include "debugUtils.h"
+#include "fake_agent.h"
+#include "sle_ssap_client.h"
+
+#define FAKE_LOG_LEVELS (LOG_FATAL + 1)
+
+server_conn_t g_server_conn_map[SERVER_CONN_MAX] = {{'P', 0xFFFF}, {'E', 0xFFFF}};
+
+static uint32_t g_log_count[FAKE_LOG_LEVELS];
+
+void fake_agent_reset(void)
+{
+    memset(g_log_count, 0, sizeof(g_log_count));
+    for (int i = 0; i < SERVER_CONN_MAX; i++)
+    {
+        g_server_conn_map[i].conn_id = 0xFFFF;
+    }
+}
+
+uint32_t fake_log_count(int level)
+{
+    return (level >= 0 && level < FAKE_LOG_LEVELS) ? g_log_count[level] : 0;
+}
+
+/* ---------------- agent_module_main ---------------- */
+
+void set_conn_id(char server_type, uint16_t conn_id)
+{
+    for (int i = 0; i < SERVER_CONN_MAX; i++)
+    {
+        if (g_server_conn_map[i].server_type == server_type)
+        {
+            g_server_conn_map[i].conn_id = conn_id;
+        }
+    }
+}
+
+uint16_t get_conn_id(char server_type)
+{
+    for (int i = 0; i < SERVER_CONN_MAX; i++)
+    {
+        if (g_server_conn_map[i].server_type == server_type)
+        {
+            return g_server_conn_map[i].conn_id;
+        }
+    }
+    return 0xFFFF;
+}
+
+/* ---------------- debugUtils ---------------- */
+
+void log_log(int level, const char *file, int line, const char *fmt, ...)
+{
+    if (level >= 0 && level < FAKE_LOG_LEVELS)
+    {
+        g_log_count[level]++;
+    }
+    if (getenv("HOST_VERBOSE") != NULL)
+    {
+        va_list ap;
+        va_start(ap, fmt);
+        fprintf(stderr, "%s:%d: ", file, line);
+        vfprintf(stderr, fmt, ap);
+        fputc('\n', stderr);
+        va_end(ap);
+    }
+}
+
+/* ---------------- gateService ---------------- */
+
+// 网关的接收回调，只在 sle_enable 回调里被引用；弱符号，链接 gateService.c 的测试用真实实现
+__attribute__((weak)) void sle_uart_notification_cb(uint8_t client_id, uint16_t conn_id, ssapc_handle_value_t *data,
+                                                    errcode_t status)
+{
+    unused(client_id);
+    unused(conn_id);
+    unused(data);
+    unused(status);
+}
+
+__attribute__((weak)) void sle_uart_indication_cb(uint8_t client_id, uint16_t conn_id, ssapc_handle_value_t *data,
+                                                  errcode_t status)
+{
+    unused(client_id);
+    unused(conn_id);
+    unused(data);
+    unused(status);
+}
@@ -0,0 +1,13 @@
+/* agent_module 替身的控制接口 */
+#ifndef HOST_FAKE_AGENT_H
+#define HOST_FAKE_AGENT_H
+
+#include <stdint.h>
+
+// 清除日志计数，连接映射恢复为无效
+void fake_agent_reset(void);
+
+// debugUtils 的 log_log 按级别计数，HOST_VERBOSE 设置时打印
+uint32_t fake_log_count(int level);
+
+#endif
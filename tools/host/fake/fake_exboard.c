@@ -0,0 +1,107 @@
+#include "adc.h"
+#include "aht20.h"
+#include "bh1750.h"
+#include "fake_exboard.h"
+#include "motor.h"
+#include "ws2812.h"
+
+static fake_exboard_env_t g_env = {25.0, 50.0, 300};
+static uint32_t g_aht20_triggers = 0;
+static uint32_t g_bh1750_triggers = 0;
+
+void fake_exboard_set_env(const fake_exboard_env_t *env)
+{
+    g_env = *env;
+}
+
+uint32_t fake_exboard_aht20_triggers(void)
+{
+    return g_aht20_triggers;
+}
+
+uint32_t fake_exboard_bh1750_triggers(void)
+{
+    return g_bh1750_triggers;
+}
+
+void AHT20_Init(void)
+{
+}
+
+uint8_t AHT20_Trigger(void)
+{
+    g_aht20_triggers++;
+    return 0;
+}
+
+uint8_t AHT20_Fetch(double *temperature, double *humidity)
+{
+    *temperature = g_env.temperature;
+    *humidity = g_env.humidity;
+    return 0;
+}
+
+void BH1750_Init(void)
+{
+}
+
+uint8_t BH1750_Trigger(void)
+{
+    g_bh1750_triggers++;
+    return 0;
+}
+
+uint8_t BH1750_Fetch(uint16_t *light)
+{
+    *light = g_env.light;
+    return 0;
+}
+
+void motor_gpio_init(void)
+{
+}
+
+void motor_forward(void)
+{
+}
+
+void motor_backward(void)
+{
+}
+
+void motor_stop(void)
+{
+}
+
+void spi_init(void)
+{
+}
+
+uint32_t ws2812_next(uint16_t mode, uint16_t red, uint16_t green, uint16_t blue)
+{
+    (void)mode;
+    (void)red;
+    (void)green;
+    (void)blue;
+    return WS2812_FRAME_MS;
+}
+
+errcode_t uapi_adc_init(uint32_t clock)
+{
+    (void)clock;
+    return ERRCODE_SUCC;
+}
+
+void uapi_adc_power_en(uint32_t afe_scan_mode, bool en)
+{
+    (void)afe_scan_mode;
+    (void)en;
+}
+
+errcode_t uapi_adc_auto_scan_ch_enable(uint8_t channel, adc_scan_config_t config, adc_callback_t callback)
+{
+    (void)channel;
+    (void)config;
+    (void)callback;
+    return ERRCODE_SUCC;
+}
@@ -0,0 +1,20 @@
+/* ExBoard 外设的替身：温湿度、光照传感器返回测试设置的环境读数，电机、灯带、ADC 只接受调用 */
+#ifndef HOST_FAKE_EXBOARD_H
+#define HOST_FAKE_EXBOARD_H
+
+#include <stdint.h>
+
+typedef struct
+{
+    double temperature;
+    double humidity;
+    uint16_t light;
+} fake_exboard_env_t;
+
+// 之后的 AHT20_Fetch / BH1750_Fetch 返回这组读数
+void fake_exboard_set_env(const fake_exboard_env_t *env);
+// AHT20、BH1750 各自的触发次数
+uint32_t fake_exboard_aht20_triggers(void);
+uint32_t fake_exboard_bh1750_triggers(void);
+
+#endif
@@ -0,0 +1,114 @@
+/* I2S 与 WM8978 替身：不产生时钟，uapi_i2s_write_data 直接用采样源的值回调 RX */
+#include <stddef.h>
+#include "fake_i2s.h"
+#include "hal_sio_v151.h"
+#include "i2s.h"
+#include "wm8978.h"
+
+#define FAKE_I2S_BATCH 32
+
+static i2s_callback_t g_rx_callback;
+static fake_i2s_source_t g_source;
+static uint32_t g_samples;
+
+void fake_i2s_reset(void)
+{
+    g_rx_callback = NULL;
+    g_source = NULL;
+    g_samples = 0;
+}
+
+void fake_i2s_set_source(fake_i2s_source_t source)
+{
+    g_source = source;
+}
+
+uint32_t fake_i2s_samples(void)
+{
+    return g_samples;
+}
+
+errcode_t uapi_i2s_init(sio_bus_t bus, i2s_callback_t callback)
+{
+    (void)bus;
+    g_rx_callback = callback;
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_i2s_deinit(sio_bus_t bus)
+{
+    (void)bus;
+    g_rx_callback = NULL;
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_i2s_set_config(sio_bus_t bus, const i2s_config_t *config)
+{
+    (void)bus;
+    (void)config;
+    return ERRCODE_SUCC;
+}
+
+void uapi_i2s_read_start(sio_bus_t bus)
+{
+    (void)bus;
+}
+
+errcode_t uapi_i2s_write_data(sio_bus_t bus, i2s_tx_data_t *data)
+{
+    (void)bus;
+    uint32_t left[FAKE_I2S_BATCH];
+    uint32_t right[FAKE_I2S_BATCH];
+    uint32_t len = (data->length < FAKE_I2S_BATCH) ? data->length : FAKE_I2S_BATCH;
+    for (uint32_t i = 0; i < len; i++)
+    {
+        left[i] = (g_source != NULL) ? g_source(g_samples + i) : 0;
+        right[i] = 0;
+    }
+    g_samples += len;
+    if (g_rx_callback != NULL)
+    {
+        g_rx_callback(left, right, len);
+    }
+    return ERRCODE_SUCC;
+}
+
+void sio_porting_i2s_pinmux(void)
+{
+}
+
+void hal_sio_v151_txrx_disable(sio_bus_t bus)
+{
+    (void)bus;
+}
+
+/* ---------------- WM8978 ---------------- */
+
+uint8_t WM8978_Init(void)
+{
+    return 0;
+}
+
+void WM8978_ADDA_Cfg(uint8_t dacen, uint8_t adcen)
+{
+    (void)dacen;
+    (void)adcen;
+}
+
+void WM8978_Input_Cfg(uint8_t micen, uint8_t lineinen, uint8_t auxen)
+{
+    (void)micen;
+    (void)lineinen;
+    (void)auxen;
+}
+
+void WM8978_MIC_Gain(uint8_t gain)
+{
+    (void)gain;
+}
+
+void WM8978_I2S_Cfg(uint8_t fmt, uint8_t len)
+{
+    (void)fmt;
+    (void)len;
+}
@@ -0,0 +1,16 @@
+/* I2S 与 WM8978 替身的控制接口：测试给出每个采样的值，TX 每发一批就以同样长度回调 RX */
+#ifndef HOST_FAKE_I2S_H
+#define HOST_FAKE_I2S_H
+
+#include <stdint.h>
+
+// 第 idx 个采样（从 reset 起累计）的左声道 32 位原始值
+typedef uint32_t (*fake_i2s_source_t)(uint32_t idx);
+
+// 清空回调与计数，采样源恢复为静音
+void fake_i2s_reset(void);
+void fake_i2s_set_source(fake_i2s_source_t source);
+// 已经送给 RX 回调的采样数
+uint32_t fake_i2s_samples(void);
+
+#endif
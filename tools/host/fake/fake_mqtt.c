@@ -0,0 +1,177 @@
+/* Paho MQTTClient 替身：不收发网络报文，只按 broker 在线状态决定连接与发布结果 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MQTTClient.h"
+#include "fake_mqtt.h"
+
+static int g_broker_online;
+static int g_connected;
+static uint32_t g_connects;
+static uint32_t g_subscribes;
+static uint32_t g_published;
+static fake_mqtt_pub_t g_log[FAKE_MQTT_LOG_MAX];
+static int g_handle;
+static fake_mqtt_publish_hook_t g_publish_hook;
+static MQTTClient_messageArrived *g_arrived;
+static void *g_context;
+
+void fake_mqtt_reset(void)
+{
+    g_broker_online = 1;
+    g_connected = 0;
+    g_connects = 0;
+    g_subscribes = 0;
+    g_published = 0;
+    memset(g_log, 0, sizeof(g_log));
+    g_publish_hook = NULL;
+}
+
+void fake_mqtt_set_broker(int online)
+{
+    g_broker_online = online;
+    if (!online)
+    {
+        g_connected = 0;
+    }
+}
+
+uint32_t fake_mqtt_connects(void)
+{
+    return g_connects;
+}
+
+uint32_t fake_mqtt_subscribes(void)
+{
+    return g_subscribes;
+}
+
+uint32_t fake_mqtt_published(void)
+{
+    return g_published;
+}
+
+const fake_mqtt_pub_t *fake_mqtt_pub(uint32_t i)
+{
+    return (i < g_published && i < FAKE_MQTT_LOG_MAX) ? &g_log[i] : NULL;
+}
+
+void fake_mqtt_set_publish_hook(fake_mqtt_publish_hook_t hook)
+{
+    g_publish_hook = hook;
+}
+
+int fake_mqtt_deliver(const char *topic, const void *payload, int len)
+{
+    if (g_arrived == NULL || !g_connected)
+    {
+        return 0;
+    }
+    // 真实的 Paho 把 topic 和消息交给回调释放；这里的 MQTTClient_free/freeMessage 不释放内存
+    char name[64];
+    snprintf(name, sizeof(name), "%s", topic);
+    MQTTClient_message msg = {len, (void *)payload, 0, 0, 0, 0};
+    return g_arrived(g_context, name, 0, &msg);
+}
+
+void MQTTClient_global_init(MQTTClient_init_options *inits)
+{
+    (void)inits;
+}
+
+int MQTTClient_create(MQTTClient *handle, const char *server_uri, const char *client_id, int persistence_type,
+                      void *persistence_context)
+{
+    (void)server_uri;
+    (void)client_id;
+    (void)persistence_type;
+    (void)persistence_context;
+    *handle = &g_handle;
+    return MQTTCLIENT_SUCCESS;
+}
+
+int MQTTClient_setCallbacks(MQTTClient handle, void *context, MQTTClient_connectionLost *cl,
+                            MQTTClient_messageArrived *ma, MQTTClient_deliveryComplete *dc)
+{
+    (void)handle;
+    (void)cl;
+    (void)dc;
+    g_context = context;
+    g_arrived = ma;
+    return MQTTCLIENT_SUCCESS;
+}
+
+int MQTTClient_connect(MQTTClient handle, MQTTClient_connectOptions *options)
+{
+    (void)handle;
+    (void)options;
+    g_connects++;
+    g_connected = g_broker_online;
+    return g_connected ? MQTTCLIENT_SUCCESS : MQTTCLIENT_FAILURE;
+}
+
+int MQTTClient_isConnected(MQTTClient handle)
+{
+    (void)handle;
+    return g_connected;
+}
+
+int MQTTClient_publish(MQTTClient handle, const char *topic_name, int payloadlen, const void *payload, int qos,
+                       int retained, MQTTClient_deliveryToken *dt)
+{
+    (void)handle;
+    (void)retained;
+    (void)dt;
+    if (!g_connected)
+    {
+        return MQTTCLIENT_DISCONNECTED;
+    }
+    if (g_publish_hook != NULL)
+    {
+        g_publish_hook(topic_name);
+    }
+    if (g_published < FAKE_MQTT_LOG_MAX)
+    {
+        fake_mqtt_pub_t *pub = &g_log[g_published];
+        snprintf(pub->topic, sizeof(pub->topic), "%s", topic_name);
+        pub->len = (payloadlen < FAKE_MQTT_PAYLOAD_MAX) ? payloadlen : FAKE_MQTT_PAYLOAD_MAX - 1;
+        memcpy(pub->payload, payload, (size_t)pub->len);
+        pub->payload[pub->len] = '\0';
+        pub->qos = qos;
+    }
+    g_published++;
+    return MQTTCLIENT_SUCCESS;
+}
+
+int MQTTClient_subscribe(MQTTClient handle, const char *topic, int qos)
+{
+    (void)handle;
+    (void)topic;
+    (void)qos;
+    if (!g_connected)
+    {
+        return MQTTCLIENT_DISCONNECTED;
+    }
+    g_subscribes++;
+    return MQTTCLIENT_SUCCESS;
+}
+
+void MQTTClient_freeMessage(MQTTClient_message **msg)
+{
+    *msg = NULL;
+}
+
+void MQTTClient_free(void *ptr)
+{
+    (void)ptr;
+}
+
+void MQTTClient_destroy(MQTTClient *handle)
+{
+    *handle = NULL;
+}
+
+const char *MQTTClient_strerror(int code)
+{
+    return (code == MQTTCLIENT_SUCCESS) ? "success" : "error";
+}
@@ -0,0 +1,38 @@
+/* Paho MQTTClient 替身的控制接口：模拟 broker 上下线，记录发布与连接次数 */
+#ifndef HOST_FAKE_MQTT_H
+#define HOST_FAKE_MQTT_H
+
+#include <stdint.h>
+
+#define FAKE_MQTT_LOG_MAX 32
+#define FAKE_MQTT_PAYLOAD_MAX 256
+
+typedef struct
+{
+    char topic[64];
+    char payload[FAKE_MQTT_PAYLOAD_MAX];
+    int len;
+    int qos;
+} fake_mqtt_pub_t;
+
+// 清空记录，broker 在线、客户端未连接
+void fake_mqtt_reset(void);
+
+// broker 下线时已连接的客户端立即断开，之后 connect 失败、publish 返回 MQTTCLIENT_DISCONNECTED
+void fake_mqtt_set_broker(int online);
+
+uint32_t fake_mqtt_connects(void);
+uint32_t fake_mqtt_subscribes(void);
+uint32_t fake_mqtt_published(void);
+// 第 i 条成功发布的报文，超出记录范围时返回 NULL
+const fake_mqtt_pub_t *fake_mqtt_pub(uint32_t i);
+
+// 已连接时每次发布在记录报文之前调用，模拟另一个线程恰好在这次发布之前插入的操作；NULL 取消
+typedef void (*fake_mqtt_publish_hook_t)(const char *topic);
+void fake_mqtt_set_publish_hook(fake_mqtt_publish_hook_t hook);
+
+// broker 向客户端投递一条消息：在调用线程里直接调用 setCallbacks 注册的 messageArrived，
+// 返回其返回值；未注册回调或未连接时返回 0
+int fake_mqtt_deliver(const char *topic, const void *payload, int len);
+
+#endif
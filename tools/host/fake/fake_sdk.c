@@ -0,0 +1,773 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cJSON.h"
+#include "cmsis_os2.h"
+#include "dma.h"
+#include "pwm.h"
+#include "fake_sdk.h"
+#include "soc_osal.h"
+#include "tcxo.h"
+#include "watchdog.h"
+
+static gpio_level_t g_levels[FAKE_GPIO_PINS];
+static uint32_t g_gpio_writes = 0;
+static fake_gpio_hook_t g_gpio_hook = NULL;
+static fake_spi_hook_t g_spi_hook = NULL;
+static errcode_t g_spi_init_ret = ERRCODE_SUCC;
+static bool g_spi_dma = false;
+static uint32_t g_spi_unaligned = 0;
+static fake_i2c_write_hook_t g_i2c_write = NULL;
+static fake_i2c_read_hook_t g_i2c_read = NULL;
+static uint64_t g_now_us = 0;
+static uint32_t g_irq_depth = 0;
+static int32_t g_heap_live = 0;
+
+typedef struct
+{
+    uint64_t due_us;
+    timer_callback_t callback;
+    uintptr_t data;
+} fake_timer_t;
+
+static fake_timer_t g_timers[FAKE_TIMERS];
+
+void fake_sdk_reset(void)
+{
+    memset(g_levels, 0, sizeof(g_levels));
+    g_gpio_writes = 0;
+    g_gpio_hook = NULL;
+    g_spi_hook = NULL;
+    g_spi_init_ret = ERRCODE_SUCC;
+    g_spi_dma = false;
+    g_spi_unaligned = 0;
+    g_i2c_write = NULL;
+    g_i2c_read = NULL;
+    g_now_us = 0;
+    g_irq_depth = 0;
+    g_heap_live = 0;
+    for (uint32_t i = 0; i < FAKE_TIMERS; i++)
+    {
+        g_timers[i].due_us = FAKE_TIMER_IDLE;
+        g_timers[i].callback = NULL;
+    }
+}
+
+void fake_gpio_set_hook(fake_gpio_hook_t hook)
+{
+    g_gpio_hook = hook;
+}
+
+gpio_level_t fake_gpio_level(pin_t pin)
+{
+    return (pin < FAKE_GPIO_PINS) ? g_levels[pin] : GPIO_LEVEL_LOW;
+}
+
+void fake_gpio_set_input(pin_t pin, gpio_level_t level)
+{
+    if (pin < FAKE_GPIO_PINS)
+    {
+        g_levels[pin] = level;
+    }
+}
+
+uint32_t fake_gpio_writes(void)
+{
+    return g_gpio_writes;
+}
+
+void fake_spi_set_hook(fake_spi_hook_t hook)
+{
+    g_spi_hook = hook;
+}
+
+void fake_spi_set_init_result(errcode_t ret)
+{
+    g_spi_init_ret = ret;
+}
+
+uint32_t fake_spi_unaligned_dma(void)
+{
+    return g_spi_unaligned;
+}
+
+void fake_i2c_set_hooks(fake_i2c_write_hook_t write, fake_i2c_read_hook_t read)
+{
+    g_i2c_write = write;
+    g_i2c_read = read;
+}
+
+uint64_t fake_clock_us(void)
+{
+    return g_now_us;
+}
+
+void fake_clock_advance_us(uint64_t us)
+{
+    g_now_us += us;
+}
+
+static fake_timer_t *fake_timer_next(void)
+{
+    fake_timer_t *next = NULL;
+    for (uint32_t i = 0; i < FAKE_TIMERS; i++)
+    {
+        if (g_timers[i].due_us != FAKE_TIMER_IDLE && (next == NULL || g_timers[i].due_us < next->due_us))
+        {
+            next = &g_timers[i];
+        }
+    }
+    return next;
+}
+
+uint64_t fake_timer_due_us(void)
+{
+    fake_timer_t *t = fake_timer_next();
+    return (t != NULL) ? t->due_us : FAKE_TIMER_IDLE;
+}
+
+void fake_timer_fire(void)
+{
+    fake_timer_t *t = fake_timer_next();
+    if (t == NULL)
+    {
+        return;
+    }
+    t->due_us = FAKE_TIMER_IDLE;
+    t->callback(t->data);
+}
+
+uint32_t fake_irq_depth(void)
+{
+    return g_irq_depth;
+}
+
+int32_t fake_heap_live(void)
+{
+    return g_heap_live;
+}
+
+/* ---------------- pinctrl / gpio ---------------- */
+
+errcode_t uapi_pin_set_mode(pin_t pin, pin_mode_t mode)
+{
+    unused(pin);
+    unused(mode);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_pin_set_ds(pin_t pin, pin_drive_strength_t ds)
+{
+    unused(pin);
+    unused(ds);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_pin_set_pull(pin_t pin, pin_pull_t pull)
+{
+    unused(pin);
+    unused(pull);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_gpio_set_dir(pin_t pin, gpio_direction_t dir)
+{
+    unused(pin);
+    unused(dir);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_gpio_set_val(pin_t pin, gpio_level_t level)
+{
+    if (pin >= FAKE_GPIO_PINS)
+    {
+        return ERRCODE_INVALID_PARAM;
+    }
+    g_levels[pin] = level;
+    g_gpio_writes++;
+    if (g_gpio_hook != NULL)
+    {
+        g_gpio_hook(pin, level);
+    }
+    return ERRCODE_SUCC;
+}
+
+gpio_level_t uapi_gpio_get_val(pin_t pin)
+{
+    return fake_gpio_level(pin);
+}
+
+errcode_t uapi_gpio_toggle(pin_t pin)
+{
+    return uapi_gpio_set_val(pin, (fake_gpio_level(pin) == GPIO_LEVEL_LOW) ? GPIO_LEVEL_HIGH : GPIO_LEVEL_LOW);
+}
+
+errcode_t uapi_gpio_register_isr_func(pin_t pin, uint32_t trigger, gpio_callback_t callback)
+{
+    unused(pin);
+    unused(trigger);
+    unused(callback);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_gpio_unregister_isr_func(pin_t pin)
+{
+    unused(pin);
+    return ERRCODE_SUCC;
+}
+
+/* ---------------- spi / dma ---------------- */
+
+errcode_t uapi_dma_init(void)
+{
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_dma_open(void)
+{
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_spi_init(spi_bus_t bus, spi_attr_t *attr, spi_extra_attr_t *extra_attr)
+{
+    unused(bus);
+    unused(attr);
+    if (g_spi_init_ret == ERRCODE_SUCC)
+    {
+        g_spi_dma = (extra_attr != NULL) && extra_attr->tx_use_dma;
+    }
+    return g_spi_init_ret;
+}
+
+errcode_t uapi_spi_master_write(spi_bus_t bus, const spi_xfer_data_t *data, uint32_t timeout)
+{
+    unused(timeout);
+    if (g_spi_dma && ((uintptr_t)data->tx_buff & 0x3) != 0)
+    {
+        g_spi_unaligned++;
+    }
+    return (g_spi_hook != NULL) ? g_spi_hook(bus, data->tx_buff, data->tx_bytes) : ERRCODE_SUCC;
+}
+
+/* ---------------- i2c ---------------- */
+
+errcode_t uapi_i2c_master_init(i2c_bus_t bus, uint32_t baudrate, uint8_t hscode)
+{
+    unused(bus);
+    unused(baudrate);
+    unused(hscode);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_i2c_master_write(i2c_bus_t bus, uint16_t dev_addr, i2c_data_t *data)
+{
+    return (g_i2c_write != NULL) ? g_i2c_write(bus, dev_addr, data->send_buf, data->send_len) : ERRCODE_SUCC;
+}
+
+errcode_t uapi_i2c_master_read(i2c_bus_t bus, uint16_t dev_addr, i2c_data_t *data)
+{
+    if (g_i2c_read == NULL)
+    {
+        memset(data->receive_buf, 0, data->receive_len);
+        return ERRCODE_SUCC;
+    }
+    return g_i2c_read(bus, dev_addr, data->receive_buf, data->receive_len);
+}
+
+/* ---------------- 时钟 ---------------- */
+
+uint64_t uapi_tcxo_get_ms(void)
+{
+    return g_now_us / 1000;
+}
+
+uint64_t uapi_tcxo_get_us(void)
+{
+    return g_now_us;
+}
+
+void osal_msleep(unsigned int ms)
+{
+    g_now_us += (uint64_t)ms * 1000;
+}
+
+void osal_mdelay(unsigned int ms)
+{
+    g_now_us += (uint64_t)ms * 1000;
+}
+
+void osal_udelay(unsigned int us)
+{
+    g_now_us += us;
+}
+
+void uapi_tcxo_delay_ms(uint32_t ms)
+{
+    g_now_us += (uint64_t)ms * 1000;
+}
+
+/* ---------------- 定时器 ---------------- */
+
+errcode_t uapi_timer_init(void)
+{
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_timer_adapter(timer_index_t index, uint32_t int_id, uint16_t int_priority)
+{
+    unused(index);
+    unused(int_id);
+    unused(int_priority);
+    return ERRCODE_SUCC;
+}
+
+// 句柄即 &g_timers[index]
+errcode_t uapi_timer_create(timer_index_t index, timer_handle_t *timer)
+{
+    if (index >= FAKE_TIMERS)
+    {
+        return ERRCODE_INVALID_PARAM;
+    }
+    *timer = &g_timers[index];
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_timer_start(timer_handle_t timer, uint32_t time_us, timer_callback_t callback, uintptr_t data)
+{
+    fake_timer_t *t = timer;
+    if (t == NULL)
+    {
+        return ERRCODE_INVALID_PARAM;
+    }
+    t->due_us = g_now_us + time_us;
+    t->callback = callback;
+    t->data = data;
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_timer_stop(timer_handle_t timer)
+{
+    fake_timer_t *t = timer;
+    if (t == NULL)
+    {
+        return ERRCODE_INVALID_PARAM;
+    }
+    t->due_us = FAKE_TIMER_IDLE;
+    return ERRCODE_SUCC;
+}
+
+/* ---------------- osal ---------------- */
+
+// 默认不输出，设置环境变量 HOST_VERBOSE 后打印到 stderr
+int osal_printk(const char *fmt, ...)
+{
+    static int verbose = -1;
+    if (verbose < 0)
+    {
+        verbose = (getenv("HOST_VERBOSE") != NULL);
+    }
+    if (!verbose)
+    {
+        return 0;
+    }
+    va_list args;
+    va_start(args, fmt);
+    int ret = vfprintf(stderr, fmt, args);
+    va_end(args);
+    return ret;
+}
+
+unsigned int osal_irq_lock(void)
+{
+    return g_irq_depth++;
+}
+
+void osal_irq_restore(unsigned int flags)
+{
+    g_irq_depth = flags;
+}
+
+void *osal_vmalloc(unsigned long size)
+{
+    void *p = malloc(size);
+    g_heap_live += (p != NULL);
+    return p;
+}
+
+void osal_vfree(void *addr)
+{
+    g_heap_live -= (addr != NULL);
+    free(addr);
+}
+
+void *osal_kmalloc(unsigned long size, unsigned int flags)
+{
+    unused(flags);
+    void *p = malloc(size);
+    g_heap_live += (p != NULL);
+    return p;
+}
+
+void osal_kfree(void *addr)
+{
+    g_heap_live -= (addr != NULL);
+    free(addr);
+}
+
+int osal_event_init(osal_event *event)
+{
+    event->bits = 0;
+    return OSAL_SUCCESS;
+}
+
+int osal_event_write(osal_event *event, unsigned int mask)
+{
+    event->bits |= mask;
+    return OSAL_SUCCESS;
+}
+
+// 没有其它任务能写事件：条件不满足时把假时钟推进 timeout_ms 后返回失败
+int osal_event_read(osal_event *event, unsigned int mask, unsigned int timeout_ms, unsigned int mode)
+{
+    uint32_t hit = event->bits & mask;
+    uint8_t ok = (mode & OSAL_WAITMODE_AND) ? (hit == mask) : (hit != 0);
+    if (!ok)
+    {
+        if (timeout_ms != OSAL_WAIT_FOREVER)
+        {
+            osal_msleep(timeout_ms);
+        }
+        return OSAL_FAILURE;
+    }
+    if (mode & OSAL_WAITMODE_CLR)
+    {
+        event->bits &= ~hit;
+    }
+    return (int)hit;
+}
+
+int osal_event_clear(osal_event *event, unsigned int mask)
+{
+    event->bits &= ~mask;
+    return OSAL_SUCCESS;
+}
+
+int osal_event_destroy(osal_event *event)
+{
+    event->bits = 0;
+    return OSAL_SUCCESS;
+}
+
+int osal_sem_init(osal_semaphore *sem, int val)
+{
+    sem->count = val;
+    return OSAL_SUCCESS;
+}
+
+int osal_sem_down(osal_semaphore *sem)
+{
+    if (sem->count <= 0)
+    {
+        return OSAL_FAILURE;
+    }
+    sem->count--;
+    return OSAL_SUCCESS;
+}
+
+int osal_sem_down_timeout(osal_semaphore *sem, unsigned int timeout_ms)
+{
+    if (sem->count <= 0)
+    {
+        osal_msleep(timeout_ms);
+        return OSAL_FAILURE;
+    }
+    sem->count--;
+    return OSAL_SUCCESS;
+}
+
+void osal_sem_up(osal_semaphore *sem)
+{
+    sem->count++;
+}
+
+void osal_sem_destroy(osal_semaphore *sem)
+{
+    sem->count = 0;
+}
+
+int osal_mutex_init(osal_mutex *mutex)
+{
+    mutex->locked = 0;
+    return OSAL_SUCCESS;
+}
+
+int osal_mutex_lock(osal_mutex *mutex)
+{
+    mutex->locked++;
+    return OSAL_SUCCESS;
+}
+
+void osal_mutex_unlock(osal_mutex *mutex)
+{
+    mutex->locked--;
+}
+
+void osal_mutex_destroy(osal_mutex *mutex)
+{
+    mutex->locked = 0;
+}
+
+osal_task *osal_kthread_create(osal_kthread_handler handler, void *data, const char *name, unsigned int stack_size)
+{
+    unused(name);
+    unused(stack_size);
+    osal_task *task = osal_kmalloc(sizeof(osal_task), 0);
+    if (task != NULL)
+    {
+        task->handler = handler;
+        task->data = data;
+    }
+    return task;
+}
+
+int osal_kthread_set_priority(osal_task *task, unsigned int priority)
+{
+    unused(task);
+    unused(priority);
+    return OSAL_SUCCESS;
+}
+
+void osal_kthread_lock(void)
+{
+}
+
+void osal_kthread_unlock(void)
+{
+}
+
+int osal_msg_queue_create(const char *name, unsigned short queue_len, unsigned long *queue_id, unsigned int flags,
+                          unsigned short max_msgsize)
+{
+    unused(name);
+    unused(queue_len);
+    unused(flags);
+    unused(max_msgsize);
+    *queue_id = 1;
+    return OSAL_SUCCESS;
+}
+
+void osal_msg_queue_delete(unsigned long queue_id)
+{
+    unused(queue_id);
+}
+
+int osal_msg_queue_write_copy(unsigned long queue_id, void *buffer_addr, unsigned int buffer_size,
+                              unsigned int timeout)
+{
+    unused(queue_id);
+    unused(buffer_addr);
+    unused(buffer_size);
+    unused(timeout);
+    return OSAL_SUCCESS;
+}
+
+/* ---------------- 其它被引用但测试不关心的接口 ---------------- */
+
+errcode_t uapi_watchdog_init(uint32_t timeout)
+{
+    unused(timeout);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_watchdog_enable(wdt_mode_t mode)
+{
+    unused(mode);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_watchdog_kick(void)
+{
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_register_watchdog_callback(watchdog_callback_t callback)
+{
+    unused(callback);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_pwm_init(void)
+{
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_pwm_deinit(void)
+{
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_pwm_open(uint8_t channel, const pwm_config_t *cfg)
+{
+    unused(channel);
+    unused(cfg);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_pwm_close(uint8_t channel)
+{
+    unused(channel);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_pwm_register_interrupt(uint8_t channel, pwm_callback_t callback)
+{
+    unused(channel);
+    unused(callback);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_pwm_unregister_interrupt(uint8_t channel)
+{
+    unused(channel);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_pwm_set_group(uint8_t group, const uint8_t *channel_set, uint32_t channel_set_len)
+{
+    unused(group);
+    unused(channel_set);
+    unused(channel_set_len);
+    return ERRCODE_SUCC;
+}
+
+errcode_t uapi_pwm_start_group(uint8_t group)
+{
+    unused(group);
+    return ERRCODE_SUCC;
+}
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+    unused(func);
+    unused(argument);
+    unused(attr);
+    return NULL;
+}
+
+osStatus_t osKernelStart(void)
+{
+    return 0;
+}
+
+osStatus_t osDelay(uint32_t ticks)
+{
+    osal_msleep(ticks * 10);
+    return 0;
+}
+
+cJSON *cJSON_Parse(const char *value)
+{
+    unused(value);
+    return NULL;
+}
+
+cJSON *cJSON_ParseWithLength(const char *value, size_t buffer_length)
+{
+    unused(value);
+    unused(buffer_length);
+    return NULL;
+}
+
+char *cJSON_PrintUnformatted(const cJSON *item)
+{
+    unused(item);
+    return NULL;
+}
+
+int cJSON_IsArray(const cJSON *item)
+{
+    unused(item);
+    return 0;
+}
+
+int cJSON_IsObject(const cJSON *item)
+{
+    unused(item);
+    return 0;
+}
+
+int cJSON_IsString(const cJSON *item)
+{
+    unused(item);
+    return 0;
+}
+
+int cJSON_IsNumber(const cJSON *item)
+{
+    unused(item);
+    return 0;
+}
+
+int cJSON_GetArraySize(const cJSON *array)
+{
+    unused(array);
+    return 0;
+}
+
+cJSON *cJSON_GetArrayItem(const cJSON *array, int index)
+{
+    unused(array);
+    unused(index);
+    return NULL;
+}
+
+cJSON *cJSON_GetObjectItem(const cJSON *object, const char *string)
+{
+    unused(object);
+    unused(string);
+    return NULL;
+}
+
+cJSON *cJSON_CreateArray(void)
+{
+    return NULL;
+}
+
+cJSON *cJSON_CreateObject(void)
+{
+    return NULL;
+}
+
+cJSON *cJSON_AddNumberToObject(cJSON *object, const char *name, double number)
+{
+    unused(object);
+    unused(name);
+    unused(number);
+    return NULL;
+}
+
+cJSON *cJSON_AddStringToObject(cJSON *object, const char *name, const char *string)
+{
+    unused(object);
+    unused(name);
+    unused(string);
+    return NULL;
+}
+
+int cJSON_AddItemToArray(cJSON *array, cJSON *item)
+{
+    unused(array);
+    unused(item);
+    return 0;
+}
+
+void cJSON_free(void *object)
+{
+    unused(object);
+}
+
+void cJSON_Delete(cJSON *item)
+{
+    unused(item);
+}
@@ -0,0 +1,50 @@
+/* 主机替身的控制接口：测试通过回调截获 GPIO/SPI/I2C 流量，并用假时钟驱动超时逻辑 */
+#ifndef HOST_FAKE_SDK_H
+#define HOST_FAKE_SDK_H
+
+#include "gpio.h"
+#include "i2c.h"
+#include "spi.h"
+#include "timer.h"
+
+#define FAKE_GPIO_PINS 32
+#define FAKE_TIMERS 4
+#define FAKE_TIMER_IDLE UINT64_MAX
+
+typedef void (*fake_gpio_hook_t)(pin_t pin, gpio_level_t level);
+typedef errcode_t (*fake_spi_hook_t)(spi_bus_t bus, const uint8_t *buf, uint32_t len);
+typedef errcode_t (*fake_i2c_write_hook_t)(i2c_bus_t bus, uint16_t addr, const uint8_t *buf, uint32_t len);
+typedef errcode_t (*fake_i2c_read_hook_t)(i2c_bus_t bus, uint16_t addr, uint8_t *buf, uint32_t len);
+
+// 恢复全部默认状态：引脚为低、无回调、时钟归零、SPI 初始化成功
+void fake_sdk_reset(void);
+
+// 每次 uapi_gpio_set_val / uapi_gpio_toggle 后调用
+void fake_gpio_set_hook(fake_gpio_hook_t hook);
+gpio_level_t fake_gpio_level(pin_t pin);
+// 设置输入引脚的电平（如 BUSY），不触发回调
+void fake_gpio_set_input(pin_t pin, gpio_level_t level);
+uint32_t fake_gpio_writes(void);
+
+void fake_spi_set_hook(fake_spi_hook_t hook);
+void fake_spi_set_init_result(errcode_t ret);
+// 使能 DMA 后发送缓冲区不是 4 字节对齐的次数
+uint32_t fake_spi_unaligned_dma(void);
+
+void fake_i2c_set_hooks(fake_i2c_write_hook_t write, fake_i2c_read_hook_t read);
+
+uint64_t fake_clock_us(void);
+void fake_clock_advance_us(uint64_t us);
+
+// 硬件定时器都是单次的：uapi_timer_start 只登记到期时刻，测试把时钟推进到（或晚于）该时刻后
+// 调用 fake_timer_fire 进入回调，以此模拟中断延迟
+uint64_t fake_timer_due_us(void); // 最早到期的时刻，没有在计时的定时器时为 FAKE_TIMER_IDLE
+void fake_timer_fire(void);       // 触发最早到期的定时器，回调中可以重新启动它
+
+// 当前关中断的嵌套深度，用于检查 osal_irq_lock / osal_irq_restore 是否配对
+uint32_t fake_irq_depth(void);
+
+// osal_vmalloc/osal_kmalloc 分配而尚未释放的块数，用于检查缓冲区所有权是否正确移交
+int32_t fake_heap_live(void);
+
+#endif
@@ -0,0 +1,217 @@
+#include <string.h>
+#include "fake_sle.h"
+#include "sle_device_discovery.h"
+
+static ssapc_callbacks_t g_ssapc_cbk;
+static ssaps_callbacks_t g_ssaps_cbk;
+static sle_connection_callbacks_t g_conn_cbk;
+static fake_ssapc_write_hook_t g_write_hook = NULL;
+static fake_ssaps_notify_hook_t g_notify_hook = NULL;
+
+void fake_sle_reset(void)
+{
+    memset(&g_ssapc_cbk, 0, sizeof(g_ssapc_cbk));
+    memset(&g_ssaps_cbk, 0, sizeof(g_ssaps_cbk));
+    memset(&g_conn_cbk, 0, sizeof(g_conn_cbk));
+    g_write_hook = NULL;
+    g_notify_hook = NULL;
+}
+
+void fake_ssapc_set_write_hook(fake_ssapc_write_hook_t hook)
+{
+    g_write_hook = hook;
+}
+
+const ssapc_callbacks_t *fake_ssapc_callbacks(void)
+{
+    return &g_ssapc_cbk;
+}
+
+const ssaps_callbacks_t *fake_ssaps_callbacks(void)
+{
+    return &g_ssaps_cbk;
+}
+
+const sle_connection_callbacks_t *fake_sle_connection_callbacks(void)
+{
+    return &g_conn_cbk;
+}
+
+void fake_sle_connect(uint16_t conn_id, const sle_addr_t *addr)
+{
+    if (g_conn_cbk.connect_state_changed_cb != NULL)
+    {
+        g_conn_cbk.connect_state_changed_cb(conn_id, addr, SLE_ACB_STATE_CONNECTED, 0, 0);
+    }
+}
+
+void fake_sle_disconnect(uint16_t conn_id, const sle_addr_t *addr)
+{
+    if (g_conn_cbk.connect_state_changed_cb != NULL)
+    {
+        g_conn_cbk.connect_state_changed_cb(conn_id, addr, SLE_ACB_STATE_DISCONNECTED, 0, 0);
+    }
+}
+
+void fake_sle_pair_complete(uint16_t conn_id, const sle_addr_t *addr)
+{
+    if (g_conn_cbk.pair_complete_cb != NULL)
+    {
+        g_conn_cbk.pair_complete_cb(conn_id, addr, ERRCODE_SUCC);
+    }
+}
+
+void fake_ssaps_set_notify_hook(fake_ssaps_notify_hook_t hook)
+{
+    g_notify_hook = hook;
+}
+
+void fake_ssapc_write_cfm(uint8_t client_id, uint16_t conn_id, errcode_t status)
+{
+    ssapc_write_result_t result = {0};
+    if (g_ssapc_cbk.write_cfm_cb != NULL)
+    {
+        g_ssapc_cbk.write_cfm_cb(client_id, conn_id, &result, status);
+    }
+}
+
+/* ---------------- 协议栈 ---------------- */
+
+errcode_t enable_sle(void)
+{
+    return ERRCODE_SUCC;
+}
+
+errcode_t sle_set_seek_param(sle_seek_param_t *param)
+{
+    unused(param);
+    return ERRCODE_SUCC;
+}
+
+errcode_t sle_start_seek(void)
+{
+    return ERRCODE_SUCC;
+}
+
+errcode_t sle_stop_seek(void)
+{
+    return ERRCODE_SUCC;
+}
+
+errcode_t sle_announce_seek_register_callbacks(sle_announce_seek_callbacks_t *func)
+{
+    unused(func);
+    return ERRCODE_SUCC;
+}
+
+errcode_t sle_connect_remote_device(const sle_addr_t *addr)
+{
+    unused(addr);
+    return ERRCODE_SUCC;
+}
+
+errcode_t sle_connection_register_callbacks(sle_connection_callbacks_t *func)
+{
+    g_conn_cbk = *func;
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssapc_register_callbacks(ssapc_callbacks_t *func)
+{
+    g_ssapc_cbk = *func;
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssapc_exchange_info_req(uint8_t client_id, uint16_t conn_id, ssap_exchange_info_t *param)
+{
+    unused(client_id);
+    unused(conn_id);
+    unused(param);
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssapc_find_structure(uint8_t client_id, uint16_t conn_id, ssapc_find_structure_param_t *param)
+{
+    unused(client_id);
+    unused(conn_id);
+    unused(param);
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssapc_write_req(uint8_t client_id, uint16_t conn_id, ssapc_write_param_t *param)
+{
+    return (g_write_hook != NULL) ? g_write_hook(client_id, conn_id, param) : ERRCODE_SUCC;
+}
+
+errcode_t ssaps_register_callbacks(ssaps_callbacks_t *func)
+{
+    g_ssaps_cbk = *func;
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssaps_register_server(sle_uuid_t *app_uuid, uint8_t *server_id)
+{
+    unused(app_uuid);
+    *server_id = 1;
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssaps_unregister_server(uint8_t server_id)
+{
+    unused(server_id);
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssaps_add_service_sync(uint8_t server_id, sle_uuid_t *service_uuid, bool is_primary, uint16_t *handle)
+{
+    unused(server_id);
+    unused(service_uuid);
+    unused(is_primary);
+    *handle = 1;
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssaps_add_property_sync(uint8_t server_id, uint16_t service_handle, ssaps_property_info_t *property,
+                                  uint16_t *handle)
+{
+    unused(server_id);
+    unused(property);
+    *handle = service_handle + 1;
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssaps_add_descriptor_sync(uint8_t server_id, uint16_t service_handle, uint16_t property_handle,
+                                    ssaps_desc_info_t *descriptor)
+{
+    unused(server_id);
+    unused(service_handle);
+    unused(property_handle);
+    unused(descriptor);
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssaps_start_service(uint8_t server_id, uint16_t service_handle)
+{
+    unused(server_id);
+    unused(service_handle);
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssaps_set_info(uint8_t server_id, ssap_exchange_info_t *info)
+{
+    unused(server_id);
+    unused(info);
+    return ERRCODE_SUCC;
+}
+
+errcode_t ssaps_notify_indicate(uint8_t server_id, uint16_t conn_id, ssaps_ntf_ind_t *param)
+{
+    unused(server_id);
+    return (g_notify_hook != NULL) ? g_notify_hook(conn_id, param->value, param->value_len) : ERRCODE_SUCC;
+}
+
+errcode_t ssaps_notify_indicate_by_uuid(uint8_t server_id, uint16_t conn_id, ssaps_ntf_ind_by_uuid_t *param)
+{
+    unused(server_id);
+    return (g_notify_hook != NULL) ? g_notify_hook(conn_id, param->value, param->value_len) : ERRCODE_SUCC;
+}
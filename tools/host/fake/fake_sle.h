@@ -0,0 +1,32 @@
+/* 星闪协议栈替身：截获 ssapc_write_req 与 ssaps_notify_indicate，保存注册的回调，由测试模拟连接和 write_cfm */
+#ifndef HOST_FAKE_SLE_H
+#define HOST_FAKE_SLE_H
+
+#include "sle_connection_manager.h"
+#include "sle_ssap_client.h"
+#include "sle_ssap_server.h"
+
+typedef errcode_t (*fake_ssapc_write_hook_t)(uint8_t client_id, uint16_t conn_id, const ssapc_write_param_t *param);
+typedef errcode_t (*fake_ssaps_notify_hook_t)(uint16_t conn_id, const uint8_t *data, uint16_t len);
+
+// 清除回调与钩子
+void fake_sle_reset(void);
+
+// 每次 ssapc_write_req 时调用，返回值即 ssapc_write_req 的返回值；未设置时返回成功
+void fake_ssapc_set_write_hook(fake_ssapc_write_hook_t hook);
+
+// 每次 ssaps_notify_indicate 时调用，返回值即其返回值；未设置时返回成功
+void fake_ssaps_set_notify_hook(fake_ssaps_notify_hook_t hook);
+
+// 被测代码注册的回调，未注册时对应成员为 NULL
+const ssapc_callbacks_t *fake_ssapc_callbacks(void);
+const ssaps_callbacks_t *fake_ssaps_callbacks(void);
+const sle_connection_callbacks_t *fake_sle_connection_callbacks(void);
+
+// 模拟协议栈上报连接状态和写确认
+void fake_sle_connect(uint16_t conn_id, const sle_addr_t *addr);
+void fake_sle_disconnect(uint16_t conn_id, const sle_addr_t *addr);
+void fake_sle_pair_complete(uint16_t conn_id, const sle_addr_t *addr);
+void fake_ssapc_write_cfm(uint8_t client_id, uint16_t conn_id, errcode_t status);
+
+#endif
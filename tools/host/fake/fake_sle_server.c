@@ -0,0 +1,10 @@
+/* EPD 主程序引用的星闪服务端接口，主机上不建立连接 */
+#include "sle_uart_server.h"
+
+errcode_t sle_uart_server_init(ssaps_read_request_callback ssaps_read_callback,
+                               ssaps_write_request_callback ssaps_write_callback)
+{
+    (void)ssaps_read_callback;
+    (void)ssaps_write_callback;
+    return ERRCODE_SUCC;
+}
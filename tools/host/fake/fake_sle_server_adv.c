@@ -0,0 +1,13 @@
+/* ExBoard 星闪服务端的广播配置，主机上不发广播 */
+#include "sle_errcode.h"
+#include "sle_uart_server.h"
+
+errcode_t sle_uart_announce_register_cbks(void)
+{
+    return ERRCODE_SLE_SUCCESS;
+}
+
+errcode_t sle_uart_server_adv_init(void)
+{
+    return ERRCODE_SLE_SUCCESS;
+}
@@ -0,0 +1,21 @@
+#include "soundService.h"
+#include "fake_sound.h"
+
+static sound_level_t g_level = {0, 0};
+static uint32_t g_seq = 0;
+
+void fake_sound_push_level(uint16_t rms, uint16_t peak)
+{
+    g_level.rms = rms;
+    g_level.peak = peak;
+    g_seq++;
+}
+
+uint32_t sound_recorder_get_level(sound_level_t *level)
+{
+    if (level != NULL)
+    {
+        *level = g_level;
+    }
+    return g_seq;
+}
@@ -0,0 +1,10 @@
+/* soundService 的替身：测试直接设置最近一块录音的电平 */
+#ifndef HOST_FAKE_SOUND_H
+#define HOST_FAKE_SOUND_H
+
+#include <stdint.h>
+
+// 写入一个新电平，sound_recorder_get_level 的序号随之加 1
+void fake_sound_push_level(uint16_t rms, uint16_t peak);
+
+#endif
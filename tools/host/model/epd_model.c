@@ -0,0 +1,255 @@
+#include <stdlib.h>
+#include <string.h>
+#include "epd_model.h"
+#include "fake_sdk.h"
+
+#define EPD_PIN_SCL 7
+#define EPD_PIN_CS 8
+#define EPD_PIN_SDA 9
+#define EPD_PIN_DC 10
+
+static epd_model_t *g_model = NULL;
+
+static void epd_model_step(uint8_t *carry, uint8_t inc, uint16_t *pos, uint16_t a, uint16_t b)
+{
+    uint16_t lo = (a < b) ? a : b;
+    uint16_t hi = (a < b) ? b : a;
+    *carry = 0;
+    if (inc)
+    {
+        if (*pos >= hi)
+        {
+            *pos = lo;
+            *carry = 1;
+        }
+        else
+        {
+            (*pos)++;
+        }
+    }
+    else
+    {
+        if (*pos <= lo)
+        {
+            *pos = hi;
+            *carry = 1;
+        }
+        else
+        {
+            (*pos)--;
+        }
+    }
+}
+
+// 写一个字节并按数据输入模式推进计数器：bit0 X 递增，bit1 Y 递增，bit2 为 1 时先走 Y 方向
+static void epd_model_ram_write(epd_model_t *m, epd_ctrl_t *c, uint8_t plane, uint8_t byte)
+{
+    if (c->x >= EPD_MODEL_X_BYTES || c->y >= EPD_MODEL_Y_LINES)
+    {
+        m->errors++;
+    }
+    else
+    {
+        c->ram[plane][c->y][c->x] = byte;
+    }
+    m->ram_bytes++;
+
+    uint16_t x = c->x;
+    uint8_t carry;
+    if (c->entry & 0x04)
+    {
+        epd_model_step(&carry, c->entry & 0x02, &c->y, c->ys, c->ye);
+        if (carry)
+        {
+            epd_model_step(&carry, c->entry & 0x01, &x, c->xs, c->xe);
+        }
+    }
+    else
+    {
+        epd_model_step(&carry, c->entry & 0x01, &x, c->xs, c->xe);
+        if (carry)
+        {
+            epd_model_step(&carry, c->entry & 0x02, &c->y, c->ys, c->ye);
+        }
+    }
+    c->x = (uint8_t)x;
+}
+
+static void epd_model_param(epd_model_t *m, uint8_t byte)
+{
+    epd_ctrl_t *c = &m->ctrl[(m->cmd & 0x80) ? 1 : 0];
+    uint8_t base = m->cmd & 0x7F;
+    // 0x24/0x26 与从控的 0xA4/0xA6：写 RAM，不计参数
+    if (base == 0x24 || base == 0x26)
+    {
+        epd_model_ram_write(m, c, (base == 0x26) ? 1 : 0, byte);
+        return;
+    }
+    if (m->nparam < sizeof(m->param))
+    {
+        m->param[m->nparam] = byte;
+    }
+    m->nparam++;
+    const uint8_t *p = m->param;
+    switch (m->cmd)
+    {
+    case 0x11:
+    case 0x91:
+        c->entry = p[0];
+        break;
+    case 0x44:
+    case 0xC4:
+        if (m->nparam == 2)
+        {
+            c->xs = p[0];
+            c->xe = p[1];
+        }
+        break;
+    case 0x45:
+    case 0xC5:
+        if (m->nparam == 4)
+        {
+            c->ys = p[0] | (p[1] << 8);
+            c->ye = p[2] | (p[3] << 8);
+        }
+        break;
+    case 0x4E:
+    case 0xCE:
+        c->x = p[0];
+        break;
+    case 0x4F:
+    case 0xCF:
+        if (m->nparam == 2)
+        {
+            c->y = p[0] | (p[1] << 8);
+        }
+        break;
+    case 0x22:
+        m->last_update_ctrl = p[0];
+        break;
+    case 0x10:
+        m->sleeping = p[0] & 0x01;
+        break;
+    default:
+        break;
+    }
+}
+
+void epd_model_feed(epd_model_t *m, uint8_t dc, uint8_t byte)
+{
+    if (m->trace != NULL && m->trace_len < m->trace_cap)
+    {
+        m->trace[m->trace_len++] = (uint16_t)((dc ? EPD_TRACE_DC : 0) | byte);
+    }
+    if (!dc)
+    {
+        m->commands++;
+        m->cmd = byte;
+        m->nparam = 0;
+        if (byte == 0x20)
+        {
+            m->updates++;
+        }
+        else if (byte == 0x12)
+        {
+            m->sleeping = 0;
+        }
+        return;
+    }
+    m->data_bytes++;
+    epd_model_param(m, byte);
+}
+
+// 软件 SPI：CS 低时在 SCL 上升沿采样 SDA，满 8 位时按当时的 DC 输出一个字节
+static void epd_model_gpio(pin_t pin, gpio_level_t level)
+{
+    epd_model_t *m = g_model;
+    if (pin == EPD_PIN_CS && level == GPIO_LEVEL_HIGH && m->bits != 0)
+    {
+        m->errors++;
+        m->bits = 0;
+    }
+    if (pin != EPD_PIN_SCL)
+    {
+        return;
+    }
+    uint8_t rising = (level == GPIO_LEVEL_HIGH) && !m->prev_scl;
+    m->prev_scl = (level == GPIO_LEVEL_HIGH);
+    if (!rising || fake_gpio_level(EPD_PIN_CS) != GPIO_LEVEL_LOW)
+    {
+        return;
+    }
+    m->shift = (uint8_t)((m->shift << 1) | (fake_gpio_level(EPD_PIN_SDA) == GPIO_LEVEL_HIGH));
+    if (++m->bits == 8)
+    {
+        m->bits = 0;
+        epd_model_feed(m, fake_gpio_level(EPD_PIN_DC) == GPIO_LEVEL_HIGH, m->shift);
+    }
+}
+
+static errcode_t epd_model_spi(spi_bus_t bus, const uint8_t *buf, uint32_t len)
+{
+    epd_model_t *m = g_model;
+    (void)bus;
+    if (fake_gpio_level(EPD_PIN_CS) != GPIO_LEVEL_LOW)
+    {
+        m->errors++;
+    }
+    uint8_t dc = fake_gpio_level(EPD_PIN_DC) == GPIO_LEVEL_HIGH;
+    for (uint32_t i = 0; i < len; i++)
+    {
+        epd_model_feed(m, dc, buf[i]);
+    }
+    return ERRCODE_SUCC;
+}
+
+void epd_model_attach(epd_model_t *m, uint32_t trace_cap)
+{
+    free(m->trace);
+    memset(m, 0, sizeof(*m));
+    if (trace_cap != 0)
+    {
+        m->trace = malloc(trace_cap * sizeof(m->trace[0]));
+        m->trace_cap = trace_cap;
+    }
+    g_model = m;
+    fake_gpio_set_hook(epd_model_gpio);
+    fake_spi_set_hook(epd_model_spi);
+}
+
+void epd_model_detach(epd_model_t *m)
+{
+    fake_gpio_set_hook(NULL);
+    fake_spi_set_hook(NULL);
+    free(m->trace);
+    m->trace = NULL;
+    m->trace_cap = 0;
+    g_model = NULL;
+}
+
+// 画布行 line 对应门线 271 - line；左半字节列 c 在主控 X = c，右半在从控 X = 99 - c
+uint8_t epd_model_canvas_byte(const epd_model_t *m, uint8_t plane, uint16_t line, uint16_t col)
+{
+    uint16_t y = EPD_MODEL_Y_LINES - 1 - line;
+    if (col < EPD_MODEL_X_BYTES)
+    {
+        return m->ctrl[0].ram[plane][y][col];
+    }
+    return m->ctrl[1].ram[plane][y][2 * EPD_MODEL_X_BYTES - 1 - col];
+}
+
+host_image_t *epd_model_image(const epd_model_t *m, uint8_t plane)
+{
+    host_image_t *img = image_new(EPD_MODEL_VISIBLE_W, EPD_MODEL_Y_LINES, 1);
+    for (uint16_t line = 0; line < EPD_MODEL_Y_LINES; line++)
+    {
+        for (uint16_t x = 0; x < EPD_MODEL_VISIBLE_W; x++)
+        {
+            uint16_t cx = (x < EPD_MODEL_VISIBLE_W / 2) ? x : x + 8;
+            uint8_t bit = (epd_model_canvas_byte(m, plane, line, cx / 8) >> (7 - cx % 8)) & 1;
+            // 黑白平面 1 为白，红色平面 1 为红
+            img->pixels[line * EPD_MODEL_VISIBLE_W + x] = plane ? bit : !bit;
+        }
+    }
+    return img;
+}
@@ -0,0 +1,61 @@
+/*
+ * SSD1683 双控制器电子纸模型：从 SPI（硬件或 GPIO 模拟）流量中解出 (DC, 字节) 序列，
+ * 按命令维护主、从控制器的地址窗口与计数器并写入 RAM，可重建面板上的黑白和红色画面
+ */
+#ifndef HOST_EPD_MODEL_H
+#define HOST_EPD_MODEL_H
+
+#include <stdint.h>
+#include "image.h"
+
+#define EPD_MODEL_X_BYTES 50  // 每个控制器的 RAM 宽度（字节）
+#define EPD_MODEL_Y_LINES 272 // 门线数
+#define EPD_MODEL_VISIBLE_W 792
+
+typedef struct
+{
+    uint8_t entry;     // 数据输入模式（0x11 / 0x91）
+    uint8_t xs, xe;    // X 窗口（字节）
+    uint16_t ys, ye;   // Y 窗口
+    uint8_t x;         // 地址计数器
+    uint16_t y;
+    uint8_t ram[2][EPD_MODEL_Y_LINES][EPD_MODEL_X_BYTES]; // [0] 黑白，[1] 红
+} epd_ctrl_t;
+
+typedef struct
+{
+    epd_ctrl_t ctrl[2]; // [0] 主控（左半），[1] 从控（右半）
+    uint8_t cmd;        // 当前命令
+    uint8_t param[8];
+    uint8_t nparam;
+    uint32_t commands;   // 收到的命令字节数
+    uint32_t data_bytes; // 收到的数据字节数
+    uint32_t ram_bytes;  // 写入 RAM 的字节数
+    uint32_t errors;     // 协议错误：RAM 越界、CS 未拉低时传输、不完整的字节等
+    uint32_t updates;    // 0x20 次数
+    uint8_t last_update_ctrl; // 最近一次 0x20 之前 0x22 的参数
+    uint8_t sleeping;
+    // GPIO 软件 SPI 解码状态
+    uint8_t shift;
+    uint8_t bits;
+    uint8_t prev_scl;
+    // 记录 (DC, 字节) 序列，trace 为 NULL 时不记录
+    uint16_t *trace;
+    uint32_t trace_len;
+    uint32_t trace_cap;
+} epd_model_t;
+
+#define EPD_TRACE_DC 0x100 // trace 元素的 bit8 为 DC，低 8 位为字节
+
+// 复位模型并接管 fake SDK 的 GPIO 与 SPI 回调；trace_cap 为 0 时不记录序列
+void epd_model_attach(epd_model_t *m, uint32_t trace_cap);
+void epd_model_detach(epd_model_t *m);
+void epd_model_feed(epd_model_t *m, uint8_t dc, uint8_t byte);
+
+// 重建可见的 792x272 画面（画布 x >= 396 的部分右移 8 像素后才可见）：
+// plane 0 为黑白（黑为 1），plane 1 为红（红为 1）
+host_image_t *epd_model_image(const epd_model_t *m, uint8_t plane);
+// 按画布坐标读取 RAM 中的一个字节（行 line、字节列 col，0~99），用于与渲染结果逐字节比对
+uint8_t epd_model_canvas_byte(const epd_model_t *m, uint8_t plane, uint16_t line, uint16_t col);
+
+#endif
@@ -0,0 +1,156 @@
+#include <string.h>
+#include "fake_sdk.h"
+#include "ssd1306_model.h"
+
+#define SSD1306_MODEL_ADDR 0x3C
+
+static ssd1306_model_t *g_model = NULL;
+
+// 带参数命令的参数个数，其余命令没有参数
+static uint8_t ssd1306_model_nparams(uint8_t cmd)
+{
+    switch (cmd)
+    {
+    case 0x20:
+    case 0x81:
+    case 0x8D:
+    case 0xA8:
+    case 0xD3:
+    case 0xD5:
+    case 0xD9:
+    case 0xDA:
+    case 0xDB:
+        return 1;
+    case 0x21:
+    case 0x22:
+        return 2;
+    default:
+        return 0;
+    }
+}
+
+static void ssd1306_model_command(ssd1306_model_t *m, uint8_t byte)
+{
+    if (m->pending != 0)
+    {
+        m->pending--;
+        if (m->cmd == 0x20)
+        {
+            m->addr_mode = byte & 0x03;
+        }
+        return;
+    }
+    m->cmd = byte;
+    m->pending = ssd1306_model_nparams(byte);
+    if (byte <= 0x0F)
+    {
+        m->col = (uint8_t)((m->col & 0xF0) | byte);
+    }
+    else if (byte <= 0x1F)
+    {
+        m->col = (uint8_t)((m->col & 0x0F) | ((byte & 0x07) << 4));
+    }
+    else if (byte >= 0xB0 && byte <= 0xB7)
+    {
+        m->page = byte & 0x07;
+    }
+    else if (byte == 0xA6 || byte == 0xA7)
+    {
+        m->inverse = byte & 0x01;
+    }
+    else if (byte == 0xAE || byte == 0xAF)
+    {
+        m->display_on = byte & 0x01;
+    }
+}
+
+// 页寻址模式下列地址在页内回绕；水平模式下写满一行后进入下一页
+static void ssd1306_model_data(ssd1306_model_t *m, uint8_t byte)
+{
+    if (m->col >= SSD1306_MODEL_W || m->page >= SSD1306_MODEL_PAGES)
+    {
+        m->errors++;
+        return;
+    }
+    m->gddram[m->page][m->col] = byte;
+    m->data_bytes++;
+    if (++m->col == SSD1306_MODEL_W)
+    {
+        m->col = 0;
+        if (m->addr_mode == 0)
+        {
+            m->page = (m->page + 1) % SSD1306_MODEL_PAGES;
+        }
+    }
+}
+
+static errcode_t ssd1306_model_write(i2c_bus_t bus, uint16_t addr, const uint8_t *buf, uint32_t len)
+{
+    ssd1306_model_t *m = g_model;
+    (void)bus;
+    if (addr != SSD1306_MODEL_ADDR)
+    {
+        m->errors++;
+        return ERRCODE_FAIL;
+    }
+    m->transfers++;
+    m->bus_bytes += len + 1;
+    uint32_t i = 0;
+    // 控制字节：bit7 (Co) 为 1 时后面只跟一个字节，再接下一个控制字节；bit6 (D/C#) 选择数据或命令
+    while (i < len)
+    {
+        uint8_t ctrl = buf[i++];
+        uint8_t is_data = ctrl & 0x40;
+        uint32_t end = (ctrl & 0x80) ? i + 1 : len;
+        if (end > len)
+        {
+            m->errors++;
+            break;
+        }
+        for (; i < end; i++)
+        {
+            if (is_data)
+            {
+                ssd1306_model_data(m, buf[i]);
+            }
+            else
+            {
+                ssd1306_model_command(m, buf[i]);
+            }
+        }
+    }
+    return ERRCODE_SUCC;
+}
+
+void ssd1306_model_attach(ssd1306_model_t *m)
+{
+    memset(m, 0, sizeof(*m));
+    m->addr_mode = 2;
+    g_model = m;
+    fake_i2c_set_hooks(ssd1306_model_write, NULL);
+}
+
+void ssd1306_model_detach(void)
+{
+    fake_i2c_set_hooks(NULL, NULL);
+    g_model = NULL;
+}
+
+host_image_t *ssd1306_model_image(const ssd1306_model_t *m)
+{
+    host_image_t *img = image_new(SSD1306_MODEL_W, SSD1306_MODEL_PAGES * 8, 1);
+    for (uint32_t y = 0; y < SSD1306_MODEL_PAGES * 8u; y++)
+    {
+        for (uint32_t x = 0; x < SSD1306_MODEL_W; x++)
+        {
+            uint8_t on = (m->gddram[y / 8][x] >> (y % 8)) & 1;
+            img->pixels[y * SSD1306_MODEL_W + x] = on ^ m->inverse;
+        }
+    }
+    return img;
+}
+
+void ssd1306_model_copy(const ssd1306_model_t *m, uint8_t out[SSD1306_MODEL_PAGES * SSD1306_MODEL_W])
+{
+    memcpy(out, m->gddram, SSD1306_MODEL_PAGES * SSD1306_MODEL_W);
+}
@@ -0,0 +1,34 @@
+/* SSD1306（I2C，地址 0x3C）模型：解析控制字节、命令及参数，维护 128x64 GDDRAM */
+#ifndef HOST_SSD1306_MODEL_H
+#define HOST_SSD1306_MODEL_H
+
+#include <stdint.h>
+#include "image.h"
+
+#define SSD1306_MODEL_W 128
+#define SSD1306_MODEL_PAGES 8
+
+typedef struct
+{
+    uint8_t gddram[SSD1306_MODEL_PAGES][SSD1306_MODEL_W];
+    uint8_t addr_mode; // 0x20 的参数：0 水平，1 垂直，2 页寻址
+    uint8_t page;
+    uint8_t col;
+    uint8_t inverse;
+    uint8_t display_on;
+    uint8_t cmd;       // 等待参数的命令
+    uint8_t pending;   // 还差几个参数
+    uint32_t transfers;  // I2C 写事务数
+    uint32_t bus_bytes;  // 总线上的字节数（含地址字节）
+    uint32_t data_bytes; // 写入 GDDRAM 的字节数
+    uint32_t errors;
+} ssd1306_model_t;
+
+void ssd1306_model_attach(ssd1306_model_t *m);
+void ssd1306_model_detach(void);
+// 128x64 PBM，考虑反显（A7），1 为亮
+host_image_t *ssd1306_model_image(const ssd1306_model_t *m);
+// 把一页一页的 GDDRAM 拷出来（与 SSD1306_Buffer 的布局相同）
+void ssd1306_model_copy(const ssd1306_model_t *m, uint8_t out[SSD1306_MODEL_PAGES * SSD1306_MODEL_W]);
+
+#endif
@@ -0,0 +1,132 @@
+#include <string.h>
+#include "fake_sdk.h"
+#include "ssd1363_model.h"
+
+#define SSD1363_MODEL_ADDR 0x3C
+
+static ssd1363_model_t *g_model = NULL;
+
+static void ssd1363_model_command(ssd1363_model_t *m, uint8_t byte)
+{
+    m->cmd = byte;
+    m->nparam = 0;
+    if (byte == 0x5C)
+    {
+        m->col = m->c0;
+        m->row = m->r0;
+        m->half = 0;
+    }
+}
+
+// 写 RAM：每个列地址收满 2 字节后列地址加 1，到窗口右边界回到左边界并换行
+static void ssd1363_model_ram(ssd1363_model_t *m, uint8_t byte)
+{
+    if (m->col >= SSD1363_MODEL_COLS || m->row >= SSD1363_MODEL_ROWS)
+    {
+        m->errors++;
+        return;
+    }
+    m->gddram[m->row][m->col][m->half] = byte;
+    m->ram_bytes++;
+    if (++m->half < 2)
+    {
+        return;
+    }
+    m->half = 0;
+    if (m->col < m->c1)
+    {
+        m->col++;
+        return;
+    }
+    m->col = m->c0;
+    m->row = (m->row < m->r1) ? m->row + 1 : m->r0;
+}
+
+static void ssd1363_model_data(ssd1363_model_t *m, uint8_t byte)
+{
+    if (m->cmd == 0x5C)
+    {
+        ssd1363_model_ram(m, byte);
+        return;
+    }
+    if (m->nparam < sizeof(m->param))
+    {
+        m->param[m->nparam] = byte;
+    }
+    m->nparam++;
+    if (m->cmd == 0x15 && m->nparam == 2)
+    {
+        m->c0 = m->param[0];
+        m->c1 = m->param[1];
+    }
+    else if (m->cmd == 0x75 && m->nparam == 2)
+    {
+        m->r0 = m->param[0];
+        m->r1 = m->param[1];
+    }
+}
+
+static errcode_t ssd1363_model_write(i2c_bus_t bus, uint16_t addr, const uint8_t *buf, uint32_t len)
+{
+    ssd1363_model_t *m = g_model;
+    (void)bus;
+    if (addr != SSD1363_MODEL_ADDR)
+    {
+        return ERRCODE_SUCC; // 传感器等其它设备
+    }
+    m->transfers++;
+    m->bus_bytes += len + 1;
+    uint32_t i = 0;
+    while (i < len)
+    {
+        uint8_t ctrl = buf[i++];
+        uint8_t is_data = ctrl & 0x40;
+        uint32_t end = (ctrl & 0x80) ? i + 1 : len;
+        if (end > len)
+        {
+            m->errors++;
+            break;
+        }
+        for (; i < end; i++)
+        {
+            if (is_data)
+            {
+                ssd1363_model_data(m, buf[i]);
+            }
+            else
+            {
+                ssd1363_model_command(m, buf[i]);
+            }
+        }
+    }
+    return ERRCODE_SUCC;
+}
+
+void ssd1363_model_attach(ssd1363_model_t *m)
+{
+    memset(m, 0, sizeof(*m));
+    g_model = m;
+    fake_i2c_set_hooks(ssd1363_model_write, NULL);
+}
+
+void ssd1363_model_detach(void)
+{
+    fake_i2c_set_hooks(NULL, NULL);
+    g_model = NULL;
+}
+
+// 一个列地址的 2 字节为 {p3 << 4 | p2, p1 << 4 | p0}，p0 在最左
+host_image_t *ssd1363_model_image(const ssd1363_model_t *m)
+{
+    host_image_t *img = image_new(SSD1363_MODEL_W, SSD1363_MODEL_ROWS, 15);
+    for (uint32_t y = 0; y < SSD1363_MODEL_ROWS; y++)
+    {
+        for (uint32_t x = 0; x < SSD1363_MODEL_W; x++)
+        {
+            const uint8_t *pair = m->gddram[y][SSD1363_MODEL_COL_OFFSET + x / 4];
+            uint8_t byte = pair[(x & 2) ? 0 : 1];
+            img->pixels[y * SSD1363_MODEL_W + x] = (x & 1) ? (byte >> 4) : (byte & 0x0F);
+        }
+    }
+    return img;
+}
@@ -0,0 +1,33 @@
+/* SSD1363（I2C，地址 0x3C）模型：解析控制字节与 0x15/0x75/0x5C 命令，维护 4bpp GDDRAM */
+#ifndef HOST_SSD1363_MODEL_H
+#define HOST_SSD1363_MODEL_H
+
+#include <stdint.h>
+#include "image.h"
+
+#define SSD1363_MODEL_COLS 80 // 列地址数，每个列地址 4 个像素、2 字节
+#define SSD1363_MODEL_ROWS 128
+#define SSD1363_MODEL_COL_OFFSET 8 // 面板第 0 列对应的列地址
+#define SSD1363_MODEL_W 256
+
+typedef struct
+{
+    uint8_t gddram[SSD1363_MODEL_ROWS][SSD1363_MODEL_COLS][2];
+    uint8_t cmd;
+    uint8_t param[4];
+    uint8_t nparam;
+    uint8_t c0, c1, r0, r1; // 窗口
+    uint8_t col, row;       // 写指针
+    uint8_t half;           // 当前列地址已写的字节数
+    uint32_t transfers;
+    uint32_t bus_bytes;
+    uint32_t ram_bytes;
+    uint32_t errors;
+} ssd1363_model_t;
+
+void ssd1363_model_attach(ssd1363_model_t *m);
+void ssd1363_model_detach(void);
+// 256x128 PGM，灰度 0~15
+host_image_t *ssd1363_model_image(const ssd1363_model_t *m);
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef HOST_MQTTCLIENT_H
+#define HOST_MQTTCLIENT_H
+
+/* Paho MQTTClient 同步接口中被网关用到的部分，行为由 fake/fake_mqtt.c 模拟 */
+#define MQTTCLIENT_SUCCESS 0
+#define MQTTCLIENT_FAILURE (-1)
+#define MQTTCLIENT_DISCONNECTED (-3)
+#define MQTTCLIENT_PERSISTENCE_NONE 1
+
+typedef void *MQTTClient;
+typedef int MQTTClient_deliveryToken;
+
+typedef struct
+{
+    int payloadlen;
+    void *payload;
+    int qos;
+    int retained;
+    int dup;
+    int msgid;
+} MQTTClient_message;
+
+typedef struct
+{
+    int struct_version;
+    int keepAliveInterval;
+    int cleansession;
+    int reliable;
+    int maxInflightMessages;
+} MQTTClient_connectOptions;
+#define MQTTClient_connectOptions_initializer {0}
+
+typedef struct
+{
+    int do_openssl_init;
+} MQTTClient_init_options;
+#define MQTTClient_init_options_initializer {0}
+
+typedef int MQTTClient_messageArrived(void *context, char *topic, int topic_len, MQTTClient_message *message);
+typedef void MQTTClient_deliveryComplete(void *context, MQTTClient_deliveryToken dt);
+typedef void MQTTClient_connectionLost(void *context, char *cause);
+
+void MQTTClient_global_init(MQTTClient_init_options *inits);
+int MQTTClient_create(MQTTClient *handle, const char *server_uri, const char *client_id, int persistence_type,
+                      void *persistence_context);
+int MQTTClient_setCallbacks(MQTTClient handle, void *context, MQTTClient_connectionLost *cl,
+                            MQTTClient_messageArrived *ma, MQTTClient_deliveryComplete *dc);
+int MQTTClient_connect(MQTTClient handle, MQTTClient_connectOptions *options);
+int MQTTClient_isConnected(MQTTClient handle);
+int MQTTClient_publish(MQTTClient handle, const char *topic_name, int payloadlen, const void *payload, int qos,
+                       int retained, MQTTClient_deliveryToken *dt);
+int MQTTClient_subscribe(MQTTClient handle, const char *topic, int qos);
+void MQTTClient_freeMessage(MQTTClient_message **msg);
+void MQTTClient_free(void *ptr);
+void MQTTClient_destroy(MQTTClient *handle);
+const char *MQTTClient_strerror(int code);
+
+#endif
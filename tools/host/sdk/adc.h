@@ -0,0 +1,23 @@
+#ifndef HOST_ADC_H
+#define HOST_ADC_H
+
+#include "common_def.h"
+#include "errcode.h"
+
+#define ADC_CHANNEL_3 3
+#define ADC_CLOCK_500KHZ 0
+#define AFE_SCAN_MODE_MAX_NUM 4
+
+typedef struct
+{
+    uint32_t type;
+    uint32_t freq;
+} adc_scan_config_t;
+
+typedef void (*adc_callback_t)(uint8_t ch, uint32_t *buffer, uint32_t length, bool *next);
+
+errcode_t uapi_adc_init(uint32_t clock);
+void uapi_adc_power_en(uint32_t afe_scan_mode, bool en);
+errcode_t uapi_adc_auto_scan_ch_enable(uint8_t channel, adc_scan_config_t config, adc_callback_t callback);
+
+#endif
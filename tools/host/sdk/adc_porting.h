@@ -0,0 +1,6 @@
+#ifndef HOST_ADC_PORTING_H
+#define HOST_ADC_PORTING_H
+
+#include "adc.h"
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef HOST_APP_INIT_H
+#define HOST_APP_INIT_H
+
+/* 主机上不自动启动任务，只保留对入口函数的引用 */
+#define app_run(func) void (*const g_app_run_entry)(void) = (func)
+
+#endif
@@ -0,0 +1,5 @@
+/* agent_module_main.h 引用的 musl 内部头文件，主机上由 libc 提供对应类型 */
+#ifndef HOST_BITS_ALLTYPES_H
+#define HOST_BITS_ALLTYPES_H
+
+#endif
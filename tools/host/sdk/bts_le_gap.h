@@ -0,0 +1,6 @@
+#ifndef HOST_BTS_LE_GAP_H
+#define HOST_BTS_LE_GAP_H
+
+#include "errcode.h"
+
+#endif
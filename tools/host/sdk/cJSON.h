@@ -0,0 +1,37 @@
+#ifndef HOST_CJSON_H
+#define HOST_CJSON_H
+
+#include <stddef.h>
+
+/* 只给出被测源码引用到的 cJSON 接口，主机替身的解析函数一律返回空 */
+typedef struct cJSON
+{
+    struct cJSON *next;
+    struct cJSON *prev;
+    struct cJSON *child;
+    int type;
+    char *valuestring;
+    int valueint;
+    double valuedouble;
+    char *string;
+} cJSON;
+
+cJSON *cJSON_Parse(const char *value);
+cJSON *cJSON_ParseWithLength(const char *value, size_t buffer_length);
+char *cJSON_PrintUnformatted(const cJSON *item);
+int cJSON_IsArray(const cJSON *item);
+int cJSON_IsObject(const cJSON *item);
+int cJSON_IsString(const cJSON *item);
+int cJSON_IsNumber(const cJSON *item);
+int cJSON_GetArraySize(const cJSON *array);
+cJSON *cJSON_GetArrayItem(const cJSON *array, int index);
+cJSON *cJSON_GetObjectItem(const cJSON *object, const char *string);
+cJSON *cJSON_CreateArray(void);
+cJSON *cJSON_CreateObject(void);
+cJSON *cJSON_AddNumberToObject(cJSON *object, const char *name, double number);
+cJSON *cJSON_AddStringToObject(cJSON *object, const char *name, const char *string);
+int cJSON_AddItemToArray(cJSON *array, cJSON *item);
+void cJSON_free(void *object);
+void cJSON_Delete(cJSON *item);
+
+#endif
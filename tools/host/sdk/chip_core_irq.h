@@ -0,0 +1,6 @@
+#ifndef HOST_CHIP_CORE_IRQ_H
+#define HOST_CHIP_CORE_IRQ_H
+
+#define TIMER_1_IRQN 27
+
+#endif
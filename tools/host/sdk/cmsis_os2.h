@@ -0,0 +1,30 @@
+#ifndef HOST_CMSIS_OS2_H
+#define HOST_CMSIS_OS2_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef void *osThreadId_t;
+typedef void (*osThreadFunc_t)(void *argument);
+typedef int32_t osPriority_t;
+typedef int32_t osStatus_t;
+
+typedef struct
+{
+    const char *name;
+    uint32_t attr_bits;
+    void *cb_mem;
+    uint32_t cb_size;
+    void *stack_mem;
+    uint32_t stack_size;
+    osPriority_t priority;
+    uint32_t tz_module;
+    uint32_t reserved;
+} osThreadAttr_t;
+
+/* 主机上不创建线程，返回 NULL */
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+osStatus_t osKernelStart(void);
+osStatus_t osDelay(uint32_t ticks);
+
+#endif
@@ -0,0 +1,13 @@
+/* 主机测试用的 SDK 替身：只提供被测源码用到的声明 */
+#ifndef HOST_COMMON_DEF_H
+#define HOST_COMMON_DEF_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define unused(var) ((void)(var))
+#define UNUSED(var) ((void)(var))
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef HOST_DMA_H
+#define HOST_DMA_H
+
+#include "errcode.h"
+
+errcode_t uapi_dma_init(void);
+errcode_t uapi_dma_open(void);
+
+#endif
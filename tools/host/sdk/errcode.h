@@ -0,0 +1,12 @@
+#ifndef HOST_ERRCODE_H
+#define HOST_ERRCODE_H
+
+#include <stdint.h>
+
+typedef uint32_t errcode_t;
+
+#define ERRCODE_SUCC 0
+#define ERRCODE_FAIL 0x80000001
+#define ERRCODE_INVALID_PARAM 0x80000002
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef HOST_GPIO_H
+#define HOST_GPIO_H
+
+#include "pinctrl.h"
+
+typedef enum
+{
+    GPIO_LEVEL_LOW,
+    GPIO_LEVEL_HIGH,
+} gpio_level_t;
+
+typedef enum
+{
+    GPIO_DIRECTION_INPUT,
+    GPIO_DIRECTION_OUTPUT,
+} gpio_direction_t;
+
+#define GPIO_INTERRUPT_RISING_EDGE 0x1
+#define GPIO_INTERRUPT_FALLING_EDGE 0x2
+#define GPIO_INTERRUPT_DEDGE 0x10
+
+typedef void (*gpio_callback_t)(pin_t pin, uintptr_t param);
+
+errcode_t uapi_gpio_set_dir(pin_t pin, gpio_direction_t dir);
+errcode_t uapi_gpio_set_val(pin_t pin, gpio_level_t level);
+gpio_level_t uapi_gpio_get_val(pin_t pin);
+errcode_t uapi_gpio_toggle(pin_t pin);
+errcode_t uapi_gpio_register_isr_func(pin_t pin, uint32_t trigger, gpio_callback_t callback);
+errcode_t uapi_gpio_unregister_isr_func(pin_t pin);
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef HOST_HAL_SIO_V151_H
+#define HOST_HAL_SIO_V151_H
+
+#include "i2s.h"
+
+void hal_sio_v151_txrx_disable(sio_bus_t bus);
+
+#endif
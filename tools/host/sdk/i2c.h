@@ -0,0 +1,21 @@
+#ifndef HOST_I2C_H
+#define HOST_I2C_H
+
+#include "common_def.h"
+#include "errcode.h"
+
+typedef uint32_t i2c_bus_t;
+
+typedef struct
+{
+    uint8_t *send_buf;
+    uint32_t send_len;
+    uint8_t *receive_buf;
+    uint32_t receive_len;
+} i2c_data_t;
+
+errcode_t uapi_i2c_master_init(i2c_bus_t bus, uint32_t baudrate, uint8_t hscode);
+errcode_t uapi_i2c_master_write(i2c_bus_t bus, uint16_t dev_addr, i2c_data_t *data);
+errcode_t uapi_i2c_master_read(i2c_bus_t bus, uint16_t dev_addr, i2c_data_t *data);
+
+#endif
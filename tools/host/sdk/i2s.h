@@ -0,0 +1,40 @@
+#ifndef HOST_I2S_H
+#define HOST_I2S_H
+
+#include "errcode.h"
+
+/* 只给出录音中断+轮询路径用到的 I2S 接口，行为由 fake/fake_i2s.c 模拟 */
+typedef enum
+{
+    SIO_BUS_0 = 0,
+} sio_bus_t;
+
+typedef struct
+{
+    uint32_t drive_mode;
+    uint32_t transfer_mode;
+    uint32_t data_width;
+    uint32_t channels_num;
+    uint32_t timing;
+    uint32_t clk_edge;
+    uint32_t div_number;
+    uint32_t number_of_channels;
+} i2s_config_t;
+
+typedef struct
+{
+    uint32_t *left_buff;
+    uint32_t *right_buff;
+    uint32_t length;
+} i2s_tx_data_t;
+
+typedef void (*i2s_callback_t)(uint32_t *left_buff, uint32_t *right_buff, uint32_t length);
+
+errcode_t uapi_i2s_init(sio_bus_t bus, i2s_callback_t callback);
+errcode_t uapi_i2s_deinit(sio_bus_t bus);
+errcode_t uapi_i2s_set_config(sio_bus_t bus, const i2s_config_t *config);
+void uapi_i2s_read_start(sio_bus_t bus);
+errcode_t uapi_i2s_write_data(sio_bus_t bus, i2s_tx_data_t *data);
+void sio_porting_i2s_pinmux(void);
+
+#endif
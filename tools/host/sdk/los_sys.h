@@ -0,0 +1,4 @@
+#ifndef HOST_LOS_SYS_H
+#define HOST_LOS_SYS_H
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef HOST_LOS_TASK_H
+#define HOST_LOS_TASK_H
+
+#include "cmsis_os2.h"
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef HOST_OSAL_DEBUG_H
+#define HOST_OSAL_DEBUG_H
+
+#include "soc_osal.h"
+
+#endif
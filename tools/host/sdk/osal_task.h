@@ -0,0 +1,7 @@
+#ifndef HOST_OSAL_TASK_H
+#define HOST_OSAL_TASK_H
+
+/* 线程接口已在 soc_osal.h 中声明 */
+#include "soc_osal.h"
+
+#endif
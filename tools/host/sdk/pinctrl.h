@@ -0,0 +1,27 @@
+#ifndef HOST_PINCTRL_H
+#define HOST_PINCTRL_H
+
+#include "errcode.h"
+
+typedef uint32_t pin_t;
+typedef uint32_t pin_mode_t;
+
+#define PIN_MODE_0 0
+#define PIN_MODE_1 1
+#define PIN_MODE_2 2
+#define PIN_MODE_3 3
+
+typedef enum
+{
+    PIN_PULL_TYPE_DISABLE,
+    PIN_PULL_TYPE_DOWN,
+    PIN_PULL_TYPE_UP,
+} pin_pull_t;
+
+typedef uint32_t pin_drive_strength_t;
+
+errcode_t uapi_pin_set_mode(pin_t pin, pin_mode_t mode);
+errcode_t uapi_pin_set_pull(pin_t pin, pin_pull_t pull);
+errcode_t uapi_pin_set_ds(pin_t pin, pin_drive_strength_t ds);
+
+#endif
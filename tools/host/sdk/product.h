@@ -0,0 +1,6 @@
+#ifndef HOST_PRODUCT_H
+#define HOST_PRODUCT_H
+
+#include "errcode.h"
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef HOST_PWM_H
+#define HOST_PWM_H
+
+#include "common_def.h"
+#include "errcode.h"
+
+typedef struct
+{
+    uint32_t low_time;
+    uint32_t high_time;
+    uint32_t offset_time;
+    uint16_t cycles;
+    bool repeat;
+} pwm_config_t;
+
+typedef errcode_t (*pwm_callback_t)(uint8_t channel);
+
+errcode_t uapi_pwm_init(void);
+errcode_t uapi_pwm_deinit(void);
+errcode_t uapi_pwm_open(uint8_t channel, const pwm_config_t *cfg);
+errcode_t uapi_pwm_close(uint8_t channel);
+errcode_t uapi_pwm_register_interrupt(uint8_t channel, pwm_callback_t callback);
+errcode_t uapi_pwm_unregister_interrupt(uint8_t channel);
+errcode_t uapi_pwm_set_group(uint8_t group, const uint8_t *channel_set, uint32_t channel_set_len);
+errcode_t uapi_pwm_start_group(uint8_t group);
+
+#endif
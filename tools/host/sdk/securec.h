@@ -0,0 +1,63 @@
+#ifndef HOST_SECUREC_H
+#define HOST_SECUREC_H
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#define EOK 0
+
+static inline int memcpy_s(void *dest, size_t dest_max, const void *src, size_t count)
+{
+    if (count > dest_max)
+    {
+        return -1;
+    }
+    memmove(dest, src, count);
+    return EOK;
+}
+
+static inline int memset_s(void *dest, size_t dest_max, int c, size_t count)
+{
+    if (count > dest_max)
+    {
+        return -1;
+    }
+    memset(dest, c, count);
+    return EOK;
+}
+
+static inline int strncpy_s(char *dest, size_t dest_max, const char *src, size_t count)
+{
+    size_t n = strnlen(src, count);
+    if (n >= dest_max)
+    {
+        return -1;
+    }
+    memcpy(dest, src, n);
+    dest[n] = '\0';
+    return EOK;
+}
+
+static inline int strcpy_s(char *dest, size_t dest_max, const char *src)
+{
+    return strncpy_s(dest, dest_max, src, dest_max);
+}
+
+static inline int vsnprintf_s(char *dest, size_t dest_max, size_t count, const char *fmt, va_list args)
+{
+    (void)count;
+    int ret = vsnprintf(dest, dest_max, fmt, args);
+    return (ret < 0 || (size_t)ret >= dest_max) ? -1 : ret;
+}
+
+static inline int snprintf_s(char *dest, size_t dest_max, size_t count, const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int ret = vsnprintf_s(dest, dest_max, count, fmt, args);
+    va_end(args);
+    return ret;
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef HOST_SLE_COMMON_H
+#define HOST_SLE_COMMON_H
+
+#include "common_def.h"
+#include "errcode.h"
+
+#define SLE_ADDR_LEN 6
+#define SLE_UUID_LEN 16
+
+typedef struct
+{
+    uint8_t type;
+    uint8_t addr[SLE_ADDR_LEN];
+} sle_addr_t;
+
+typedef struct
+{
+    uint8_t len;
+    uint8_t uuid[SLE_UUID_LEN];
+} sle_uuid_t;
+
+typedef struct
+{
+    uint32_t mtu_size;
+    uint16_t version;
+} ssap_exchange_info_t;
+
+#endif
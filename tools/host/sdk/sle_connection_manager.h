@@ -0,0 +1,30 @@
+#ifndef HOST_SLE_CONNECTION_MANAGER_H
+#define HOST_SLE_CONNECTION_MANAGER_H
+
+#include "sle_common.h"
+
+typedef enum
+{
+    SLE_ACB_STATE_NONE = 0x00,
+    SLE_ACB_STATE_CONNECTED = 0x01,
+    SLE_ACB_STATE_DISCONNECTED = 0x02,
+} sle_acb_state_t;
+
+typedef uint8_t sle_pair_state_t;
+typedef uint8_t sle_disc_reason_t;
+
+typedef void (*sle_connect_state_changed_callback)(uint16_t conn_id, const sle_addr_t *addr,
+                                                   sle_acb_state_t conn_state, sle_pair_state_t pair_state,
+                                                   sle_disc_reason_t disc_reason);
+typedef void (*sle_pair_complete_callback)(uint16_t conn_id, const sle_addr_t *addr, errcode_t status);
+
+typedef struct
+{
+    sle_connect_state_changed_callback connect_state_changed_cb;
+    sle_pair_complete_callback pair_complete_cb;
+} sle_connection_callbacks_t;
+
+errcode_t sle_connect_remote_device(const sle_addr_t *addr);
+errcode_t sle_connection_register_callbacks(sle_connection_callbacks_t *func);
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef HOST_SLE_DEVICE_DISCOVERY_H
+#define HOST_SLE_DEVICE_DISCOVERY_H
+
+#include "sle_connection_manager.h"
+
+#define SLE_SEEK_PHY_NUM_MAX 3
+
+typedef struct
+{
+    uint8_t own_addr_type;
+    uint8_t filter_duplicates;
+    uint8_t seek_filter_policy;
+    uint8_t seek_phys;
+    uint8_t seek_type[SLE_SEEK_PHY_NUM_MAX];
+    uint16_t seek_interval[SLE_SEEK_PHY_NUM_MAX];
+    uint16_t seek_window[SLE_SEEK_PHY_NUM_MAX];
+} sle_seek_param_t;
+
+typedef struct
+{
+    uint8_t event_type;
+    sle_addr_t addr;
+    sle_addr_t direct_addr;
+    uint8_t rssi;
+    uint8_t data_status;
+    uint8_t data_length;
+    uint8_t *data;
+} sle_seek_result_info_t;
+
+typedef struct
+{
+    void (*sle_enable_cb)(errcode_t status);
+    void (*seek_enable_cb)(errcode_t status);
+    void (*seek_result_cb)(sle_seek_result_info_t *seek_result_data);
+    void (*seek_disable_cb)(errcode_t status);
+} sle_announce_seek_callbacks_t;
+
+errcode_t enable_sle(void);
+errcode_t sle_set_seek_param(sle_seek_param_t *param);
+errcode_t sle_start_seek(void);
+errcode_t sle_stop_seek(void);
+errcode_t sle_announce_seek_register_callbacks(sle_announce_seek_callbacks_t *func);
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef HOST_SLE_ERRCODE_H
+#define HOST_SLE_ERRCODE_H
+
+#include "errcode.h"
+
+#define ERRCODE_SLE_SUCCESS 0
+#define ERRCODE_SLE_FAIL 0x8000600F
+
+#endif
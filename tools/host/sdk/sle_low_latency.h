@@ -0,0 +1,4 @@
+#ifndef HOST_SLE_LOW_LATENCY_H
+#define HOST_SLE_LOW_LATENCY_H
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef HOST_SLE_SSAP_CLIENT_H
+#define HOST_SLE_SSAP_CLIENT_H
+
+#include "sle_common.h"
+
+#define SSAP_PROPERTY_TYPE_VALUE 0x00
+#define SSAP_FIND_TYPE_PROPERTY 0x03
+
+typedef struct
+{
+    uint8_t type;
+    uint16_t start_hdl;
+    uint16_t end_hdl;
+    sle_uuid_t uuid;
+    uint8_t reserve;
+} ssapc_find_structure_param_t;
+
+typedef struct
+{
+    uint16_t start_hdl;
+    uint16_t end_hdl;
+    sle_uuid_t uuid;
+} ssapc_find_service_result_t;
+
+typedef struct
+{
+    uint16_t handle;
+    uint32_t operate_indication;
+    sle_uuid_t uuid;
+    uint8_t descriptors_count;
+    uint8_t descriptors_type[SLE_UUID_LEN];
+} ssapc_find_property_result_t;
+
+typedef struct
+{
+    uint8_t type;
+    sle_uuid_t uuid;
+} ssapc_find_structure_result_t;
+
+typedef struct
+{
+    uint16_t handle;
+    uint8_t type;
+} ssapc_write_result_t;
+
+typedef struct
+{
+    uint16_t handle;
+    uint8_t type;
+    uint16_t data_len;
+    uint8_t *data;
+} ssapc_write_param_t;
+
+typedef struct
+{
+    uint16_t handle;
+    uint8_t type;
+    uint16_t data_len;
+    uint8_t *data;
+} ssapc_handle_value_t;
+
+typedef void (*ssapc_notification_callback)(uint8_t client_id, uint16_t conn_id, ssapc_handle_value_t *data,
+                                            errcode_t status);
+typedef void (*ssapc_indication_callback)(uint8_t client_id, uint16_t conn_id, ssapc_handle_value_t *data,
+                                          errcode_t status);
+
+typedef struct
+{
+    void (*exchange_info_cb)(uint8_t client_id, uint16_t conn_id, ssap_exchange_info_t *param, errcode_t status);
+    void (*find_structure_cb)(uint8_t client_id, uint16_t conn_id, ssapc_find_service_result_t *service,
+                              errcode_t status);
+    void (*ssapc_find_property_cbk)(uint8_t client_id, uint16_t conn_id, ssapc_find_property_result_t *property,
+                                    errcode_t status);
+    void (*find_structure_cmp_cb)(uint8_t client_id, uint16_t conn_id,
+                                  ssapc_find_structure_result_t *structure_result, errcode_t status);
+    void (*write_cfm_cb)(uint8_t client_id, uint16_t conn_id, ssapc_write_result_t *write_result,
+                         errcode_t status);
+    ssapc_notification_callback notification_cb;
+    ssapc_indication_callback indication_cb;
+} ssapc_callbacks_t;
+
+errcode_t ssapc_register_callbacks(ssapc_callbacks_t *func);
+errcode_t ssapc_exchange_info_req(uint8_t client_id, uint16_t conn_id, ssap_exchange_info_t *param);
+errcode_t ssapc_find_structure(uint8_t client_id, uint16_t conn_id, ssapc_find_structure_param_t *param);
+errcode_t ssapc_write_req(uint8_t client_id, uint16_t conn_id, ssapc_write_param_t *param);
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef HOST_SLE_SSAP_SERVER_H
+#define HOST_SLE_SSAP_SERVER_H
+
+#include "sle_common.h"
+
+#define SSAP_PERMISSION_READ 0x01
+#define SSAP_PERMISSION_WRITE 0x02
+#define SSAP_OPERATE_INDICATION_BIT_READ 0x01
+#define SSAP_OPERATE_INDICATION_BIT_WRITE 0x02
+#define SSAP_OPERATE_INDICATION_BIT_NOTIFY 0x10
+#define SSAP_PROPERTY_TYPE_VALUE 0x00
+#define SSAP_DESCRIPTOR_USER_DESCRIPTION 0x01
+
+typedef struct
+{
+    uint16_t request_id;
+    uint16_t handle;
+    uint8_t type;
+    bool need_rsp;
+    bool need_authorize;
+} ssaps_req_read_cb_t;
+
+typedef struct
+{
+    uint16_t request_id;
+    uint16_t handle;
+    uint8_t type;
+    bool need_rsp;
+    bool need_authorize;
+    bool is_prep;
+    uint16_t length;
+    uint8_t *value;
+} ssaps_req_write_cb_t;
+
+typedef void (*ssaps_read_request_callback)(uint8_t server_id, uint16_t conn_id, ssaps_req_read_cb_t *read_cb_para,
+                                            errcode_t status);
+typedef void (*ssaps_write_request_callback)(uint8_t server_id, uint16_t conn_id, ssaps_req_write_cb_t *write_cb_para,
+                                             errcode_t status);
+
+typedef struct
+{
+    sle_uuid_t uuid;
+    uint16_t permissions;
+    uint32_t operate_indication;
+    uint16_t value_len;
+    uint8_t *value;
+} ssaps_property_info_t;
+
+typedef struct
+{
+    sle_uuid_t uuid;
+    uint16_t permissions;
+    uint32_t operate_indication;
+    uint8_t type;
+    uint16_t value_len;
+    uint8_t *value;
+} ssaps_desc_info_t;
+
+typedef struct
+{
+    uint16_t handle;
+    uint8_t type;
+    uint16_t value_len;
+    uint8_t *value;
+} ssaps_ntf_ind_t;
+
+typedef struct
+{
+    sle_uuid_t uuid;
+    uint16_t start_handle;
+    uint16_t end_handle;
+    uint8_t type;
+    uint16_t value_len;
+    uint8_t *value;
+} ssaps_ntf_ind_by_uuid_t;
+
+typedef struct
+{
+    void (*add_service_cb)(uint8_t server_id, sle_uuid_t *uuid, uint16_t handle, errcode_t status);
+    void (*add_property_cb)(uint8_t server_id, sle_uuid_t *uuid, uint16_t service_handle, uint16_t handle,
+                            errcode_t status);
+    void (*add_descriptor_cb)(uint8_t server_id, sle_uuid_t *uuid, uint16_t service_handle,
+                              uint16_t property_handle, errcode_t status);
+    void (*start_service_cb)(uint8_t server_id, uint16_t handle, errcode_t status);
+    void (*delete_all_service_cb)(uint8_t server_id, errcode_t status);
+    ssaps_read_request_callback read_request_cb;
+    ssaps_write_request_callback write_request_cb;
+    void (*mtu_changed_cb)(uint8_t server_id, uint16_t conn_id, ssap_exchange_info_t *mtu_size, errcode_t status);
+} ssaps_callbacks_t;
+
+errcode_t ssaps_register_callbacks(ssaps_callbacks_t *func);
+errcode_t ssaps_register_server(sle_uuid_t *app_uuid, uint8_t *server_id);
+errcode_t ssaps_unregister_server(uint8_t server_id);
+errcode_t ssaps_add_service_sync(uint8_t server_id, sle_uuid_t *service_uuid, bool is_primary, uint16_t *handle);
+errcode_t ssaps_add_property_sync(uint8_t server_id, uint16_t service_handle, ssaps_property_info_t *property,
+                                  uint16_t *handle);
+errcode_t ssaps_add_descriptor_sync(uint8_t server_id, uint16_t service_handle, uint16_t property_handle,
+                                    ssaps_desc_info_t *descriptor);
+errcode_t ssaps_start_service(uint8_t server_id, uint16_t service_handle);
+errcode_t ssaps_set_info(uint8_t server_id, ssap_exchange_info_t *info);
+errcode_t ssaps_notify_indicate(uint8_t server_id, uint16_t conn_id, ssaps_ntf_ind_t *param);
+errcode_t ssaps_notify_indicate_by_uuid(uint8_t server_id, uint16_t conn_id, ssaps_ntf_ind_by_uuid_t *param);
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef HOST_SOC_OSAL_H
+#define HOST_SOC_OSAL_H
+
+#include "common_def.h"
+#include "errcode.h"
+
+#define OSAL_SUCCESS 0
+#define OSAL_FAILURE (-1)
+#define OSAL_WAIT_FOREVER 0xFFFFFFFF
+#define OSAL_WAITMODE_OR 0x2
+#define OSAL_WAITMODE_AND 0x4
+#define OSAL_WAITMODE_CLR 0x1
+#define OSAL_TASK_PRIORITY_HIGH 10
+#define OSAL_TASK_PRIORITY_MIDDLE 20
+#define OSAL_TASK_PRIORITY_LOW 25
+
+/* 主机上没有调度器：事件、信号量只记录计数，等不到时按超时推进假时钟后返回失败 */
+typedef struct
+{
+    uint32_t bits;
+} osal_event;
+
+typedef struct
+{
+    int count;
+} osal_semaphore;
+
+typedef struct
+{
+    int locked;
+} osal_mutex;
+
+/* 线程只记录入口，不会运行；测试直接调用被测代码中的单步函数 */
+typedef int (*osal_kthread_handler)(void *data);
+
+typedef struct
+{
+    osal_kthread_handler handler;
+    void *data;
+} osal_task;
+
+int osal_printk(const char *fmt, ...);
+void osal_msleep(unsigned int ms);
+void osal_mdelay(unsigned int ms);
+void osal_udelay(unsigned int us);
+
+unsigned int osal_irq_lock(void);
+void osal_irq_restore(unsigned int flags);
+
+void *osal_vmalloc(unsigned long size);
+void osal_vfree(void *addr);
+void *osal_kmalloc(unsigned long size, unsigned int flags);
+void osal_kfree(void *addr);
+
+int osal_event_init(osal_event *event);
+int osal_event_write(osal_event *event, unsigned int mask);
+int osal_event_read(osal_event *event, unsigned int mask, unsigned int timeout_ms, unsigned int mode);
+int osal_event_clear(osal_event *event, unsigned int mask);
+int osal_event_destroy(osal_event *event);
+
+int osal_sem_init(osal_semaphore *sem, int val);
+int osal_sem_down(osal_semaphore *sem);
+int osal_sem_down_timeout(osal_semaphore *sem, unsigned int timeout_ms);
+void osal_sem_up(osal_semaphore *sem);
+void osal_sem_destroy(osal_semaphore *sem);
+
+int osal_mutex_init(osal_mutex *mutex);
+int osal_mutex_lock(osal_mutex *mutex);
+void osal_mutex_unlock(osal_mutex *mutex);
+void osal_mutex_destroy(osal_mutex *mutex);
+
+osal_task *osal_kthread_create(osal_kthread_handler handler, void *data, const char *name, unsigned int stack_size);
+int osal_kthread_set_priority(osal_task *task, unsigned int priority);
+void osal_kthread_lock(void);
+void osal_kthread_unlock(void);
+
+int osal_msg_queue_create(const char *name, unsigned short queue_len, unsigned long *queue_id, unsigned int flags,
+                          unsigned short max_msgsize);
+void osal_msg_queue_delete(unsigned long queue_id);
+int osal_msg_queue_write_copy(unsigned long queue_id, void *buffer_addr, unsigned int buffer_size,
+                              unsigned int timeout);
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "common_def.h"
+#include "errcode.h"
+
+typedef uint32_t spi_bus_t;
+
+#define HAL_SPI_FRAME_FORMAT_STANDARD 0
+#define HAL_SPI_FRAME_SIZE_8 0x07
+
+typedef struct
+{
+    bool is_slave;
+    uint32_t slave_num;
+    uint32_t bus_clk;
+    uint32_t freq_mhz;
+    uint32_t clk_polarity;
+    uint32_t clk_phase;
+    uint32_t frame_format;
+    uint32_t spi_frame_format;
+    uint32_t frame_size;
+    uint32_t tmod;
+    uint32_t sste;
+} spi_attr_t;
+
+typedef struct
+{
+    uint32_t inst_len;
+    uint32_t addr_len;
+    uint32_t wait_cycles;
+} spi_qspi_param_t;
+
+typedef struct
+{
+    spi_qspi_param_t qspi_param;
+    bool tx_use_dma;
+    bool rx_use_dma;
+} spi_extra_attr_t;
+
+typedef struct
+{
+    uint8_t *cmd_buf;
+    uint32_t cmd_len;
+    uint8_t *addr_buf;
+    uint32_t addr_len;
+    uint8_t *tx_buff;
+    uint32_t tx_bytes;
+    uint8_t *rx_buff;
+    uint32_t rx_bytes;
+} spi_xfer_data_t;
+
+errcode_t uapi_spi_init(spi_bus_t bus, spi_attr_t *attr, spi_extra_attr_t *extra_attr);
+errcode_t uapi_spi_master_write(spi_bus_t bus, const spi_xfer_data_t *data, uint32_t timeout);
+
+#endif
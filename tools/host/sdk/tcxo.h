@@ -0,0 +1,10 @@
+#ifndef HOST_TCXO_H
+#define HOST_TCXO_H
+
+#include <stdint.h>
+
+uint64_t uapi_tcxo_get_ms(void);
+uint64_t uapi_tcxo_get_us(void);
+void uapi_tcxo_delay_ms(uint32_t ms);
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef HOST_TIMER_H
+#define HOST_TIMER_H
+
+#include "common_def.h"
+#include "errcode.h"
+
+typedef uint32_t timer_index_t;
+typedef void *timer_handle_t;
+typedef void (*timer_callback_t)(uintptr_t data);
+
+errcode_t uapi_timer_init(void);
+errcode_t uapi_timer_adapter(timer_index_t index, uint32_t int_id, uint16_t int_priority);
+errcode_t uapi_timer_create(timer_index_t index, timer_handle_t *timer);
+errcode_t uapi_timer_start(timer_handle_t timer, uint32_t time_us, timer_callback_t callback, uintptr_t data);
+errcode_t uapi_timer_stop(timer_handle_t timer);
+
+#endif
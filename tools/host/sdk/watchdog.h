@@ -0,0 +1,14 @@
+#ifndef HOST_WATCHDOG_H
+#define HOST_WATCHDOG_H
+
+#include "errcode.h"
+
+typedef uint32_t wdt_mode_t;
+typedef errcode_t (*watchdog_callback_t)(uintptr_t param);
+
+errcode_t uapi_watchdog_init(uint32_t timeout);
+errcode_t uapi_watchdog_enable(wdt_mode_t mode);
+errcode_t uapi_watchdog_kick(void);
+errcode_t uapi_register_watchdog_callback(watchdog_callback_t callback);
+
+#endif
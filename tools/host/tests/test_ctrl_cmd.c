@@ -0,0 +1,704 @@
+/*
+ * ExBoard 控制命令解码：已知用例逐条覆盖头文件的规则；随机生成带多余字段、嵌套值、重复字段和随机空白的消息，
+ * 与生成时推出的期望逐条对照；再对合法消息做截断和逐字节变异，输入紧贴在不可访问的保护页之前，越界读取会直接崩溃。
+ * 最后经 sle_server_write_cbk 检查执行器状态只在整条消息解码成功时整体替换
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "ExBoard_sample.c"
+#include "sle_uart_server.c"
+#include "alert.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+
+#define LOG_MAX 64
+#define MSG_MAX 4096
+#define MEMBER_MAX 16
+#define GEN_MESSAGES 20000
+#define CUT_MESSAGES 1000
+#define MUTATIONS 50000
+
+typedef struct
+{
+    uint8_t arg;
+    int32_t value[CTRL_FIELD_MAX];
+} applied_t;
+
+typedef struct
+{
+    uint32_t n;
+    applied_t cmd[LOG_MAX];
+} apply_log_t;
+
+static void log_apply(void *ctx, uint8_t arg, const int32_t value[CTRL_FIELD_MAX])
+{
+    apply_log_t *log = (apply_log_t *)ctx;
+    if (log->n < LOG_MAX)
+    {
+        log->cmd[log->n].arg = arg;
+        memcpy(log->cmd[log->n].value, value, sizeof(log->cmd[0].value));
+    }
+    log->n++;
+}
+
+// arg 即下标；servo_b 以 servo 开头，用来检查 topic 整体匹配；stop 不需要字段
+static const ctrl_cmd_t g_table[] = {
+    {"servo", {"angle"}, 0, log_apply},
+    {"servo_b", {"angle"}, 1, log_apply},
+    {"rgb", {"mode", "r", "g", "b"}, 2, log_apply},
+    {"stop", {NULL}, 3, log_apply},
+};
+#define TABLE_COUNT (sizeof(g_table) / sizeof(g_table[0]))
+
+// 保护页之前的缓冲区：输入复制到紧贴保护页的位置再解码
+static uint8_t *g_guard = NULL;
+
+static void guard_init(void)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t span = (MSG_MAX + page - 1) / page * page;
+    uint8_t *m = mmap(NULL, span + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    CHECK(m != MAP_FAILED);
+    CHECK(mprotect(m + span, page, PROT_NONE) == 0);
+    g_guard = m + span;
+}
+
+static int32_t decode_buf(const uint8_t *msg, uint32_t len, apply_log_t *log)
+{
+    uint8_t *p = g_guard - len;
+    memcpy(p, msg, len);
+    memset(log, 0, sizeof(*log));
+    return ctrl_decode(g_table, TABLE_COUNT, p, len, log);
+}
+
+static int32_t decode(const char *json, apply_log_t *log)
+{
+    return decode_buf((const uint8_t *)json, (uint32_t)strlen(json), log);
+}
+
+// 只执行了一条命令时返回它，便于已知用例核对数值
+static const applied_t *decode_one(const char *json, uint8_t arg)
+{
+    static apply_log_t log;
+    int32_t n = decode(json, &log);
+    CHECK_EQ(n, 1);
+    CHECK_EQ(log.n, 1);
+    CHECK_EQ(log.cmd[0].arg, arg);
+    return &log.cmd[0];
+}
+
+// 返回值不为 -1 时与 apply 的调用次数相同
+static int32_t decode_n(const char *json)
+{
+    static apply_log_t log;
+    int32_t n = decode(json, &log);
+    CHECK(n < 0 || log.n == (uint32_t)n);
+    return n;
+}
+
+static void check_known(void)
+{
+    CHECK_EQ(decode_one("{\"topic\":\"servo\",\"angle\":90}", 0)->value[0], 90);
+    // topic 可以在字段之后，空白任意
+    CHECK_EQ(decode_one(" \r\n{ \"angle\" :\t-45 , \"topic\" : \"servo\" }\n", 0)->value[0], -45);
+    CHECK_EQ(decode_one("{\"topic\":\"servo_b\",\"angle\":1}", 1)->value[0], 1);
+    CHECK_EQ(decode_n("{\"topic\":\"serv\",\"angle\":1}"), 0);
+    CHECK_EQ(decode_n("{\"topic\":\"servo_bb\",\"angle\":1}"), 0);
+    CHECK_EQ(decode_n("{\"angle\":1}"), 0);
+    // 缺字段跳过；不需要字段的命令直接执行，数值为 0
+    CHECK_EQ(decode_n("{\"topic\":\"rgb\",\"mode\":1,\"r\":2,\"g\":3}"), 0);
+    const applied_t *a = decode_one("{\"topic\":\"stop\",\"angle\":5}", 3);
+    CHECK_EQ(a->value[0], 0);
+    // 重复字段以最后一次为准；topic 重复时同样取最后一个字符串
+    CHECK_EQ(decode_one("{\"topic\":\"servo\",\"angle\":1,\"angle\":2}", 0)->value[0], 2);
+    CHECK_EQ(decode_one("{\"topic\":\"rgb\",\"topic\":\"servo\",\"angle\":3}", 0)->value[0], 3);
+    // 小数截断、布尔为 1/0、指数部分只跳过、整数部分溢出时饱和
+    a = decode_one("{\"topic\":\"rgb\",\"mode\":true,\"r\":2.9,\"g\":-2.9,\"b\":false}", 2);
+    CHECK_EQ(a->value[0], 1);
+    CHECK_EQ(a->value[1], 2);
+    CHECK_EQ(a->value[2], -2);
+    CHECK_EQ(a->value[3], 0);
+    CHECK_EQ(decode_one("{\"topic\":\"servo\",\"angle\":1e3}", 0)->value[0], 1);
+    CHECK_EQ(decode_one("{\"topic\":\"servo\",\"angle\":-0.5E-2}", 0)->value[0], 0);
+    CHECK_EQ(decode_one("{\"topic\":\"servo\",\"angle\":99999999999999999999}", 0)->value[0], INT32_MAX);
+    CHECK_EQ(decode_one("{\"topic\":\"servo\",\"angle\":-2147483648}", 0)->value[0], INT32_MIN);
+    CHECK_EQ(decode_one("{\"topic\":\"servo\",\"angle\":-99999999999}", 0)->value[0], INT32_MIN);
+    // 超过 64 位的整数部分同样饱和，不回绕
+    CHECK_EQ(decode_one("{\"topic\":\"servo\",\"angle\":18446744073709551617}", 0)->value[0], INT32_MAX);
+    CHECK_EQ(decode_one("{\"topic\":\"servo\",\"angle\":-9223372036854775809}", 0)->value[0], INT32_MIN);
+    // 字符串、null、容器不是数值：不覆盖同名字段，也不占用字段位置
+    CHECK_EQ(decode_n("{\"topic\":\"servo\",\"angle\":\"90\"}"), 0);
+    CHECK_EQ(decode_one("{\"topic\":\"servo\",\"angle\":4,\"angle\":null,\"angle\":[5],\"angle\":{\"angle\":6}}", 0)
+                 ->value[0],
+             4);
+    // 转义引号不结束字符串，带转义的 topic 不做反转义
+    CHECK_EQ(decode_one("{\"note\":\"a\\\"}\\\\\",\"topic\":\"servo\",\"angle\":7}", 0)->value[0], 7);
+    CHECK_EQ(decode_n("{\"topic\":\"serv\\u006f\",\"angle\":1}"), 0);
+    // 数值字段最多记录 CTRL_PAIR_MAX 个，多出的忽略；字符串字段不计入
+    CHECK_EQ(decode_n("{\"topic\":\"servo\",\"a\":1,\"b\":2,\"c\":3,\"d\":4,\"e\":5,\"f\":6,\"g\":7,\"h\":8,"
+                      "\"angle\":9}"),
+             0);
+    CHECK_EQ(decode_one("{\"topic\":\"servo\",\"a\":1,\"b\":2,\"c\":3,\"d\":4,\"e\":5,\"f\":6,\"g\":7,\"s\":\"x\","
+                        "\"angle\":9}",
+                        0)
+                 ->value[0],
+             9);
+
+    // 数组：逐个执行对象，其它元素跳过
+    static apply_log_t log;
+    CHECK_EQ(decode("[{\"topic\":\"servo\",\"angle\":1}, 5, \"x\", [1, {}], null, {\"topic\":\"nope\"}, {}, "
+                    "{\"topic\":\"stop\"}]",
+                    &log),
+             2);
+    CHECK_EQ(log.n, 2);
+    CHECK_EQ(log.cmd[0].arg, 0);
+    CHECK_EQ(log.cmd[1].arg, 3);
+    CHECK_EQ(decode_n("{}"), 0);
+    CHECK_EQ(decode_n("[]"), 0);
+    CHECK_EQ(decode_n(" [ ] "), 0);
+
+    // 结尾只允许空白和 '\0'
+    static const char nul[] = "{\"topic\":\"stop\"}\0\0";
+    CHECK_EQ(decode_buf((const uint8_t *)nul, sizeof(nul) - 1, &log), 1);
+    CHECK_EQ(decode_n("{\"topic\":\"stop\"}x"), -1);
+    CHECK_EQ(decode_n("{\"topic\":\"stop\"}{}"), -1);
+    CHECK_EQ(decode_buf((const uint8_t *)"{}\0 \0", 5, &log), 0);
+    CHECK_EQ(decode_buf((const uint8_t *)"{}\0x", 4, &log), -1);
+
+    // 格式错误
+    static const char *const bad[] = {
+        "",
+        "   ",
+        "42",
+        "\"topic\"",
+        "null",
+        "{",
+        "[",
+        "{\"topic\":\"servo\",\"angle\":}",
+        "{\"topic\":\"servo\" \"angle\":1}",
+        "{\"topic\":\"servo\",}",
+        "{\"topic\":\"servo\",\"angle\":1,}",
+        "{\"topic\":\"servo\",\"angle\":1]",
+        "[{\"topic\":\"stop\"}}",
+        "[1,]",
+        "[,1]",
+        "{,}",
+        "{topic:\"servo\"}",
+        "{\"topic\"=\"servo\"}",
+        "{\"a\":tru}",
+        "{\"a\":nul}",
+        "{\"a\":True}",
+        "{\"a\":-}",
+        "{\"a\":-x}",
+        "{\"a\":+1}",
+        "{\"a\":.5}",
+        "{\"a\":'x'}",
+        "{\"a\":\"tab\there\"}",
+        "{\"a\":\"open}",
+        "{\"a\":\"\\\"}",
+        "{\"a\":[1 2]}",
+        "{\"a\":{\"b\"}}",
+        "{\"a\":{\"b\":1,}}",
+        "[{\"topic\":\"stop\"},{\"topic\":\"stop\"]",
+    };
+    for (uint32_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+    {
+        int32_t n = decode_n(bad[i]);
+        if (n != -1)
+        {
+            fprintf(stderr, "accepted malformed %s: %d\n", bad[i], n);
+            CHECK(0);
+        }
+    }
+    // 格式错误前已执行的命令照样调用过 apply，由调用方整体丢弃
+    CHECK_EQ(decode("[{\"topic\":\"stop\"},{\"topic\":]", &log), -1);
+    CHECK_EQ(log.n, 1);
+
+    // 嵌套深度：对象的值算第 1 层，第 CTRL_DEPTH_MAX 层的容器是格式错误
+    char deep[64];
+    for (uint32_t depth = CTRL_DEPTH_MAX - 1; depth <= CTRL_DEPTH_MAX; depth++)
+    {
+        uint32_t n = 0;
+        n += (uint32_t)sprintf(deep, "{\"topic\":\"stop\",\"x\":");
+        memset(deep + n, '[', depth);
+        memset(deep + n + depth, ']', depth);
+        strcpy(deep + n + 2 * depth, "}");
+        CHECK_EQ(decode_n(deep), (depth < CTRL_DEPTH_MAX) ? 1 : -1);
+    }
+    // 很深的嵌套在深度限制处停下，不会耗尽栈
+    uint32_t huge = 200000;
+    uint8_t *nest = malloc(2 * huge);
+    memset(nest, '[', huge);
+    memset(nest + huge, ']', huge);
+    CHECK_EQ(ctrl_decode(g_table, TABLE_COUNT, nest, 2 * huge, &log), -1);
+    free(nest);
+}
+
+// 随机消息生成：边生成边按头文件的规则推出期望执行的命令
+static uint32_t g_rng = 50;
+static char g_msg[MSG_MAX];
+static uint32_t g_len;
+static apply_log_t g_expect;
+
+static uint32_t rnd(uint32_t n)
+{
+    g_rng = g_rng * 1664525u + 1013904223u;
+    return (g_rng >> 8) % n;
+}
+
+static void emit(const char *s)
+{
+    size_t n = strlen(s);
+    if (g_len + n < MSG_MAX)
+    {
+        memcpy(g_msg + g_len, s, n);
+        g_len += (uint32_t)n;
+    }
+}
+
+static void emit_ws(void)
+{
+    static const char *const ws[] = {"", "", "", " ", "\n", "\r\n", "\t", "  "};
+    emit(ws[rnd(8)]);
+}
+
+// 截断后取整为 v 的数值文本：整数、带小数，或溢出 int32 的长整数
+static int32_t emit_number(uint8_t allow_exp)
+{
+    char text[48];
+    int32_t v;
+    switch (rnd(6))
+    {
+    case 0:
+        v = rnd(2) ? INT32_MAX : INT32_MIN;
+        sprintf(text, "%s%u%09u", (v < 0) ? "-" : "", 3 + rnd(1000), rnd(1000000000));
+        break;
+    case 1:
+        v = (int32_t)rnd(2000) - 1000;
+        sprintf(text, "%s%d.%u", (v == 0 && rnd(2)) ? "-" : "", v, rnd(1000));
+        break;
+    case 2:
+        v = (int32_t)rnd(10);
+        sprintf(text, "%d%s", v, allow_exp ? (rnd(2) ? "e+2" : "E-1") : "");
+        break;
+    default:
+        v = (int32_t)(rnd(1u << 24)) - (1 << 23);
+        sprintf(text, "%d", v);
+        break;
+    }
+    emit(text);
+    return v;
+}
+
+static void emit_string(void)
+{
+    static const char *const strs[] = {"\"\"", "\"x\"", "\"a\\\"b\"", "\"}]{[,:\"", "\"\\\\\"", "\"topic\"",
+                                       "\"\\u0041\""};
+    emit(strs[rnd(7)]);
+}
+
+// 任意合法的值；depth 为该值所在的层数
+static void emit_junk(uint32_t depth)
+{
+    uint32_t kind = rnd((depth < CTRL_DEPTH_MAX - 1) ? 7 : 5);
+    if (kind == 0)
+    {
+        emit_number(1);
+    }
+    else if (kind == 1)
+    {
+        emit_string();
+    }
+    else if (kind == 2)
+    {
+        emit(rnd(2) ? "true" : "false");
+    }
+    else if (kind == 3 || kind == 4)
+    {
+        emit("null");
+    }
+    else
+    {
+        uint8_t obj = (kind == 5);
+        emit(obj ? "{" : "[");
+        uint32_t n = rnd(4);
+        for (uint32_t i = 0; i < n; i++)
+        {
+            emit_ws();
+            if (obj)
+            {
+                emit_string();
+                emit_ws();
+                emit(":");
+                emit_ws();
+            }
+            emit_junk(depth + 1);
+            emit_ws();
+            emit((i + 1 < n) ? "," : "");
+        }
+        emit(obj ? "}" : "]");
+    }
+}
+
+// 对象成员中不被记录为字段的值：null、容器，key 不是 topic 时还可以是字符串
+static void emit_other(const char *key)
+{
+    uint32_t kind = rnd(4);
+    if (kind == 0)
+    {
+        emit("null");
+    }
+    else if (kind == 1 && strcmp(key, "topic") != 0)
+    {
+        emit_string();
+    }
+    else if (rnd(2))
+    {
+        emit("[");
+        emit_junk(2);
+        emit("]");
+    }
+    else
+    {
+        emit("{\"k\":");
+        emit_junk(2);
+        emit("}");
+    }
+}
+
+typedef enum
+{
+    MEMBER_NUMBER, // 数值或布尔，记录为字段
+    MEMBER_TOPIC,  // "topic" 的字符串值
+    MEMBER_OTHER,  // 字符串、null、容器，不记录
+} member_kind_t;
+
+typedef struct
+{
+    const char *key;
+    member_kind_t kind;
+    int8_t topic; // MEMBER_TOPIC：命令表下标，-1 为表中没有的 topic
+    uint8_t is_bool;
+    int32_t value;
+} member_t;
+
+static const char *const g_extra_keys[] = {"id", "Angle", "angl", "angle ", "x", "mode2", "topic", "r"};
+
+static void gen_object(void)
+{
+    member_t m[MEMBER_MAX];
+    uint32_t n = 0;
+    int32_t topic = (int32_t)rnd(TABLE_COUNT + 2) - 2; // -2 没有 topic，-1 未知 topic
+    if (topic != -2)
+    {
+        m[n++] = (member_t){"topic", MEMBER_TOPIC, (int8_t)topic, 0, 0};
+        if (rnd(8) == 0)
+        {
+            // 之前再放一个会被覆盖的 topic
+            m[n++] = (member_t){"topic", MEMBER_TOPIC, (int8_t)((int32_t)rnd(TABLE_COUNT + 1) - 1), 0, 0};
+        }
+    }
+    const ctrl_cmd_t *cmd = (topic >= 0) ? &g_table[topic] : &g_table[rnd(TABLE_COUNT)];
+    for (uint32_t f = 0; f < CTRL_FIELD_MAX && cmd->fields[f] != NULL; f++)
+    {
+        uint32_t copies = (rnd(10) == 0) ? 0 : 1 + (rnd(5) == 0);
+        for (uint32_t c = 0; c < copies && n < MEMBER_MAX; c++)
+        {
+            m[n++] = (member_t){cmd->fields[f], rnd(8) ? MEMBER_NUMBER : MEMBER_OTHER, 0, (uint8_t)(rnd(6) == 0), 0};
+        }
+    }
+    uint32_t extra = rnd(5);
+    for (uint32_t i = 0; i < extra && n < MEMBER_MAX; i++)
+    {
+        m[n++] = (member_t){g_extra_keys[rnd(8)], rnd(2) ? MEMBER_NUMBER : MEMBER_OTHER, 0, 0, 0};
+    }
+    // 打乱顺序：两个 topic 的先后随之改变，期望按打乱后的顺序推
+    for (uint32_t i = n; i > 1; i--)
+    {
+        uint32_t j = rnd(i);
+        member_t t = m[i - 1];
+        m[i - 1] = m[j];
+        m[j] = t;
+    }
+
+    // 输出，同时记下前 CTRL_PAIR_MAX 个数值字段和最后一个 topic
+    const char *keys[CTRL_PAIR_MAX];
+    int32_t vals[CTRL_PAIR_MAX];
+    uint32_t pairs = 0;
+    int32_t last_topic = -2;
+    emit("{");
+    for (uint32_t i = 0; i < n; i++)
+    {
+        emit_ws();
+        emit("\"");
+        emit(m[i].key);
+        emit("\"");
+        emit_ws();
+        emit(":");
+        emit_ws();
+        if (m[i].kind == MEMBER_TOPIC)
+        {
+            emit("\"");
+            emit((m[i].topic >= 0) ? g_table[m[i].topic].topic : "nope");
+            emit("\"");
+            last_topic = m[i].topic;
+        }
+        else if (m[i].kind == MEMBER_NUMBER)
+        {
+            int32_t v;
+            if (m[i].is_bool)
+            {
+                v = (int32_t)rnd(2);
+                emit(v ? "true" : "false");
+            }
+            else
+            {
+                v = emit_number(strcmp(m[i].key, "id") == 0);
+            }
+            if (pairs < CTRL_PAIR_MAX)
+            {
+                keys[pairs] = m[i].key;
+                vals[pairs++] = v;
+            }
+        }
+        else
+        {
+            emit_other(m[i].key);
+        }
+        emit_ws();
+        emit((i + 1 < n) ? "," : "");
+    }
+    emit_ws();
+    emit("}");
+
+    if (last_topic < 0)
+    {
+        return;
+    }
+    applied_t want = {(uint8_t)last_topic, {0}};
+    for (uint32_t f = 0; f < CTRL_FIELD_MAX && g_table[last_topic].fields[f] != NULL; f++)
+    {
+        uint32_t k = pairs;
+        while (k > 0 && strcmp(keys[k - 1], g_table[last_topic].fields[f]) != 0)
+        {
+            k--;
+        }
+        if (k == 0)
+        {
+            return;
+        }
+        want.value[f] = vals[k - 1];
+    }
+    if (g_expect.n < LOG_MAX)
+    {
+        g_expect.cmd[g_expect.n] = want;
+    }
+    g_expect.n++;
+}
+
+// 单个对象或数组，数组里混有非对象元素；返回最后一个括号之后的位置
+static uint32_t gen_message(void)
+{
+    g_len = 0;
+    memset(&g_expect, 0, sizeof(g_expect));
+    emit_ws();
+    if (rnd(3) == 0)
+    {
+        gen_object();
+    }
+    else
+    {
+        uint32_t n = rnd(6);
+        emit("[");
+        for (uint32_t i = 0; i < n; i++)
+        {
+            emit_ws();
+            if (rnd(5) == 0)
+            {
+                emit_junk(1);
+            }
+            else
+            {
+                gen_object();
+            }
+            emit_ws();
+            emit((i + 1 < n) ? "," : "");
+        }
+        emit_ws();
+        emit("]");
+    }
+    uint32_t close = g_len;
+    emit_ws();
+    return close;
+}
+
+static void check_generated(void)
+{
+    static apply_log_t log;
+    uint32_t applied = 0;
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < GEN_MESSAGES; i++)
+    {
+        uint32_t close = gen_message();
+        CHECK(g_len < MSG_MAX);
+        int32_t n = decode_buf((const uint8_t *)g_msg, g_len, &log);
+        uint8_t ok = (n == (int32_t)g_expect.n && log.n == g_expect.n);
+        for (uint32_t k = 0; ok && k < log.n && k < LOG_MAX; k++)
+        {
+            ok = (memcmp(&log.cmd[k], &g_expect.cmd[k], sizeof(applied_t)) == 0);
+        }
+        if (!ok && mismatches++ == 0)
+        {
+            fprintf(stderr, "decoded %d, expected %u: %.*s\n", n, g_expect.n, (int)g_len, g_msg);
+        }
+        applied += log.n;
+
+        // 最后一个括号之前的任何截断都是不完整的消息
+        if (i < CUT_MESSAGES)
+        {
+            for (uint32_t cut = 0; cut < close; cut++)
+            {
+                if (decode_buf((const uint8_t *)g_msg, cut, &log) != -1 && mismatches++ == 0)
+                {
+                    fprintf(stderr, "accepted %u of %u bytes: %.*s\n", cut, g_len, (int)g_len, g_msg);
+                }
+            }
+        }
+    }
+    printf("%u generated messages, %u commands applied\n", GEN_MESSAGES, applied);
+    CHECK_EQ(mismatches, 0);
+    CHECK(applied > GEN_MESSAGES / 2);
+}
+
+// 逐字节变异：不崩溃、不越界，返回值与 apply 调用次数一致，不超过对象数
+static void check_mutated(void)
+{
+    static const char alphabet[] = "{}[]\":,\\-.0123456789eEtruefalsn \t\r\n\x01\x7f\xff";
+    static apply_log_t log;
+    static apply_log_t again;
+    uint32_t accepted = 0;
+    uint32_t bad = 0;
+    for (uint32_t i = 0; i < MUTATIONS; i++)
+    {
+        gen_message();
+        uint32_t edits = 1 + rnd(4);
+        for (uint32_t e = 0; e < edits && g_len > 0; e++)
+        {
+            uint32_t at = rnd(g_len);
+            uint32_t op = rnd(4);
+            if (op == 0)
+            {
+                g_msg[at] = alphabet[rnd(sizeof(alphabet) - 1)];
+            }
+            else if (op == 1)
+            {
+                g_msg[at] = (char)rnd(256);
+            }
+            else if (op == 2)
+            {
+                memmove(g_msg + at, g_msg + at + 1, g_len - at - 1);
+                g_len--;
+            }
+            else if (g_len + 1 < MSG_MAX)
+            {
+                memmove(g_msg + at + 1, g_msg + at, g_len - at);
+                g_msg[at] = alphabet[rnd(sizeof(alphabet) - 1)];
+                g_len++;
+            }
+        }
+        uint32_t objects = 0;
+        for (uint32_t k = 0; k < g_len; k++)
+        {
+            objects += (g_msg[k] == '{');
+        }
+        int32_t n = decode_buf((const uint8_t *)g_msg, g_len, &log);
+        int32_t n2 = decode_buf((const uint8_t *)g_msg, g_len, &again);
+        uint8_t ok = (n >= -1 && n <= (int32_t)objects && n == n2 && log.n == again.n && log.n <= objects &&
+                      (n < 0 || log.n == (uint32_t)n));
+        for (uint32_t k = 0; ok && k < log.n && k < LOG_MAX; k++)
+        {
+            ok = (log.cmd[k].arg < TABLE_COUNT && memcmp(&log.cmd[k], &again.cmd[k], sizeof(applied_t)) == 0);
+        }
+        if (!ok && bad++ == 0)
+        {
+            fprintf(stderr, "mutated message decoded %d/%d: %.*s\n", n, n2, (int)g_len, g_msg);
+        }
+        accepted += (n >= 0);
+    }
+    printf("%u mutated messages, %u still well-formed\n", MUTATIONS, accepted);
+    CHECK_EQ(bad, 0);
+    CHECK(accepted > 0 && accepted < MUTATIONS);
+}
+
+static void write_cmd(const char *json)
+{
+    ssaps_req_write_cb_t req;
+    memset(&req, 0, sizeof(req));
+    req.value = (uint8_t *)json;
+    req.length = (uint16_t)strlen(json);
+    sle_server_write_cbk(0, 0, &req, ERRCODE_SUCC);
+}
+
+static int actuator_updated(void)
+{
+    return osal_event_read(&g_actuator_event, ACTUATOR_EVT_UPDATE, 0, OSAL_WAITMODE_OR | OSAL_WAITMODE_CLR) ==
+           ACTUATOR_EVT_UPDATE;
+}
+
+// 网关下发的格式（Python json.dumps），经 ExBoard_sample.c 的命令表写入执行器状态
+static void check_write_callback(void)
+{
+    fake_sdk_reset();
+    osal_event_init(&g_actuator_event);
+    actuator_state_t st;
+    actuator_state_get(&st);
+    CHECK_EQ(st.servo[0], 10);
+    CHECK_EQ(st.motor, 0);
+
+    write_cmd("[{\"topic\": \"EngineControl_2\", \"Angle\": 250}, {\"topic\": \"RGBControl\", \"Mode\": 2, "
+              "\"Red\": 300, \"Green\": -5, \"Blue\": 17}, {\"topic\": \"BuzzControl\", \"Start\": true}]");
+    actuator_state_get(&st);
+    CHECK_EQ(st.servo[0], 10);
+    CHECK_EQ(st.servo[1], PWM_SERVO_MAX_ANGLE);
+    CHECK_EQ(st.servo[2], 10);
+    CHECK_EQ(st.led_mode, 2);
+    CHECK_EQ(st.rgb[0], 255);
+    CHECK_EQ(st.rgb[1], 0);
+    CHECK_EQ(st.rgb[2], 17);
+    CHECK_EQ(st.buzz, 1);
+    CHECK_EQ(st.motor, 0);
+    CHECK(actuator_updated());
+
+    // 后半截格式错误：前面的 SteeringControl 不生效，也不通知执行器任务
+    write_cmd("[{\"topic\": \"SteeringControl\", \"Start\": 1}, {\"topic\": \"EngineControl_1\", \"Angle\": ");
+    actuator_state_get(&st);
+    CHECK_EQ(st.motor, 0);
+    CHECK(!actuator_updated());
+    // 没有可执行的命令时同样不动
+    write_cmd("{\"topic\": \"Nope\", \"Start\": 1}");
+    write_cmd("{\"topic\": \"SteeringControl\"}");
+    CHECK(!actuator_updated());
+    sle_server_write_cbk(0, 0, NULL, ERRCODE_SUCC);
+
+    write_cmd("{\"topic\": \"SteeringControl\", \"Start\": 1}");
+    write_cmd("{\"Angle\": -3, \"topic\": \"EngineControl_3\"}");
+    actuator_state_get(&st);
+    CHECK_EQ(st.motor, 1);
+    CHECK_EQ(st.servo[2], 0);
+    CHECK_EQ(st.servo[1], PWM_SERVO_MAX_ANGLE);
+    CHECK_EQ(st.buzz, 1);
+    CHECK(actuator_updated());
+    CHECK_EQ(fake_irq_depth(), 0);
+}
+
+int main(void)
+{
+    guard_init();
+    check_known();
+    check_generated();
+    check_mutated();
+    check_write_callback();
+    return host_test_done("test_ctrl_cmd");
+}
@@ -0,0 +1,103 @@
+/*
+ * EPD 局部刷新（黑白屏配置，EPD_PARTIAL_ENABLE 为 1）：0x26 必须始终保存屏上的黑白画面，
+ * 局刷只写变化的窗口，刷新后的黑白 RAM 与整屏重绘的结果相同，连续局刷到上限后回到全刷
+ */
+#define EPD_PARTIAL_ENABLE 1
+#include "EPD_Sample.c"
+#include "epd_model.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+
+#define PLANE_RAM_BYTES (2 * EPD_MODEL_X_BYTES * EPD_MODEL_Y_LINES)
+
+static epd_model_t g_epd;
+static uint8_t g_shown[EPD_H][EPD_W / 8];
+
+static void epd_fixture(void)
+{
+    temperature = 23.5;
+    humidity = 41.2;
+    light = 320;
+    air = 3.4;
+    weather = 3;
+    caution = 0;
+    time = 12.58;
+}
+
+// 0x24 与 0x26 逐字节相同，并记下当前黑白画面
+static void check_planes_match(void)
+{
+    for (uint16_t line = 0; line < EPD_H; line++)
+    {
+        for (uint16_t col = 0; col < EPD_W / 8; col++)
+        {
+            uint8_t bw = epd_model_canvas_byte(&g_epd, 0, line, col);
+            if (bw != epd_model_canvas_byte(&g_epd, 1, line, col))
+            {
+                fprintf(stderr, "0x26 differs from 0x24 at line %u col %u\n", line, col);
+                CHECK(0);
+                return;
+            }
+            g_shown[line][col] = bw;
+        }
+    }
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    epd_model_attach(&g_epd, 0);
+    EPD_Init();
+    Paint_NewImage(band_buf, EPD_W, EPD_H, 0, WHITE);
+    Paint_SelectBand(band_buf, 0, EPD_BAND_LINES);
+
+    epd_fixture();
+    CHECK_EQ(refresh_scene(), 1);
+    CHECK_EQ(g_epd.last_update_ctrl, 0xF7);
+    check_planes_match();
+
+    for (uint32_t i = 1; i <= EPD_FULL_REFRESH_EVERY; i++)
+    {
+        time = 12.58 + i / 100.0;
+        weather = (uint8_t)(i % 6);
+        uint32_t ram = g_epd.ram_bytes;
+        CHECK_EQ(refresh_scene(), 1);
+        CHECK_EQ(g_epd.updates, 1 + i);
+        CHECK_EQ(g_epd.last_update_ctrl, EPD_PART_UPDATE_CTRL);
+        // 只写时钟和天气所在的窗口（0x24 与 0x26 各一次）
+        CHECK(g_epd.ram_bytes - ram < PLANE_RAM_BYTES / 4);
+        check_planes_match();
+
+        // 整屏重绘同一场景，黑白 RAM 不应再有变化
+        draw_main_scene();
+        for (uint16_t line = 0; line < EPD_H; line++)
+        {
+            for (uint16_t col = 0; col < EPD_W / 8; col++)
+            {
+                if (epd_model_canvas_byte(&g_epd, 0, line, col) != g_shown[line][col])
+                {
+                    fprintf(stderr, "partial %u: line %u col %u differs from a full redraw\n", i, line, col);
+                    CHECK(0);
+                    line = EPD_H;
+                    break;
+                }
+            }
+        }
+    }
+
+    // 连续局刷达到上限后强制全刷
+    time = 13.00;
+    CHECK_EQ(refresh_scene(), 1);
+    CHECK_EQ(g_epd.last_update_ctrl, 0xF7);
+    check_planes_match();
+
+    // 红色内容（传感器数值）变化在黑白屏上同样全刷，0x26 仍为黑白画面
+    temperature = 30.1;
+    CHECK_EQ(refresh_scene(), 1);
+    CHECK_EQ(g_epd.last_update_ctrl, 0xF7);
+    check_planes_match();
+
+    CHECK_EQ(g_epd.errors, 0);
+    epd_model_detach(&g_epd);
+    return host_test_done("test_epd_partial");
+}
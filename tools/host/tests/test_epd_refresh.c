@@ -0,0 +1,64 @@
+/* EPD 刷新策略（默认配置，三色屏）：画面不变时跳过，时钟等黑白控件变化也全刷，红色平面始终保留传感器与警告 */
+#include "EPD_Sample.c"
+#include "epd_model.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+
+static epd_model_t g_epd;
+
+static void epd_fixture(void)
+{
+    temperature = 23.5;
+    humidity = 41.2;
+    light = 320;
+    air = 3.4;
+    weather = 3;
+    caution = 0;
+    time = 12.58;
+}
+
+static void check_red_golden(void)
+{
+    host_image_t *red = epd_model_image(&g_epd, 1);
+    CHECK_EQ(image_check_golden(red, "epd_main_red.pbm"), 0);
+    image_free(red);
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    epd_model_attach(&g_epd, 0);
+    EPD_Init();
+    Paint_NewImage(band_buf, EPD_W, EPD_H, 0, WHITE);
+    Paint_SelectBand(band_buf, 0, EPD_BAND_LINES);
+    CHECK_EQ(EPD_PARTIAL_ENABLE, 0);
+
+    epd_fixture();
+    CHECK_EQ(refresh_scene(), 1);
+    CHECK_EQ(g_epd.updates, 1);
+    CHECK_EQ(g_epd.last_update_ctrl, 0xF7);
+    check_red_golden();
+
+    // 数据没变：不写 RAM，不刷新
+    uint32_t ram = g_epd.ram_bytes;
+    CHECK_EQ(refresh_scene(), 0);
+    CHECK_EQ(g_epd.ram_bytes, ram);
+    CHECK_EQ(g_epd.updates, 1);
+
+    // 只有时钟和天气变化：仍然两个平面整屏写入后全刷，红色平面不受影响
+    for (uint32_t i = 1; i <= 3; i++)
+    {
+        time = 12.58 + i / 100.0;
+        weather = (uint8_t)(i % 6);
+        ram = g_epd.ram_bytes;
+        CHECK_EQ(refresh_scene(), 1);
+        CHECK_EQ(g_epd.updates, 1 + i);
+        CHECK_EQ(g_epd.last_update_ctrl, 0xF7);
+        CHECK_EQ(g_epd.ram_bytes - ram, 2 * 2 * EPD_MODEL_X_BYTES * EPD_MODEL_Y_LINES);
+        check_red_golden();
+    }
+
+    CHECK_EQ(g_epd.errors, 0);
+    epd_model_detach(&g_epd);
+    return host_test_done("test_epd_refresh");
+}
@@ -0,0 +1,51 @@
+/* EPD 主界面：固定数据渲染后经传输层写入面板模型，重建的黑白、红色画面与 golden 比对 */
+#include "EPD_Sample.c"
+#include "epd_model.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+
+static epd_model_t g_epd;
+
+// 与 golden 对应的固定数据
+static void epd_fixture(void)
+{
+    temperature = 23.5;
+    humidity = 41.2;
+    light = 320;
+    air = 3.4;
+    weather = 3;
+    caution = 0;
+    time = 12.58;
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    epd_model_attach(&g_epd, 0);
+    EPD_Init();
+    CHECK(EPD_TransportIsHw());
+    // 与 EPD_task 相同的画布初始化
+    Paint_NewImage(band_buf, EPD_W, EPD_H, 0, WHITE);
+    Paint_SelectBand(band_buf, 0, EPD_BAND_LINES);
+    // 选中的画布不能超出条带缓冲区
+    CHECK((uint32_t)Paint.widthByte * Paint.heightByte <= sizeof(band_buf));
+
+    epd_fixture();
+    draw_main_scene();
+    EPD_Update();
+    CHECK_EQ(g_epd.errors, 0);
+    CHECK_EQ(g_epd.updates, 1);
+    CHECK_EQ(g_epd.last_update_ctrl, 0xF7);
+    // 两个平面各写满两个控制器的全部 RAM
+    CHECK_EQ(g_epd.ram_bytes, 2 * 2 * EPD_MODEL_X_BYTES * EPD_MODEL_Y_LINES);
+
+    host_image_t *bw = epd_model_image(&g_epd, 0);
+    host_image_t *red = epd_model_image(&g_epd, 1);
+    CHECK_EQ(image_check_golden(bw, "epd_main_bw.pbm"), 0);
+    CHECK_EQ(image_check_golden(red, "epd_main_red.pbm"), 0);
+    image_free(bw);
+    image_free(red);
+
+    epd_model_detach(&g_epd);
+    return host_test_done("test_epd_render");
+}
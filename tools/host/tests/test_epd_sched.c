@@ -0,0 +1,168 @@
+/*
+ * 电子纸刷新调度：用假时钟按 EPD_Update_Task 的循环驱动 epd_sched，
+ * 检查合并窗口、最小刷新间隔、警告立即刷新，以及持续数据流下的刷新间隔和显示延迟
+ */
+#include "EPD_Sched.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "tcxo.h"
+
+#define HEARTBEAT_MS 1000 // 与 EPD_Sample.c 的 EPD_HEARTBEAT_MS 相同
+#define REFRESH_MS 15000  // 一次全刷占用面板的时间
+#define MAX_EVENTS 700
+#define MAX_REFRESH 64
+
+typedef struct
+{
+    uint64_t t_ms;
+    uint32_t evt;
+} sched_event_t;
+
+static sched_event_t g_events[MAX_EVENTS];
+static uint32_t g_event_count = 0;
+static uint64_t g_refresh_at[MAX_REFRESH];
+static uint32_t g_refresh_count = 0;
+
+static void add_event(uint64_t t_ms, uint32_t evt)
+{
+    g_events[g_event_count].t_ms = t_ms;
+    g_events[g_event_count].evt = evt;
+    g_event_count++;
+}
+
+static void advance_to(uint64_t t_ms)
+{
+    fake_clock_advance_us((t_ms - uapi_tcxo_get_ms()) * 1000);
+}
+
+// 与 EPD_Update_Task 相同的循环：到期就刷新，否则最多等一个心跳，期间到达的事件立即唤醒
+static void run_until(uint64_t end_ms)
+{
+    epd_sched_t s;
+    uint32_t next = 0;
+    fake_sdk_reset();
+    g_refresh_count = 0;
+    epd_sched_init(&s, uapi_tcxo_get_ms());
+    while (uapi_tcxo_get_ms() < end_ms)
+    {
+        uint64_t now = uapi_tcxo_get_ms();
+        uint32_t wait = epd_sched_wait_ms(&s, now);
+        if (wait == 0)
+        {
+            epd_sched_take(&s);
+            if (g_refresh_count < MAX_REFRESH)
+            {
+                g_refresh_at[g_refresh_count] = now;
+            }
+            g_refresh_count++;
+            advance_to(now + REFRESH_MS);
+            epd_sched_refreshed(&s, uapi_tcxo_get_ms());
+            continue;
+        }
+        wait = (wait < HEARTBEAT_MS) ? wait : HEARTBEAT_MS;
+        uint32_t evt = 0;
+        if (next < g_event_count && g_events[next].t_ms <= now + wait)
+        {
+            // 事件在等待期间（或刷新期间）到达：事件位累积，在到达时刻或当前时刻被读出
+            uint64_t at = (g_events[next].t_ms > now) ? g_events[next].t_ms : now;
+            while (next < g_event_count && g_events[next].t_ms <= at)
+            {
+                evt |= g_events[next++].evt;
+            }
+            advance_to(at);
+        }
+        else
+        {
+            advance_to(now + wait);
+        }
+        epd_sched_on_event(&s, evt, uapi_tcxo_get_ms());
+    }
+}
+
+static void reset_events(void)
+{
+    g_event_count = 0;
+}
+
+int main(void)
+{
+    // 没有数据：只有心跳，不刷新
+    reset_events();
+    run_until(600000);
+    CHECK_EQ(g_refresh_count, 0);
+
+    // 上次刷新后不久到达的数据：等到最小间隔结束
+    reset_events();
+    add_event(5000, EPD_SCENE_EVT_DATA);
+    run_until(200000);
+    CHECK_EQ(g_refresh_count, 1);
+    CHECK_EQ(g_refresh_at[0], EPD_MIN_REFRESH_INTERVAL_MS);
+
+    // 空闲很久之后到达的数据：合并窗口结束即刷新
+    reset_events();
+    add_event(100000, EPD_SCENE_EVT_DATA);
+    run_until(200000);
+    CHECK_EQ(g_refresh_count, 1);
+    CHECK_EQ(g_refresh_at[0], 100000 + EPD_SETTLE_MS);
+
+    // 合并窗口内的一串数据只刷新一次，窗口从第一个变化起算，不被后续变化推迟
+    reset_events();
+    add_event(100000, EPD_SCENE_EVT_DATA);
+    add_event(100500, EPD_SCENE_EVT_DATA);
+    add_event(101500, EPD_SCENE_EVT_DATA);
+    add_event(101900, EPD_SCENE_EVT_DATA);
+    run_until(300000);
+    CHECK_EQ(g_refresh_count, 1);
+    CHECK_EQ(g_refresh_at[0], 100000 + EPD_SETTLE_MS);
+
+    // 刷新期间到达的数据在刷新结束后读出，下一次刷新仍遵守最小间隔
+    reset_events();
+    add_event(100000, EPD_SCENE_EVT_DATA);
+    add_event(105000, EPD_SCENE_EVT_DATA);
+    run_until(300000);
+    CHECK_EQ(g_refresh_count, 2);
+    CHECK_EQ(g_refresh_at[0], 100000 + EPD_SETTLE_MS);
+    CHECK_EQ(g_refresh_at[1], g_refresh_at[0] + REFRESH_MS + EPD_MIN_REFRESH_INTERVAL_MS);
+
+    // 警告不等合并窗口和最小间隔，并带走之前积累的数据变化
+    reset_events();
+    add_event(5000, EPD_SCENE_EVT_ALERT);
+    run_until(100000);
+    CHECK_EQ(g_refresh_count, 1);
+    CHECK_EQ(g_refresh_at[0], 5000);
+
+    reset_events();
+    add_event(30000, EPD_SCENE_EVT_DATA);
+    add_event(31000, EPD_SCENE_EVT_DATA | EPD_SCENE_EVT_ALERT);
+    run_until(200000);
+    CHECK_EQ(g_refresh_count, 1);
+    CHECK_EQ(g_refresh_at[0], 31000);
+
+    // 每秒一条数据持续 10 分钟：刷新间隔不小于最小间隔，每条数据最迟在一个间隔加合并窗口内被显示
+    reset_events();
+    for (uint32_t i = 0; i < 600; i++)
+    {
+        add_event(1000 + i * 1000, EPD_SCENE_EVT_DATA);
+    }
+    run_until(700000);
+    CHECK(g_refresh_count >= 7 && g_refresh_count <= MAX_REFRESH);
+    for (uint32_t i = 1; i < g_refresh_count && i < MAX_REFRESH; i++)
+    {
+        CHECK(g_refresh_at[i] - g_refresh_at[i - 1] >= REFRESH_MS + EPD_MIN_REFRESH_INTERVAL_MS);
+    }
+    uint32_t r = 0;
+    for (uint32_t i = 0; i < g_event_count; i++)
+    {
+        while (r < g_refresh_count && g_refresh_at[r] < g_events[i].t_ms)
+        {
+            r++;
+        }
+        CHECK(r < g_refresh_count);
+        if (r < g_refresh_count)
+        {
+            CHECK(g_refresh_at[r] - g_events[i].t_ms <= REFRESH_MS + EPD_MIN_REFRESH_INTERVAL_MS + EPD_SETTLE_MS);
+        }
+    }
+
+    return host_test_done("test_epd_sched");
+}
@@ -0,0 +1,142 @@
+/*
+ * 电子纸 SPI 分帧：硬件 SPI（DMA）和回退的 GPIO 软件 SPI 两条路径发出的 (DC, 字节) 序列，
+ * 都必须与改为硬件 SPI 之前的逐字节软件 SPI 驱动录下的 data/epd_bitbang.trace 完全一致
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "EPD.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "epd_model.h"
+
+#define LINE_BYTES (Source_BYTES * 2)
+#define TRACE_CAP 200000
+
+static uint8_t g_bw[LINE_BYTES * Gate_BITS];
+static uint8_t g_red[LINE_BYTES * Gate_BITS];
+static uint16_t g_want[TRACE_CAP];
+static uint32_t g_want_len = 0;
+static epd_model_t g_epd;
+
+static void fill(uint8_t *img, uint32_t l0, uint32_t l1, uint32_t c0, uint32_t c1, uint8_t v)
+{
+    for (uint32_t l = l0; l <= l1; l++)
+    {
+        for (uint32_t c = c0; c <= c1; c++)
+        {
+            img[l * LINE_BYTES + c] = v;
+        }
+    }
+}
+
+// 录制 trace 时使用的两幅图：首末列逐行不同，用来发现转置顺序的错误；另有跨主从两半的色块
+static void make_images(void)
+{
+    memset(g_bw, 0xFF, sizeof(g_bw));
+    memset(g_red, 0x00, sizeof(g_red));
+    for (uint32_t l = 0; l < Gate_BITS; l++)
+    {
+        g_bw[l * LINE_BYTES] = (uint8_t)l;
+        g_bw[l * LINE_BYTES + LINE_BYTES - 1] = (uint8_t)(l * 3);
+    }
+    fill(g_bw, 20, 99, 5, 30, 0x00);
+    for (uint32_t l = 200; l <= 263; l++)
+    {
+        fill(g_bw, l, l, 60, 70, (l & 1) ? 0xAA : 0x55);
+    }
+    fill(g_bw, 120, 140, 45, 54, 0x0F);
+    fill(g_red, 120, 180, 40, 60, 0xFF);
+    fill(g_red, 5, 10, 49, 49, 0x81);
+    fill(g_red, 5, 10, 50, 50, 0x18);
+}
+
+// 每行 "C xx" 为命令，"D xx" 或 "D xx*n" 为数据（n 个相同字节），# 开头为注释
+static void load_trace(const char *name)
+{
+    FILE *f = fopen(host_data_path(name), "r");
+    CHECK(f != NULL);
+    if (f == NULL)
+    {
+        return;
+    }
+    char line[64];
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        unsigned int byte = 0;
+        unsigned int n = 1;
+        if (line[0] == 'C' && sscanf(line + 1, "%x", &byte) == 1)
+        {
+            g_want[g_want_len++] = (uint16_t)byte;
+        }
+        else if (line[0] == 'D' && sscanf(line + 1, "%x*%u", &byte, &n) >= 1)
+        {
+            for (unsigned int i = 0; i < n && g_want_len < TRACE_CAP; i++)
+            {
+                g_want[g_want_len++] = (uint16_t)(EPD_TRACE_DC | byte);
+            }
+        }
+    }
+    fclose(f);
+}
+
+static void run_sequence(void)
+{
+    EPD_Init();
+    EPD_Display_Clear();
+    EPD_Display(g_bw, g_red);
+    EPD_Update();
+    EPD_DeepSleep();
+}
+
+static void compare_trace(const char *path)
+{
+    CHECK_EQ(g_epd.errors, 0);
+    CHECK_EQ(g_epd.trace_len, g_want_len);
+    uint32_t n = (g_epd.trace_len < g_want_len) ? g_epd.trace_len : g_want_len;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (g_epd.trace[i] != g_want[i])
+        {
+            fprintf(stderr, "%s: entry %u is %03X, recorded %03X\n", path, i, g_epd.trace[i], g_want[i]);
+            CHECK(0);
+            break;
+        }
+    }
+}
+
+// 传输层只初始化一次，换路径前把它的状态清掉
+static void reset_transport(void)
+{
+    fake_sdk_reset();
+    g_epd_transport_ready = 0;
+    g_epd_hw_spi = 0;
+    g_epd_busy_irq = 0;
+}
+
+int main(void)
+{
+    make_images();
+    load_trace("epd_bitbang.trace");
+    CHECK(g_want_len > 2 * ALLSCREEN_BYTES * 4);
+
+    // 硬件 SPI + DMA：CS 整段拉低，发送缓冲区始终 4 字节对齐
+    reset_transport();
+    epd_model_attach(&g_epd, TRACE_CAP);
+    run_sequence();
+    CHECK_EQ(EPD_TransportIsHw(), 1);
+    compare_trace("hw spi");
+    CHECK_EQ(fake_spi_unaligned_dma(), 0);
+    uint32_t hw_gpio_writes = fake_gpio_writes();
+
+    // uapi_spi_init 失败时回退到 GPIO 软件 SPI，线上的字节序列不变
+    reset_transport();
+    fake_spi_set_init_result(ERRCODE_FAIL);
+    epd_model_attach(&g_epd, TRACE_CAP);
+    run_sequence();
+    CHECK_EQ(EPD_TransportIsHw(), 0);
+    compare_trace("gpio spi");
+    CHECK(fake_gpio_writes() > hw_gpio_writes * 16);
+
+    epd_model_detach(&g_epd);
+    return host_test_done("test_epd_spi_framing");
+}
@@ -0,0 +1,208 @@
+/*
+ * EPD 字库索引：EPD_atlas.h 中每个字形都能由 EPD_AtlasFind 找回；按 EPD_font.h 的原始字库逐个核对应有的字形，
+ * 其余码点（逐个扫过整个 Unicode 范围）一律返回 NULL；非法 UTF-8 序列只消耗一个字节，且查不到字形
+ */
+#include <string.h>
+#include "EPD_GUI.c"
+#include "EPD_font.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+
+#define MAX_CODE 0x10FFFF
+
+static const uint16_t g_sizes[] = {8, 12, 16, 24, 32, 48};
+
+// EPD_font.h 中 size 号字是否有码点 code 的字形
+static int in_font(uint16_t size, uint32_t code)
+{
+    uint32_t ascii = 0;
+    if (size == 8)
+    {
+        ascii = sizeof(asc2_0806) / sizeof(asc2_0806[0]);
+    }
+    else if (size == 12)
+    {
+        ascii = sizeof(asc2_1206) / sizeof(asc2_1206[0]);
+    }
+    else if (size == 16)
+    {
+        ascii = sizeof(asc2_1608) / sizeof(asc2_1608[0]);
+    }
+    else if (size == 24)
+    {
+        ascii = sizeof(asc2_2412) / sizeof(asc2_2412[0]);
+    }
+    else if (size == 48)
+    {
+        ascii = sizeof(asc2_4824) / sizeof(asc2_4824[0]);
+    }
+    if (code >= ' ' && code < ' ' + ascii)
+    {
+        return 1;
+    }
+
+    const unsigned char *index = NULL;
+    uint32_t count = 0;
+    uint32_t stride = 0;
+    if (size == 12)
+    {
+        index = tfont12[0].Index, count = sizeof(tfont12) / sizeof(tfont12[0]), stride = sizeof(tfont12[0]);
+    }
+    else if (size == 16)
+    {
+        index = tfont16[0].Index, count = sizeof(tfont16) / sizeof(tfont16[0]), stride = sizeof(tfont16[0]);
+    }
+    else if (size == 24)
+    {
+        index = tfont24[0].Index, count = sizeof(tfont24) / sizeof(tfont24[0]), stride = sizeof(tfont24[0]);
+    }
+    else if (size == 32)
+    {
+        index = tfont32[0].Index, count = sizeof(tfont32) / sizeof(tfont32[0]), stride = sizeof(tfont32[0]);
+    }
+    for (uint32_t k = 0; k < count; k++)
+    {
+        uint32_t c;
+        if (EPD_DecodeUtf8(index + k * stride, &c) > 1 && c == code)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void check_atlas_entries(void)
+{
+    for (uint32_t i = 0; i < EPD_ATLAS_SLOTS; i++)
+    {
+        const EPD_GLYPH *g = &epd_atlas_glyph[i];
+        uint16_t size = (uint16_t)(g->key >> 24);
+        uint32_t code = g->key & 0xFFFFFF;
+        if (EPD_AtlasFind(size, code) != g)
+        {
+            fprintf(stderr, "slot %u (size %u, U+%04X) not found\n", i, size, code);
+            CHECK(0);
+        }
+        // 字形在位图内，ASCII 不透明、汉字透明
+        CHECK(g->offset + (uint32_t)g->h * ((g->w + 7) / 8) <= sizeof(epd_atlas_bits));
+        CHECK_EQ(g->opaque, code < 0x80);
+    }
+}
+
+// 每个字号扫过全部码点：查到的正好是 EPD_font.h 里有的字形，宽高与原来的画法一致
+static void check_all_code_points(void)
+{
+    uint32_t found = 0;
+    for (uint32_t s = 0; s < sizeof(g_sizes) / sizeof(g_sizes[0]); s++)
+    {
+        uint16_t size = g_sizes[s];
+        for (uint32_t code = 0; code <= MAX_CODE; code++)
+        {
+            const EPD_GLYPH *g = EPD_AtlasFind(size, code);
+            int want = in_font(size, code);
+            if ((g != NULL) != want)
+            {
+                fprintf(stderr, "size %u U+%04X: found %d, in font %d\n", size, code, g != NULL, want);
+                CHECK(0);
+                return;
+            }
+            if (g != NULL)
+            {
+                found++;
+                // ASCII 字模按列存放，每列整字节 8 行，12 号字实际是 16 行
+                CHECK_EQ(g->h, (code < 0x80) ? (size + 7) / 8 * 8 : size);
+                CHECK_EQ(g->w, (code < 0x80) ? ((size == 8) ? 6 : size / 2) : size);
+            }
+        }
+        // 不存在的字号
+        CHECK(EPD_AtlasFind(size + 1, 'A') == NULL);
+    }
+    CHECK_EQ(found, EPD_ATLAS_SLOTS);
+}
+
+static void check_decode(const char *what, const uint8_t *s, uint8_t want_len, uint32_t want_code)
+{
+    uint32_t code = 0xFFFFFFFF;
+    uint8_t len = EPD_DecodeUtf8(s, &code);
+    if (len != want_len || code != want_code)
+    {
+        fprintf(stderr, "%s: len %u code U+%04X, want %u U+%04X\n", what, len, code, want_len, want_code);
+        CHECK(0);
+    }
+}
+
+static void check_utf8(void)
+{
+    check_decode("ascii", (const uint8_t *)"A", 1, 'A');
+    check_decode("zhong", (const uint8_t *)"\xE4\xB8\xAD", 3, 0x4E2D);
+    check_decode("2 bytes", (const uint8_t *)"\xC2\xB0", 2, 0xB0);
+    check_decode("4 bytes", (const uint8_t *)"\xF0\x9F\x98\x80", 4, 0x1F600);
+    for (uint32_t s = 0; s < sizeof(g_sizes) / sizeof(g_sizes[0]); s++)
+    {
+        if (g_sizes[s] != 8 && g_sizes[s] != 48)
+        {
+            CHECK(EPD_AtlasFind(g_sizes[s], 0x4E2D) != NULL);
+        }
+    }
+
+    // 任何非 ASCII 首字节后面跟着非续字节（含字符串结尾）：只消耗首字节，码点即该字节，字库中没有
+    static const uint8_t followers[] = {0x00, 'A', 0x7F, 0xC0, 0xE4, 0xFF};
+    for (uint32_t lead = 0x80; lead <= 0xFF; lead++)
+    {
+        for (uint32_t f = 0; f < sizeof(followers); f++)
+        {
+            uint8_t s[4] = {(uint8_t)lead, followers[f], 0x80, 0x80};
+            uint32_t code;
+            uint8_t len = EPD_DecodeUtf8(s, &code);
+            CHECK_EQ(len, 1);
+            CHECK_EQ(code, lead);
+            for (uint32_t k = 0; k < sizeof(g_sizes) / sizeof(g_sizes[0]); k++)
+            {
+                CHECK(EPD_AtlasFind(g_sizes[k], code) == NULL);
+            }
+        }
+    }
+
+    // 截断的多字节序列：在第一个非续字节处停下
+    check_decode("truncated 3", (const uint8_t *)"\xE4\xB8", 1, 0xE4);
+    check_decode("truncated 4", (const uint8_t *)"\xF0\x9F\x98", 1, 0xF0);
+    check_decode("lone continuation", (const uint8_t *)"\xAD", 1, 0xAD);
+    check_decode("5-byte lead", (const uint8_t *)"\xF8\x88\x80\x80\x80", 1, 0xF8);
+    // 过长编码（可以拼出字库里有的 'A'）、UTF-16 代理区、超出 U+10FFFF：同样只消耗首字节
+    check_decode("overlong A", (const uint8_t *)"\xC1\x81", 1, 0xC1);
+    check_decode("overlong 3", (const uint8_t *)"\xE0\x81\x81", 1, 0xE0);
+    check_decode("overlong 4", (const uint8_t *)"\xF0\x80\x81\x81", 1, 0xF0);
+    check_decode("surrogate", (const uint8_t *)"\xED\xA0\x80", 1, 0xED);
+    check_decode("beyond U+10FFFF", (const uint8_t *)"\xF4\x90\x80\x80", 1, 0xF4);
+    check_decode("largest 2", (const uint8_t *)"\xDF\xBF", 2, 0x7FF);
+    check_decode("smallest 3", (const uint8_t *)"\xE0\xA0\x80", 3, 0x800);
+    check_decode("largest 4", (const uint8_t *)"\xF4\x8F\xBF\xBF", 4, 0x10FFFF);
+}
+
+// 中间夹着非法字节的字符串：非法字节按字号留空，后面的汉字仍在正确的位置
+static void check_show_chinese(void)
+{
+    static uint8_t canvas[EPD_W / 8 * EPD_H];
+    static uint8_t want[EPD_W / 8 * EPD_H];
+    Paint_NewImage(canvas, EPD_W, EPD_H, 0, WHITE);
+
+    Paint_SelectImage(want);
+    Paint_Clear(WHITE);
+    EPD_ShowChinese(40, 30, (uint8_t *)"\xE4\xB8\xAD", 24, BLACK);
+    EPD_ShowChinese(88, 30, (uint8_t *)"\xE4\xB8\xAD", 24, BLACK);
+
+    Paint_SelectImage(canvas);
+    Paint_Clear(WHITE);
+    EPD_ShowChinese(40, 30, (uint8_t *)"\xE4\xB8\xAD\xB8\xE4\xB8\xAD", 24, BLACK);
+    CHECK(memcmp(canvas, want, sizeof(canvas)) == 0);
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    check_atlas_entries();
+    check_all_code_points();
+    check_utf8();
+    check_show_chinese();
+    return host_test_done("test_epd_text");
+}
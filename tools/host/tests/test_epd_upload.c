@@ -0,0 +1,173 @@
+/*
+ * 电子纸平面上传：经转置条带整块发送的 EPD_Display / _BW / _R，(DC, 字节) 序列须与原来按列逐字节
+ * EPD_DataPut 的写法逐字节相同；EPD_UploadWindow 对任意窗口（列数不是条带宽度的整数倍）也逐字节相同
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "EPD.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "epd_model.h"
+
+#define TRACE_CAP 120000
+#define PLANE_BYTES (EPD_LINE_BYTES * Gate_BITS)
+
+static uint8_t g_bw[PLANE_BYTES];
+static uint8_t g_red[PLANE_BYTES];
+static uint16_t g_want[TRACE_CAP];
+static uint32_t g_want_len = 0;
+static epd_model_t g_epd;
+
+// 改动前的 EPD_Display_BW / _R：从画布按列逐字节读出，每个字节一次 EPD_DataPut，从控接着主控的列继续
+static void ref_upload_plane(const uint8_t *image, uint8_t master_cmd, uint8_t slave_cmd)
+{
+    uint32_t tempcol = 0;
+    uint32_t templine = 0;
+    EPD_SetRAMMP();
+    EPD_SetRAMMA();
+    EPD_WR_REG(master_cmd);
+    for (uint8_t half = 0; half < 2; half++)
+    {
+        if (half == 1)
+        {
+            EPD_SetRAMSP();
+            EPD_SetRAMSA();
+            EPD_WR_REG(slave_cmd);
+        }
+        EPD_DataBegin();
+        for (uint32_t i = 0; i < ALLSCREEN_BYTES; i++)
+        {
+            uint8_t temp = image[templine * EPD_LINE_BYTES + tempcol];
+            templine++;
+            if (templine >= Gate_BITS)
+            {
+                tempcol++;
+                templine = 0;
+            }
+            EPD_DataPut(temp);
+        }
+        EPD_DataEnd();
+    }
+}
+
+static void random_image(uint8_t *img, uint32_t seed)
+{
+    srand(seed);
+    for (uint32_t i = 0; i < PLANE_BYTES; i++)
+    {
+        img[i] = (uint8_t)rand();
+    }
+}
+
+static void start(void)
+{
+    epd_model_attach(&g_epd, TRACE_CAP);
+}
+
+static void keep_reference(void)
+{
+    CHECK_EQ(g_epd.errors, 0);
+    g_want_len = g_epd.trace_len;
+    memcpy(g_want, g_epd.trace, g_want_len * sizeof(g_want[0]));
+}
+
+static void compare(const char *what, uint32_t seed)
+{
+    CHECK_EQ(g_epd.errors, 0);
+    if (g_epd.trace_len != g_want_len || memcmp(g_epd.trace, g_want, g_want_len * sizeof(g_want[0])) != 0)
+    {
+        fprintf(stderr, "%s seed %u: stream differs (%u vs %u entries)\n", what, seed, g_epd.trace_len, g_want_len);
+        CHECK(0);
+    }
+}
+
+// EPD_UploadWindow 单独比对：截获 SPI 上的数据字节
+static uint8_t g_spi[PLANE_BYTES];
+static uint32_t g_spi_len = 0;
+
+static errcode_t capture_spi(spi_bus_t bus, const uint8_t *buf, uint32_t len)
+{
+    (void)bus;
+    if (g_spi_len + len <= sizeof(g_spi))
+    {
+        memcpy(&g_spi[g_spi_len], buf, len);
+    }
+    g_spi_len += len;
+    return ERRCODE_SUCC;
+}
+
+static void check_window(const uint8_t *image, uint32_t line0, uint32_t col0, uint32_t ncols, uint32_t nlines)
+{
+    const uint8_t *lines = image + line0 * EPD_LINE_BYTES;
+    g_spi_len = 0;
+    EPD_DataBegin();
+    EPD_UploadWindow(lines, col0, ncols, nlines);
+    EPD_DataEnd();
+
+    CHECK_EQ(g_spi_len, ncols * nlines);
+    uint32_t i = 0;
+    for (uint32_t col = col0; col < col0 + ncols; col++)
+    {
+        for (uint32_t line = 0; line < nlines; line++, i++)
+        {
+            if (i < g_spi_len && g_spi[i] != lines[line * EPD_LINE_BYTES + col])
+            {
+                fprintf(stderr, "window line0 %u col0 %u %ux%u: byte %u differs\n", line0, col0, ncols, nlines, i);
+                CHECK(0);
+                return;
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    EPD_Init();
+    CHECK_EQ(EPD_TransportIsHw(), 1);
+
+    for (uint32_t seed = 1; seed <= 3; seed++)
+    {
+        random_image(g_bw, seed);
+        random_image(g_red, seed + 100);
+
+        start();
+        ref_upload_plane(g_bw, 0x24, 0xa4);
+        keep_reference();
+        start();
+        EPD_Display_BW(g_bw);
+        compare("EPD_Display_BW", seed);
+
+        start();
+        ref_upload_plane(g_red, 0x26, 0xA6);
+        keep_reference();
+        start();
+        EPD_Display_R(g_red);
+        compare("EPD_Display_R", seed);
+
+        start();
+        ref_upload_plane(g_bw, 0x24, 0xa4);
+        ref_upload_plane(g_red, 0x26, 0xA6);
+        keep_reference();
+        start();
+        EPD_Display(g_bw, g_red);
+        compare("EPD_Display", seed);
+    }
+    epd_model_detach(&g_epd);
+    CHECK_EQ(fake_spi_unaligned_dma(), 0);
+
+    // 窗口：整列条带、不足一个条带、跨条带边界、单列单行、整个一半
+    fake_spi_set_hook(capture_spi);
+    random_image(g_bw, 7);
+    static const uint32_t windows[][4] = {
+        {0, 0, 10, 16},  {3, 7, 1, 1},     {16, 5, 13, 37},  {100, 41, 9, 172},
+        {0, 0, 50, 272}, {0, 50, 50, 272}, {255, 93, 7, 17}, {40, 9, 22, 16},
+    };
+    for (uint32_t w = 0; w < sizeof(windows) / sizeof(windows[0]); w++)
+    {
+        check_window(g_bw, windows[w][0], windows[w][1], windows[w][2], windows[w][3]);
+    }
+    CHECK_EQ(fake_spi_unaligned_dma(), 0);
+
+    return host_test_done("test_epd_upload");
+}
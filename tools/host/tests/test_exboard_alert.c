@@ -0,0 +1,132 @@
+/* ExBoard 紧急告警通道：去抖、队列满时覆盖最旧记录、ex_us 时间戳，以及告警先于合并中的遥测发出 */
+#include "sle_uart_server.c"
+#include "alert.c"
+#include <string.h>
+#include "fake_sdk.h"
+#include "fake_sle.h"
+#include "host_test.h"
+
+#define NTF_LOG_MAX 16
+
+static char g_ntf[NTF_LOG_MAX][SLE_UART_SERVER_NTF_MAX_SIZE + 1];
+static uint32_t g_ntf_count = 0;
+
+static errcode_t record_notify(uint16_t conn_id, const uint8_t *data, uint16_t len)
+{
+    (void)conn_id;
+    if (g_ntf_count < NTF_LOG_MAX && len <= SLE_UART_SERVER_NTF_MAX_SIZE)
+    {
+        memcpy(g_ntf[g_ntf_count], data, len);
+        g_ntf[g_ntf_count][len] = '\0';
+    }
+    g_ntf_count++;
+    return ERRCODE_SUCC;
+}
+
+static void expect_alert(uint32_t index, uint32_t seq, uint32_t ex_us)
+{
+    char expect[ALERT_MSG_MAX_LEN];
+    snprintf(expect, sizeof(expect), "[{\"topic\":\"CautionStatus\",\"caution\":%u,\"seq\":%u,\"ex_us\":%u}]",
+             ALERT_TYPE_SOS, seq, ex_us);
+    CHECK(index < g_ntf_count && strcmp(g_ntf[index], expect) == 0);
+}
+
+// 中断到发送任务取走记录之间的耗时如实写进 ex_us
+static void test_latency_stamp(void)
+{
+    g_ntf_count = 0;
+    alert_raise_from_isr(ALERT_TYPE_SOS);
+    fake_clock_advance_us(350);
+    alert_send_pending();
+    CHECK_EQ(g_ntf_count, 1);
+    expect_alert(0, 1, 350);
+}
+
+static void test_debounce(void)
+{
+    g_ntf_count = 0;
+    fake_clock_advance_us(ALERT_DEBOUNCE_US);
+    alert_raise_from_isr(ALERT_TYPE_SOS);
+    fake_clock_advance_us(ALERT_DEBOUNCE_US / 4);
+    alert_raise_from_isr(ALERT_TYPE_SOS);
+    fake_clock_advance_us(ALERT_DEBOUNCE_US / 4);
+    alert_raise_from_isr(ALERT_TYPE_SOS);
+    alert_send_pending();
+    CHECK_EQ(g_ntf_count, 1);
+    expect_alert(0, 2, ALERT_DEBOUNCE_US / 2);
+}
+
+// 告警直接 notify，不等遥测的合并窗口
+static void test_ahead_of_telemetry(void)
+{
+    static const char telemetry[] = "{\"topic\":\"LightSenser\",\"light\":320}";
+    g_ntf_count = 0;
+    fake_clock_advance_us(ALERT_DEBOUNCE_US);
+    CHECK_EQ(sle_uart_server_batch_put("LightSenser", (const uint8_t *)telemetry, sizeof(telemetry) - 1, false),
+             ERRCODE_SLE_SUCCESS);
+    alert_raise_from_isr(ALERT_TYPE_SOS);
+    alert_send_pending();
+    sle_uart_batch_wait_flush();
+    CHECK_EQ(g_ntf_count, 2);
+    expect_alert(0, 3, 0);
+    CHECK(strstr(g_ntf[1], "LightSenser") != NULL);
+}
+
+// 发送任务来不及处理时只保留最新的 ALERT_QUEUE_LEN 条
+static void test_overflow_keeps_newest(void)
+{
+    const uint32_t raised = ALERT_QUEUE_LEN + 2;
+    g_ntf_count = 0;
+    for (uint32_t i = 0; i < raised; i++)
+    {
+        fake_clock_advance_us(ALERT_DEBOUNCE_US);
+        alert_raise_from_isr(ALERT_TYPE_SOS);
+    }
+    alert_send_pending();
+    CHECK_EQ(g_ntf_count, ALERT_QUEUE_LEN);
+    for (uint32_t i = 0; i < ALERT_QUEUE_LEN; i++)
+    {
+        uint32_t seq = 3 + raised - ALERT_QUEUE_LEN + i + 1;
+        expect_alert(i, seq, (ALERT_QUEUE_LEN - 1 - i) * ALERT_DEBOUNCE_US);
+    }
+}
+
+// 未连接时发送失败，记录被取走，不会在重连后补发过期告警
+static void test_disconnected(const sle_addr_t *addr)
+{
+    g_ntf_count = 0;
+    fake_sle_disconnect(1, addr);
+    fake_clock_advance_us(ALERT_DEBOUNCE_US);
+    alert_raise_from_isr(ALERT_TYPE_SOS);
+    alert_send_pending();
+    CHECK_EQ(g_ntf_count, 0);
+    CHECK_EQ(g_alert_count, 0);
+}
+
+int main(void)
+{
+    static const sle_addr_t addr = {0, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06}};
+    fake_sdk_reset();
+    fake_sle_reset();
+    fake_ssaps_set_notify_hook(record_notify);
+    // 初始化前的中断直接忽略
+    alert_raise_from_isr(ALERT_TYPE_SOS);
+    CHECK_EQ(g_alert_count, 0);
+
+    CHECK_EQ(sle_uart_server_init(NULL, NULL), ERRCODE_SLE_SUCCESS);
+    CHECK_EQ(sle_uart_server_batch_init(SLE_UART_BATCH_WINDOW_MS_DEFAULT), ERRCODE_SLE_SUCCESS);
+    alert_init();
+    fake_sle_connect(1, &addr);
+    fake_sle_pair_complete(1, &addr);
+    fake_clock_advance_us(1000000);
+
+    test_latency_stamp();
+    test_debounce();
+    test_ahead_of_telemetry();
+    test_overflow_keeps_newest();
+    test_disconnected(&addr);
+
+    CHECK_EQ(fake_irq_depth(), 0);
+    CHECK_EQ(fake_heap_live(), 0);
+    return host_test_done("test_exboard_alert");
+}
@@ -0,0 +1,33 @@
+/* ExBoard SSD1363：开机画面经帧缓冲写入面板模型，重建的灰度画面与 golden 比对 */
+#include <string.h>
+#include "bmp.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "ssd1363.h"
+#include "ssd1363_model.h"
+
+static ssd1363_model_t g_oled;
+
+int main(void)
+{
+    fake_sdk_reset();
+    ssd1363_model_attach(&g_oled);
+    OLED_Init();
+    OLED_FB_DrawSingleBMP(0, 0, OLED_WIDTH, OLED_HEIGHT, ExBoard_pic, 0);
+    OLED_FB_Flush();
+    CHECK_EQ(g_oled.errors, 0);
+    CHECK_EQ(g_oled.ram_bytes, OLED_WIDTH / 2 * OLED_HEIGHT);
+
+    host_image_t *img = ssd1363_model_image(&g_oled);
+    CHECK_EQ(image_check_golden(img, "exboard_splash.pgm"), 0);
+    image_free(img);
+
+    // 帧缓冲与屏上一致时再次 Flush 不产生传输
+    uint32_t transfers = g_oled.transfers;
+    OLED_FB_DrawSingleBMP(0, 0, OLED_WIDTH, OLED_HEIGHT, ExBoard_pic, 0);
+    OLED_FB_Flush();
+    CHECK_EQ(g_oled.transfers, transfers);
+
+    ssd1363_model_detach();
+    return host_test_done("test_exboard_render");
+}
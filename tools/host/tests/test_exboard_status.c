@@ -0,0 +1,83 @@
+/*
+ * ExBoard 状态行刷新：开机画面整屏 Flush 之后，用 oled_show_status 按真实格式画几组读数，
+ * 每次只把变化的字符所在区域写到屏上。逐次核对面板模型的显存与帧缓冲一致、I2C 字节数不超过脏区窗口的上限，
+ * 并与整屏 Flush 的字节数对比
+ */
+#include "ExBoard_sample.c"
+#include "sle_uart_server.c"
+#include "alert.c"
+#include "ssd1363.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "ssd1363_model.h"
+
+// 窗口命令两次传输（6、8 字节负载），每 OLED_TX_CHUNK 字节数据一次 0x40 传输；每次传输另计地址字节
+#define WINDOW_BYTES ((6 + 1) + (8 + 1))
+#define FLUSH_OVERHEAD (WINDOW_BYTES + 1 + 1)
+#define FULL_FRAME (OLED_WIDTH / 2 * OLED_HEIGHT)
+
+static ssd1363_model_t g_oled;
+
+static void check_panel(void)
+{
+    for (uint32_t y = 0; y < OLED_HEIGHT; y++)
+    {
+        if (memcmp(g_oled.gddram[y][SSD1363_MODEL_COL_OFFSET], g_oled_fb[y], sizeof(g_oled_fb[y])) != 0)
+        {
+            fprintf(stderr, "row %u on the panel differs from the framebuffer\n", y);
+            CHECK(0);
+            return;
+        }
+    }
+    CHECK_EQ(g_oled.errors, 0);
+}
+
+// 画一组读数，返回这次刷新的 I2C 总线字节数
+static uint32_t show(double t, double h, uint16_t lx)
+{
+    temperature = t;
+    humidity = h;
+    light = lx;
+    uint32_t bytes = g_oled.bus_bytes;
+    oled_show_status();
+    check_panel();
+    return g_oled.bus_bytes - bytes;
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    ssd1363_model_attach(&g_oled);
+    OLED_Init();
+
+    // 开机：整屏
+    uint32_t bytes = g_oled.bus_bytes;
+    OLED_FB_DrawSingleBMP(0, 0, OLED_WIDTH, OLED_HEIGHT, ExBoard_pic, 0);
+    OLED_FB_Flush();
+    check_panel();
+    uint32_t full = g_oled.bus_bytes - bytes;
+    CHECK_EQ(full, FULL_FRAME + WINDOW_BYTES + FULL_FRAME / OLED_TX_CHUNK * (1 + 1));
+
+    // 一个字符 8x16，占 2 个列地址、16 行；整行 21 个字符
+    uint32_t char_max = 2 * 2 * OLED_STATUS_SIZE + FLUSH_OVERHEAD;
+    uint32_t line_max = 21 * OLED_STATUS_SIZE / 2 / 2 * OLED_STATUS_SIZE + FLUSH_OVERHEAD;
+
+    uint32_t first = show(23.5, 41.2, 320);
+    CHECK(first > char_max && first <= line_max);
+    uint32_t digit = show(23.6, 41.2, 320); // 温度末位
+    CHECK(digit > FLUSH_OVERHEAD && digit <= char_max);
+    uint32_t transfers = g_oled.transfers;
+    CHECK_EQ(show(23.6, 41.2, 320), 0); // 读数没变
+    CHECK_EQ(g_oled.transfers, transfers);
+    uint32_t light_only = show(23.6, 41.2, 1250); // 光照 3 位变 4 位
+    CHECK(light_only <= 4 * 2 * 2 * OLED_STATUS_SIZE + FLUSH_OVERHEAD);
+    uint32_t both_ends = show(24.1, 41.2, 1260); // 温度与光照同时变：脏区是两端之间的整段
+    CHECK(both_ends <= line_max);
+
+    printf("status line: first %u bytes, one digit %u, light only %u, temperature and light %u, unchanged 0; "
+           "full-frame flush %u bytes (%.0fx a one-digit update)\n",
+           first, digit, light_only, both_ends, full, (double)full / digit);
+
+    ssd1363_model_detach();
+    return host_test_done("test_exboard_status");
+}
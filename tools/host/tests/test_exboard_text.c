@@ -0,0 +1,112 @@
+/* ExBoard SSD1363：整串/整字一次传输写出的文字，面板显存必须与原来逐字节 OLED_WR_Byte 的写法一致 */
+#include <string.h>
+#include "ssd1363.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "ref_ssd1363_text.h"
+#include "ssd1363_model.h"
+
+static ssd1363_model_t g_oled;
+
+// 显存先铺上固定图案，未被写到的字节也参与比较
+static void prime(void)
+{
+    ssd1363_model_attach(&g_oled);
+    for (uint32_t r = 0; r < SSD1363_MODEL_ROWS; r++)
+    {
+        for (uint32_t c = 0; c < SSD1363_MODEL_COLS; c++)
+        {
+            g_oled.gddram[r][c][0] = (uint8_t)(r * 7 + c);
+            g_oled.gddram[r][c][1] = (uint8_t)(r + c * 3);
+        }
+    }
+}
+
+static uint8_t g_want[SSD1363_MODEL_ROWS][SSD1363_MODEL_COLS][2];
+
+static void take_reference(void)
+{
+    CHECK_EQ(g_oled.errors, 0);
+    memcpy(g_want, g_oled.gddram, sizeof(g_want));
+}
+
+static void compare(const char *what, uint8_t sizey, uint8_t mode)
+{
+    CHECK_EQ(g_oled.errors, 0);
+    if (memcmp(g_want, g_oled.gddram, sizeof(g_want)) != 0)
+    {
+        fprintf(stderr, "%s size %u mode %u differs\n", what, sizey, mode);
+        CHECK(0);
+    }
+}
+
+int main(void)
+{
+    static const uint8_t sizes[] = {16, 24, 32};
+    static const uint8_t xs[] = {0, 4, 6, 120, 200};
+    fake_sdk_reset();
+
+    for (uint32_t s = 0; s < sizeof(sizes); s++)
+    {
+        uint8_t sizey = sizes[s];
+        for (uint8_t mode = 0; mode < 2; mode++)
+        {
+            // 全部可显示字符，位置在行列上错开
+            for (uint8_t ch = ' '; ch <= '~'; ch++)
+            {
+                uint8_t x = xs[ch % 5];
+                uint8_t y = (uint8_t)((ch * 5) % (SSD1363_MODEL_ROWS - sizey + 1));
+                prime();
+                ref_show_char(x, y, ch, sizey, mode);
+                take_reference();
+                prime();
+                OLED_ShowChar(x, y, ch, sizey, mode);
+                compare("char", sizey, mode);
+            }
+
+            // 整串：在屏内放得下的部分
+            uint8_t len = (uint8_t)(256 / (sizey / 2) - 1);
+            uint8_t str[64];
+            for (uint8_t i = 0; i < len; i++)
+            {
+                str[i] = (uint8_t)(' ' + (i * 7 + sizey) % 95);
+            }
+            str[len] = '\0';
+            prime();
+            ref_show_string(4, 9, str, sizey, mode);
+            take_reference();
+            prime();
+            uint32_t transfers = g_oled.transfers;
+            OLED_ShowString(4, 9, str, sizey, mode);
+            compare("string", sizey, mode);
+            // 列地址、行地址各一次，显存数据一次
+            CHECK_EQ(g_oled.transfers - transfers, 3);
+
+            // 中文字形
+            const unsigned char *msk = (sizey == 16) ? tfont16[0].Msk : (sizey == 24) ? tfont24[0].Msk : tfont32[0].Msk;
+            uint8_t zh[3] = {0};
+            memcpy(zh, (sizey == 16) ? tfont16[0].Index : (sizey == 24) ? tfont24[0].Index : tfont32[0].Index, 2);
+            prime();
+            ref_show_chinese(8, 40, msk, sizey, mode);
+            take_reference();
+            prime();
+            OLED_ShowChinese(8, 40, zh, sizey, mode);
+            compare("chinese", sizey, mode);
+        }
+    }
+
+    // 超出右边界的字符不再写出（原来的写法会在列地址上回绕），放得下的前缀与逐字写出的结果相同
+    uint8_t longstr[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    uint8_t fit[sizeof(longstr)];
+    memcpy(fit, longstr, sizeof(longstr));
+    fit[(256 - 16) / 8] = '\0';
+    prime();
+    ref_show_string(16, 0, fit, 16, 0);
+    take_reference();
+    prime();
+    OLED_ShowString(16, 0, longstr, 16, 0);
+    compare("clipped string", 16, 0);
+
+    ssd1363_model_detach();
+    return host_test_done("test_exboard_text");
+}
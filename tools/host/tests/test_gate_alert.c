@@ -0,0 +1,149 @@
+/* 网关告警：断线时 SLE 回调只入队不重连，由守护线程重连后按序补发，队满保留最新的 */
+#include <stdio.h>
+#include <string.h>
+#include "gateService.c"
+#include "fake_agent.h"
+#include "fake_mqtt.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+
+#define CONN_E 1
+
+static void send_alert(int caution)
+{
+    char msg[64];
+    int n = snprintf(msg, sizeof(msg), "[{\"topic\":\"CautionStatus\",\"caution\":%d,\"ex_us\":5}]", caution);
+    ssapc_handle_value_t value = {0};
+    value.data = (uint8_t *)msg;
+    value.data_len = (uint16_t)n;
+    sle_uart_notification_cb(0, CONN_E, &value, ERRCODE_SUCC);
+}
+
+static int pub_caution(uint32_t i)
+{
+    const fake_mqtt_pub_t *pub = fake_mqtt_pub(i);
+    int caution = -1;
+    if (pub == NULL || strcmp(pub->topic, "CautionStatus") != 0 || pub->qos != MQTT_ALERT_QOS ||
+        strstr(pub->payload, "\"gw_us\":") == NULL || sscanf(pub->payload, "{\"topic\":\"CautionStatus\",\"caution\":%d",
+                                                              &caution) != 1)
+    {
+        return -1;
+    }
+    return caution;
+}
+
+// 补发线程取出报文、尚未发出时，SLE 回调送来新的告警
+static int g_race_caution = -1;
+
+static void alert_during_flush(const char *topic)
+{
+    (void)topic;
+    fake_mqtt_set_publish_hook(NULL);
+    send_alert(g_race_caution);
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    fake_agent_reset();
+    fake_mqtt_reset();
+    set_conn_id('E', CONN_E);
+    CHECK_EQ(MqttInit(), 0);
+    CHECK_EQ(fake_mqtt_connects(), 1);
+
+    // 在线时直接发布，去掉外层 [] 并带上 gw_us
+    send_alert(1);
+    CHECK_EQ(fake_mqtt_published(), 1);
+    CHECK_EQ(pub_caution(0), 1);
+
+    // broker 掉线：SLE 回调不连接、不睡眠，只入队并唤醒守护线程
+    fake_mqtt_set_broker(0);
+    uint64_t t0 = fake_clock_us();
+    send_alert(2);
+    send_alert(3);
+    CHECK_EQ(fake_clock_us(), t0);
+    CHECK_EQ(fake_mqtt_connects(), 1);
+    CHECK_EQ(fake_mqtt_published(), 1);
+    CHECK_EQ(g_mqtt_pending_count, 2);
+    CHECK(g_mqtt_event_sem.count > 0);
+
+    // 重连仍然失败：守护线程重试后积压保留
+    mqtt_supervise_once();
+    CHECK(fake_mqtt_connects() > 1);
+    CHECK_EQ(g_mqtt_pending_count, 2);
+
+    // broker 恢复：下一轮重连、恢复订阅并按入队顺序补发
+    CHECK_EQ(MqttRegisterHandler("Control/#", process_control_payload, NULL), 0);
+    osal_mutex_lock(&g_sub_table_mutex);
+    CHECK_EQ(topic_trie_set_subscribed(&g_sub_table, "Control/#", MQTT_QOS), 0);
+    osal_mutex_unlock(&g_sub_table_mutex);
+    fake_mqtt_set_broker(1);
+    mqtt_supervise_once();
+    CHECK_EQ(fake_mqtt_subscribes(), 1);
+    CHECK_EQ(g_mqtt_pending_count, 0);
+    CHECK_EQ(fake_mqtt_published(), 3);
+    CHECK_EQ(pub_caution(1), 2);
+    CHECK_EQ(pub_caution(2), 3);
+
+    // 积压期间到达的新告警排在积压之后
+    fake_mqtt_set_broker(0);
+    send_alert(4);
+    fake_mqtt_set_broker(1);
+    CHECK_EQ(MQTTClient_connect(g_mqtt_client, NULL), MQTTCLIENT_SUCCESS);
+    send_alert(5);
+    CHECK_EQ(fake_mqtt_published(), 3);
+    mqtt_supervise_once();
+    CHECK_EQ(fake_mqtt_published(), 5);
+    CHECK_EQ(pub_caution(3), 4);
+    CHECK_EQ(pub_caution(4), 5);
+
+    // 队满丢弃最旧的，保留最新的 MQTT_PENDING_MAX 条
+    fake_mqtt_set_broker(0);
+    for (int i = 0; i < MQTT_PENDING_MAX + 3; i++)
+    {
+        send_alert(100 + i);
+    }
+    CHECK_EQ(g_mqtt_pending_count, MQTT_PENDING_MAX);
+    fake_mqtt_set_broker(1);
+    mqtt_supervise_once();
+    CHECK_EQ(fake_mqtt_published(), 5 + MQTT_PENDING_MAX);
+    CHECK_EQ(pub_caution(5), 103);
+    CHECK_EQ(pub_caution(4 + MQTT_PENDING_MAX), 100 + MQTT_PENDING_MAX + 2);
+
+    // 补发途中再次掉线：未发出的放回队首，顺序不变
+    fake_mqtt_set_broker(0);
+    send_alert(200);
+    send_alert(201);
+    fake_mqtt_set_broker(1);
+    CHECK_EQ(MQTTClient_connect(g_mqtt_client, NULL), MQTTCLIENT_SUCCESS);
+    fake_mqtt_set_broker(0);
+    mqtt_pending_flush();
+    CHECK_EQ(g_mqtt_pending_count, 2);
+    fake_mqtt_set_broker(1);
+    mqtt_supervise_once();
+    CHECK_EQ(pub_caution(5 + MQTT_PENDING_MAX), 200);
+    CHECK_EQ(pub_caution(6 + MQTT_PENDING_MAX), 201);
+
+    // 补发途中积压已被取空，新告警仍排在正在补发的那条之后
+    fake_mqtt_set_broker(0);
+    send_alert(300);
+    fake_mqtt_set_broker(1);
+    CHECK_EQ(MQTTClient_connect(g_mqtt_client, NULL), MQTTCLIENT_SUCCESS);
+    g_race_caution = 301;
+    fake_mqtt_set_publish_hook(alert_during_flush);
+    mqtt_supervise_once();
+    CHECK_EQ(g_mqtt_pending_count, 0);
+    CHECK_EQ(pub_caution(7 + MQTT_PENDING_MAX), 300);
+    CHECK_EQ(pub_caution(8 + MQTT_PENDING_MAX), 301);
+    // 补发结束后恢复直接发布
+    send_alert(302);
+    CHECK_EQ(g_mqtt_pending_count, 0);
+    CHECK_EQ(pub_caution(9 + MQTT_PENDING_MAX), 302);
+
+    // QoS 0 的遥测断线时直接丢弃，不入队
+    fake_mqtt_set_broker(0);
+    CHECK_EQ(MqttPublishQos("devices/Temp", "{}", 2, MQTT_QOS), MQTTCLIENT_DISCONNECTED);
+    CHECK_EQ(g_mqtt_pending_count, 0);
+
+    return host_test_done("test_gate_alert");
+}
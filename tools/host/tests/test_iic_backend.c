@@ -0,0 +1,455 @@
+/*
+ * ExBoard I2C 总线的两种后端对照：同一段操作（AHT20、BH1750 初始化与读数，SSD1363 初始化、整屏 OLED_DrawSingleBMP、
+ * 帧缓冲字符串刷新）分别走硬件控制器（IIC_USE_HW 1，经 fake_i2c_set_hooks 截获）和 GPIO 模拟时序（IIC_USE_HW 0，
+ * 由假从机逐个时钟解码 SDA/SCL 还原成事务）。两边的事务序列必须逐字节相同，回放进 ssd1363_model 后显存与绘制内容一致；
+ * 另外输出整屏绘制的事务数、总线字节数和模拟时序的 GPIO 写次数
+ */
+#include <math.h>
+#include <string.h>
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "ssd1363_model.h"
+
+// 第一份 my_iic.c 是硬件控制器后端：外部符号和会与第二份重名的静态变量都加 hw_ 前缀
+#define iic_delay hw_iic_delay
+#define SDA_read_mode hw_SDA_read_mode
+#define SDA_send_mode hw_SDA_send_mode
+#define iic_init hw_iic_init
+#define iic_start hw_iic_start
+#define iic_stop hw_iic_stop
+#define iic_wait_ack hw_iic_wait_ack
+#define iic_ack hw_iic_ack
+#define iic_nak hw_iic_nak
+#define iic_send_byte hw_iic_send_byte
+#define iic_read_byte hw_iic_read_byte
+#define iic_bus_init hw_iic_bus_init
+#define iic_bus_write hw_iic_bus_write
+#define iic_bus_read hw_iic_bus_read
+#define g_iic_mutex hw_g_iic_mutex
+#define g_iic_ready hw_g_iic_ready
+#include "my_iic.c"
+#undef iic_delay
+#undef SDA_read_mode
+#undef SDA_send_mode
+#undef iic_init
+#undef iic_start
+#undef iic_stop
+#undef iic_wait_ack
+#undef iic_ack
+#undef iic_nak
+#undef iic_send_byte
+#undef iic_read_byte
+#undef iic_bus_init
+#undef iic_bus_write
+#undef iic_bus_read
+#undef g_iic_mutex
+#undef g_iic_ready
+
+// 第二份是模拟时序后端，只有总线接口改名
+#undef IIC_USE_HW
+#define IIC_USE_HW 0
+#define iic_bus_init soft_iic_bus_init
+#define iic_bus_write soft_iic_bus_write
+#define iic_bus_read soft_iic_bus_read
+#include "my_iic.c"
+#undef iic_bus_init
+#undef iic_bus_write
+#undef iic_bus_read
+
+// 驱动调用的总线接口转到当前选中的后端
+static uint8_t g_soft = 0;
+
+void iic_bus_init(void)
+{
+    if (g_soft)
+    {
+        soft_iic_bus_init();
+    }
+    else
+    {
+        hw_iic_bus_init();
+    }
+}
+
+uint8_t iic_bus_write(uint8_t addr, const uint8_t *data, uint32_t len)
+{
+    return g_soft ? soft_iic_bus_write(addr, data, len) : hw_iic_bus_write(addr, data, len);
+}
+
+uint8_t iic_bus_read(uint8_t addr, uint8_t *data, uint32_t len)
+{
+    return g_soft ? soft_iic_bus_read(addr, data, len) : hw_iic_bus_read(addr, data, len);
+}
+
+#include "aht20.c"
+#include "bh1750.c"
+#include "ssd1363.c"
+
+#define LOG_XFERS 128
+#define LOG_BYTES (48 * 1024)
+
+typedef struct
+{
+    uint8_t addr;
+    uint8_t read;
+    uint32_t off;
+    uint32_t len;
+} xfer_t;
+
+// 一个后端的全部事务，读事务记录从机送出的数据
+typedef struct
+{
+    xfer_t xfers[LOG_XFERS];
+    uint32_t n;
+    uint8_t bytes[LOG_BYTES];
+    uint32_t used;
+} bus_log_t;
+
+static bus_log_t g_log[2]; // [0] 硬件控制器，[1] 模拟时序
+static bus_log_t *g_cur = NULL;
+
+static void log_xfer(uint8_t addr, uint8_t read, const uint8_t *buf, uint32_t len)
+{
+    if (g_cur->n >= LOG_XFERS || g_cur->used + len > LOG_BYTES)
+    {
+        CHECK(0);
+        return;
+    }
+    g_cur->xfers[g_cur->n++] = (xfer_t){addr, read, g_cur->used, len};
+    memcpy(&g_cur->bytes[g_cur->used], buf, len);
+    g_cur->used += len;
+}
+
+// 总线字节数：每个事务另加一个地址字节
+static uint32_t log_bus_bytes(const bus_log_t *log, uint32_t from, uint32_t to)
+{
+    uint32_t bytes = 0;
+    for (uint32_t i = from; i < to; i++)
+    {
+        bytes += log->xfers[i].len + 1;
+    }
+    return bytes;
+}
+
+// 传感器的读数：AHT20 湿度 50%、温度 30℃（状态字节 bit7 为 0 表示空闲），BH1750 计数 300 即 250 lx
+static const uint8_t g_aht20_sample[6] = {0x1C, 0x08, 0x00, 0x06, 0x66, 0x66};
+static const uint8_t g_bh1750_sample[2] = {0x01, 0x2C};
+
+static uint8_t device_present(uint8_t addr)
+{
+    return addr == AHT20_ADDRESS || addr == BH1750_ADDRESS || addr == OLED_ADDRESS;
+}
+
+static void device_read(uint8_t addr, uint8_t *buf, uint32_t len)
+{
+    const uint8_t *src = (addr == AHT20_ADDRESS) ? g_aht20_sample : g_bh1750_sample;
+    uint32_t n = (addr == AHT20_ADDRESS) ? sizeof(g_aht20_sample) : sizeof(g_bh1750_sample);
+    memset(buf, 0xFF, len);
+    memcpy(buf, src, (n < len) ? n : len);
+}
+
+static errcode_t hw_write(i2c_bus_t bus, uint16_t addr, const uint8_t *buf, uint32_t len)
+{
+    CHECK_EQ(bus, IIC_BUS_ID);
+    log_xfer((uint8_t)addr, 0, buf, len);
+    return ERRCODE_SUCC;
+}
+
+static errcode_t hw_read(i2c_bus_t bus, uint16_t addr, uint8_t *buf, uint32_t len)
+{
+    CHECK_EQ(bus, IIC_BUS_ID);
+    device_read((uint8_t)addr, buf, len);
+    log_xfer((uint8_t)addr, 1, buf, len);
+    return ERRCODE_SUCC;
+}
+
+/*
+ * 模拟时序的假从机：SCL 为高时 SDA 下降为起始、上升为停止；SCL 上升沿采样，第 9 个时钟是应答位。
+ * 从机自己驱动 SDA 用 fake_gpio_set_input（不经过回调）：应答在第 9 个时钟的上升沿拉低
+ * （iic_wait_ack 在 SCL 为低时先把 SDA 置高），读数据在 SCL 下降沿送出下一位
+ */
+typedef struct
+{
+    gpio_level_t scl;
+    gpio_level_t sda;
+    uint8_t active;    // 起始之后、停止之前
+    uint8_t have_addr; // 地址字节已收到
+    uint8_t addr;
+    uint8_t read;
+    uint8_t bit;     // 当前字节已过的时钟数，9 表示应答位已过、等待下降沿
+    uint8_t shift;   // 收到或正在送出的字节
+    uint8_t sending; // 读事务中从机正在送出字节
+    uint8_t buf[OLED_TX_CHUNK + 16];
+    uint32_t len; // 写事务收到的数据字节数，读事务已送出的字节数
+} soft_slave_t;
+
+static soft_slave_t g_slave;
+
+static void slave_drive(gpio_level_t level)
+{
+    g_slave.sda = level;
+    fake_gpio_set_input(SDA_PIN, level);
+}
+
+static void slave_start(soft_slave_t *s)
+{
+    s->active = 1;
+    s->have_addr = 0;
+    s->bit = 0;
+    s->sending = 0;
+    s->len = 0;
+}
+
+static void slave_stop(soft_slave_t *s)
+{
+    if (s->active && s->have_addr)
+    {
+        log_xfer(s->addr, s->read, s->buf, s->len);
+    }
+    s->active = 0;
+}
+
+static void slave_rise(soft_slave_t *s)
+{
+    if (s->bit < 8)
+    {
+        if (!(s->have_addr && s->read))
+        {
+            s->shift = (uint8_t)((s->shift << 1) | (s->sda == GPIO_LEVEL_HIGH));
+        }
+        s->bit++;
+        return;
+    }
+    if (s->bit != 8)
+    {
+        return;
+    }
+    s->bit = 9;
+    if (s->have_addr && s->read)
+    {
+        // 主机对读出字节的应答，低电平表示还要下一个字节
+        s->len++;
+        s->sending = (s->sda == GPIO_LEVEL_LOW);
+        return;
+    }
+    if (!s->have_addr)
+    {
+        s->addr = s->shift >> 1;
+        s->read = s->shift & 0x01;
+        s->have_addr = 1;
+        if (!device_present(s->addr))
+        {
+            return; // 不应答
+        }
+        if (s->read)
+        {
+            device_read(s->addr, s->buf, sizeof(s->buf));
+            s->sending = 1;
+        }
+    }
+    else if (s->len < sizeof(s->buf))
+    {
+        s->buf[s->len++] = s->shift;
+    }
+    slave_drive(GPIO_LEVEL_LOW);
+}
+
+static void slave_fall(soft_slave_t *s)
+{
+    if (s->have_addr && s->read && s->sending && (s->bit == 9 || s->bit < 8))
+    {
+        if (s->bit == 9)
+        {
+            s->bit = 0;
+            s->shift = s->buf[s->len];
+        }
+        slave_drive(((s->shift >> (7 - s->bit)) & 0x01) ? GPIO_LEVEL_HIGH : GPIO_LEVEL_LOW);
+        return;
+    }
+    if (s->bit >= 8)
+    {
+        // 放开 SDA：写事务的应答位结束，或读出第 8 位后轮到主机应答
+        slave_drive(GPIO_LEVEL_HIGH);
+        s->bit = (s->bit == 9) ? 0 : s->bit;
+    }
+}
+
+static void slave_gpio(pin_t pin, gpio_level_t level)
+{
+    soft_slave_t *s = &g_slave;
+    if (pin == SDA_PIN)
+    {
+        gpio_level_t old = s->sda;
+        s->sda = level;
+        if (s->scl == GPIO_LEVEL_HIGH && old != level)
+        {
+            if (level == GPIO_LEVEL_LOW)
+            {
+                slave_start(s);
+            }
+            else
+            {
+                slave_stop(s);
+            }
+        }
+        return;
+    }
+    if (pin != SCL_PIN || level == s->scl)
+    {
+        return;
+    }
+    s->scl = level;
+    if (!s->active)
+    {
+        return;
+    }
+    if (level == GPIO_LEVEL_HIGH)
+    {
+        slave_rise(s);
+    }
+    else
+    {
+        slave_fall(s);
+    }
+}
+
+// 整屏 1bpp 图案，每行 32 字节
+static uint8_t g_bmp[OLED_HEIGHT * OLED_WIDTH / 8];
+static const char g_status[] = "T:24.6C H:51% L:320";
+
+typedef struct
+{
+    uint32_t draw_from; // 整屏绘制的事务区间
+    uint32_t draw_to;
+    uint32_t draw_gpio_writes;
+} run_stats_t;
+
+static void run(uint8_t soft, run_stats_t *st)
+{
+    fake_sdk_reset();
+    g_soft = soft;
+    g_cur = &g_log[soft];
+    memset(g_cur, 0, sizeof(*g_cur));
+    if (soft)
+    {
+        memset(&g_slave, 0, sizeof(g_slave)); // 复位后两根线都为低
+        fake_gpio_set_hook(slave_gpio);
+    }
+    else
+    {
+        fake_i2c_set_hooks(hw_write, hw_read);
+    }
+    // 帧缓冲回到上电状态：内容全 0，整屏为脏区
+    memset(g_oled_fb, 0, sizeof(g_oled_fb));
+    g_fb_y0 = 0;
+    g_fb_y1 = OLED_HEIGHT - 1;
+    g_fb_c0 = 0;
+    g_fb_c1 = OLED_WIDTH / 4 - 1;
+
+    AHT20_Init();
+    BH1750_Init();
+    OLED_Init();
+
+    double temperature = 0;
+    double humidity = 0;
+    CHECK_EQ(AHT20_ReadData(&temperature, &humidity), 0);
+    CHECK(fabs(temperature - 30.0) < 0.01);
+    CHECK(fabs(humidity - 50.0) < 0.01);
+    CHECK_EQ(BH1750_ReadLight(), 250);
+
+    st->draw_from = g_cur->n;
+    uint32_t gpio_writes = fake_gpio_writes();
+    OLED_DrawSingleBMP(0, 0, OLED_WIDTH, OLED_HEIGHT, g_bmp, 0);
+    st->draw_to = g_cur->n;
+    st->draw_gpio_writes = fake_gpio_writes() - gpio_writes;
+
+    OLED_FB_ShowString(8, 40, (const uint8_t *)g_status, 24, 0);
+    OLED_FB_Flush();
+    fake_gpio_set_hook(NULL);
+    fake_i2c_set_hooks(NULL, NULL);
+}
+
+static void check_same_logs(void)
+{
+    const bus_log_t *hw = &g_log[0];
+    const bus_log_t *soft = &g_log[1];
+    CHECK_EQ(soft->n, hw->n);
+    for (uint32_t i = 0; i < hw->n && i < soft->n; i++)
+    {
+        const xfer_t *a = &hw->xfers[i];
+        const xfer_t *b = &soft->xfers[i];
+        if (a->addr != b->addr || a->read != b->read || a->len != b->len ||
+            memcmp(&hw->bytes[a->off], &soft->bytes[b->off], a->len) != 0)
+        {
+            fprintf(stderr, "transaction %u: hw 0x%02X %s %u bytes, bit-bang 0x%02X %s %u bytes\n", i, a->addr,
+                    a->read ? "read" : "write", a->len, b->addr, b->read ? "read" : "write", b->len);
+            CHECK(0);
+            return;
+        }
+    }
+}
+
+static void replay(const bus_log_t *log, uint32_t from, uint32_t to)
+{
+    for (uint32_t i = from; i < to; i++)
+    {
+        const xfer_t *x = &log->xfers[i];
+        if (!x->read && x->addr == OLED_ADDRESS)
+        {
+            i2c_data_t msg = {0};
+            msg.send_buf = (uint8_t *)&log->bytes[x->off];
+            msg.send_len = x->len;
+            uapi_i2c_master_write(IIC_BUS_ID, x->addr, &msg);
+        }
+    }
+}
+
+// 回放到面板模型：整屏图与帧缓冲都按原样进了显存
+static void check_panel(const bus_log_t *log, const run_stats_t *st)
+{
+    static ssd1363_model_t m;
+    ssd1363_model_attach(&m);
+    replay(log, 0, st->draw_to);
+    for (uint32_t y = 0; y < OLED_HEIGHT; y++)
+    {
+        for (uint32_t i = 0; i < OLED_WIDTH / 8; i++)
+        {
+            uint8_t b = g_bmp[y * (OLED_WIDTH / 8) + i];
+            const uint8_t *got = m.gddram[y][SSD1363_MODEL_COL_OFFSET + i * 2];
+            CHECK(memcmp(got, g_nibble_gray[b & 0x0F], 2) == 0);
+            CHECK(memcmp(got + 2, g_nibble_gray[b >> 4], 2) == 0);
+        }
+    }
+    replay(log, st->draw_to, log->n);
+    for (uint32_t y = 0; y < OLED_HEIGHT; y++)
+    {
+        CHECK(memcmp(m.gddram[y][SSD1363_MODEL_COL_OFFSET], g_oled_fb[y], sizeof(g_oled_fb[y])) == 0);
+    }
+    CHECK_EQ(m.errors, 0);
+    ssd1363_model_detach();
+}
+
+int main(void)
+{
+    for (uint32_t i = 0; i < sizeof(g_bmp); i++)
+    {
+        g_bmp[i] = (uint8_t)(i * 37 + (i >> 5));
+    }
+
+    run_stats_t hw;
+    run_stats_t soft;
+    run(0, &hw);
+    run(1, &soft);
+    check_same_logs();
+    check_panel(&g_log[1], &soft);
+
+    // 整屏 16KB 显存数据按 OLED_TX_CHUNK 分块，另加列、行窗口各一次
+    uint32_t xfers = hw.draw_to - hw.draw_from;
+    CHECK_EQ(xfers, 2 + OLED_WIDTH * OLED_HEIGHT / 2 / OLED_TX_CHUNK);
+    uint32_t bytes = log_bus_bytes(&g_log[0], hw.draw_from, hw.draw_to);
+    printf("full-screen OLED_DrawSingleBMP: %u transactions, %u bus bytes, %.1f ms at %u Hz; "
+           "bit-bang fallback: %u GPIO writes\n",
+           xfers, bytes, bytes * 9 * 1000.0 / IIC_BAUDRATE, IIC_BAUDRATE, soft.draw_gpio_writes);
+    printf("%u transactions in the whole run (hardware), %u (bit-bang)\n", g_log[0].n, g_log[1].n);
+    return host_test_done("test_iic_backend");
+}
@@ -0,0 +1,116 @@
+/* agent_module OLED 差分流：skip/literal/fill 记录的解码、截断流的处理，以及循环动画首尾相接 */
+#include <string.h>
+#include "oledService.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "ssd1306_model.h"
+
+#define FRAME_BYTES (SSD1306_MODEL_W * SSD1306_MODEL_PAGES)
+
+static ssd1306_model_t g_oled;
+
+static void screen(uint8_t out[FRAME_BYTES])
+{
+    ssd1306_UpdateScreen();
+    ssd1306_model_copy(&g_oled, out);
+}
+
+static void expect_unchanged_after(const uint8_t *delta, uint32_t len)
+{
+    uint8_t before[FRAME_BYTES];
+    uint8_t after[FRAME_BYTES];
+    screen(before);
+    ssd1306_ApplyDelta(delta, len);
+    screen(after);
+    CHECK(memcmp(before, after, FRAME_BYTES) == 0);
+}
+
+// 一个动画从关键帧开始依次套用 1..count-1 号差分，再套用 0 号差分应回到关键帧
+static void check_loop(const OledAnim *anim)
+{
+    uint8_t key[FRAME_BYTES];
+    uint8_t got[FRAME_BYTES];
+    ssd1306_Fill(Black);
+    ssd1306_ApplyDelta(anim->key, anim->key_len);
+    screen(key);
+    for (uint32_t i = 1; i < anim->count; i++)
+    {
+        ssd1306_ApplyDelta(&anim->delta[anim->offsets[i]], anim->offsets[i + 1] - anim->offsets[i]);
+    }
+    ssd1306_ApplyDelta(&anim->delta[anim->offsets[0]], anim->offsets[1] - anim->offsets[0]);
+    screen(got);
+    CHECK(memcmp(key, got, FRAME_BYTES) == 0);
+    CHECK_EQ(anim->offsets[anim->count], (anim == &g_eye_anim) ? sizeof(g_oled_eye_delta)
+                                                                 : sizeof(g_oled_audio_delta));
+}
+
+int main(void)
+{
+    uint8_t got[FRAME_BYTES];
+    uint8_t expect[FRAME_BYTES];
+    fake_sdk_reset();
+    ssd1306_model_attach(&g_oled);
+    ssd1306_Init();
+
+    // 原样 3 字节，跳过 2，填充 4 个 0x5A，跳过 128+119 到第三页开头再原样 1 字节
+    ssd1306_Fill(Black);
+    const uint8_t stream[] = {0x02, 0x11, 0x22, 0x33, 0x81, 0x43, 0x5A, 0xFF, 0xF6, 0x00, 0xEE};
+    ssd1306_ApplyDelta(stream, sizeof(stream));
+    screen(got);
+    memset(expect, 0, sizeof(expect));
+    memcpy(expect, "\x11\x22\x33\x00\x00\x5A\x5A\x5A\x5A", 9);
+    expect[SSD1306_MODEL_W * 2] = 0xEE;
+    CHECK(memcmp(expect, got, FRAME_BYTES) == 0);
+
+    // 最长的记录：128 字节跳过、64 字节填充、64 字节原样
+    uint8_t lit[1 + 64];
+    lit[0] = 0x3F;
+    for (int i = 0; i < 64; i++)
+    {
+        lit[1 + i] = (uint8_t)(i + 1);
+    }
+    const uint8_t fill_skip[] = {0xFF, 0x7F, 0xA5};
+    ssd1306_Fill(Black);
+    ssd1306_ApplyDelta(fill_skip, sizeof(fill_skip));
+    ssd1306_ApplyDelta(lit, sizeof(lit));
+    screen(got);
+    memset(expect, 0, sizeof(expect));
+    for (int i = 0; i < 64; i++)
+    {
+        expect[i] = (uint8_t)(i + 1);
+        expect[SSD1306_MODEL_W + i] = 0xA5;
+    }
+    CHECK(memcmp(expect, got, FRAME_BYTES) == 0);
+
+    // 截断的流：原样记录缺数据、填充记录缺取值时不写入，也不越过 len 读取
+    const uint8_t short_lit[] = {0x03, 0x11, 0x22};
+    expect_unchanged_after(short_lit, sizeof(short_lit));
+    const uint8_t short_fill[] = {0x45};
+    expect_unchanged_after(short_fill, sizeof(short_fill));
+
+    // 跳过到缓冲区末尾后的记录被忽略
+    uint8_t tail[8 + 2];
+    for (int i = 0; i < 8; i++)
+    {
+        tail[i] = 0xFF; // 8 x 128 = 1024
+    }
+    tail[8] = 0x00;
+    tail[9] = 0xAB;
+    expect_unchanged_after(tail, 10);
+
+    // 最后一字节可写，写满后的记录被忽略
+    ssd1306_Fill(Black);
+    const uint8_t edge[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x77, 0x00, 0x99};
+    ssd1306_ApplyDelta(edge, sizeof(edge));
+    screen(got);
+    memset(expect, 0, sizeof(expect));
+    expect[FRAME_BYTES - 1] = 0x77;
+    CHECK(memcmp(expect, got, FRAME_BYTES) == 0);
+
+    check_loop(&g_eye_anim);
+    check_loop(&g_audio_anim);
+    CHECK_EQ(g_oled.errors, 0);
+
+    ssd1306_model_detach();
+    return host_test_done("test_oled_delta");
+}
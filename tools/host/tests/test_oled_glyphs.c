@@ -0,0 +1,122 @@
+/* agent_module SSD1306：预栅格化字形按列写入的结果必须与原来逐像素 DrawPixel 的画法逐字节一致 */
+#include <string.h>
+#include "my_ssd1306.h"
+#include "my_ssd1306_fonts.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "ref_ssd1306_glyphs.h"
+#include "ssd1306_model.h"
+
+#define FRAME_BYTES (SSD1306_MODEL_W * SSD1306_MODEL_PAGES)
+
+static ssd1306_model_t g_oled;
+
+static const FontDef *const g_fonts[] = {&Font_6x8, &Font_7x10, &Font_11x18, &Font_16x26};
+static const char *const g_font_names[] = {"6x8", "7x10", "11x18", "16x26"};
+
+static void snapshot(uint8_t *out)
+{
+    ssd1306_UpdateScreen();
+    ssd1306_model_copy(&g_oled, out);
+}
+
+// 背景先铺成条纹，确保字形以外的像素也被比较到
+static void clear_screen(void)
+{
+    ssd1306_Fill(Black);
+    for (uint8_t x = 0; x < SSD1306_WIDTH; x += 3)
+    {
+        ssd1306_DrawPixel(x, (uint8_t)(x % SSD1306_HEIGHT), White);
+    }
+}
+
+static void check_char(const FontDef *font, const char *name, char ch, uint8_t x, uint8_t y, SSD1306_COLOR color)
+{
+    static uint8_t want[FRAME_BYTES];
+    static uint8_t got[FRAME_BYTES];
+
+    clear_screen();
+    uint8_t rx = x;
+    char ref_ret = ref_draw_char(&rx, y, ch, font, color);
+    // 紧接着再画一个字符，顺带核对光标前进的距离
+    char ref_next = ref_draw_char(&rx, y, 'A', font, color);
+    snapshot(want);
+
+    clear_screen();
+    ssd1306_SetCursor(x, y);
+    char ret = ssd1306_DrawChar(ch, *font, color);
+    char next = ssd1306_DrawChar('A', *font, color);
+    snapshot(got);
+
+    if (ret != ref_ret || next != ref_next || memcmp(want, got, FRAME_BYTES) != 0)
+    {
+        fprintf(stderr, "font %s char 0x%02X at (%u,%u) color %d differs\n", name, (unsigned char)ch, x, y, color);
+        CHECK(0);
+    }
+}
+
+static void check_string(const FontDef *font, const char *name, const char *str, uint8_t x, uint8_t y,
+                         SSD1306_COLOR color)
+{
+    static uint8_t want[FRAME_BYTES];
+    static uint8_t got[FRAME_BYTES];
+
+    clear_screen();
+    char ref_ret = ref_draw_string(x, y, str, font, color);
+    snapshot(want);
+
+    clear_screen();
+    ssd1306_SetCursor(x, y);
+    char ret = ssd1306_DrawString((char *)str, *font, color);
+    snapshot(got);
+
+    if (ret != ref_ret || memcmp(want, got, FRAME_BYTES) != 0)
+    {
+        fprintf(stderr, "font %s string \"%s\" at (%u,%u) color %d differs (ret 0x%02X, want 0x%02X)\n", name, str, x,
+                y, color, (unsigned char)ret, (unsigned char)ref_ret);
+        CHECK(0);
+    }
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    ssd1306_model_attach(&g_oled);
+    ssd1306_Init();
+
+    static const uint8_t xs[] = {0, 1, 37, 64};
+    static const uint8_t ys[] = {0, 3, 8, 13, 30};
+    for (uint32_t f = 0; f < sizeof(g_fonts) / sizeof(g_fonts[0]); f++)
+    {
+        const FontDef *font = g_fonts[f];
+        for (int ch = 32; ch <= 126; ch++)
+        {
+            for (uint32_t c = 0; c < 2; c++)
+            {
+                SSD1306_COLOR color = c ? Black : White;
+                check_char(font, g_font_names[f], (char)ch, xs[ch % 4], ys[ch % 5], color);
+            }
+        }
+        // 贴着右下角、超出右边界、超出下边界、字库范围以外的字符
+        uint8_t right = (uint8_t)(SSD1306_WIDTH - font->FontWidth);
+        uint8_t bottom = (uint8_t)(SSD1306_HEIGHT - font->FontHeight);
+        check_char(font, g_font_names[f], 'W', right, bottom, White);
+        check_char(font, g_font_names[f], 'W', right + 1, 0, White);
+        check_char(font, g_font_names[f], 'W', 0, bottom + 1, White);
+        check_char(font, g_font_names[f], '\x1F', 0, 0, White);
+        check_char(font, g_font_names[f], '\x7F', 0, 0, Black);
+
+        // 整串：写得下、写到一半没有空间、中途遇到非法字符、光标已在右边界上
+        check_string(font, g_font_names[f], "Hi!", 2, 5, White);
+        check_string(font, g_font_names[f], "The quick brown fox jumps over the lazy dog", 3, 11, White);
+        check_string(font, g_font_names[f], "The quick brown fox jumps over the lazy dog", 0, bottom, Black);
+        check_string(font, g_font_names[f], "ab\x01" "cd", 9, 7, White);
+        check_string(font, g_font_names[f], "xyz", SSD1306_WIDTH, 0, White);
+        check_string(font, g_font_names[f], "xyz", 0, bottom + 1, White);
+        check_string(font, g_font_names[f], "", 0, 0, White);
+    }
+
+    CHECK_EQ(g_oled.errors, 0);
+    ssd1306_model_detach();
+    return host_test_done("test_oled_glyphs");
+}
@@ -0,0 +1,100 @@
+/* agent_module OLED：逐帧播放预编码动画，面板模型中的 GDDRAM 必须与原始帧一致，整串帧与 golden 比对 */
+#include <string.h>
+#include "oledService.c"
+#include "fake_sdk.h"
+#include "fake_sound.h"
+#include "host_test.h"
+#include "ssd1306_model.h"
+#include "frame_1.h"
+#include "frame_2.h"
+#include "frame_3.h"
+#include "frame_audio_1.h"
+#include "frame_audio_2.h"
+#include "frame_audio_3.h"
+#include "frame_audio_4.h"
+#include "frame_audio_5.h"
+#include "frame_audio_6.h"
+#include "frame_audio_7.h"
+#include "frame_audio_8.h"
+#include "frame_audio_9.h"
+#include "frame_audio_10.h"
+#include "frame_audio_11.h"
+#include "frame_audio_12.h"
+#include "frame_audio_13.h"
+#include "frame_audio_14.h"
+
+#define FRAME_BYTES (SSD1306_MODEL_W * SSD1306_MODEL_PAGES)
+
+static ssd1306_model_t g_oled;
+
+static const unsigned char *const g_eye_frames[] = {gImage_frame_1, gImage_frame_2, gImage_frame_3, gImage_frame_2};
+static const unsigned char *const g_audio_frames[] = {
+    gImage_frame_audio_1,  gImage_frame_audio_2,  gImage_frame_audio_3,  gImage_frame_audio_4,  gImage_frame_audio_5,
+    gImage_frame_audio_6,  gImage_frame_audio_7,  gImage_frame_audio_8,  gImage_frame_audio_9,  gImage_frame_audio_10,
+    gImage_frame_audio_11, gImage_frame_audio_12, gImage_frame_audio_13, gImage_frame_audio_14};
+
+// 行优先、MSB 在左的原始帧转换为页格式，与 tools/gen_oled_frames.py 的 to_page_major 相同
+static void frame_to_pages(const unsigned char *rows, uint8_t *out)
+{
+    memset(out, 0, FRAME_BYTES);
+    for (uint32_t y = 0; y < SSD1306_MODEL_PAGES * 8; y++)
+    {
+        for (uint32_t x = 0; x < SSD1306_MODEL_W; x++)
+        {
+            if (rows[y * SSD1306_MODEL_W / 8 + x / 8] & (0x80 >> (x % 8)))
+            {
+                out[x + (y / 8) * SSD1306_MODEL_W] |= 1 << (y % 8);
+            }
+        }
+    }
+}
+
+// 依次显示 anim 的每一帧，与原始帧比对，并把画面竖着拼成一张图
+static host_image_t *play_anim(const OledAnim *anim, const unsigned char *const *frames)
+{
+    uint32_t h = SSD1306_MODEL_PAGES * 8;
+    host_image_t *strip = image_new(SSD1306_MODEL_W, (uint16_t)(h * anim->count), 1);
+    uint8_t expect[FRAME_BYTES];
+    uint8_t got[FRAME_BYTES];
+    for (uint32_t i = 0; i < anim->count; i++)
+    {
+        ShowFrame(anim, i);
+        frame_to_pages(frames[i], expect);
+        ssd1306_model_copy(&g_oled, got);
+        CHECK(memcmp(expect, got, FRAME_BYTES) == 0);
+
+        host_image_t *img = ssd1306_model_image(&g_oled);
+        memcpy(&strip->pixels[i * h * SSD1306_MODEL_W], img->pixels, h * SSD1306_MODEL_W);
+        image_free(img);
+    }
+    return strip;
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    ssd1306_model_attach(&g_oled);
+    ssd1306_Init();
+    CHECK(g_oled.display_on);
+    CHECK(g_oled.inverse);
+
+    host_image_t *eye = play_anim(&g_eye_anim, g_eye_frames);
+    host_image_t *audio = play_anim(&g_audio_anim, g_audio_frames);
+    CHECK_EQ(image_check_golden(eye, "oled_eye.pbm"), 0);
+    CHECK_EQ(image_check_golden(audio, "oled_audio.pbm"), 0);
+    image_free(eye);
+    image_free(audio);
+
+    // 从动画中间跳帧和回到眼睛动画都要从关键帧重建
+    uint8_t expect[FRAME_BYTES];
+    uint8_t got[FRAME_BYTES];
+    ShowFrame(&g_audio_anim, 9);
+    ShowFrame(&g_eye_anim, 2);
+    frame_to_pages(gImage_frame_3, expect);
+    ssd1306_model_copy(&g_oled, got);
+    CHECK(memcmp(expect, got, FRAME_BYTES) == 0);
+    CHECK_EQ(g_oled.errors, 0);
+
+    ssd1306_model_detach();
+    return host_test_done("test_oled_render");
+}
@@ -0,0 +1,82 @@
+/* agent_module OLED 录音模式的帧节奏：刷新耗时从休眠中扣除，预置动画和音量表都保持 100 ms 一帧 */
+#include "oledService.c"
+#include "fake_sdk.h"
+#include "fake_sound.h"
+#include "host_test.h"
+
+// 原先固定休眠 100 ms（AUDIO_FRAME_DELAY_MS）时的播放速度，录音动画不应变快
+#define EXPECT_FRAME_MS 100
+
+static uint32_t g_bus_us_per_byte = 0;
+static uint32_t g_bus_bytes = 0;
+
+// 按设定的每字节耗时推进假时钟，模拟 I2C 传输占用的时间
+static errcode_t slow_i2c(i2c_bus_t bus, uint16_t addr, const uint8_t *buf, uint32_t len)
+{
+    (void)bus;
+    (void)addr;
+    (void)buf;
+    g_bus_bytes += len + 1;
+    fake_clock_advance_us((uint64_t)(len + 1) * g_bus_us_per_byte);
+    return ERRCODE_SUCC;
+}
+
+// 跑一帧并按返回值休眠，返回这一帧从开始到下一帧开始的微秒数
+static uint64_t run_frame(void)
+{
+    uint64_t t0 = fake_clock_us();
+    osal_msleep(OledAudioFrame());
+    return fake_clock_us() - t0;
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    fake_i2c_set_hooks(slow_i2c, NULL);
+    ssd1306_Init();
+    fake_clock_advance_us(1000 * 1000);
+    g_last_level_seq = sound_recorder_get_level(NULL);
+
+    // 400 kHz 下每字节约 23 us：关键帧整屏刷新也只占周期的一部分，帧间隔仍为 100 ms
+    g_bus_us_per_byte = 23;
+    uint64_t start = fake_clock_us();
+    uint32_t frames = g_audio_anim.count * 2;
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        g_bus_bytes = 0;
+        uint64_t period = run_frame();
+        CHECK(g_bus_bytes > 0);
+        CHECK(period >= (EXPECT_FRAME_MS - 1) * 1000 && period <= (EXPECT_FRAME_MS + 1) * 1000);
+    }
+    uint64_t total = fake_clock_us() - start;
+    CHECK(total >= (uint64_t)frames * (EXPECT_FRAME_MS - 1) * 1000);
+    CHECK(total <= (uint64_t)frames * (EXPECT_FRAME_MS + 1) * 1000);
+    CHECK_EQ(g_audio_idx, 0);
+
+    // 刷新超过一个周期时只让出 1 ms，不再额外等待
+    g_bus_us_per_byte = 300;
+    ssd1306_InvalidateScreen();
+    uint64_t t0 = fake_clock_us();
+    uint32_t sleep_ms = OledAudioFrame();
+    CHECK(fake_clock_us() - t0 > EXPECT_FRAME_MS * 1000);
+    CHECK_EQ(sleep_ms, 1);
+
+    // 有新电平时切到音量表，节奏不变
+    g_bus_us_per_byte = 23;
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        fake_sound_push_level((uint16_t)(1000 * i), (uint16_t)(1500 * i));
+        uint64_t period = run_frame();
+        CHECK(g_vu_active);
+        CHECK(period >= (EXPECT_FRAME_MS - 1) * 1000 && period <= (EXPECT_FRAME_MS + 1) * 1000);
+    }
+
+    // 电平停止超过 VU_LEVEL_TIMEOUT_MS 后回到预置动画
+    for (uint32_t i = 0; i * AUDIO_FRAME_PERIOD_MS <= VU_LEVEL_TIMEOUT_MS; i++)
+    {
+        run_frame();
+    }
+    CHECK(!g_vu_active);
+
+    return host_test_done("test_oled_timing");
+}
@@ -0,0 +1,124 @@
+/* agent_module OLED 音量表：增量改写的画面与按 (bar, peak) 从头画的画面一致，峰值按固定速度回落 */
+#include <string.h>
+#include "oledService.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "ssd1306_model.h"
+
+#define FRAME_BYTES (SSD1306_MODEL_W * SSD1306_MODEL_PAGES)
+
+static ssd1306_model_t g_oled;
+
+static void set_px(uint8_t *fb, uint32_t x, uint32_t y)
+{
+    fb[x + (y / 8) * SSD1306_MODEL_W] |= (uint8_t)(1 << (y % 8));
+}
+
+static void vu_reference(uint8_t bar, uint8_t peak, uint8_t *fb)
+{
+    memset(fb, 0, FRAME_BYTES);
+    for (uint32_t x = 0; x < SSD1306_MODEL_W; x++)
+    {
+        for (uint32_t y = 0; y < SSD1306_MODEL_PAGES * 8; y++)
+        {
+            bool tick = (x % VU_SCALE_STEP == 0) && y >= VU_SCALE_TOP && y <= VU_SCALE_BOTTOM;
+            bool in_bar = x < bar && y >= VU_BAR_TOP && y <= VU_BAR_BOTTOM;
+            bool in_peak = peak > 0 && x == (uint32_t)(peak - 1) && y >= VU_PEAK_TOP && y <= VU_PEAK_BOTTOM;
+            if (tick || in_bar || in_peak)
+            {
+                set_px(fb, x, y);
+            }
+        }
+    }
+}
+
+static uint32_t g_rand = 12345;
+
+static uint16_t next_level(void)
+{
+    g_rand = g_rand * 1103515245u + 12345u;
+    uint32_t shift = (g_rand >> 28) & 0xF; // 让小电平也经常出现
+    return (uint16_t)(((g_rand >> 8) & 0x7FFF) >> shift);
+}
+
+int main(void)
+{
+    uint8_t expect[FRAME_BYTES];
+    uint8_t got[FRAME_BYTES];
+    fake_sdk_reset();
+    ssd1306_model_attach(&g_oled);
+    ssd1306_Init();
+
+    // 刻度：16 以下为 0，单调不减，满幅不超出屏宽
+    uint8_t prev = 0;
+    for (uint32_t level = 0; level <= 0x7FFF; level++)
+    {
+        uint8_t px = VuLevelToPx((uint16_t)level);
+        CHECK(px >= prev);
+        prev = px;
+    }
+    CHECK_EQ(VuLevelToPx(15), 0);
+    CHECK_EQ(VuLevelToPx(16), 0);
+    CHECK(VuLevelToPx(0x7FFF) > SSD1306_WIDTH - 8 && VuLevelToPx(0x7FFF) <= SSD1306_WIDTH);
+
+    VuBegin();
+    ssd1306_UpdateScreen();
+    ssd1306_model_copy(&g_oled, got);
+    vu_reference(0, 0, expect);
+    CHECK(memcmp(expect, got, FRAME_BYTES) == 0);
+
+    // 随机电平序列：每帧画面等于从头画的结果，峰值取当前峰值、回落后的旧峰值与 RMS 条的最大者
+    uint8_t peak = 0;
+    for (uint32_t i = 0; i < 2000; i++)
+    {
+        sound_level_t lv;
+        lv.rms = next_level();
+        lv.peak = (uint16_t)(lv.rms + next_level() / 2);
+        lv.peak = (lv.peak > 0x7FFF) ? 0x7FFF : lv.peak;
+        uint8_t bar = VuLevelToPx(lv.rms);
+        uint8_t held = (peak > VU_PEAK_DECAY_PX) ? (uint8_t)(peak - VU_PEAK_DECAY_PX) : 0;
+        uint8_t p = VuLevelToPx(lv.peak);
+        p = (p > held) ? p : held;
+        peak = (p > bar) ? p : bar;
+
+        if (VuRender(&lv))
+        {
+            ssd1306_UpdateScreen();
+        }
+        ssd1306_model_copy(&g_oled, got);
+        vu_reference(bar, peak, expect);
+        CHECK(memcmp(expect, got, FRAME_BYTES) == 0);
+        CHECK(g_vu_bar == bar && g_vu_peak == peak);
+    }
+
+    // 安静下来后峰值每帧回落 VU_PEAK_DECAY_PX，条立即归零
+    sound_level_t loud = {20000, 32000};
+    VuRender(&loud);
+    sound_level_t quiet = {0, 0};
+    uint8_t last = g_vu_peak;
+    VuRender(&quiet);
+    CHECK_EQ(g_vu_bar, 0);
+    CHECK_EQ(g_vu_peak, last - VU_PEAK_DECAY_PX);
+    while (g_vu_peak > 0)
+    {
+        VuRender(&quiet);
+    }
+    CHECK(!VuRender(&quiet));
+
+    // 条前进 1 像素只改动条所在几页的一两列
+    sound_level_t lv = {1000, 1000};
+    VuRender(&lv);
+    ssd1306_UpdateScreen();
+    uint32_t bytes = g_oled.data_bytes;
+    while (VuLevelToPx(lv.rms) == g_vu_bar)
+    {
+        lv.rms = lv.peak = (uint16_t)(lv.rms + 20);
+    }
+    VuRender(&lv);
+    ssd1306_UpdateScreen();
+    CHECK(g_oled.data_bytes - bytes <= 2 * SSD1306_MODEL_PAGES);
+    CHECK_EQ(g_oled.errors, 0);
+
+    ssd1306_model_detach();
+    return host_test_done("test_oled_vu");
+}
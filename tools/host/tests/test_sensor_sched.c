@@ -0,0 +1,265 @@
+/*
+ * ExBoard 传感器调度：假驱动记录每次触发、读取的时刻，按 BH_AHT_start 的循环在假时钟上推进 sensor_sched，
+ * 检查各自周期不漂移、转换等待不阻塞其它传感器、失败重试、改周期、落后不补测，以及样本环的读写
+ */
+#include <string.h>
+#include "sensor_sched.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "soc_osal.h"
+#include "tcxo.h"
+
+#define LOG_MAX 256
+
+typedef struct
+{
+    uint32_t triggers;
+    uint32_t reads;
+    uint64_t trigger_ms[LOG_MAX];
+    uint64_t read_ms[LOG_MAX];
+    uint8_t fail_trigger; // 非 0 时 trigger 返回失败
+    uint8_t fail_read;    // 非 0 时 read 返回失败
+} fake_sensor_t;
+
+static fake_sensor_t g_fake[SENSOR_MAX];
+
+static uint8_t fake_trigger(uint8_t id)
+{
+    fake_sensor_t *f = &g_fake[id];
+    if (f->triggers < LOG_MAX)
+    {
+        f->trigger_ms[f->triggers] = uapi_tcxo_get_ms();
+    }
+    f->triggers++;
+    CHECK_EQ(fake_irq_depth(), 0);
+    return f->fail_trigger;
+}
+
+// 读数为 id*1000 + 第几次读取，便于核对样本来源和顺序
+static uint8_t fake_read(uint8_t id, double value[SENSOR_VALUE_MAX])
+{
+    fake_sensor_t *f = &g_fake[id];
+    if (f->reads < LOG_MAX)
+    {
+        f->read_ms[f->reads] = uapi_tcxo_get_ms();
+    }
+    f->reads++;
+    CHECK_EQ(fake_irq_depth(), 0);
+    value[0] = id * 1000 + f->reads;
+    value[1] = -value[0];
+    return f->fail_read;
+}
+
+static uint8_t trigger0(void)
+{
+    return fake_trigger(0);
+}
+static uint8_t trigger1(void)
+{
+    return fake_trigger(1);
+}
+static uint8_t trigger3(void)
+{
+    return fake_trigger(3);
+}
+static uint8_t read0(double value[SENSOR_VALUE_MAX])
+{
+    return fake_read(0, value);
+}
+static uint8_t read1(double value[SENSOR_VALUE_MAX])
+{
+    return fake_read(1, value);
+}
+static uint8_t read2(double value[SENSOR_VALUE_MAX])
+{
+    return fake_read(2, value);
+}
+static uint8_t read3(double value[SENSOR_VALUE_MAX])
+{
+    return fake_read(3, value);
+}
+
+// 前三项与 ExBoard_sample.c 的驱动表相同（AHT20、BH1750、空气 ADC），第四项周期不同且转换时间长
+static const sensor_driver_t g_drivers[SENSOR_MAX] = {
+    {2000, 80, trigger0, read0},
+    {2000, 120, trigger1, read1},
+    {2000, 0, NULL, read2},
+    {700, 300, trigger3, read3},
+};
+
+static uint32_t g_cursor = 0;
+static uint32_t g_wakeups = 0;
+static uint32_t g_samples = 0;
+static sensor_sample_t g_last[SENSOR_MAX];
+
+static void start(uint8_t count)
+{
+    fake_sdk_reset();
+    fake_clock_advance_us(12345 * 1000ULL);
+    memset(g_fake, 0, sizeof(g_fake));
+    memset(g_last, 0, sizeof(g_last));
+    g_wakeups = 0;
+    g_samples = 0;
+    // 样本环不随调度重新初始化，读者从当前位置开始
+    sensor_sample_t s;
+    while (sensor_ring_read(&g_cursor, &s))
+    {
+    }
+    sensor_sched_init(g_drivers, count, uapi_tcxo_get_ms());
+}
+
+// 样本按时间顺序到达，来源与数值对得上
+static void drain(void)
+{
+    sensor_sample_t s;
+    while (sensor_ring_read(&g_cursor, &s))
+    {
+        CHECK(s.id < SENSOR_MAX);
+        if (s.id >= SENSOR_MAX)
+        {
+            continue;
+        }
+        CHECK(s.t_ms >= g_last[s.id].t_ms);
+        CHECK(s.value[0] > g_last[s.id].value[0]);
+        CHECK_EQ((uint32_t)s.value[0] / 1000, s.id);
+        CHECK(s.value[1] == -s.value[0]);
+        g_last[s.id] = s;
+        g_samples++;
+    }
+}
+
+// 与 BH_AHT_start 相同的循环：推进状态机、读出新样本、睡到下一个事件；
+// 睡眠不越过 end_ms，测试在该时刻插入的调用就像发生在任务里一样
+static void run_until(uint64_t end_ms)
+{
+    while (uapi_tcxo_get_ms() < end_ms)
+    {
+        uint64_t now = uapi_tcxo_get_ms();
+        uint32_t wait = sensor_sched_step(now);
+        CHECK(wait <= SENSOR_SCHED_IDLE_MS);
+        drain();
+        g_wakeups++;
+        wait = wait ? wait : 1;
+        osal_msleep((now + wait > end_ms) ? (uint32_t)(end_ms - now) : wait);
+    }
+}
+
+static void check_schedule(uint8_t id, uint64_t t0, uint32_t period, uint32_t wait, uint32_t n)
+{
+    const fake_sensor_t *f = &g_fake[id];
+    CHECK(f->reads >= n);
+    for (uint32_t i = 0; i < n && i < LOG_MAX; i++)
+    {
+        uint64_t want = t0 + (uint64_t)i * period;
+        if (g_drivers[id].trigger != NULL && f->trigger_ms[i] != want)
+        {
+            fprintf(stderr, "sensor %u trigger %u at %llu, want %llu\n", id, i, (unsigned long long)f->trigger_ms[i],
+                    (unsigned long long)want);
+            CHECK(0);
+            return;
+        }
+        if (f->read_ms[i] != want + wait)
+        {
+            fprintf(stderr, "sensor %u read %u at %llu, want %llu\n", id, i, (unsigned long long)f->read_ms[i],
+                    (unsigned long long)(want + wait));
+            CHECK(0);
+            return;
+        }
+    }
+}
+
+int main(void)
+{
+    // 各传感器在初始化时刻一起开始，此后严格按各自周期触发，转换完成的那一毫秒读取，互不阻塞；
+    // 任务只在事件时刻醒来
+    start(SENSOR_MAX);
+    uint64_t t0 = uapi_tcxo_get_ms();
+    run_until(t0 + 60000);
+    check_schedule(0, t0, 2000, 80, 30);
+    check_schedule(1, t0, 2000, 120, 30);
+    check_schedule(2, t0, 2000, 0, 30);
+    check_schedule(3, t0, 700, 300, 85);
+    CHECK_EQ(g_samples, g_fake[0].reads + g_fake[1].reads + g_fake[2].reads + g_fake[3].reads);
+    CHECK(g_wakeups <= 30 * 3 + 86 * 2 + 60);
+    CHECK_EQ(fake_irq_depth(), 0);
+
+    // 触发失败：不读取，下一个周期再试；读取失败：不产生样本，仍按周期继续
+    start(2);
+    t0 = uapi_tcxo_get_ms();
+    g_fake[0].fail_trigger = 1;
+    g_fake[1].fail_read = 1;
+    run_until(t0 + 10000);
+    CHECK_EQ(g_fake[0].reads, 0);
+    CHECK_EQ(g_fake[0].triggers, 5);
+    CHECK_EQ(g_fake[0].trigger_ms[4], t0 + 8000);
+    CHECK_EQ(g_fake[1].reads, 5);
+    CHECK_EQ(g_samples, 0);
+    g_fake[0].fail_trigger = 0;
+    g_fake[1].fail_read = 0;
+    run_until(t0 + 11000);
+    CHECK_EQ(g_fake[0].reads, 1);
+    CHECK_EQ(g_fake[0].read_ms[0], t0 + 10080);
+    CHECK_EQ(g_samples, 2);
+
+    // 缩短周期：空闲中的传感器提前到 now + 新周期；正在转换的不受影响，读完后按新周期排
+    start(2);
+    t0 = uapi_tcxo_get_ms();
+    run_until(t0 + 500);
+    sensor_sched_set_period(0, 1000, uapi_tcxo_get_ms());
+    run_until(t0 + 4100);
+    CHECK_EQ(g_fake[0].trigger_ms[1], t0 + 1500);
+    CHECK_EQ(g_fake[0].trigger_ms[2], t0 + 2500);
+    CHECK_EQ(g_fake[0].trigger_ms[3], t0 + 3500);
+    CHECK_EQ(g_fake[1].trigger_ms[1], t0 + 2000);
+    run_until(t0 + 4050);
+    sensor_sched_set_period(1, 500, uapi_tcxo_get_ms());
+    run_until(t0 + 5000);
+    CHECK_EQ(g_fake[1].trigger_ms[2], t0 + 4000);
+    CHECK_EQ(g_fake[1].read_ms[2], t0 + 4120);
+    CHECK_EQ(g_fake[1].trigger_ms[3], t0 + 4500);
+    // 恢复长周期：已排好的下一次触发不推迟
+    sensor_sched_set_period(0, 2000, uapi_tcxo_get_ms());
+    uint32_t n = g_fake[0].triggers;
+    run_until(t0 + 9000);
+    CHECK_EQ(g_fake[0].trigger_ms[n], t0 + 5500);
+    CHECK_EQ(g_fake[0].trigger_ms[n + 1], t0 + 7500);
+    // 不存在的传感器被忽略
+    sensor_sched_set_period(SENSOR_MAX, 10, uapi_tcxo_get_ms());
+
+    // 任务被耽误好几个周期：醒来后只测一次，再从读完的时刻按周期重新排，不连着补测
+    start(1);
+    t0 = uapi_tcxo_get_ms();
+    run_until(t0 + 100);
+    osal_msleep(7000);
+    run_until(t0 + 12000);
+    CHECK_EQ(g_fake[0].trigger_ms[1], t0 + 7100);
+    CHECK_EQ(g_fake[0].read_ms[1], t0 + 7180);
+    CHECK_EQ(g_fake[0].trigger_ms[2], t0 + 9180);
+    CHECK_EQ(g_fake[0].trigger_ms[3], t0 + 11180);
+
+    // 读者落后超过环长时跳过被覆盖的样本，读到的是最近的 SENSOR_RING_LEN 个
+    start(SENSOR_MAX);
+    t0 = uapi_tcxo_get_ms();
+    uint32_t slow = g_cursor;
+    run_until(t0 + 20000);
+    sensor_sample_t s;
+    uint32_t got = 0;
+    sensor_sample_t first = {0};
+    while (sensor_ring_read(&slow, &s))
+    {
+        if (got == 0)
+        {
+            first = s;
+        }
+        got++;
+    }
+    CHECK_EQ(got, SENSOR_RING_LEN);
+    CHECK_EQ(slow, g_cursor);
+    CHECK(g_samples > 2 * SENSOR_RING_LEN);
+    // 每 2 秒约 6 个样本，环里最早的样本也在最后 6 秒内
+    CHECK(first.t_ms + 6000 >= t0 + 20000);
+    CHECK_EQ(sensor_ring_read(&slow, &s), 0);
+    CHECK_EQ(fake_irq_depth(), 0);
+
+    return host_test_done("test_sensor_sched");
+}
@@ -0,0 +1,276 @@
+/*
+ * ExBoard 舵机：用假定时器驱动 pwm_ex.c 的边沿调度，从 GPIO 边沿的时刻量出每路脉宽和周期，
+ * 检查 0~180° 对应 500~2500us、20ms 周期、逐周期限速、各路互不影响，以及中断延迟下的误差
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "pwm_ex.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+
+#define CH 4
+#define MAX_PULSES 4096
+
+static const uint8_t g_pins[CH] = {3, 5, 9, 12};
+
+typedef struct
+{
+    uint64_t rise_us;
+    uint64_t fall_us;
+    uint8_t high;
+    uint32_t count;
+    uint32_t width[MAX_PULSES];
+    uint64_t rise[MAX_PULSES];
+    uint16_t target_us; // 测试最近一次设置的目标脉宽
+    uint16_t expect_us; // 按限速规则推出的本周期脉宽，0 表示还没有输出过
+    uint32_t bad;       // 脉宽超出允许误差的次数
+} servo_probe_t;
+
+static servo_probe_t g_probe[CH];
+static uint32_t g_max_latency_us = 0;
+
+static uint16_t angle_us(uint16_t angle)
+{
+    return (uint16_t)(PWM_SERVO_MIN_US + (uint32_t)angle * (PWM_SERVO_MAX_US - PWM_SERVO_MIN_US) / PWM_SERVO_MAX_ANGLE);
+}
+
+static int channel_of(pin_t pin)
+{
+    for (int i = 0; i < CH; i++)
+    {
+        if (g_pins[i] == pin)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 头文件描述的限速规则：首次直接到位，之后每周期最多变化 PWM_SERVO_SLEW_US
+static void expect_step(servo_probe_t *p)
+{
+    if (p->expect_us == 0 ||
+        (p->target_us <= p->expect_us + PWM_SERVO_SLEW_US && p->target_us + PWM_SERVO_SLEW_US >= p->expect_us))
+    {
+        p->expect_us = p->target_us;
+    }
+    else if (p->target_us > p->expect_us)
+    {
+        p->expect_us += PWM_SERVO_SLEW_US;
+    }
+    else
+    {
+        p->expect_us -= PWM_SERVO_SLEW_US;
+    }
+}
+
+static void on_gpio(pin_t pin, gpio_level_t level)
+{
+    int ch = channel_of(pin);
+    CHECK(ch >= 0);
+    if (ch < 0)
+    {
+        return;
+    }
+    servo_probe_t *p = &g_probe[ch];
+    uint64_t now = fake_clock_us();
+    if (level == GPIO_LEVEL_HIGH)
+    {
+        CHECK(!p->high);
+        p->high = 1;
+        p->rise_us = now;
+        expect_step(p);
+        return;
+    }
+    if (!p->high)
+    {
+        return; // PWM_ServoInit 的初始拉低
+    }
+    p->high = 0;
+    p->fall_us = now;
+    uint32_t width = (uint32_t)(now - p->rise_us);
+    // 下降沿最多推迟一个中断延迟；只有和同一次中断里更早的下降沿合并时才允许提前，且不超过合并窗口
+    uint8_t merged = 0;
+    for (int i = 0; i < CH; i++)
+    {
+        merged |= (i != ch && g_probe[i].fall_us == now && !g_probe[i].high && g_probe[i].count > 0);
+    }
+    uint32_t early = merged ? PWM_SERVO_MERGE_US : 0;
+    if (width + early < p->expect_us || width > p->expect_us + g_max_latency_us)
+    {
+        if (p->bad++ == 0)
+        {
+            fprintf(stderr, "ch %d pulse %u: %uus, expected %uus\n", ch, p->count, width, p->expect_us);
+        }
+    }
+    if (p->count < MAX_PULSES)
+    {
+        p->width[p->count] = width;
+        p->rise[p->count] = p->rise_us;
+    }
+    p->count++;
+}
+
+static void start(uint8_t count)
+{
+    fake_sdk_reset();
+    memset(g_probe, 0, sizeof(g_probe));
+    fake_gpio_set_hook(on_gpio);
+    PWM_ServoInit(g_pins, count);
+}
+
+static void set_angle(uint8_t ch, uint16_t angle)
+{
+    PWM_ServoSetAngle(ch, angle);
+    if (ch < CH)
+    {
+        g_probe[ch].target_us = angle_us(angle > PWM_SERVO_MAX_ANGLE ? PWM_SERVO_MAX_ANGLE : angle);
+    }
+}
+
+// 逐个中断推进：时钟走到定时器到期时刻再加上 0..max_latency 的随机延迟后进入回调
+static void run_us(uint64_t duration_us, uint32_t max_latency)
+{
+    uint64_t end = fake_clock_us() + duration_us;
+    g_max_latency_us = max_latency;
+    while (fake_timer_due_us() != FAKE_TIMER_IDLE && fake_timer_due_us() <= end)
+    {
+        uint64_t due = fake_timer_due_us();
+        uint32_t latency = max_latency ? (uint32_t)rand() % (max_latency + 1) : 0;
+        fake_clock_advance_us(due + latency - fake_clock_us());
+        fake_timer_fire();
+    }
+    CHECK(fake_timer_due_us() != FAKE_TIMER_IDLE);
+    if (end > fake_clock_us())
+    {
+        fake_clock_advance_us(end - fake_clock_us());
+    }
+}
+
+static void check_periods(const servo_probe_t *p, uint32_t from, uint32_t slack)
+{
+    for (uint32_t i = from + 1; i < p->count && i < MAX_PULSES; i++)
+    {
+        uint32_t period = (uint32_t)(p->rise[i] - p->rise[i - 1]);
+        if (period + slack < PWM_SERVO_PERIOD_US || period > PWM_SERVO_PERIOD_US + slack)
+        {
+            fprintf(stderr, "pulse %u: period %uus\n", i, period);
+            CHECK(0);
+            return;
+        }
+    }
+}
+
+int main(void)
+{
+    // 没有收到角度指令的通道不输出，定时器照常按周期运行
+    start(CH);
+    run_us(10 * PWM_SERVO_PERIOD_US, 0);
+    for (int ch = 0; ch < CH; ch++)
+    {
+        CHECK_EQ(g_probe[ch].count, 0);
+        CHECK_EQ(fake_gpio_level(g_pins[ch]), GPIO_LEVEL_LOW);
+    }
+
+    // 四路各自的角度：脉宽精确到微秒，周期 20ms；超出范围的角度按 180° 处理，不存在的通道被忽略
+    start(CH);
+    set_angle(0, 0);
+    set_angle(1, 45);
+    set_angle(2, 90);
+    set_angle(3, 250);
+    PWM_ServoSetAngle(CH, 30);
+    // 停在周期中间，没有正在输出的脉冲
+    run_us(50 * PWM_SERVO_PERIOD_US + PWM_SERVO_PERIOD_US / 2, 0);
+    static const uint32_t want[CH] = {500, 1000, 1500, 2500};
+    for (int ch = 0; ch < CH; ch++)
+    {
+        const servo_probe_t *p = &g_probe[ch];
+        CHECK(p->count >= 49);
+        CHECK_EQ(p->bad, 0);
+        for (uint32_t i = 0; i < p->count; i++)
+        {
+            CHECK_EQ(p->width[i], want[ch]);
+        }
+        CHECK_EQ(p->rise[0], PWM_SERVO_PERIOD_US);
+        check_periods(p, 0, 0);
+    }
+
+    // 一路改角度，其它各路脉宽不变；改动的那一路每周期最多走 PWM_SERVO_SLEW_US
+    uint32_t base[CH];
+    for (int ch = 0; ch < CH; ch++)
+    {
+        base[ch] = g_probe[ch].count;
+    }
+    set_angle(0, 180);
+    run_us(50 * PWM_SERVO_PERIOD_US, 0);
+    CHECK_EQ(g_probe[0].bad, 0);
+    uint32_t steps = (2000 + PWM_SERVO_SLEW_US - 1) / PWM_SERVO_SLEW_US;
+    for (uint32_t i = 0; i < steps; i++)
+    {
+        uint32_t w = 500 + (i + 1) * PWM_SERVO_SLEW_US;
+        CHECK_EQ(g_probe[0].width[base[0] + i], (w > 2500) ? 2500 : w);
+    }
+    CHECK_EQ(g_probe[0].width[g_probe[0].count - 1], 2500);
+    for (int ch = 1; ch < CH; ch++)
+    {
+        for (uint32_t i = base[ch]; i < g_probe[ch].count; i++)
+        {
+            CHECK_EQ(g_probe[ch].width[i], want[ch]);
+        }
+    }
+
+    // 只配置两路时，其余引脚不被碰到
+    start(2);
+    set_angle(0, 60);
+    set_angle(1, 120);
+    set_angle(2, 90);
+    run_us(20 * PWM_SERVO_PERIOD_US, 0);
+    CHECK(g_probe[0].count >= 19 && g_probe[1].count >= 19);
+    CHECK_EQ(g_probe[2].count, 0);
+    CHECK_EQ(g_probe[3].count, 0);
+
+    // 0~3us 随机中断延迟、随机改角度（含脉宽只差几微秒、需要合并的下降沿）：
+    // 脉宽误差在 [-合并窗口, +延迟] 内，周期误差不超过延迟
+    srand(43);
+    start(CH);
+    for (uint32_t round = 0; round < 1000; round++)
+    {
+        for (uint8_t ch = 0; ch < CH; ch++)
+        {
+            if (rand() % 3 == 0)
+            {
+                uint16_t angle = (rand() % 4 == 0) ? (uint16_t)(60 + ch) : (uint16_t)(rand() % 181);
+                set_angle(ch, angle);
+            }
+        }
+        run_us((uint64_t)(1 + rand() % 5) * PWM_SERVO_PERIOD_US + (uint64_t)(rand() % 1000), 3);
+    }
+    for (int ch = 0; ch < CH; ch++)
+    {
+        CHECK(g_probe[ch].count > 2000);
+        CHECK_EQ(g_probe[ch].bad, 0);
+        check_periods(&g_probe[ch], 0, 3);
+    }
+
+    // 中断被耽误超过一个周期时重新对齐：之后的周期从迟到的那一次起算，不连发补脉冲
+    start(CH);
+    set_angle(0, 90);
+    run_us(5 * PWM_SERVO_PERIOD_US + 100, 0);
+    uint32_t before = g_probe[0].count;
+    while (g_probe[0].count == before || g_probe[0].high)
+    {
+        fake_clock_advance_us(fake_timer_due_us() - fake_clock_us());
+        fake_timer_fire();
+    }
+    fake_clock_advance_us(fake_timer_due_us() + 45000 - fake_clock_us());
+    uint64_t late = fake_clock_us();
+    fake_timer_fire();
+    run_us(10 * PWM_SERVO_PERIOD_US, 0);
+    const servo_probe_t *p = &g_probe[0];
+    CHECK_EQ(p->rise[before + 1], late);
+    check_periods(p, before + 1, 0);
+    CHECK_EQ(p->bad, 0);
+
+    CHECK_EQ(fake_irq_depth(), 0);
+    return host_test_done("test_servo_pwm");
+}
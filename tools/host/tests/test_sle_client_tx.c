@@ -0,0 +1,248 @@
+/* 星闪客户端发送队列：信用数、发送顺序、队列满、写请求失败、断开释放与队列耗尽 */
+#include <string.h>
+#include "agent_module_main.h"
+#include "debugUtils.h"
+#include "fake_agent.h"
+#include "fake_sdk.h"
+#include "fake_sle.h"
+#include "host_test.h"
+#include "sle_uart_client.h"
+#include "soc_osal.h"
+
+#define WRITE_LOG_MAX 256
+#define CONN_P 1
+#define CONN_E 2
+
+typedef struct
+{
+    uint16_t conn_id;
+    uint32_t seq;
+} write_rec_t;
+
+static const sle_addr_t g_addr_p = {0, {0x02, 0x02, 0x03, 0x04, 0x05, 0x06}};
+static const sle_addr_t g_addr_e = {0, {0x03, 0x02, 0x03, 0x04, 0x05, 0x06}};
+static const sle_addr_t g_addr_other = {0, {0x09, 0x09, 0x09, 0x09, 0x09, 0x09}};
+
+static write_rec_t g_writes[WRITE_LOG_MAX];
+static uint32_t g_write_count = 0;
+static uint32_t g_fail_next = 0;
+
+static errcode_t record_write(uint8_t client_id, uint16_t conn_id, const ssapc_write_param_t *param)
+{
+    (void)client_id;
+    if (g_fail_next > 0)
+    {
+        g_fail_next--;
+        return ERRCODE_FAIL;
+    }
+    if (g_write_count < WRITE_LOG_MAX && param->data_len == sizeof(uint32_t))
+    {
+        g_writes[g_write_count].conn_id = conn_id;
+        memcpy(&g_writes[g_write_count].seq, param->data, sizeof(uint32_t));
+    }
+    g_write_count++;
+    return ERRCODE_SUCC;
+}
+
+static errcode_t send_seq(uint16_t conn_id, uint32_t seq)
+{
+    return sle_uart_client_send_data((const uint8_t *)&seq, sizeof(seq), 0, conn_id);
+}
+
+static sle_uart_tx_stats_t stats_of(uint16_t conn_id)
+{
+    sle_uart_tx_stats_t st = {0};
+    CHECK_EQ(sle_uart_client_get_tx_stats(conn_id, &st), ERRCODE_SUCC);
+    return st;
+}
+
+// 同一连接上写请求的 seq 必须严格递增
+static void check_order(uint16_t conn_id, uint32_t expect_count)
+{
+    uint32_t n = 0;
+    uint32_t last = 0;
+    for (uint32_t i = 0; i < g_write_count && i < WRITE_LOG_MAX; i++)
+    {
+        if (g_writes[i].conn_id != conn_id)
+        {
+            continue;
+        }
+        CHECK(n == 0 || g_writes[i].seq > last);
+        last = g_writes[i].seq;
+        n++;
+    }
+    CHECK_EQ(n, expect_count);
+}
+
+static void test_credits_and_order(void)
+{
+    g_write_count = 0;
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        CHECK_EQ(send_seq(CONN_P, i), ERRCODE_SUCC);
+    }
+    // 没有 write_cfm 时最多下发 SLE_UART_TX_CREDITS 条，其余留在队列中
+    CHECK_EQ(g_write_count, 4);
+    sle_uart_tx_stats_t st = stats_of(CONN_P);
+    CHECK_EQ(st.queued, 6);
+    CHECK_EQ(st.credits, 0);
+    CHECK_EQ(st.sent, 4);
+    CHECK_EQ(fake_heap_live(), 6);
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        fake_ssapc_write_cfm(0, CONN_P, ERRCODE_SUCC);
+    }
+    CHECK_EQ(g_write_count, 10);
+    check_order(CONN_P, 10);
+    st = stats_of(CONN_P);
+    CHECK_EQ(st.queued, 0);
+    CHECK_EQ(st.credits, 4);
+    CHECK_EQ(st.sent, 10);
+    CHECK_EQ(fake_heap_live(), 0);
+}
+
+static void test_queue_full(void)
+{
+    g_write_count = 0;
+    uint32_t dropped = stats_of(CONN_P).dropped;
+    for (uint32_t i = 0; i < 4 + 16; i++)
+    {
+        CHECK_EQ(send_seq(CONN_P, 100 + i), ERRCODE_SUCC);
+    }
+    CHECK_EQ(send_seq(CONN_P, 200), ERRCODE_FAIL);
+    CHECK_EQ(stats_of(CONN_P).dropped, dropped + 1);
+    CHECK_EQ(fake_heap_live(), 16);
+
+    for (uint32_t i = 0; i < 4 + 16; i++)
+    {
+        fake_ssapc_write_cfm(0, CONN_P, ERRCODE_SUCC);
+    }
+    CHECK_EQ(g_write_count, 20);
+    check_order(CONN_P, 20);
+    CHECK_EQ(fake_heap_live(), 0);
+}
+
+// 写请求失败：只记日志并计入 dropped，信用立即归还，后续数据照常下发
+static void test_write_failure(void)
+{
+    g_write_count = 0;
+    sle_uart_tx_stats_t before = stats_of(CONN_P);
+    uint32_t errors = fake_log_count(LOG_ERROR);
+    g_fail_next = 2;
+    for (uint32_t i = 0; i < 6; i++)
+    {
+        CHECK_EQ(send_seq(CONN_P, 300 + i), ERRCODE_SUCC);
+    }
+    CHECK_EQ(fake_log_count(LOG_ERROR), errors + 2);
+    CHECK_EQ(g_write_count, 4);
+    sle_uart_tx_stats_t st = stats_of(CONN_P);
+    CHECK_EQ(st.dropped, before.dropped + 2);
+    CHECK_EQ(st.sent, before.sent + 4);
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        fake_ssapc_write_cfm(0, CONN_P, ERRCODE_SUCC);
+    }
+    check_order(CONN_P, 4);
+    CHECK_EQ(g_writes[0].seq, 302);
+    CHECK_EQ(fake_heap_live(), 0);
+}
+
+static void test_two_peers(void)
+{
+    g_write_count = 0;
+    fake_sle_connect(CONN_E, &g_addr_e);
+    CHECK_EQ(get_conn_id('E'), CONN_E);
+    for (uint32_t i = 0; i < 12; i++)
+    {
+        CHECK_EQ(send_seq((i & 1) ? CONN_E : CONN_P, 400 + i), ERRCODE_SUCC);
+    }
+    // 两个连接的信用相互独立
+    CHECK_EQ(g_write_count, 8);
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        fake_ssapc_write_cfm(0, CONN_P, ERRCODE_SUCC);
+        fake_ssapc_write_cfm(0, CONN_E, ERRCODE_SUCC);
+    }
+    CHECK_EQ(g_write_count, 12);
+    check_order(CONN_P, 6);
+    check_order(CONN_E, 6);
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        fake_ssapc_write_cfm(0, CONN_P, ERRCODE_SUCC);
+        fake_ssapc_write_cfm(0, CONN_E, ERRCODE_SUCC);
+    }
+}
+
+// 断开时释放排队中的缓冲区，之后向该连接发送失败
+static void test_disconnect(void)
+{
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        CHECK_EQ(send_seq(CONN_E, 500 + i), ERRCODE_SUCC);
+    }
+    CHECK_EQ(fake_heap_live(), 6);
+    fake_sle_disconnect(CONN_E, &g_addr_e);
+    CHECK_EQ(fake_heap_live(), 0);
+    CHECK_EQ(get_conn_id('E'), 0xFFFF);
+    sle_uart_tx_stats_t st;
+    CHECK_EQ(sle_uart_client_get_tx_stats(CONN_E, &st), ERRCODE_FAIL);
+    CHECK_EQ(send_seq(CONN_E, 600), ERRCODE_FAIL);
+    CHECK_EQ(fake_heap_live(), 0);
+    // 断开后迟到的 write_cfm 不影响其它连接
+    fake_ssapc_write_cfm(0, CONN_E, ERRCODE_SUCC);
+    CHECK_EQ(stats_of(CONN_P).credits, 4);
+}
+
+// 所有队列被占用时新连接记错误日志，向它发送返回失败而不是静默丢弃
+static void test_no_free_queue(void)
+{
+    uint32_t errors = fake_log_count(LOG_ERROR);
+    for (uint16_t conn = 10; conn < 17; conn++)
+    {
+        fake_sle_connect(conn, &g_addr_other);
+    }
+    CHECK_EQ(fake_log_count(LOG_ERROR), errors);
+    fake_sle_connect(17, &g_addr_other);
+    CHECK_EQ(fake_log_count(LOG_ERROR), errors + 1);
+    CHECK_EQ(send_seq(17, 700), ERRCODE_FAIL);
+    CHECK_EQ(fake_heap_live(), 0);
+
+    // 释放一个后重新连接即可分到队列
+    fake_sle_disconnect(10, &g_addr_other);
+    fake_sle_connect(17, &g_addr_other);
+    CHECK_EQ(send_seq(17, 701), ERRCODE_SUCC);
+    fake_ssapc_write_cfm(0, 17, ERRCODE_SUCC);
+}
+
+static void test_owned(void)
+{
+    uint8_t *buf = osal_vmalloc(8);
+    memset(buf, 0x5A, 8);
+    CHECK_EQ(sle_uart_client_send_data_owned(buf, 8, 0, 0xFFFF), ERRCODE_FAIL);
+    CHECK_EQ(fake_heap_live(), 0);
+    buf = osal_vmalloc(8);
+    CHECK_EQ(sle_uart_client_send_data_owned(buf, 0, 0, CONN_P), ERRCODE_INVALID_PARAM);
+    CHECK_EQ(fake_heap_live(), 0);
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    fake_sle_reset();
+    fake_agent_reset();
+    fake_ssapc_set_write_hook(record_write);
+    sle_uart_client_init(NULL, NULL);
+    fake_sle_connect(CONN_P, &g_addr_p);
+    CHECK_EQ(get_conn_id('P'), CONN_P);
+
+    test_credits_and_order();
+    test_queue_full();
+    test_write_failure();
+    test_two_peers();
+    test_disconnect();
+    test_no_free_queue();
+    test_owned();
+    CHECK_EQ(fake_irq_depth(), 0);
+    return host_test_done("test_sle_client_tx");
+}
@@ -0,0 +1,156 @@
+/* ExBoard 星闪服务端 notify 合并：同 topic 覆盖、合并窗口、紧急优先、按 MTU 拆分与各类丢弃计数 */
+#include "sle_uart_server.c"
+#include <string.h>
+#include "fake_sdk.h"
+#include "fake_sle.h"
+#include "host_test.h"
+
+#define NTF_LOG_MAX 16
+
+static char g_ntf[NTF_LOG_MAX][SLE_UART_SERVER_NTF_MAX_SIZE + 1];
+static uint32_t g_ntf_count = 0;
+
+static errcode_t record_notify(uint16_t conn_id, const uint8_t *data, uint16_t len)
+{
+    (void)conn_id;
+    if (g_ntf_count < NTF_LOG_MAX && len <= SLE_UART_SERVER_NTF_MAX_SIZE)
+    {
+        memcpy(g_ntf[g_ntf_count], data, len);
+        g_ntf[g_ntf_count][len] = '\0';
+    }
+    g_ntf_count++;
+    return ERRCODE_SUCC;
+}
+
+static errcode_t put_str(const char *topic, const char *obj, bool urgent)
+{
+    return sle_uart_server_batch_put(topic, (const uint8_t *)obj, (uint16_t)strlen(obj), urgent);
+}
+
+static sle_uart_batch_stats_t stats(void)
+{
+    sle_uart_batch_stats_t st;
+    sle_uart_server_batch_get_stats(&st);
+    return st;
+}
+
+static void test_not_connected(void)
+{
+    CHECK_EQ(put_str("T", "{\"topic\":\"T\",\"v\":0}", false), ERRCODE_SLE_SUCCESS);
+    sle_uart_batch_wait_flush();
+    CHECK_EQ(g_ntf_count, 0);
+    CHECK_EQ(stats().dropped, 1);
+}
+
+static void test_coalesce_window(void)
+{
+    g_ntf_count = 0;
+    CHECK_EQ(put_str("T", "{\"topic\":\"T\",\"v\":1}", false), ERRCODE_SLE_SUCCESS);
+    CHECK_EQ(put_str("H", "{\"topic\":\"H\",\"v\":5}", false), ERRCODE_SLE_SUCCESS);
+    CHECK_EQ(put_str("T", "{\"topic\":\"T\",\"v\":2}", false), ERRCODE_SLE_SUCCESS);
+    CHECK_EQ(stats().coalesced, 1);
+
+    // 普通更新等满一个合并窗口后只发一条 notify，同 topic 只保留最新值
+    uint64_t t0 = fake_clock_us();
+    sle_uart_batch_wait_flush();
+    CHECK_EQ(fake_clock_us() - t0, SLE_UART_BATCH_WINDOW_MS_DEFAULT * 1000);
+    CHECK_EQ(g_ntf_count, 1);
+    CHECK(strcmp(g_ntf[0], "[{\"topic\":\"T\",\"v\":2},{\"topic\":\"H\",\"v\":5}]") == 0);
+    CHECK_EQ(stats().notifies, 1);
+    CHECK_EQ(stats().bytes, strlen(g_ntf[0]));
+
+    // 没有待发数据时不发送
+    sle_uart_batch_flush();
+    CHECK_EQ(g_ntf_count, 1);
+}
+
+static void test_urgent_first(void)
+{
+    g_ntf_count = 0;
+    CHECK_EQ(put_str("H", "{\"topic\":\"H\",\"v\":6}", false), ERRCODE_SLE_SUCCESS);
+    CHECK_EQ(put_str("C", "{\"topic\":\"C\",\"v\":1}", true), ERRCODE_SLE_SUCCESS);
+    uint64_t t0 = fake_clock_us();
+    sle_uart_batch_wait_flush();
+    CHECK_EQ(fake_clock_us(), t0);
+    CHECK_EQ(g_ntf_count, 1);
+    CHECK(strcmp(g_ntf[0], "[{\"topic\":\"C\",\"v\":1},{\"topic\":\"H\",\"v\":6}]") == 0);
+    CHECK_EQ(stats().urgent, 1);
+}
+
+static void test_window_zero(void)
+{
+    g_ntf_count = 0;
+    CHECK_EQ(sle_uart_server_batch_init(0), ERRCODE_SLE_SUCCESS);
+    CHECK_EQ(put_str("H", "{\"topic\":\"H\",\"v\":7}", false), ERRCODE_SLE_SUCCESS);
+    uint64_t t0 = fake_clock_us();
+    sle_uart_batch_wait_flush();
+    CHECK_EQ(fake_clock_us(), t0);
+    CHECK_EQ(g_ntf_count, 1);
+    CHECK_EQ(sle_uart_server_batch_init(SLE_UART_BATCH_WINDOW_MS_DEFAULT), ERRCODE_SLE_SUCCESS);
+}
+
+// 超过单条 notify 上限时拆成多条，每条都是完整的 JSON 数组
+static void test_split_and_limits(void)
+{
+    char obj[SLE_UART_BATCH_OBJ_MAX_SIZE * 2];
+    char fill[SLE_UART_BATCH_OBJ_MAX_SIZE];
+    char topic[8];
+    // {"Sn":"aaa..."} 正好 SLE_UART_BATCH_OBJ_MAX_SIZE 字节
+    memset(fill, 'a', SLE_UART_BATCH_OBJ_MAX_SIZE - 9);
+    fill[SLE_UART_BATCH_OBJ_MAX_SIZE - 9] = '\0';
+    g_ntf_count = 0;
+    for (uint32_t i = 0; i < SLE_UART_BATCH_MAX_TOPICS - 3; i++)
+    {
+        snprintf(topic, sizeof(topic), "S%u", i);
+        snprintf(obj, sizeof(obj), "{\"%s\":\"%s\"}", topic, fill);
+        CHECK_EQ(strlen(obj), SLE_UART_BATCH_OBJ_MAX_SIZE);
+        CHECK_EQ(put_str(topic, obj, false), ERRCODE_SLE_SUCCESS);
+    }
+    sle_uart_batch_wait_flush();
+    // 每条最多放下两个 96 字节左右的对象
+    CHECK_EQ(g_ntf_count, 3);
+    uint32_t objects = 0;
+    for (uint32_t i = 0; i < g_ntf_count && i < NTF_LOG_MAX; i++)
+    {
+        size_t len = strlen(g_ntf[i]);
+        CHECK(len <= SLE_UART_SERVER_NTF_MAX_SIZE);
+        CHECK(g_ntf[i][0] == '[' && g_ntf[i][len - 1] == ']');
+        for (const char *p = g_ntf[i]; (p = strstr(p, "{\"S")) != NULL; p++)
+        {
+            objects++;
+        }
+    }
+    CHECK_EQ(objects, SLE_UART_BATCH_MAX_TOPICS - 3);
+
+    // 对象过长、topic 槽位用完时拒绝并计数
+    memset(obj, 'b', sizeof(obj) - 1);
+    obj[sizeof(obj) - 1] = '\0';
+    CHECK_EQ(put_str("T", obj, false), ERRCODE_SLE_FAIL);
+    uint32_t dropped = stats().dropped;
+    CHECK_EQ(put_str("X", "{}", false), ERRCODE_SLE_FAIL);
+    CHECK_EQ(stats().dropped, dropped + 1);
+}
+
+int main(void)
+{
+    static const sle_addr_t addr = {0, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06}};
+    fake_sdk_reset();
+    fake_sle_reset();
+    fake_ssaps_set_notify_hook(record_notify);
+    CHECK_EQ(put_str("T", "{}", false), ERRCODE_SLE_FAIL);
+    CHECK_EQ(sle_uart_server_init(NULL, NULL), ERRCODE_SLE_SUCCESS);
+    CHECK_EQ(sle_uart_server_batch_init(SLE_UART_BATCH_WINDOW_MS_DEFAULT), ERRCODE_SLE_SUCCESS);
+
+    test_not_connected();
+    fake_sle_connect(1, &addr);
+    fake_sle_pair_complete(1, &addr);
+    CHECK(sle_uart_client_is_connected());
+    test_coalesce_window();
+    test_urgent_first();
+    test_window_zero();
+    test_split_and_limits();
+
+    CHECK_EQ(fake_irq_depth(), 0);
+    CHECK_EQ(fake_heap_live(), 0);
+    return host_test_done("test_sle_notify_batch");
+}
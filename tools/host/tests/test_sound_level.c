@@ -0,0 +1,79 @@
+/* agent_module 录音电平：sound_recorder_read 在拆包循环里算出的 RMS/峰值与解析值一致，邮箱序号逐块递增 */
+#include <math.h>
+#include "fake_i2s.h"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "soundService.h"
+
+#define CHUNK 1024
+
+static int32_t g_amp;
+
+static uint32_t src_const(uint32_t idx)
+{
+    (void)idx;
+    return (uint32_t)(uint16_t)(int16_t)g_amp;
+}
+
+// 高 16 位是另一声道，电平只看低 16 位
+static uint32_t src_square(uint32_t idx)
+{
+    int16_t s = (idx & 1) ? (int16_t)g_amp : (int16_t)-g_amp;
+    return 0xABCD0000u | (uint16_t)s;
+}
+
+static uint32_t src_sine(uint32_t idx)
+{
+    double v = g_amp * sin(2 * M_PI * (idx % 64) / 64.0);
+    return (uint16_t)(int16_t)lround(v);
+}
+
+static uint32_t read_chunk(fake_i2s_source_t src, int32_t amp, sound_level_t *lv)
+{
+    static uint16_t buf[CHUNK];
+    g_amp = amp;
+    fake_i2s_set_source(src);
+    CHECK_EQ(sound_recorder_read(buf, CHUNK), CHUNK);
+    return sound_recorder_get_level(lv);
+}
+
+int main(void)
+{
+    sound_level_t lv;
+    fake_sdk_reset();
+    fake_i2s_reset();
+    CHECK_EQ(sound_recorder_get_level(NULL), 0);
+    CHECK_EQ(sound_recorder_open(), 0);
+
+    CHECK_EQ(read_chunk(src_const, 0, &lv), 1);
+    CHECK_EQ(lv.rms, 0);
+    CHECK_EQ(lv.peak, 0);
+
+    // 常数信号的 RMS 即其绝对值（整数开方精确）
+    CHECK_EQ(read_chunk(src_const, -1234, &lv), 2);
+    CHECK_EQ(lv.rms, 1234);
+    CHECK_EQ(lv.peak, 1234);
+
+    CHECK_EQ(read_chunk(src_square, 32767, &lv), 3);
+    CHECK_EQ(lv.rms, 32767);
+    CHECK_EQ(lv.peak, 32767);
+
+    // -32768 的峰值截到 0x7FFF
+    CHECK_EQ(read_chunk(src_const, -32768, &lv), 4);
+    CHECK_EQ(lv.rms, 32768);
+    CHECK_EQ(lv.peak, 0x7FFF);
+
+    // 整周期正弦：RMS = A/sqrt(2)，开方向下取整
+    CHECK_EQ(read_chunk(src_sine, 10000, &lv), 5);
+    CHECK(lv.rms >= 7070 && lv.rms <= 7071);
+    CHECK_EQ(lv.peak, 10000);
+    CHECK_EQ(fake_i2s_samples(), 5 * CHUNK);
+
+    // 只读序号不改变电平
+    sound_level_t again;
+    CHECK_EQ(sound_recorder_get_level(&again), 5);
+    CHECK(again.rms == lv.rms && again.peak == lv.peak);
+
+    sound_recorder_close();
+    return host_test_done("test_sound_level");
+}
@@ -0,0 +1,126 @@
+/* 订阅路由表：'+'/'#' 匹配规则、多处理函数分发、非法过滤器与订阅遍历 */
+#include <string.h>
+#include "host_test.h"
+#include "topicTrie.h"
+
+#define HIT_MAX 8
+
+static int g_hits[HIT_MAX];
+static size_t g_last_len;
+
+static void on_msg(const char *topic, size_t topic_len, const uint8_t *payload, size_t len, void *arg)
+{
+    (void)topic;
+    (void)topic_len;
+    (void)payload;
+    g_hits[(int)(intptr_t)arg]++;
+    g_last_len = len;
+}
+
+static int dispatch(const topic_trie_t *trie, const char *topic)
+{
+    memset(g_hits, 0, sizeof(g_hits));
+    return topic_trie_dispatch(trie, topic, strlen(topic), (const uint8_t *)"x", 1);
+}
+
+typedef struct
+{
+    char seen[HIT_MAX][32];
+    int qos[HIT_MAX];
+    int n;
+} visit_log_t;
+
+static void on_visit(const char *filter, int qos, void *ctx)
+{
+    visit_log_t *log = (visit_log_t *)ctx;
+    if (log->n < HIT_MAX)
+    {
+        strncpy(log->seen[log->n], filter, sizeof(log->seen[0]) - 1);
+        log->qos[log->n++] = qos;
+    }
+}
+
+static int visited(const visit_log_t *log, const char *filter, int qos)
+{
+    for (int i = 0; i < log->n; i++)
+    {
+        if (strcmp(log->seen[i], filter) == 0)
+        {
+            return log->qos[i] == qos;
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    static topic_trie_t trie;
+
+    CHECK_EQ(topic_trie_set_handler(&trie, "report", on_msg, (void *)0), 0);
+    CHECK_EQ(topic_trie_set_handler(&trie, "devices/report", on_msg, (void *)1), 0);
+    CHECK_EQ(topic_trie_set_handler(&trie, "Control/#", on_msg, (void *)2), 0);
+    CHECK_EQ(topic_trie_set_handler(&trie, "+/report", on_msg, (void *)3), 0);
+    CHECK_EQ(topic_trie_set_handler(&trie, "#", on_msg, (void *)4), 0);
+    CHECK_EQ(topic_trie_set_handler(&trie, "sensor/+/temp", on_msg, (void *)5), 0);
+    CHECK_EQ(trie.count, 6);
+
+    // 精确匹配与单层通配符同时命中，全局 '#' 也收到
+    CHECK_EQ(dispatch(&trie, "devices/report"), 3);
+    CHECK(g_hits[1] == 1 && g_hits[3] == 1 && g_hits[4] == 1);
+    CHECK_EQ(g_last_len, 1);
+
+    CHECK_EQ(dispatch(&trie, "report"), 2);
+    CHECK(g_hits[0] == 1 && g_hits[4] == 1);
+
+    // "a/#" 匹配 a 本身及任意深度的子层
+    CHECK_EQ(dispatch(&trie, "Control"), 2);
+    CHECK_EQ(g_hits[2], 1);
+    CHECK_EQ(dispatch(&trie, "Control/led/1"), 2);
+    CHECK_EQ(g_hits[2], 1);
+
+    // '+' 只匹配一层，且可以匹配空层
+    CHECK_EQ(dispatch(&trie, "sensor/3/temp"), 2);
+    CHECK_EQ(g_hits[5], 1);
+    CHECK_EQ(dispatch(&trie, "sensor/3/4/temp"), 1);
+    CHECK_EQ(g_hits[5], 0);
+    CHECK_EQ(dispatch(&trie, "sensor//temp"), 2);
+    CHECK_EQ(dispatch(&trie, "devices/report/x"), 1);
+
+    // 以 '$' 开头的主题不被首层通配符匹配
+    CHECK_EQ(dispatch(&trie, "$SYS/report"), 0);
+
+    // topic 不以 NUL 结尾时只看 topic_len
+    memset(g_hits, 0, sizeof(g_hits));
+    CHECK_EQ(topic_trie_dispatch(&trie, "reportXYZ", 6, (const uint8_t *)"", 0), 2);
+    CHECK_EQ(g_hits[0], 1);
+
+    // 非法过滤器
+    CHECK_EQ(topic_trie_set_handler(&trie, "a/#/b", on_msg, NULL), -1);
+    CHECK_EQ(topic_trie_set_handler(&trie, "a/b#", on_msg, NULL), -1);
+    CHECK_EQ(topic_trie_set_handler(&trie, "a/+b", on_msg, NULL), -1);
+    CHECK_EQ(topic_trie_set_handler(&trie, "", on_msg, NULL), -1);
+    CHECK_EQ(trie.count, 6);
+
+    // 覆盖处理函数，置空后不再计数
+    CHECK_EQ(topic_trie_set_handler(&trie, "#", NULL, NULL), 0);
+    CHECK_EQ(dispatch(&trie, "report"), 1);
+    CHECK_EQ(topic_trie_set_handler(&trie, "report", on_msg, (void *)6), 0);
+    CHECK_EQ(dispatch(&trie, "report"), 1);
+    CHECK(g_hits[0] == 0 && g_hits[6] == 1);
+    CHECK_EQ(trie.count, 6);
+
+    // 只记订阅、没有处理函数的过滤器也会在重连时遍历到
+    CHECK_EQ(topic_trie_set_subscribed(&trie, "Control/#", 0), 0);
+    CHECK_EQ(topic_trie_set_subscribed(&trie, "alarm/+", 1), 0);
+    CHECK_EQ(topic_trie_set_subscribed(&trie, "alarm/+", 0), 0);
+    CHECK_EQ(trie.count, 7);
+    CHECK_EQ(dispatch(&trie, "alarm/1"), 0);
+
+    visit_log_t log = {0};
+    topic_trie_foreach_subscribed(&trie, on_visit, &log);
+    CHECK_EQ(log.n, 2);
+    CHECK(visited(&log, "Control/#", 0));
+    CHECK(visited(&log, "alarm/+", 0));
+
+    return host_test_done("test_topic_trie");
+}
@@ -0,0 +1,232 @@
+/*
+ * ExBoard WS2812：查表编码与原来逐位 rgb2spi 的字节一致；整数 HSV 与原来浮点 HSL(s=1, l=0.1) 相差不超过 1；
+ * 没变的帧不发送、只变一颗灯时只改它的 24 字节；ws2812_poll 返回距下一帧到期的时间
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "ws2812.c"
+#include "fake_sdk.h"
+#include "host_test.h"
+#include "ref_ws2812.h"
+
+#define TX_BYTES (LED_COUNT * WS2812_BYTES_PER_LED + WS2812_RESET_BYTES)
+
+static uint32_t g_writes = 0;
+static uint32_t g_last_len = 0;
+static uint8_t g_sent[TX_BYTES];
+
+static errcode_t capture_spi(spi_bus_t bus, const uint8_t *buf, uint32_t len)
+{
+    CHECK_EQ(bus, SPI_ID);
+    g_writes++;
+    g_last_len = len;
+    memcpy(g_sent, buf, (len < TX_BYTES) ? len : TX_BYTES);
+    return ERRCODE_SUCC;
+}
+
+static void check_led(uint16_t i, const ws2812_rgb_t *c)
+{
+    uint8_t want[WS2812_BYTES_PER_LED];
+    ref_rgb2spi(c->r, c->g, c->b, want);
+    if (memcmp(&g_ws2812_tx[i * WS2812_BYTES_PER_LED], want, sizeof(want)) != 0)
+    {
+        fprintf(stderr, "LED %u (%u,%u,%u) encoded differently\n", i, c->r, c->g, c->b);
+        CHECK(0);
+    }
+}
+
+// 三个通道都取遍 0~255，并错开，使同一颗灯的 G、R、B 各不相同
+static void check_lut(void)
+{
+    spi_init();
+    for (uint32_t round = 0; round < 256 / LED_COUNT + 1; round++)
+    {
+        for (uint16_t i = 0; i < LED_COUNT; i++)
+        {
+            uint8_t v = (uint8_t)(round * LED_COUNT + i);
+            g_ws2812_frame[i] = (ws2812_rgb_t){v, (uint8_t)(v * 7 + 1), (uint8_t)~v};
+        }
+        (void)ws2812_encode();
+        for (uint16_t i = 0; i < LED_COUNT; i++)
+        {
+            check_led(i, &g_ws2812_frame[i]);
+        }
+    }
+    // 帧尾复位区保持低电平
+    for (uint32_t k = LED_COUNT * WS2812_BYTES_PER_LED; k < TX_BYTES; k++)
+    {
+        CHECK_EQ(g_ws2812_tx[k], 0);
+    }
+}
+
+static void check_hsv(void)
+{
+    for (uint16_t h = 0; h < 360; h++)
+    {
+        uint8_t r, g, b;
+        ref_hsl2rgb(h, 1.0, 0.1, &r, &g, &b);
+        ws2812_rgb_t c;
+        ws2812_hsv2rgb(h, 255, 51, &c);
+        if (abs(c.r - r) > 1 || abs(c.g - g) > 1 || abs(c.b - b) > 1)
+        {
+            fprintf(stderr, "hue %u: hsv (%u,%u,%u), old hsl (%u,%u,%u)\n", h, c.r, c.g, c.b, r, g, b);
+            CHECK(0);
+        }
+    }
+    // 色相按 360 取模，效果函数的帧号可以一直增长
+    ws2812_rgb_t a, b;
+    ws2812_hsv2rgb(17, 255, 51, &a);
+    ws2812_hsv2rgb(17 + 360, 255, 51, &b);
+    CHECK(memcmp(&a, &b, sizeof(a)) == 0);
+}
+
+static uint32_t g_effect_calls = 0;
+static ws2812_rgb_t g_one = {0, 0, 0};
+
+// 只有第 5 颗灯取 g_one，其余固定
+static void effect_one(ws2812_rgb_t *pixels, uint16_t count, uint32_t frame, void *arg)
+{
+    (void)frame;
+    (void)arg;
+    g_effect_calls++;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        pixels[i] = (ws2812_rgb_t){10, 20, 30};
+    }
+    pixels[5] = g_one;
+}
+
+static void start(void)
+{
+    fake_sdk_reset();
+    fake_spi_set_hook(capture_spi);
+    // 时钟从 0 开始时 g_ws2812_last_ms 的“从未出帧”标记与真实时间重合，设备上 tcxo 在任务启动时早已不为 0
+    fake_clock_advance_us(1000 * 1000);
+    spi_init();
+    g_writes = 0;
+    g_effect_calls = 0;
+}
+
+static void check_poll(void)
+{
+    start();
+    CHECK_EQ(ws2812_poll(), WS2812_FRAME_MS); // 没有效果函数
+    CHECK_EQ(g_writes, 0);
+
+    // 第一帧整条发送，一次写完
+    ws2812_set_effect(effect_one, NULL);
+    CHECK_EQ(ws2812_poll(), WS2812_FRAME_MS);
+    CHECK_EQ(g_writes, 1);
+    CHECK_EQ(g_last_len, TX_BYTES);
+    CHECK(memcmp(g_sent, g_ws2812_tx, TX_BYTES) == 0);
+
+    // 未到期：不调用效果函数，返回剩余时间
+    osal_msleep(2);
+    CHECK_EQ(ws2812_poll(), WS2812_FRAME_MS - 2);
+    CHECK_EQ(g_effect_calls, 1);
+    osal_msleep(WS2812_FRAME_MS - 3);
+    CHECK_EQ(ws2812_poll(), 1);
+
+    // 到期但画面不变：生成一帧，不发送
+    osal_msleep(1);
+    CHECK_EQ(ws2812_poll(), WS2812_FRAME_MS);
+    CHECK_EQ(g_effect_calls, 2);
+    CHECK_EQ(g_writes, 0 + 1);
+
+    // 只变一颗灯：整条发送，其余灯的字节不变
+    static uint8_t before[TX_BYTES];
+    memcpy(before, g_ws2812_tx, TX_BYTES);
+    g_one = (ws2812_rgb_t){0xFF, 0x00, 0x81};
+    osal_msleep(WS2812_FRAME_MS);
+    (void)ws2812_poll();
+    CHECK_EQ(g_writes, 2);
+    check_led(5, &g_one);
+    CHECK(memcmp(before, g_ws2812_tx, 5 * WS2812_BYTES_PER_LED) == 0);
+    CHECK(memcmp(before + 6 * WS2812_BYTES_PER_LED, g_ws2812_tx + 6 * WS2812_BYTES_PER_LED,
+                 TX_BYTES - 6 * WS2812_BYTES_PER_LED) == 0);
+
+    // 按返回值睡眠的主循环：从下一帧到期时起，一秒内正好 1000 / WS2812_FRAME_MS 帧，每次醒来都出一帧
+    osal_msleep(WS2812_FRAME_MS);
+    uint32_t calls = g_effect_calls;
+    uint32_t wakeups = 0;
+    uint64_t end = fake_clock_us() + 1000 * 1000;
+    while (fake_clock_us() < end)
+    {
+        osal_msleep(ws2812_poll());
+        wakeups++;
+    }
+    CHECK_EQ(g_effect_calls - calls, 1000 / WS2812_FRAME_MS);
+    CHECK_EQ(wakeups, 1000 / WS2812_FRAME_MS);
+    CHECK_EQ(g_writes, 2); // 画面一直没变
+}
+
+// 发送占用的时间从帧间隔里扣掉：8MHz 下每字节 1us，每帧都变、都发，一秒仍是 1000 / WS2812_FRAME_MS 帧
+static errcode_t slow_spi(spi_bus_t bus, const uint8_t *buf, uint32_t len)
+{
+    fake_clock_advance_us(len);
+    return capture_spi(bus, buf, len);
+}
+
+static void effect_count(ws2812_rgb_t *pixels, uint16_t count, uint32_t frame, void *arg)
+{
+    (void)arg;
+    memset(pixels, 0, count * sizeof(*pixels));
+    pixels[0].r = (uint8_t)frame;
+}
+
+static void check_send_time(void)
+{
+    start();
+    fake_spi_set_hook(slow_spi);
+    ws2812_set_effect(effect_count, NULL);
+    uint32_t wakeups = 0;
+    uint64_t end = fake_clock_us() + 1000 * 1000;
+    while (fake_clock_us() < end)
+    {
+        osal_msleep(ws2812_poll());
+        wakeups++;
+    }
+    CHECK_EQ(g_writes, 1000 / WS2812_FRAME_MS);
+    CHECK_EQ(wakeups, 1000 / WS2812_FRAME_MS);
+}
+
+// ws2812_next：纯色只在颜色变化时发送，彩虹每帧色相加 1；切换模式立即出帧
+static void check_next(void)
+{
+    start();
+    CHECK_EQ(ws2812_next(1, 1, 2, 3), WS2812_FRAME_MS);
+    CHECK_EQ(g_writes, 1);
+    ws2812_rgb_t c = {1, 2, 3};
+    check_led(0, &c);
+    check_led(LED_COUNT - 1, &c);
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        osal_msleep(ws2812_next(1, 1, 2, 3));
+    }
+    CHECK_EQ(g_writes, 1);
+    osal_msleep(ws2812_next(1, 4, 5, 6));
+    CHECK_EQ(g_writes, 2);
+    c = (ws2812_rgb_t){4, 5, 6};
+    check_led(7, &c);
+
+    CHECK_EQ(ws2812_next(0, 0, 0, 0), WS2812_FRAME_MS);
+    CHECK_EQ(g_writes, 3);
+    uint8_t r, g, b;
+    ref_hsl2rgb(0, 1.0, 0.1, &r, &g, &b);
+    CHECK(abs(g_ws2812_shown[0].r - r) <= 1 && abs(g_ws2812_shown[0].g - g) <= 1 && abs(g_ws2812_shown[0].b - b) <= 1);
+    osal_msleep(WS2812_FRAME_MS);
+    (void)ws2812_next(0, 0, 0, 0);
+    ws2812_hsv2rgb(1, 255, 51, &c);
+    check_led(LED_COUNT / 2, &c);
+}
+
+int main(void)
+{
+    fake_sdk_reset();
+    check_lut();
+    check_hsv();
+    check_poll();
+    check_next();
+    check_send_time();
+    return host_test_done("test_ws2812");
+}